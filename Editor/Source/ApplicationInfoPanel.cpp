@@ -8,6 +8,7 @@
 #include "Editor.h"
 
 #include <Lumos/Core/Engine.h>
+#include <Lumos/Core/JobSystem.h>
 #include <Lumos/Core/OS/Window.h>
 #include <Lumos/Graphics/Renderers/SceneRenderer.h>
 #include <Lumos/ImGui/ImGuiUtilities.h>
@@ -130,6 +131,20 @@ namespace Lumos
                     if(ImGuiUtilities::Property("Shadow Resolution", shadowRes, 0, 3))
                         qs.ShadowResolution = (ShadowResolutionSetting)shadowRes;
 
+                    ImGuiUtilities::Property("Compact Vertices", qs.CompactVertices);
+                    ImGuiUtilities::Property("Mesh LODs", qs.EnableMeshLODs);
+                    ImGuiUtilities::Property("LOD Error Pixels", qs.LODErrorPixels, 0.0f, 16.0f, 0.1f);
+                    ImGuiUtilities::Property("LOD Hysteresis", qs.LODHysteresis, 0.0f, 0.9f, 0.01f);
+                    ImGuiUtilities::Property("Shadow LOD Bias", qs.ShadowLODBias);
+                    ImGuiUtilities::Property("Animation LOD", qs.EnableAnimationLOD);
+                    ImGuiUtilities::Property("Freeze Offscreen Animations", qs.FreezeOffscreenAnimations);
+                    ImGuiUtilities::Property("Animation Near Pixels", qs.AnimationNearPixels, 0.0f, 2000.0f, 1.0f);
+                    ImGuiUtilities::Property("Animation Far Pixels", qs.AnimationFarPixels, 0.0f, 2000.0f, 1.0f);
+                    ImGuiUtilities::Property("Animation Mid Interval", qs.AnimationMidInterval);
+                    ImGuiUtilities::Property("Animation Far Interval", qs.AnimationFarInterval);
+                    ImGuiUtilities::Property("Animation Far Joint Depth", qs.AnimationFarJointDepth);
+                    ImGuiUtilities::Property("Animation Budget (ms)", qs.AnimationBudgetMs, 0.0f, 16.0f, 0.1f);
+
                     ImGui::Columns(1);
 
                     ImGui::TreePop();
@@ -171,18 +186,36 @@ namespace Lumos
                 ImGui::Text("Num Shadow Objects %u", Engine::Get().Statistics().NumShadowObjects);
                 ImGui::Text("Bound Pipelines %u", Engine::Get().Statistics().BoundPipelines);
                 ImGui::Text("Bound RenderPasses %u", Engine::Get().Statistics().BoundRenderPasses);
+                ImGui::Text("Animated Skeletons %u | Animation %.2f ms", Engine::Get().Statistics().NumAnimatedSkeletons, Engine::Get().Statistics().AnimationTime);
+                ImGui::Text("Sampled %u | Blended %u | Skipped %u", Engine::Get().Statistics().NumSampledSkeletons, Engine::Get().Statistics().NumBlendedSkeletons, Engine::Get().Statistics().NumSkippedSkeletons);
+                auto jobStats = System::JobSystem::GetStats();
+                ImGui::Text("Job Threads %u | Jobs %llu | Stolen %llu | Overflow %llu", System::JobSystem::GetThreadCount(), (unsigned long long)jobStats.JobsExecuted, (unsigned long long)jobStats.JobsStolen, (unsigned long long)jobStats.OverflowPushes);
+                if(ImGui::Button("Benchmark Job System"))
+                    m_JobBenchmark = System::JobSystem::Benchmark();
+                if(m_JobBenchmark.GraphMS > 0.0f)
+                    ImGui::Text("Fan Out / Fan In Graph %.3f ms | Dispatch %.3f ms%s", m_JobBenchmark.GraphMS, m_JobBenchmark.DispatchMS, m_JobBenchmark.Valid ? "" : " | Wrong Results");
                 if(ImGui::TreeNodeEx("Arenas", 0))
                 {
-                    uint64_t totalAllocated = 0;
+                    uint64_t totalCommitted = 0;
+                    uint64_t totalReserved  = 0;
                     for(int i = 0; i < GetArenaCount(); i++)
                     {
-                        auto arena = GetArena(i);
-                        totalAllocated += arena->Size;
-                        float percentageFull = (float)arena->Position / (float)arena->Size;
+                        auto stats = GetArenaStats(GetArena(i));
+                        totalCommitted += stats.Committed;
+                        totalReserved += stats.Reserved;
+                        float percentageFull = (float)stats.Used / (float)stats.Committed;
                         ImGui::ProgressBar(percentageFull);
-                        Lumos::ImGuiUtilities::Tooltip((Lumos::StringUtilities::BytesToString(arena->Position) + " / " + Lumos::StringUtilities::BytesToString(arena->Size)).c_str());
+                        if(ImGui::IsItemHovered())
+                            ImGui::SetTooltip("Used %s / Committed %s / Reserved %s\nHigh Water %s\nBlocks %u\nPushes %llu (%s) per frame",
+                                              Lumos::StringUtilities::BytesToString(stats.Used).c_str(),
+                                              Lumos::StringUtilities::BytesToString(stats.Committed).c_str(),
+                                              Lumos::StringUtilities::BytesToString(stats.Reserved).c_str(),
+                                              Lumos::StringUtilities::BytesToString(stats.HighWater).c_str(),
+                                              stats.BlockCount,
+                                              (unsigned long long)stats.PushCountPerFrame,
+                                              Lumos::StringUtilities::BytesToString(stats.PushBytesPerFrame).c_str());
                     }
-                    ImGui::Text("Total %s", Lumos::StringUtilities::BytesToString(totalAllocated).c_str());
+                    ImGui::Text("Total %s committed / %s reserved", Lumos::StringUtilities::BytesToString(totalCommitted).c_str(), Lumos::StringUtilities::BytesToString(totalReserved).c_str());
                     ImGui::TreePop();
                 }
 
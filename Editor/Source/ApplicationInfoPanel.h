@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EditorPanel.h"
+#include <Lumos/Core/JobSystem.h>
 #include <vector>
 
 namespace Lumos
@@ -14,5 +15,6 @@ namespace Lumos
         void OnImGui() override;
 
         std::vector<float> m_FPSData;
+        System::JobSystem::BenchmarkResult m_JobBenchmark;
     };
 }
@@ -32,6 +32,11 @@ namespace Lumos
         {
             ImGuiUtilities::PushID();
 
+            const AssetStreamer::Stats& streamStats = m_Editor->GetAssetManager()->GetStreamer().GetStats();
+            ImGui::Text("Streaming : %u pending, %u loading, %u awaiting upload (%.2f MB), %u uploaded last frame in %.2f ms",
+                        streamStats.Pending, streamStats.Loading, streamStats.AwaitingUpload, double(streamStats.BufferedBytes) / (1024.0 * 1024.0),
+                        streamStats.UploadedLastFrame, streamStats.UploadMsLastFrame);
+
             enum MyItemColumnID
             {
                 MyItemColumnID_ID,
@@ -75,6 +80,8 @@ namespace Lumos
 
                         if(!metaData.Data)
                             ImGui::TextUnformatted("Data Null");
+                        else if(metaData.LoadState != AssetLoadState::Loaded)
+                            ImGui::TextUnformatted(AssetLoadStateToString(metaData.LoadState));
                         else if(metaData.Type == AssetType::Shader && metaData.Data.As<Graphics::Shader>())
                             ImGui::TextUnformatted(metaData.Data.As<Graphics::Shader>()->IsCompiled() ? "Compiled" : "Failed to compile");
 
@@ -59,6 +59,8 @@
 #include <Lumos/Graphics/Animation/AnimationController.h>
 #include <Lumos/ImGui/IconsMaterialDesignIcons.h>
 #include <Lumos/Embedded/EmbedAsset.h>
+#include <Lumos/Core/Asset/AssetPack.h>
+#include <Lumos/Core/Asset/AssetManager.h>
 #include <Lumos/Scene/Component/ModelComponent.h>
 #include <imgui/Plugins/imcmd_command_palette.h>
 #include <Lumos/Maths/BoundingBox.h>
@@ -89,6 +91,7 @@ namespace Lumos
         Application::SetInstance(this);
 
         m_ImGuiClearScreen = true;
+        m_UsePackedAssets  = false; // Edits go to the loose files
     }
 
     Editor::~Editor()
@@ -688,6 +691,28 @@ namespace Lumos
 
                 ImGui::Separator();
 
+                if(ImGui::MenuItem("Pack Assets"))
+                {
+                    Serialise();
+
+                    ArenaTemp scratch = ScratchBegin(0, 0);
+                    String8 packPath  = PushStr8F(scratch.arena, "%s%s.lpak", m_ProjectSettings.m_ProjectRoot.c_str(), m_ProjectSettings.m_ProjectName.c_str());
+                    AssetPack::Cook(GetAssetPath(), packPath, GetAssetManager()->GetAssetRegistry(), AssetPack::CookSettings());
+                    ScratchEnd(scratch);
+                }
+
+                if(ImGui::MenuItem("Benchmark Asset Pack"))
+                {
+                    ArenaTemp scratch = ScratchBegin(0, 0);
+                    String8 packPath  = PushStr8F(scratch.arena, "%s%s_Benchmark.lpak", m_ProjectSettings.m_ProjectRoot.c_str(), m_ProjectSettings.m_ProjectName.c_str());
+                    AssetPack::Benchmark(GetAssetPath(), packPath, GetAssetManager()->GetAssetRegistry(), AssetPack::CookSettings());
+                    std::error_code error;
+                    std::filesystem::remove(ToStdString(packPath), error);
+                    ScratchEnd(scratch);
+                }
+
+                ImGui::Separator();
+
                 if(ImGui::BeginMenu("Style"))
                 {
                     if(ImGui::MenuItem("Dark", "", m_Settings.m_Theme == ImGuiUtilities::Dark))
@@ -2510,9 +2535,9 @@ namespace Lumos
             {
                 const auto& [model, trans] = group.get<Graphics::ModelComponent, Maths::Transform>(entity);
                 auto& worldTransform       = trans.GetWorldMatrix();
-                if(model.ModelRef && model.ModelRef->GetAnimationController())
+                if(model.ModelRef && model.Animation && model.ModelRef->GetAnimationController())
                 {
-                    model.ModelRef->GetAnimationController()->DebugDraw(worldTransform);
+                    model.ModelRef->GetAnimationController()->DebugDraw(*model.Animation, worldTransform);
                 }
             }
         }
@@ -235,6 +235,11 @@ namespace Lumos
                 ImGui::Text("Num Rendered Objects %u", SceneRendererStats.NumRenderedObjects);
                 ImGui::Text("Num Shadow Objects %u", SceneRendererStats.NumShadowObjects);
                 ImGui::Text("Num Draw Calls  %u", SceneRendererStats.NumDrawCalls);
+                ImGui::Text("Mesh Draws %u -> %u (%u instanced)", SceneRendererStats.NumMeshCommands, SceneRendererStats.NumMeshDrawCalls, SceneRendererStats.NumInstancedDrawCalls);
+                ImGui::Text("Clustered Lights %u (max %u per cluster, %.2f ms)", SceneRendererStats.NumClusteredLights, SceneRendererStats.MaxLightsPerCluster, SceneRendererStats.ClusterBuildTime);
+                ImGui::Text("LOD Triangles %u / %u / %u / %u (LOD 0 only %u)", SceneRendererStats.LODTriangles[0], SceneRendererStats.LODTriangles[1], SceneRendererStats.LODTriangles[2], SceneRendererStats.LODTriangles[3], SceneRendererStats.FullDetailTriangles);
+                ImGui::Text("Shadow LOD Triangles %u / %u / %u / %u (LOD 0 only %u)", SceneRendererStats.ShadowLODTriangles[0], SceneRendererStats.ShadowLODTriangles[1], SceneRendererStats.ShadowLODTriangles[2], SceneRendererStats.ShadowLODTriangles[3], SceneRendererStats.ShadowFullDetailTriangles);
+                ImGui::Text("Mesh Cull %.3f ms (%u meshes, %u batches) | Merge %.3f ms", SceneRendererStats.CullTime, SceneRendererStats.NumMeshesTested, SceneRendererStats.NumCullBatches, SceneRendererStats.CommandMergeTime);
                 ImGui::Text("Used GPU Memory : %.1f mb | Total : %.1f mb", stats.UsedGPUMemory * 0.000001f, stats.TotalGPUMemory * 0.000001f);
 
                 if(ImGui::BeginPopupContextWindow())
@@ -1,6 +1,8 @@
 #include "GraphicsInfoPanel.h"
 #include <Lumos/Graphics/RHI/GraphicsContext.h>
 #include <Lumos/Graphics/RHI/Renderer.h>
+#include <Lumos/Graphics/RHI/Pipeline.h>
+#include <Lumos/ImGui/ImGuiUtilities.h>
 
 #include <imgui/imgui.h>
 
@@ -18,6 +20,28 @@ namespace Lumos
         ImGui::Begin("GraphicsInfo", &m_Active, flags);
         {
             Graphics::Renderer::GetGraphicsContext()->OnImGui();
+
+            if(ImGui::CollapsingHeader("Pipeline Cache"))
+            {
+                uint32_t maxUnusedPipelines;
+                float maxUnusedTime;
+                Graphics::Pipeline::GetCacheLimits(maxUnusedPipelines, maxUnusedTime);
+                Graphics::PipelineCacheStats stats = Graphics::Pipeline::GetCacheStats();
+
+                ImGui::Columns(2);
+                bool changed = ImGuiUtilities::Property("Max Unused Pipelines", maxUnusedPipelines);
+                changed |= ImGuiUtilities::Property("Max Unused Time (s)", maxUnusedTime, 0.0f, 600.0f, 1.0f, ImGuiUtilities::PropertyFlag::DragValue);
+                if(changed)
+                    Graphics::Pipeline::SetCacheLimits(maxUnusedPipelines, maxUnusedTime);
+
+                ImGuiUtilities::Property("Cached Pipelines", stats.CachedPipelines, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGuiUtilities::Property("Unused Pipelines", stats.UnusedPipelines, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGuiUtilities::Property("Evicted Pipelines", stats.EvictedPipelines, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGuiUtilities::Property("Manifest Pipelines", stats.ManifestRecords, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGuiUtilities::Property("Warmed Pipelines", stats.WarmedPipelines, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGuiUtilities::Property("Warm Up (ms)", stats.WarmUpTime, 0.0f, 0.0f, 0.0f, ImGuiUtilities::PropertyFlag::ReadOnly);
+                ImGui::Columns(1);
+            }
         }
         ImGui::End();
     }
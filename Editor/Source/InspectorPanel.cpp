@@ -2831,6 +2831,18 @@ end
 
                 if(animCount > 0)
                 {
+                    // Each entity plays its own instance of the model's animations, created here if the scene hasn't run yet
+                    auto& animation        = reg.get<Lumos::Graphics::ModelComponent>(e).Animation;
+                    const auto& controller = modelRef->GetAnimationController();
+                    if(!animation)
+                    {
+                        animation        = Lumos::CreateSharedPtr<Lumos::Graphics::AnimationInstance>();
+                        animation->State = modelRef->GetCurrentAnimationIndex();
+                    }
+
+                    Lumos::ImGuiUtilities::Property("Speed", animation->Speed, -4.0f, 4.0f, 0.01f);
+                    Lumos::ImGuiUtilities::Property("Blend Duration", animation->BlendDuration, 0.0f, 2.0f, 0.01f);
+
                     ImGui::Columns(1);
                     static bool testPlayAnimation = false;
                     if(Application::Get().GetEditorState() == EditorState::Preview)
@@ -2850,12 +2862,18 @@ end
                             static float animTime = 0.0f;
                             if(ImGui::SliderFloat("Animation Preview", &animTime, 0.0f, 1.0f))
                             {
-                                modelRef->UpdateAnimation(Engine::GetTimeStep(), animTime);
+                                animation->Time        = animTime * controller->GetDuration(animation->State);
+                                animation->BlendWeight = 1.0f;
+                                controller->Sample(*animation);
                             }
                         }
 
+                        // The scene isn't updated while previewing, so the inspector drives the selected entity
                         if(testPlayAnimation)
-                            modelRef->UpdateAnimation(Engine::GetTimeStep());
+                        {
+                            controller->Advance(*animation, (float)Engine::GetTimeStep().GetSeconds());
+                            controller->Sample(*animation);
+                        }
                     }
                     else
                     {
@@ -2876,7 +2894,7 @@ end
                         animNames.PushBack(anim->GetName().c_str());
                     }
 
-                    uint32_t currentIndex   = modelRef->GetCurrentAnimationIndex();
+                    uint32_t currentIndex   = Lumos::Maths::Min(animation->State, (uint32_t)animCount - 1);
                     const char* currentAnim = animNames[currentIndex];
                     if(ImGui::BeginCombo("##AnimationCombo", currentAnim, 0)) // The second parameter is the label previewed before opening the combo.
                     {
@@ -2887,6 +2905,7 @@ end
                             {
                                 currentIndex = n;
                                 modelRef->SetCurrentAnimationIndex(n);
+                                animation->SetState(n);
                             }
                             if(is_selected)
                                 ImGui::SetItemDefaultFocus();
@@ -3159,6 +3178,13 @@ end
         PropertySet("Launch Particles", emitter.GetNumLaunchParticles, emitter.SetNumLaunchParticles);
         PropertySet("Sort Particles", emitter.GetSortParticles, emitter.SetSortParticles);
         PropertySet("Depth Write", emitter.GetDepthWrite, emitter.SetDepthWrite);
+        PropertySet("GPU Simulation", emitter.GetGPUSimulation, emitter.SetGPUSimulation);
+        Lumos::ImGuiUtilities::Tooltip("Spawn, simulate and draw on the GPU when the renderer supports it");
+        if(emitter.GetGPUSimulation())
+        {
+            PropertySet("Depth Collision", emitter.GetDepthCollision, emitter.SetDepthCollision);
+            PropertySet("Restitution", emitter.GetRestitution, emitter.SetRestitution);
+        }
 
         Lumos::ParticleEmitter::BlendType blendtype = emitter.GetBlendType();
         static const char* possibleBlendTypes[3]    = { "Additive", "Alpha", "Off" };
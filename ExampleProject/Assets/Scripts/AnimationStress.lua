@@ -0,0 +1,37 @@
+--Spawns a grid of animated foxes around this entity to stress skeletal animation
+--Every fox shares one model but plays its own animation instance. Animated skeletons and sampling time are shown in
+--the application info panel, skinned instances and palette joints in the scene renderer settings.
+
+local FoxCount = 1000
+local Spacing = 3.0
+
+function OnInit()
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+	local side = math.ceil(math.sqrt(FoxCount))
+	local source = nil
+
+	for i = 0, FoxCount - 1 do
+		local x = (i % side - side * 0.5) * Spacing
+		local z = (math.floor(i / side) - side * 0.5) * Spacing
+
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Stress Fox"
+		local transform = entity:AddTransform()
+		transform:SetLocalPosition(Vec3.new(origin.x + x, origin.y, origin.z + z))
+		transform:SetLocalScale(Vec3.new(0.02, 0.02, 0.02))
+
+		--Components move inside the registry as entities are added, so the source is fetched again each time
+		if source == nil then
+			entity:AddModelComponent("//Assets/Meshes/Fox.glb")
+			source = entity
+		else
+			entity:AddModelComponent(source:GetModelComponent())
+		end
+	end
+end
+
+function OnUpdate(dt)
+end
+
+function OnCleanUp()
+end
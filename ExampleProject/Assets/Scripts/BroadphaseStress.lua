@@ -0,0 +1,45 @@
+--Spawns a cloud of drifting rigid bodies above this entity to compare broadphases
+--Switch Broadphase between BroadphaseType.SortAndSweep and BroadphaseType.DynamicTree and compare the
+--"BroadPhaseCollisions" profile zone. The bodies all fall together, so the random velocities are what keeps the
+--pairs changing between steps. The pair count is logged every LogInterval seconds.
+--LumosPhysicsEngineConfig::MaxRigidBodyCount defaults to 4096, raise it to run more bodies.
+
+local Broadphase = BroadphaseType.SortAndSweep
+local BodyCount = 4000
+local Extent = 60.0
+local Height = 200.0
+local DriftSpeed = 4.0
+local LogInterval = 1.0
+
+local timer = 0.0
+
+function OnInit()
+	SetBroadphase3D(Broadphase)
+
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+
+	for i = 0, BodyCount - 1 do
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Broadphase Body"
+		entity:AddTransform()
+
+		local params = RigidBodyParameters3D.new()
+		params.mass = 1.0
+		params.position = Vec3.new(origin.x + Rand(-Extent, Extent), origin.y + Height + Rand(-Extent, Extent), origin.z + Rand(-Extent, Extent))
+
+		local body = entity:AddRigidBody3DComponent(params):GetRigidBody()
+		body:SetCollisionShape(CollisionShapeType.Cuboid)
+		body:SetLinearVelocity(Vec3.new(Rand(-1.0, 1.0), Rand(-1.0, 1.0), Rand(-1.0, 1.0)) * DriftSpeed)
+	end
+end
+
+function OnUpdate(dt)
+	timer = timer + dt
+	if timer >= LogInterval then
+		timer = 0.0
+		Log.Info("Broadphase pairs: " .. tostring(GetBroadphasePairCount3D()))
+	end
+end
+
+function OnCleanUp()
+end
@@ -0,0 +1,31 @@
+--Spawns a grid of point lights around this entity to stress clustered light culling
+--Cluster build time and light counts are shown in the scene renderer settings
+
+local LightCount = 1024
+local Spacing = 6.0
+
+function OnInit()
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+	local side = math.ceil(math.sqrt(LightCount))
+
+	for i = 0, LightCount - 1 do
+		local x = (i % side - side * 0.5) * Spacing
+		local z = (math.floor(i / side) - side * 0.5) * Spacing
+
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Stress Light"
+		entity:AddTransform():SetLocalPosition(Vec3.new(origin.x + x, origin.y + Rand(0.5, 3.0), origin.z + z))
+
+		local light = entity:AddLight()
+		light.Type = 2.0
+		light.Radius = Rand(3.0, 8.0)
+		light.Intensity = Rand(0.5, 2.0) * 120000.0
+		light.Colour = Vec4.new(Rand(0.0, 1.0), Rand(0.0, 1.0), Rand(0.0, 1.0), 1.0)
+	end
+end
+
+function OnUpdate(dt)
+end
+
+function OnCleanUp()
+end
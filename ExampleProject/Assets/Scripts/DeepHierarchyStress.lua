@@ -0,0 +1,56 @@
+--Builds prefab like hierarchies under this entity to stress active state propagation in SceneGraph::Update
+--Each prefab is a chain Depth entities deep with LeafCount leaves hanging off every link. Every frame
+--TogglesPerFrame prefab roots flip their active state, which flips InactiveComponent on their whole subtree.
+--Compare the "SceneGraph::Update" profile zone with TogglesPerFrame at 0 to see the propagation cost alone.
+
+local PrefabCount = 64
+local Depth = 32
+local LeafCount = 3
+local TogglesPerFrame = 4
+
+local roots = {}
+local rootActive = {}
+local nextToggle = 1
+
+local function CreateNode(name, parent)
+	local entity = scene:GetEntityManager():Create()
+	entity:AddNameComponent().name = name
+	entity:AddTransform():SetLocalPosition(Vec3.new(0.0, 1.0, 0.0))
+	--Added up front so toggling never changes which entities the scene graph tracks
+	entity:SetActive(true)
+	if parent ~= nil then
+		entity:SetParent(parent)
+	end
+	return entity
+end
+
+function OnInit()
+	local owner = LuaComponent:GetCurrentEntity()
+
+	for p = 1, PrefabCount do
+		local root = CreateNode("Stress Prefab", owner)
+		roots[p] = root
+		rootActive[p] = true
+
+		local link = root
+		for d = 1, Depth - 1 do
+			link = CreateNode("Stress Link", link)
+			for l = 1, LeafCount do
+				CreateNode("Stress Leaf", link)
+			end
+		end
+	end
+end
+
+function OnUpdate(dt)
+	for i = 1, TogglesPerFrame do
+		rootActive[nextToggle] = not rootActive[nextToggle]
+		roots[nextToggle]:SetActive(rootActive[nextToggle])
+		nextToggle = nextToggle % PrefabCount + 1
+	end
+end
+
+function OnCleanUp()
+	roots = {}
+	rootActive = {}
+end
@@ -0,0 +1,27 @@
+--Spawns a grid of meshes around this entity to stress draw recording
+--Every mesh is its own primitive so none merge into instanced draws. Turn GPU Culling off in the scene renderer
+--settings to record them all on the CPU, then compare Draw Recording with Parallel Recording on and off.
+
+local MeshCount = 10000
+local Spacing = 2.0
+
+function OnInit()
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+	local side = math.ceil(math.sqrt(MeshCount))
+
+	for i = 0, MeshCount - 1 do
+		local x = (i % side - side * 0.5) * Spacing
+		local z = (math.floor(i / side) - side * 0.5) * Spacing
+
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Stress Mesh"
+		entity:AddTransform():SetLocalPosition(Vec3.new(origin.x + x, origin.y + Rand(0.0, 2.0), origin.z + z))
+		entity:AddModelComponent(i % 2 == 0 and PrimitiveType.Cube or PrimitiveType.Sphere)
+	end
+end
+
+function OnUpdate(dt)
+end
+
+function OnCleanUp()
+end
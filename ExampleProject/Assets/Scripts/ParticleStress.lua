@@ -0,0 +1,40 @@
+--Spawns a grid of particle emitters around this entity to stress particle simulation
+--Each emitter launches LaunchCount particles per frame at 60fps, which keeps its ParticleCount slots close to full.
+--Simulation time shows up under the "Scene::UpdateParticles" profile zone, set GPUSimulation to move it to ParticleSimulate.
+
+local EmitterCount = 100
+local ParticleCount = 10000
+local LaunchCount = 60
+local ParticleLife = 3.0
+local Spacing = 10.0
+local GPUSimulation = false
+
+function OnInit()
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+	local side = math.ceil(math.sqrt(EmitterCount))
+
+	for i = 0, EmitterCount - 1 do
+		local x = (i % side - side * 0.5) * Spacing
+		local z = (math.floor(i / side) - side * 0.5) * Spacing
+
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Stress Emitter"
+		entity:AddTransform():SetLocalPosition(Vec3.new(origin.x + x, origin.y, origin.z + z))
+
+		local emitter = entity:AddParticleEmitter()
+		emitter:SetParticleCount(ParticleCount)
+		emitter:SetParticleLife(ParticleLife)
+		emitter:SetParticleRate(1.0 / 60.0)
+		emitter:SetNumLaunchParticles(LaunchCount)
+		emitter:SetInitialVelocity(Vec3.new(0.0, 4.0, 0.0))
+		emitter:SetVelocitySpread(Vec3.new(1.5, 1.0, 1.5))
+		emitter:SetInitialColour(Vec4.new(Rand(0.0, 1.0), Rand(0.0, 1.0), Rand(0.0, 1.0), 1.0))
+		emitter:SetGPUSimulation(GPUSimulation)
+	end
+end
+
+function OnUpdate(dt)
+end
+
+function OnCleanUp()
+end
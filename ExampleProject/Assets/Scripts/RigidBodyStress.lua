@@ -0,0 +1,38 @@
+--Spawns a grid of free falling rigid bodies above this entity to stress rigid body integration
+--The bodies are spaced so they never touch, which leaves the step dominated by integrating them. Body counts and the
+--"Update Rigid Body" profile zone show up in the physics panel and the profiler.
+--LumosPhysicsEngineConfig::MaxRigidBodyCount defaults to 4096, raise it to run 10k or 50k bodies.
+
+local BodyCount = 4000
+local Spacing = 2.0
+local Height = 200.0
+local SpinSpeed = 2.0
+
+function OnInit()
+	local origin = LuaComponent:GetCurrentEntity():GetTransform():GetWorldPosition()
+	local side = math.ceil(math.sqrt(BodyCount))
+
+	for i = 0, BodyCount - 1 do
+		local x = (i % side - side * 0.5) * Spacing
+		local z = (math.floor(i / side) - side * 0.5) * Spacing
+
+		local entity = scene:GetEntityManager():Create()
+		entity:AddNameComponent().name = "Stress Body"
+		entity:AddTransform()
+
+		local params = RigidBodyParameters3D.new()
+		params.mass = 1.0
+		params.position = Vec3.new(origin.x + x, origin.y + Height, origin.z + z)
+
+		local body = entity:AddRigidBody3DComponent(params):GetRigidBody()
+		body:SetCollisionShape(CollisionShapeType.Sphere)
+		--A spin per body so orientation integration is exercised as well
+		body:SetAngularVelocity(Vec3.new(math.random() - 0.5, math.random() - 0.5, math.random() - 0.5) * SpinSpeed)
+	end
+end
+
+function OnUpdate(dt)
+end
+
+function OnCleanUp()
+end
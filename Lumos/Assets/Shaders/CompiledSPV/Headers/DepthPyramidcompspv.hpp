@@ -0,0 +1,117 @@
+// Header generated by Lumos Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_DepthPyramidcompspv_size = 3468;
+constexpr std::array<uint32_t, 867> spirv_DepthPyramidcompspv = {
+    0x07230203, 0x00010000, 0x0008000B, 0x0000008E, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+0x00000002, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
+0x0006000F, 0x00000005, 0x00000005, 0x6E69616D, 0x00000000, 0x0000000E, 0x00060010, 0x00000005, 
+0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 
+0x415F4C47, 0x735F4252, 0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 0x63656A62, 0x00007374, 
+0x00090004, 0x415F4C47, 0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 0x5F656761, 0x70303234, 
+0x006B6361, 0x00040005, 0x00000005, 0x6E69616D, 0x00000000, 0x00040005, 0x0000000A, 0x65786574, 
+0x0000006C, 0x00080005, 0x0000000E, 0x475F6C67, 0x61626F6C, 0x766E496C, 0x7461636F, 0x496E6F69, 
+0x00000044, 0x00050005, 0x00000014, 0x68737550, 0x736E6F43, 0x00007374, 0x00070006, 0x00000014, 
+0x00000000, 0x76657250, 0x73756F69, 0x657A6953, 0x00000000, 0x00060006, 0x00000014, 0x00000001, 
+0x6576654C, 0x7A69536C, 0x00000065, 0x00060006, 0x00000014, 0x00000002, 0x6D6F7246, 0x74706544, 
+0x00000068, 0x00040005, 0x00000016, 0x75505F75, 0x00006873, 0x00040005, 0x0000002D, 0x654C5F6F, 
+0x006C6576, 0x00040005, 0x00000033, 0x65445F75, 0x00687470, 0x00040005, 0x0000003D, 0x73726966, 
+0x00000074, 0x00040005, 0x00000041, 0x7473616C, 0x00000000, 0x00050005, 0x00000061, 0x74726166, 
+0x74736568, 0x00000000, 0x00030005, 0x00000063, 0x00000079, 0x00030005, 0x0000006F, 0x00000078, 
+0x00060005, 0x0000007C, 0x72505F75, 0x6F697665, 0x654C7375, 0x006C6576, 0x00040047, 0x0000000E, 
+0x0000000B, 0x0000001C, 0x00030047, 0x00000014, 0x00000002, 0x00050048, 0x00000014, 0x00000000, 
+0x00000023, 0x00000000, 0x00050048, 0x00000014, 0x00000001, 0x00000023, 0x00000008, 0x00050048, 
+0x00000014, 0x00000002, 0x00000023, 0x00000010, 0x00030047, 0x0000002D, 0x00000013, 0x00030047, 
+0x0000002D, 0x00000019, 0x00040047, 0x0000002D, 0x00000021, 0x00000000, 0x00040047, 0x0000002D, 
+0x00000022, 0x00000000, 0x00040047, 0x00000033, 0x00000021, 0x00000002, 0x00040047, 0x00000033, 
+0x00000022, 0x00000000, 0x00030047, 0x0000007C, 0x00000013, 0x00030047, 0x0000007C, 0x00000018, 
+0x00040047, 0x0000007C, 0x00000021, 0x00000001, 0x00040047, 0x0000007C, 0x00000022, 0x00000000, 
+0x00040047, 0x0000008D, 0x0000000B, 0x00000019, 0x00020013, 0x00000003, 0x00030021, 0x00000004, 
+0x00000003, 0x00040015, 0x00000007, 0x00000020, 0x00000001, 0x00040017, 0x00000008, 0x00000007, 
+0x00000002, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00040015, 0x0000000B, 0x00000020, 
+0x00000000, 0x00040017, 0x0000000C, 0x0000000B, 0x00000003, 0x00040020, 0x0000000D, 0x00000001, 
+0x0000000C, 0x0004003B, 0x0000000D, 0x0000000E, 0x00000001, 0x00040017, 0x0000000F, 0x0000000B, 
+0x00000002, 0x0005001E, 0x00000014, 0x00000008, 0x00000008, 0x0000000B, 0x00040020, 0x00000015, 
+0x00000009, 0x00000014, 0x0004003B, 0x00000015, 0x00000016, 0x00000009, 0x0004002B, 0x00000007, 
+0x00000017, 0x00000001, 0x00040020, 0x00000018, 0x00000009, 0x00000008, 0x00020014, 0x0000001B, 
+0x00040017, 0x0000001C, 0x0000001B, 0x00000002, 0x0004002B, 0x00000007, 0x00000022, 0x00000002, 
+0x00040020, 0x00000023, 0x00000009, 0x0000000B, 0x0004002B, 0x0000000B, 0x00000026, 0x00000000, 
+0x00030016, 0x0000002A, 0x00000020, 0x00090019, 0x0000002B, 0x0000002A, 0x00000001, 0x00000000, 
+0x00000000, 0x00000000, 0x00000002, 0x00000003, 0x00040020, 0x0000002C, 0x00000000, 0x0000002B, 
+0x0004003B, 0x0000002C, 0x0000002D, 0x00000000, 0x00090019, 0x00000030, 0x0000002A, 0x00000001, 
+0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x00000031, 0x00000030, 
+0x00040020, 0x00000032, 0x00000000, 0x00000031, 0x0004003B, 0x00000032, 0x00000033, 0x00000000, 
+0x0004002B, 0x00000007, 0x00000036, 0x00000000, 0x00040017, 0x00000038, 0x0000002A, 0x00000004, 
+0x00040020, 0x00000045, 0x00000007, 0x00000007, 0x00040020, 0x00000048, 0x00000009, 0x00000007, 
+0x0004002B, 0x0000000B, 0x00000053, 0x00000001, 0x00040020, 0x00000060, 0x00000007, 0x0000002A, 
+0x0004002B, 0x0000002A, 0x00000062, 0x00000000, 0x0004003B, 0x0000002C, 0x0000007C, 0x00000000, 
+0x0004002B, 0x0000000B, 0x0000008C, 0x00000008, 0x0006002C, 0x0000000C, 0x0000008D, 0x0000008C, 
+0x0000008C, 0x00000053, 0x00050036, 0x00000003, 0x00000005, 0x00000000, 0x00000004, 0x000200F8, 
+0x00000006, 0x0004003B, 0x00000009, 0x0000000A, 0x00000007, 0x0004003B, 0x00000009, 0x0000003D, 
+0x00000007, 0x0004003B, 0x00000009, 0x00000041, 0x00000007, 0x0004003B, 0x00000060, 0x00000061, 
+0x00000007, 0x0004003B, 0x00000045, 0x00000063, 0x00000007, 0x0004003B, 0x00000045, 0x0000006F, 
+0x00000007, 0x0004003D, 0x0000000C, 0x00000010, 0x0000000E, 0x0007004F, 0x0000000F, 0x00000011, 
+0x00000010, 0x00000010, 0x00000000, 0x00000001, 0x0004007C, 0x00000008, 0x00000012, 0x00000011, 
+0x0003003E, 0x0000000A, 0x00000012, 0x0004003D, 0x00000008, 0x00000013, 0x0000000A, 0x00050041, 
+0x00000018, 0x00000019, 0x00000016, 0x00000017, 0x0004003D, 0x00000008, 0x0000001A, 0x00000019, 
+0x000500AF, 0x0000001C, 0x0000001D, 0x00000013, 0x0000001A, 0x0004009A, 0x0000001B, 0x0000001E, 
+0x0000001D, 0x000300F7, 0x00000020, 0x00000000, 0x000400FA, 0x0000001E, 0x0000001F, 0x00000020, 
+0x000200F8, 0x0000001F, 0x000100FD, 0x000200F8, 0x00000020, 0x00050041, 0x00000023, 0x00000024, 
+0x00000016, 0x00000022, 0x0004003D, 0x0000000B, 0x00000025, 0x00000024, 0x000500AB, 0x0000001B, 
+0x00000027, 0x00000025, 0x00000026, 0x000300F7, 0x00000029, 0x00000000, 0x000400FA, 0x00000027, 
+0x00000028, 0x00000029, 0x000200F8, 0x00000028, 0x0004003D, 0x0000002B, 0x0000002E, 0x0000002D, 
+0x0004003D, 0x00000008, 0x0000002F, 0x0000000A, 0x0004003D, 0x00000031, 0x00000034, 0x00000033, 
+0x0004003D, 0x00000008, 0x00000035, 0x0000000A, 0x00040064, 0x00000030, 0x00000037, 0x00000034, 
+0x0007005F, 0x00000038, 0x00000039, 0x00000037, 0x00000035, 0x00000002, 0x00000036, 0x00050051, 
+0x0000002A, 0x0000003A, 0x00000039, 0x00000000, 0x00070050, 0x00000038, 0x0000003B, 0x0000003A, 
+0x0000003A, 0x0000003A, 0x0000003A, 0x00040063, 0x0000002E, 0x0000002F, 0x0000003B, 0x000100FD, 
+0x000200F8, 0x00000029, 0x0004003D, 0x00000008, 0x0000003E, 0x0000000A, 0x00050050, 0x00000008, 
+0x0000003F, 0x00000022, 0x00000022, 0x00050084, 0x00000008, 0x00000040, 0x0000003E, 0x0000003F, 
+0x0003003E, 0x0000003D, 0x00000040, 0x0004003D, 0x00000008, 0x00000042, 0x0000003D, 0x00050050, 
+0x00000008, 0x00000043, 0x00000017, 0x00000017, 0x00050080, 0x00000008, 0x00000044, 0x00000042, 
+0x00000043, 0x0003003E, 0x00000041, 0x00000044, 0x00050041, 0x00000045, 0x00000046, 0x0000000A, 
+0x00000026, 0x0004003D, 0x00000007, 0x00000047, 0x00000046, 0x00060041, 0x00000048, 0x00000049, 
+0x00000016, 0x00000017, 0x00000026, 0x0004003D, 0x00000007, 0x0000004A, 0x00000049, 0x00050082, 
+0x00000007, 0x0000004B, 0x0000004A, 0x00000017, 0x000500AA, 0x0000001B, 0x0000004C, 0x00000047, 
+0x0000004B, 0x000300F7, 0x0000004E, 0x00000000, 0x000400FA, 0x0000004C, 0x0000004D, 0x0000004E, 
+0x000200F8, 0x0000004D, 0x00060041, 0x00000048, 0x0000004F, 0x00000016, 0x00000036, 0x00000026, 
+0x0004003D, 0x00000007, 0x00000050, 0x0000004F, 0x00050082, 0x00000007, 0x00000051, 0x00000050, 
+0x00000017, 0x00050041, 0x00000045, 0x00000052, 0x00000041, 0x00000026, 0x0003003E, 0x00000052, 
+0x00000051, 0x000200F9, 0x0000004E, 0x000200F8, 0x0000004E, 0x00050041, 0x00000045, 0x00000054, 
+0x0000000A, 0x00000053, 0x0004003D, 0x00000007, 0x00000055, 0x00000054, 0x00060041, 0x00000048, 
+0x00000056, 0x00000016, 0x00000017, 0x00000053, 0x0004003D, 0x00000007, 0x00000057, 0x00000056, 
+0x00050082, 0x00000007, 0x00000058, 0x00000057, 0x00000017, 0x000500AA, 0x0000001B, 0x00000059, 
+0x00000055, 0x00000058, 0x000300F7, 0x0000005B, 0x00000000, 0x000400FA, 0x00000059, 0x0000005A, 
+0x0000005B, 0x000200F8, 0x0000005A, 0x00060041, 0x00000048, 0x0000005C, 0x00000016, 0x00000036, 
+0x00000053, 0x0004003D, 0x00000007, 0x0000005D, 0x0000005C, 0x00050082, 0x00000007, 0x0000005E, 
+0x0000005D, 0x00000017, 0x00050041, 0x00000045, 0x0000005F, 0x00000041, 0x00000053, 0x0003003E, 
+0x0000005F, 0x0000005E, 0x000200F9, 0x0000005B, 0x000200F8, 0x0000005B, 0x0003003E, 0x00000061, 
+0x00000062, 0x00050041, 0x00000045, 0x00000064, 0x0000003D, 0x00000053, 0x0004003D, 0x00000007, 
+0x00000065, 0x00000064, 0x0003003E, 0x00000063, 0x00000065, 0x000200F9, 0x00000066, 0x000200F8, 
+0x00000066, 0x000400F6, 0x00000068, 0x00000069, 0x00000000, 0x000200F9, 0x0000006A, 0x000200F8, 
+0x0000006A, 0x0004003D, 0x00000007, 0x0000006B, 0x00000063, 0x00050041, 0x00000045, 0x0000006C, 
+0x00000041, 0x00000053, 0x0004003D, 0x00000007, 0x0000006D, 0x0000006C, 0x000500B3, 0x0000001B, 
+0x0000006E, 0x0000006B, 0x0000006D, 0x000400FA, 0x0000006E, 0x00000067, 0x00000068, 0x000200F8, 
+0x00000067, 0x00050041, 0x00000045, 0x00000070, 0x0000003D, 0x00000026, 0x0004003D, 0x00000007, 
+0x00000071, 0x00000070, 0x0003003E, 0x0000006F, 0x00000071, 0x000200F9, 0x00000072, 0x000200F8, 
+0x00000072, 0x000400F6, 0x00000074, 0x00000075, 0x00000000, 0x000200F9, 0x00000076, 0x000200F8, 
+0x00000076, 0x0004003D, 0x00000007, 0x00000077, 0x0000006F, 0x00050041, 0x00000045, 0x00000078, 
+0x00000041, 0x00000026, 0x0004003D, 0x00000007, 0x00000079, 0x00000078, 0x000500B3, 0x0000001B, 
+0x0000007A, 0x00000077, 0x00000079, 0x000400FA, 0x0000007A, 0x00000073, 0x00000074, 0x000200F8, 
+0x00000073, 0x0004003D, 0x0000002A, 0x0000007B, 0x00000061, 0x0004003D, 0x0000002B, 0x0000007D, 
+0x0000007C, 0x0004003D, 0x00000007, 0x0000007E, 0x0000006F, 0x0004003D, 0x00000007, 0x0000007F, 
+0x00000063, 0x00050050, 0x00000008, 0x00000080, 0x0000007E, 0x0000007F, 0x00050062, 0x00000038, 
+0x00000081, 0x0000007D, 0x00000080, 0x00050051, 0x0000002A, 0x00000082, 0x00000081, 0x00000000, 
+0x0007000C, 0x0000002A, 0x00000083, 0x00000002, 0x00000028, 0x0000007B, 0x00000082, 0x0003003E, 
+0x00000061, 0x00000083, 0x000200F9, 0x00000075, 0x000200F8, 0x00000075, 0x0004003D, 0x00000007, 
+0x00000084, 0x0000006F, 0x00050080, 0x00000007, 0x00000085, 0x00000084, 0x00000017, 0x0003003E, 
+0x0000006F, 0x00000085, 0x000200F9, 0x00000072, 0x000200F8, 0x00000074, 0x000200F9, 0x00000069, 
+0x000200F8, 0x00000069, 0x0004003D, 0x00000007, 0x00000086, 0x00000063, 0x00050080, 0x00000007, 
+0x00000087, 0x00000086, 0x00000017, 0x0003003E, 0x00000063, 0x00000087, 0x000200F9, 0x00000066, 
+0x000200F8, 0x00000068, 0x0004003D, 0x0000002B, 0x00000088, 0x0000002D, 0x0004003D, 0x00000008, 
+0x00000089, 0x0000000A, 0x0004003D, 0x0000002A, 0x0000008A, 0x00000061, 0x00070050, 0x00000038, 
+0x0000008B, 0x0000008A, 0x0000008A, 0x0000008A, 0x0000008A, 0x00040063, 0x00000088, 0x00000089, 
+0x0000008B, 0x000100FD, 0x00010038, 
+    };
\ No newline at end of file
@@ -0,0 +1,253 @@
+// Header generated by Lumos Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_ForwardPBRInstancedvertspv_size = 7808;
+constexpr std::array<uint32_t, 1952> spirv_ForwardPBRInstancedvertspv = {
+    0x07230203, 0x00010000, 0x0008000B, 0x000000AA, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+0x00000002, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
+0x000E000F, 0x00000000, 0x00000005, 0x6E69616D, 0x00000000, 0x0000001A, 0x00000026, 0x0000002A, 
+0x00000036, 0x00000041, 0x00000048, 0x0000005B, 0x00000061, 0x000000A9, 0x00030003, 0x00000002, 
+0x000001C2, 0x00090004, 0x415F4C47, 0x735F4252, 0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 
+0x63656A62, 0x00007374, 0x00090004, 0x415F4C47, 0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 
+0x5F656761, 0x70303234, 0x006B6361, 0x00040005, 0x00000005, 0x6E69616D, 0x00000000, 0x00050005, 
+0x0000000B, 0x6E617274, 0x726F6673, 0x0000006D, 0x00070005, 0x0000000D, 0x74736E49, 0x65636E61, 
+0x6E617254, 0x726F6673, 0x0000736D, 0x00060006, 0x0000000D, 0x00000000, 0x6E617254, 0x726F6673, 
+0x0000736D, 0x00050005, 0x0000000F, 0x6E495F75, 0x6E617473, 0x00736563, 0x00050005, 0x00000013, 
+0x68737550, 0x736E6F43, 0x00007374, 0x00070006, 0x00000013, 0x00000000, 0x74736E69, 0x65636E61, 
+0x7366664F, 0x00007465, 0x00050005, 0x00000015, 0x68737570, 0x736E6F43, 0x00007374, 0x00070005, 
+0x0000001A, 0x495F6C67, 0x6174736E, 0x4965636E, 0x7865646E, 0x00000000, 0x00050005, 0x00000024, 
+0x74726556, 0x61447865, 0x00006174, 0x00050006, 0x00000024, 0x00000000, 0x6F6C6F43, 0x00007275, 
+0x00060006, 0x00000024, 0x00000001, 0x43786554, 0x64726F6F, 0x00000000, 0x00060006, 0x00000024, 
+0x00000002, 0x69736F50, 0x6E6F6974, 0x00000000, 0x00050006, 0x00000024, 0x00000003, 0x6D726F4E, 
+0x00006C61, 0x00060006, 0x00000024, 0x00000004, 0x6C726F57, 0x726F4E64, 0x006C616D, 0x00060005, 
+0x00000026, 0x74726556, 0x754F7865, 0x74757074, 0x00000000, 0x00050005, 0x0000002A, 0x6F506E69, 
+0x69746973, 0x00006E6F, 0x00060005, 0x00000034, 0x505F6C67, 0x65567265, 0x78657472, 0x00000000, 
+0x00060006, 0x00000034, 0x00000000, 0x505F6C67, 0x7469736F, 0x006E6F69, 0x00030005, 0x00000036, 
+0x00000000, 0x00030005, 0x00000037, 0x004F4255, 0x00060006, 0x00000037, 0x00000000, 0x6A6F7270, 
+0x77656956, 0x00000000, 0x00060005, 0x00000039, 0x61435F75, 0x6172656D, 0x61746144, 0x00000000, 
+0x00040005, 0x00000041, 0x6F436E69, 0x00726F6C, 0x00050005, 0x00000048, 0x65546E69, 0x6F6F4378, 
+0x00006472, 0x00060005, 0x0000004D, 0x6E617274, 0x736F7073, 0x766E4965, 0x00000000, 0x00030005, 
+0x00000059, 0x0000004E, 0x00050005, 0x0000005B, 0x6F4E6E69, 0x6C616D72, 0x00000000, 0x00030005, 
+0x0000005F, 0x00000054, 0x00050005, 0x00000061, 0x61546E69, 0x6E65676E, 0x00000074, 0x00030005, 
+0x00000065, 0x00000042, 0x00050005, 0x00000083, 0x64616853, 0x6144776F, 0x00006174, 0x00080006, 
+0x00000083, 0x00000000, 0x4C726944, 0x74686769, 0x7274614D, 0x73656369, 0x00000000, 0x00050005, 
+0x00000085, 0x69445F75, 0x61685372, 0x00776F64, 0x00050005, 0x00000089, 0x6C415F75, 0x6F646562, 
+0x0070614D, 0x00060005, 0x0000008A, 0x654D5F75, 0x6C6C6174, 0x614D6369, 0x00000070, 0x00060005, 
+0x0000008B, 0x6F525F75, 0x6E686775, 0x4D737365, 0x00007061, 0x00050005, 0x0000008C, 0x6F4E5F75, 
+0x6C616D72, 0x0070614D, 0x00040005, 0x0000008D, 0x4F415F75, 0x0070614D, 0x00060005, 0x0000008E, 
+0x6D455F75, 0x69737369, 0x614D6576, 0x00000070, 0x00070005, 0x0000008F, 0x66696E55, 0x4D6D726F, 
+0x72657461, 0x446C6169, 0x00617461, 0x00070006, 0x0000008F, 0x00000000, 0x65626C41, 0x6F436F64, 
+0x72756F6C, 0x00000000, 0x00060006, 0x0000008F, 0x00000001, 0x67756F52, 0x73656E68, 0x00000073, 
+0x00060006, 0x0000008F, 0x00000002, 0x6174654D, 0x63696C6C, 0x00000000, 0x00060006, 0x0000008F, 
+0x00000003, 0x6C666552, 0x61746365, 0x0065636E, 0x00060006, 0x0000008F, 0x00000004, 0x73696D45, 
+0x65766973, 0x00000000, 0x00070006, 0x0000008F, 0x00000005, 0x65626C41, 0x614D6F64, 0x63614670, 
+0x00726F74, 0x00080006, 0x0000008F, 0x00000006, 0x6174654D, 0x63696C6C, 0x4670614D, 0x6F746361, 
+0x00000072, 0x00080006, 0x0000008F, 0x00000007, 0x67756F52, 0x73656E68, 0x70614D73, 0x74636146, 
+0x0000726F, 0x00070006, 0x0000008F, 0x00000008, 0x6D726F4E, 0x614D6C61, 0x63614670, 0x00726F74, 
+0x00080006, 0x0000008F, 0x00000009, 0x73696D45, 0x65766973, 0x4670614D, 0x6F746361, 0x00000072, 
+0x00060006, 0x0000008F, 0x0000000A, 0x614D4F41, 0x63614670, 0x00726F74, 0x00060006, 0x0000008F, 
+0x0000000B, 0x68706C41, 0x74754361, 0x0066664F, 0x00060006, 0x0000008F, 0x0000000C, 0x6B726F77, 
+0x776F6C66, 0x00000000, 0x00060005, 0x00000091, 0x614D5F75, 0x69726574, 0x61446C61, 0x00006174, 
+0x00050005, 0x00000095, 0x61685375, 0x4D776F64, 0x00007061, 0x00040005, 0x00000099, 0x766E4575, 
+0x0070614D, 0x00040005, 0x0000009A, 0x72724975, 0x0070614D, 0x00050005, 0x0000009B, 0x44524275, 
+0x54554C46, 0x00000000, 0x00050005, 0x0000009C, 0x41535375, 0x70614D4F, 0x00000000, 0x00040005, 
+0x0000009D, 0x6867694C, 0x00000074, 0x00050006, 0x0000009D, 0x00000000, 0x6F6C6F63, 0x00007275, 
+0x00060006, 0x0000009D, 0x00000001, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00060006, 0x0000009D, 
+0x00000002, 0x65726964, 0x6F697463, 0x0000006E, 0x00060006, 0x0000009D, 0x00000003, 0x65746E69, 
+0x7469736E, 0x00000079, 0x00050006, 0x0000009D, 0x00000004, 0x69646172, 0x00007375, 0x00050006, 
+0x0000009D, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x0000009D, 0x00000006, 0x6C676E61, 
+0x00000065, 0x00070005, 0x000000A1, 0x66696E55, 0x536D726F, 0x656E6563, 0x61746144, 0x00000000, 
+0x00050006, 0x000000A1, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 0x000000A1, 0x00000001, 
+0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x000000A1, 0x00000002, 0x77656956, 
+0x7274614D, 0x00007869, 0x00060006, 0x000000A1, 0x00000003, 0x6867694C, 0x65695674, 0x00000077, 
+0x00060006, 0x000000A1, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 0x00070006, 0x000000A1, 
+0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x000000A1, 0x00000006, 
+0x6867694C, 0x7A695374, 0x00000065, 0x00070006, 0x000000A1, 0x00000007, 0x5378614D, 0x6F646168, 
+0x73694477, 0x00000074, 0x00060006, 0x000000A1, 0x00000008, 0x64616853, 0x6146776F, 0x00006564, 
+0x00060006, 0x000000A1, 0x00000009, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x000000A1, 
+0x0000000A, 0x6867694C, 0x756F4374, 0x0000746E, 0x00060006, 0x000000A1, 0x0000000B, 0x64616853, 
+0x6F43776F, 0x00746E75, 0x00050006, 0x000000A1, 0x0000000C, 0x65646F4D, 0x00000000, 0x00060006, 
+0x000000A1, 0x0000000D, 0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x000000A1, 0x0000000E, 
+0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x000000A1, 0x0000000F, 0x74696E49, 0x426C6169, 
+0x00736169, 0x00050006, 0x000000A1, 0x00000010, 0x74646957, 0x00000068, 0x00050006, 0x000000A1, 
+0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x000000A1, 0x00000012, 0x64616853, 0x6E45776F, 
+0x656C6261, 0x00000064, 0x00070006, 0x000000A1, 0x00000013, 0x6E656C42, 0x61685364, 0x73776F64, 
+0x00000000, 0x00060006, 0x000000A1, 0x00000014, 0x53464350, 0x6C706D61, 0x00007365, 0x00060006, 
+0x000000A1, 0x00000015, 0x65676F56, 0x66664F6C, 0x00746573, 0x00070006, 0x000000A1, 0x00000016, 
+0x746C6946, 0x68537265, 0x776F6461, 0x00000073, 0x00050005, 0x000000A3, 0x63535F75, 0x44656E65, 
+0x00617461, 0x00060005, 0x000000A6, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070006, 
+0x000000A6, 0x00000000, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070005, 0x000000A8, 
+0x6F425F75, 0x7254656E, 0x66736E61, 0x736D726F, 0x00000000, 0x00050005, 0x000000A9, 0x69426E69, 
+0x676E6174, 0x00746E65, 0x00040047, 0x0000000C, 0x00000006, 0x00000040, 0x00030047, 0x0000000D, 
+0x00000003, 0x00040048, 0x0000000D, 0x00000000, 0x00000005, 0x00050048, 0x0000000D, 0x00000000, 
+0x00000007, 0x00000010, 0x00040048, 0x0000000D, 0x00000000, 0x00000018, 0x00050048, 0x0000000D, 
+0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000F, 0x00000018, 0x00040047, 0x0000000F, 
+0x00000021, 0x00000001, 0x00040047, 0x0000000F, 0x00000022, 0x00000003, 0x00030047, 0x00000013, 
+0x00000002, 0x00050048, 0x00000013, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x0000001A, 
+0x0000000B, 0x0000002B, 0x00040047, 0x00000026, 0x0000001E, 0x00000000, 0x00040047, 0x0000002A, 
+0x0000001E, 0x00000000, 0x00030047, 0x00000034, 0x00000002, 0x00050048, 0x00000034, 0x00000000, 
+0x0000000B, 0x00000000, 0x00030047, 0x00000037, 0x00000002, 0x00040048, 0x00000037, 0x00000000, 
+0x00000005, 0x00050048, 0x00000037, 0x00000000, 0x00000007, 0x00000010, 0x00050048, 0x00000037, 
+0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x00000039, 0x00000021, 0x00000000, 0x00040047, 
+0x00000039, 0x00000022, 0x00000000, 0x00040047, 0x00000041, 0x0000001E, 0x00000001, 0x00040047, 
+0x00000048, 0x0000001E, 0x00000002, 0x00040047, 0x0000005B, 0x0000001E, 0x00000003, 0x00040047, 
+0x00000061, 0x0000001E, 0x00000004, 0x00040047, 0x00000082, 0x00000006, 0x00000040, 0x00030047, 
+0x00000083, 0x00000002, 0x00040048, 0x00000083, 0x00000000, 0x00000005, 0x00050048, 0x00000083, 
+0x00000000, 0x00000007, 0x00000010, 0x00050048, 0x00000083, 0x00000000, 0x00000023, 0x00000000, 
+0x00040047, 0x00000085, 0x00000021, 0x00000001, 0x00040047, 0x00000085, 0x00000022, 0x00000000, 
+0x00040047, 0x00000089, 0x00000021, 0x00000000, 0x00040047, 0x00000089, 0x00000022, 0x00000001, 
+0x00040047, 0x0000008A, 0x00000021, 0x00000001, 0x00040047, 0x0000008A, 0x00000022, 0x00000001, 
+0x00040047, 0x0000008B, 0x00000021, 0x00000002, 0x00040047, 0x0000008B, 0x00000022, 0x00000001, 
+0x00040047, 0x0000008C, 0x00000021, 0x00000003, 0x00040047, 0x0000008C, 0x00000022, 0x00000001, 
+0x00040047, 0x0000008D, 0x00000021, 0x00000004, 0x00040047, 0x0000008D, 0x00000022, 0x00000001, 
+0x00040047, 0x0000008E, 0x00000021, 0x00000005, 0x00040047, 0x0000008E, 0x00000022, 0x00000001, 
+0x00030047, 0x0000008F, 0x00000002, 0x00050048, 0x0000008F, 0x00000000, 0x00000023, 0x00000000, 
+0x00050048, 0x0000008F, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x0000008F, 0x00000002, 
+0x00000023, 0x00000014, 0x00050048, 0x0000008F, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 
+0x0000008F, 0x00000004, 0x00000023, 0x0000001C, 0x00050048, 0x0000008F, 0x00000005, 0x00000023, 
+0x00000020, 0x00050048, 0x0000008F, 0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x0000008F, 
+0x00000007, 0x00000023, 0x00000028, 0x00050048, 0x0000008F, 0x00000008, 0x00000023, 0x0000002C, 
+0x00050048, 0x0000008F, 0x00000009, 0x00000023, 0x00000030, 0x00050048, 0x0000008F, 0x0000000A, 
+0x00000023, 0x00000034, 0x00050048, 0x0000008F, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 
+0x0000008F, 0x0000000C, 0x00000023, 0x0000003C, 0x00040047, 0x00000091, 0x00000021, 0x00000006, 
+0x00040047, 0x00000091, 0x00000022, 0x00000001, 0x00040047, 0x00000095, 0x00000021, 0x00000000, 
+0x00040047, 0x00000095, 0x00000022, 0x00000002, 0x00040047, 0x00000099, 0x00000021, 0x00000001, 
+0x00040047, 0x00000099, 0x00000022, 0x00000002, 0x00040047, 0x0000009A, 0x00000021, 0x00000002, 
+0x00040047, 0x0000009A, 0x00000022, 0x00000002, 0x00040047, 0x0000009B, 0x00000021, 0x00000003, 
+0x00040047, 0x0000009B, 0x00000022, 0x00000002, 0x00040047, 0x0000009C, 0x00000021, 0x00000004, 
+0x00040047, 0x0000009C, 0x00000022, 0x00000002, 0x00050048, 0x0000009D, 0x00000000, 0x00000023, 
+0x00000000, 0x00050048, 0x0000009D, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x0000009D, 
+0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x0000009D, 0x00000003, 0x00000023, 0x00000030, 
+0x00050048, 0x0000009D, 0x00000004, 0x00000023, 0x00000034, 0x00050048, 0x0000009D, 0x00000005, 
+0x00000023, 0x00000038, 0x00050048, 0x0000009D, 0x00000006, 0x00000023, 0x0000003C, 0x00040047, 
+0x0000009F, 0x00000006, 0x00000040, 0x00040047, 0x000000A0, 0x00000006, 0x00000040, 0x00030047, 
+0x000000A1, 0x00000002, 0x00050048, 0x000000A1, 0x00000000, 0x00000023, 0x00000000, 0x00040048, 
+0x000000A1, 0x00000001, 0x00000005, 0x00050048, 0x000000A1, 0x00000001, 0x00000007, 0x00000010, 
+0x00050048, 0x000000A1, 0x00000001, 0x00000023, 0x00000800, 0x00040048, 0x000000A1, 0x00000002, 
+0x00000005, 0x00050048, 0x000000A1, 0x00000002, 0x00000007, 0x00000010, 0x00050048, 0x000000A1, 
+0x00000002, 0x00000023, 0x00000900, 0x00040048, 0x000000A1, 0x00000003, 0x00000005, 0x00050048, 
+0x000000A1, 0x00000003, 0x00000007, 0x00000010, 0x00050048, 0x000000A1, 0x00000003, 0x00000023, 
+0x00000940, 0x00040048, 0x000000A1, 0x00000004, 0x00000005, 0x00050048, 0x000000A1, 0x00000004, 
+0x00000007, 0x00000010, 0x00050048, 0x000000A1, 0x00000004, 0x00000023, 0x00000980, 0x00050048, 
+0x000000A1, 0x00000005, 0x00000023, 0x000009C0, 0x00050048, 0x000000A1, 0x00000006, 0x00000023, 
+0x000009D0, 0x00050048, 0x000000A1, 0x00000007, 0x00000023, 0x000009D4, 0x00050048, 0x000000A1, 
+0x00000008, 0x00000023, 0x000009D8, 0x00050048, 0x000000A1, 0x00000009, 0x00000023, 0x000009DC, 
+0x00050048, 0x000000A1, 0x0000000A, 0x00000023, 0x000009E0, 0x00050048, 0x000000A1, 0x0000000B, 
+0x00000023, 0x000009E4, 0x00050048, 0x000000A1, 0x0000000C, 0x00000023, 0x000009E8, 0x00050048, 
+0x000000A1, 0x0000000D, 0x00000023, 0x000009EC, 0x00050048, 0x000000A1, 0x0000000E, 0x00000023, 
+0x000009F0, 0x00050048, 0x000000A1, 0x0000000F, 0x00000023, 0x00000A00, 0x00050048, 0x000000A1, 
+0x00000010, 0x00000023, 0x00000A04, 0x00050048, 0x000000A1, 0x00000011, 0x00000023, 0x00000A08, 
+0x00050048, 0x000000A1, 0x00000012, 0x00000023, 0x00000A0C, 0x00050048, 0x000000A1, 0x00000013, 
+0x00000023, 0x00000A10, 0x00050048, 0x000000A1, 0x00000014, 0x00000023, 0x00000A14, 0x00050048, 
+0x000000A1, 0x00000015, 0x00000023, 0x00000A18, 0x00050048, 0x000000A1, 0x00000016, 0x00000023, 
+0x00000A1C, 0x00040047, 0x000000A3, 0x00000021, 0x00000005, 0x00040047, 0x000000A3, 0x00000022, 
+0x00000002, 0x00040047, 0x000000A5, 0x00000006, 0x00000040, 0x00030047, 0x000000A6, 0x00000002, 
+0x00040048, 0x000000A6, 0x00000000, 0x00000005, 0x00050048, 0x000000A6, 0x00000000, 0x00000007, 
+0x00000010, 0x00050048, 0x000000A6, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x000000A8, 
+0x00000021, 0x00000000, 0x00040047, 0x000000A8, 0x00000022, 0x00000003, 0x00040047, 0x000000A9, 
+0x0000001E, 0x00000005, 0x00020013, 0x00000003, 0x00030021, 0x00000004, 0x00000003, 0x00030016, 
+0x00000007, 0x00000020, 0x00040017, 0x00000008, 0x00000007, 0x00000004, 0x00040018, 0x00000009, 
+0x00000008, 0x00000004, 0x00040020, 0x0000000A, 0x00000007, 0x00000009, 0x0003001D, 0x0000000C, 
+0x00000009, 0x0003001E, 0x0000000D, 0x0000000C, 0x00040020, 0x0000000E, 0x00000002, 0x0000000D, 
+0x0004003B, 0x0000000E, 0x0000000F, 0x00000002, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 
+0x0004002B, 0x00000010, 0x00000011, 0x00000000, 0x00040015, 0x00000012, 0x00000020, 0x00000000, 
+0x0003001E, 0x00000013, 0x00000012, 0x00040020, 0x00000014, 0x00000009, 0x00000013, 0x0004003B, 
+0x00000014, 0x00000015, 0x00000009, 0x00040020, 0x00000016, 0x00000009, 0x00000012, 0x00040020, 
+0x00000019, 0x00000001, 0x00000010, 0x0004003B, 0x00000019, 0x0000001A, 0x00000001, 0x00040020, 
+0x0000001E, 0x00000002, 0x00000009, 0x00040017, 0x00000021, 0x00000007, 0x00000003, 0x00040017, 
+0x00000022, 0x00000007, 0x00000002, 0x00040018, 0x00000023, 0x00000021, 0x00000003, 0x0007001E, 
+0x00000024, 0x00000021, 0x00000022, 0x00000008, 0x00000021, 0x00000023, 0x00040020, 0x00000025, 
+0x00000003, 0x00000024, 0x0004003B, 0x00000025, 0x00000026, 0x00000003, 0x0004002B, 0x00000010, 
+0x00000027, 0x00000002, 0x00040020, 0x00000029, 0x00000001, 0x00000021, 0x0004003B, 0x00000029, 
+0x0000002A, 0x00000001, 0x0004002B, 0x00000007, 0x0000002C, 0x3F800000, 0x00040020, 0x00000032, 
+0x00000003, 0x00000008, 0x0003001E, 0x00000034, 0x00000008, 0x00040020, 0x00000035, 0x00000003, 
+0x00000034, 0x0004003B, 0x00000035, 0x00000036, 0x00000003, 0x0003001E, 0x00000037, 0x00000009, 
+0x00040020, 0x00000038, 0x00000002, 0x00000037, 0x0004003B, 0x00000038, 0x00000039, 0x00000002, 
+0x00040020, 0x00000040, 0x00000001, 0x00000008, 0x0004003B, 0x00000040, 0x00000041, 0x00000001, 
+0x00040020, 0x00000044, 0x00000003, 0x00000021, 0x0004002B, 0x00000010, 0x00000046, 0x00000001, 
+0x00040020, 0x00000047, 0x00000001, 0x00000022, 0x0004003B, 0x00000047, 0x00000048, 0x00000001, 
+0x00040020, 0x0000004A, 0x00000003, 0x00000022, 0x00040020, 0x0000004C, 0x00000007, 0x00000023, 
+0x00040020, 0x00000058, 0x00000007, 0x00000021, 0x0004003B, 0x00000029, 0x0000005B, 0x00000001, 
+0x0004003B, 0x00000029, 0x00000061, 0x00000001, 0x0004002B, 0x00000010, 0x0000006A, 0x00000003, 
+0x0004002B, 0x00000010, 0x0000006D, 0x00000004, 0x0004002B, 0x00000007, 0x00000071, 0x00000000, 
+0x00040020, 0x0000007F, 0x00000003, 0x00000023, 0x0004002B, 0x00000012, 0x00000081, 0x00000004, 
+0x0004001C, 0x00000082, 0x00000009, 0x00000081, 0x0003001E, 0x00000083, 0x00000082, 0x00040020, 
+0x00000084, 0x00000002, 0x00000083, 0x0004003B, 0x00000084, 0x00000085, 0x00000002, 0x00090019, 
+0x00000086, 0x00000007, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 
+0x0003001B, 0x00000087, 0x00000086, 0x00040020, 0x00000088, 0x00000000, 0x00000087, 0x0004003B, 
+0x00000088, 0x00000089, 0x00000000, 0x0004003B, 0x00000088, 0x0000008A, 0x00000000, 0x0004003B, 
+0x00000088, 0x0000008B, 0x00000000, 0x0004003B, 0x00000088, 0x0000008C, 0x00000000, 0x0004003B, 
+0x00000088, 0x0000008D, 0x00000000, 0x0004003B, 0x00000088, 0x0000008E, 0x00000000, 0x000F001E, 
+0x0000008F, 0x00000008, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
+0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00040020, 0x00000090, 
+0x00000002, 0x0000008F, 0x0004003B, 0x00000090, 0x00000091, 0x00000002, 0x00090019, 0x00000092, 
+0x00000007, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 
+0x00000093, 0x00000092, 0x00040020, 0x00000094, 0x00000000, 0x00000093, 0x0004003B, 0x00000094, 
+0x00000095, 0x00000000, 0x00090019, 0x00000096, 0x00000007, 0x00000003, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x00000097, 0x00000096, 0x00040020, 0x00000098, 
+0x00000000, 0x00000097, 0x0004003B, 0x00000098, 0x00000099, 0x00000000, 0x0004003B, 0x00000098, 
+0x0000009A, 0x00000000, 0x0004003B, 0x00000088, 0x0000009B, 0x00000000, 0x0004003B, 0x00000088, 
+0x0000009C, 0x00000000, 0x0009001E, 0x0000009D, 0x00000008, 0x00000008, 0x00000008, 0x00000007, 
+0x00000007, 0x00000007, 0x00000007, 0x0004002B, 0x00000012, 0x0000009E, 0x00000020, 0x0004001C, 
+0x0000009F, 0x0000009D, 0x0000009E, 0x0004001C, 0x000000A0, 0x00000009, 0x00000081, 0x0019001E, 
+0x000000A1, 0x0000009F, 0x000000A0, 0x00000009, 0x00000009, 0x00000009, 0x00000008, 0x00000007, 
+0x00000007, 0x00000007, 0x00000007, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000008, 
+0x00000007, 0x00000007, 0x00000007, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 
+0x00040020, 0x000000A2, 0x00000002, 0x000000A1, 0x0004003B, 0x000000A2, 0x000000A3, 0x00000002, 
+0x0004002B, 0x00000012, 0x000000A4, 0x00000064, 0x0004001C, 0x000000A5, 0x00000009, 0x000000A4, 
+0x0003001E, 0x000000A6, 0x000000A5, 0x00040020, 0x000000A7, 0x00000002, 0x000000A6, 0x0004003B, 
+0x000000A7, 0x000000A8, 0x00000002, 0x0004003B, 0x00000029, 0x000000A9, 0x00000001, 0x00050036, 
+0x00000003, 0x00000005, 0x00000000, 0x00000004, 0x000200F8, 0x00000006, 0x0004003B, 0x0000000A, 
+0x0000000B, 0x00000007, 0x0004003B, 0x0000004C, 0x0000004D, 0x00000007, 0x0004003B, 0x00000058, 
+0x00000059, 0x00000007, 0x0004003B, 0x00000058, 0x0000005F, 0x00000007, 0x0004003B, 0x00000058, 
+0x00000065, 0x00000007, 0x00050041, 0x00000016, 0x00000017, 0x00000015, 0x00000011, 0x0004003D, 
+0x00000012, 0x00000018, 0x00000017, 0x0004003D, 0x00000010, 0x0000001B, 0x0000001A, 0x0004007C, 
+0x00000012, 0x0000001C, 0x0000001B, 0x00050080, 0x00000012, 0x0000001D, 0x00000018, 0x0000001C, 
+0x00060041, 0x0000001E, 0x0000001F, 0x0000000F, 0x00000011, 0x0000001D, 0x0004003D, 0x00000009, 
+0x00000020, 0x0000001F, 0x0003003E, 0x0000000B, 0x00000020, 0x0004003D, 0x00000009, 0x00000028, 
+0x0000000B, 0x0004003D, 0x00000021, 0x0000002B, 0x0000002A, 0x00050051, 0x00000007, 0x0000002D, 
+0x0000002B, 0x00000000, 0x00050051, 0x00000007, 0x0000002E, 0x0000002B, 0x00000001, 0x00050051, 
+0x00000007, 0x0000002F, 0x0000002B, 0x00000002, 0x00070050, 0x00000008, 0x00000030, 0x0000002D, 
+0x0000002E, 0x0000002F, 0x0000002C, 0x00050091, 0x00000008, 0x00000031, 0x00000028, 0x00000030, 
+0x00050041, 0x00000032, 0x00000033, 0x00000026, 0x00000027, 0x0003003E, 0x00000033, 0x00000031, 
+0x00050041, 0x0000001E, 0x0000003A, 0x00000039, 0x00000011, 0x0004003D, 0x00000009, 0x0000003B, 
+0x0000003A, 0x00050041, 0x00000032, 0x0000003C, 0x00000026, 0x00000027, 0x0004003D, 0x00000008, 
+0x0000003D, 0x0000003C, 0x00050091, 0x00000008, 0x0000003E, 0x0000003B, 0x0000003D, 0x00050041, 
+0x00000032, 0x0000003F, 0x00000036, 0x00000011, 0x0003003E, 0x0000003F, 0x0000003E, 0x0004003D, 
+0x00000008, 0x00000042, 0x00000041, 0x0008004F, 0x00000021, 0x00000043, 0x00000042, 0x00000042, 
+0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000044, 0x00000045, 0x00000026, 0x00000011, 
+0x0003003E, 0x00000045, 0x00000043, 0x0004003D, 0x00000022, 0x00000049, 0x00000048, 0x00050041, 
+0x0000004A, 0x0000004B, 0x00000026, 0x00000046, 0x0003003E, 0x0000004B, 0x00000049, 0x0004003D, 
+0x00000009, 0x0000004E, 0x0000000B, 0x00050051, 0x00000008, 0x0000004F, 0x0000004E, 0x00000000, 
+0x0008004F, 0x00000021, 0x00000050, 0x0000004F, 0x0000004F, 0x00000000, 0x00000001, 0x00000002, 
+0x00050051, 0x00000008, 0x00000051, 0x0000004E, 0x00000001, 0x0008004F, 0x00000021, 0x00000052, 
+0x00000051, 0x00000051, 0x00000000, 0x00000001, 0x00000002, 0x00050051, 0x00000008, 0x00000053, 
+0x0000004E, 0x00000002, 0x0008004F, 0x00000021, 0x00000054, 0x00000053, 0x00000053, 0x00000000, 
+0x00000001, 0x00000002, 0x00060050, 0x00000023, 0x00000055, 0x00000050, 0x00000052, 0x00000054, 
+0x0006000C, 0x00000023, 0x00000056, 0x00000002, 0x00000022, 0x00000055, 0x00040054, 0x00000023, 
+0x00000057, 0x00000056, 0x0003003E, 0x0000004D, 0x00000057, 0x0004003D, 0x00000023, 0x0000005A, 
+0x0000004D, 0x0004003D, 0x00000021, 0x0000005C, 0x0000005B, 0x00050091, 0x00000021, 0x0000005D, 
+0x0000005A, 0x0000005C, 0x0006000C, 0x00000021, 0x0000005E, 0x00000002, 0x00000045, 0x0000005D, 
+0x0003003E, 0x00000059, 0x0000005E, 0x0004003D, 0x00000023, 0x00000060, 0x0000004D, 0x0004003D, 
+0x00000021, 0x00000062, 0x00000061, 0x00050091, 0x00000021, 0x00000063, 0x00000060, 0x00000062, 
+0x0006000C, 0x00000021, 0x00000064, 0x00000002, 0x00000045, 0x00000063, 0x0003003E, 0x0000005F, 
+0x00000064, 0x0004003D, 0x00000021, 0x00000066, 0x00000059, 0x0004003D, 0x00000021, 0x00000067, 
+0x0000005F, 0x0007000C, 0x00000021, 0x00000068, 0x00000002, 0x00000044, 0x00000066, 0x00000067, 
+0x0006000C, 0x00000021, 0x00000069, 0x00000002, 0x00000045, 0x00000068, 0x0003003E, 0x00000065, 
+0x00000069, 0x0004003D, 0x00000021, 0x0000006B, 0x00000059, 0x00050041, 0x00000044, 0x0000006C, 
+0x00000026, 0x0000006A, 0x0003003E, 0x0000006C, 0x0000006B, 0x0004003D, 0x00000021, 0x0000006E, 
+0x0000005F, 0x0004003D, 0x00000021, 0x0000006F, 0x00000065, 0x0004003D, 0x00000021, 0x00000070, 
+0x00000059, 0x00050051, 0x00000007, 0x00000072, 0x0000006E, 0x00000000, 0x00050051, 0x00000007, 
+0x00000073, 0x0000006E, 0x00000001, 0x00050051, 0x00000007, 0x00000074, 0x0000006E, 0x00000002, 
+0x00050051, 0x00000007, 0x00000075, 0x0000006F, 0x00000000, 0x00050051, 0x00000007, 0x00000076, 
+0x0000006F, 0x00000001, 0x00050051, 0x00000007, 0x00000077, 0x0000006F, 0x00000002, 0x00050051, 
+0x00000007, 0x00000078, 0x00000070, 0x00000000, 0x00050051, 0x00000007, 0x00000079, 0x00000070, 
+0x00000001, 0x00050051, 0x00000007, 0x0000007A, 0x00000070, 0x00000002, 0x00060050, 0x00000021, 
+0x0000007B, 0x00000072, 0x00000073, 0x00000074, 0x00060050, 0x00000021, 0x0000007C, 0x00000075, 
+0x00000076, 0x00000077, 0x00060050, 0x00000021, 0x0000007D, 0x00000078, 0x00000079, 0x0000007A, 
+0x00060050, 0x00000023, 0x0000007E, 0x0000007B, 0x0000007C, 0x0000007D, 0x00050041, 0x0000007F, 
+0x00000080, 0x00000026, 0x0000006D, 0x0003003E, 0x00000080, 0x0000007E, 0x000100FD, 0x00010038, 
+
+    };
\ No newline at end of file
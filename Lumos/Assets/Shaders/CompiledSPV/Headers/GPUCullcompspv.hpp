@@ -0,0 +1,393 @@
+// Header generated by Lumos Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_GPUCullcompspv_size = 12316;
+constexpr std::array<uint32_t, 3079> spirv_GPUCullcompspv = {
+    0x07230203, 0x00010000, 0x0008000B, 0x000001C2, 0x00000000, 0x00020011, 0x00000001, 0x00020011, 
+0x00000032, 0x0006000B, 0x00000002, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 
+0x00000000, 0x00000001, 0x0006000F, 0x00000005, 0x00000005, 0x6E69616D, 0x00000000, 0x00000122, 
+0x00060010, 0x00000005, 0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 
+0x000001C2, 0x00090004, 0x415F4C47, 0x735F4252, 0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 
+0x63656A62, 0x00007374, 0x00090004, 0x415F4C47, 0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 
+0x5F656761, 0x70303234, 0x006B6361, 0x00040005, 0x00000005, 0x6E69616D, 0x00000000, 0x00050005, 
+0x0000000D, 0x6C6C7543, 0x77656956, 0x00000000, 0x00050006, 0x0000000D, 0x00000000, 0x6E616C50, 
+0x00007365, 0x00060006, 0x0000000D, 0x00000001, 0x77656956, 0x6A6F7250, 0x00000000, 0x00060006, 
+0x0000000D, 0x00000002, 0x73677241, 0x7366664F, 0x00007465, 0x00070006, 0x0000000D, 0x00000003, 
+0x53657355, 0x6F646168, 0x74614277, 0x00006863, 0x00070006, 0x0000000D, 0x00000004, 0x6C63634F, 
+0x6F697375, 0x7365546E, 0x00000074, 0x00050006, 0x0000000D, 0x00000005, 0x64646150, 0x00676E69, 
+0x00130005, 0x00000016, 0x6E497349, 0x65646973, 0x73757246, 0x286D7574, 0x75727473, 0x432D7463, 
+0x566C6C75, 0x2D776569, 0x5B346676, 0x6D2D5D36, 0x2D343466, 0x752D3175, 0x31752D31, 0x3131752D, 
+0x3366763B, 0x3366763B, 0x0000003B, 0x00040005, 0x00000013, 0x77656976, 0x00000000, 0x00040005, 
+0x00000014, 0x746E6563, 0x00006572, 0x00040005, 0x00000015, 0x65747865, 0x0000746E, 0x00120005, 
+0x0000001B, 0x634F7349, 0x64756C63, 0x73286465, 0x63757274, 0x75432D74, 0x69566C6C, 0x762D7765, 
+0x365B3466, 0x666D2D5D, 0x752D3434, 0x31752D31, 0x2D31752D, 0x3B313175, 0x3B336676, 0x3B336676, 
+0x00000000, 0x00040005, 0x00000018, 0x77656976, 0x00000000, 0x00040005, 0x00000019, 0x746E6563, 
+0x00006572, 0x00040005, 0x0000001A, 0x65747865, 0x0000746E, 0x00030005, 0x0000001F, 0x00000069, 
+0x00040005, 0x0000002A, 0x6E616C70, 0x00000065, 0x00040005, 0x0000004B, 0x556E696D, 0x00000056, 
+0x00040005, 0x0000004E, 0x5578616D, 0x00000056, 0x00050005, 0x00000050, 0x446E696D, 0x68747065, 
+0x00000000, 0x00030005, 0x00000051, 0x00000069, 0x00040005, 0x0000005A, 0x6E726F63, 0x00007265, 
+0x00040005, 0x0000006F, 0x70696C63, 0x00000000, 0x00030005, 0x0000007F, 0x0063646E, 0x00040005, 
+0x0000009E, 0x657A6973, 0x00000000, 0x00050005, 0x0000009F, 0x68737550, 0x736E6F43, 0x00007374, 
+0x00070006, 0x0000009F, 0x00000000, 0x74736E49, 0x65636E61, 0x6E756F43, 0x00000074, 0x00060006, 
+0x0000009F, 0x00000001, 0x77656956, 0x65646E49, 0x00000078, 0x00070006, 0x0000009F, 0x00000002, 
+0x61727950, 0x4C64696D, 0x6C657665, 0x00000073, 0x00050006, 0x0000009F, 0x00000003, 0x64646150, 
+0x00676E69, 0x00060006, 0x0000009F, 0x00000004, 0x61727950, 0x5364696D, 0x00657A69, 0x00040005, 
+0x000000A1, 0x75505F75, 0x00006873, 0x00040005, 0x000000A6, 0x73726966, 0x00000074, 0x00040005, 
+0x000000B1, 0x7473616C, 0x00000000, 0x00040005, 0x000000BB, 0x6E617073, 0x00000000, 0x00040005, 
+0x000000C9, 0x6576656C, 0x0000006C, 0x00050005, 0x000000DA, 0x6576656C, 0x7A69536C, 0x00000065, 
+0x00060005, 0x000000DE, 0x65445F75, 0x50687470, 0x6D617279, 0x00006469, 0x00030005, 0x000000E3, 
+0x00000061, 0x00030005, 0x000000EC, 0x00000062, 0x00050005, 0x000000F5, 0x74726166, 0x74736568, 
+0x00000000, 0x00040005, 0x0000011F, 0x65646E69, 0x00000078, 0x00080005, 0x00000122, 0x475F6C67, 
+0x61626F6C, 0x766E496C, 0x7461636F, 0x496E6F69, 0x00000044, 0x00040005, 0x0000012D, 0x77656976, 
+0x00000000, 0x00050005, 0x0000012F, 0x6C6C7543, 0x77656956, 0x00000000, 0x00050006, 0x0000012F, 
+0x00000000, 0x6E616C50, 0x00007365, 0x00060006, 0x0000012F, 0x00000001, 0x77656956, 0x6A6F7250, 
+0x00000000, 0x00060006, 0x0000012F, 0x00000002, 0x73677241, 0x7366664F, 0x00007465, 0x00070006, 
+0x0000012F, 0x00000003, 0x53657355, 0x6F646168, 0x74614277, 0x00006863, 0x00070006, 0x0000012F, 
+0x00000004, 0x6C63634F, 0x6F697375, 0x7365546E, 0x00000074, 0x00050006, 0x0000012F, 0x00000005, 
+0x64646150, 0x00676E69, 0x00040005, 0x00000131, 0x77656956, 0x00000073, 0x00050006, 0x00000131, 
+0x00000000, 0x61746144, 0x00000000, 0x00040005, 0x00000133, 0x69565F75, 0x00737765, 0x00060005, 
+0x00000154, 0x6C6C7543, 0x74736E49, 0x65636E61, 0x00000000, 0x00060006, 0x00000154, 0x00000000, 
+0x6E617254, 0x726F6673, 0x0000006D, 0x00050006, 0x00000154, 0x00000001, 0x746E6543, 0x00006572, 
+0x00050006, 0x00000154, 0x00000002, 0x65747845, 0x0000746E, 0x00070006, 0x00000154, 0x00000003, 
+0x77726F46, 0x42647261, 0x68637461, 0x00000000, 0x00060006, 0x00000154, 0x00000004, 0x64616853, 
+0x6142776F, 0x00686374, 0x00060006, 0x00000154, 0x00000005, 0x64646150, 0x30676E69, 0x00000000, 
+0x00060006, 0x00000154, 0x00000006, 0x64646150, 0x31676E69, 0x00000000, 0x00050005, 0x00000156, 
+0x74736E69, 0x65636E61, 0x00000000, 0x00060005, 0x00000157, 0x6C6C7543, 0x74736E49, 0x65636E61, 
+0x00000000, 0x00060006, 0x00000157, 0x00000000, 0x6E617254, 0x726F6673, 0x0000006D, 0x00050006, 
+0x00000157, 0x00000001, 0x746E6543, 0x00006572, 0x00050006, 0x00000157, 0x00000002, 0x65747845, 
+0x0000746E, 0x00070006, 0x00000157, 0x00000003, 0x77726F46, 0x42647261, 0x68637461, 0x00000000, 
+0x00060006, 0x00000157, 0x00000004, 0x64616853, 0x6142776F, 0x00686374, 0x00060006, 0x00000157, 
+0x00000005, 0x64646150, 0x30676E69, 0x00000000, 0x00060006, 0x00000157, 0x00000006, 0x64646150, 
+0x31676E69, 0x00000000, 0x00050005, 0x00000159, 0x74736E49, 0x65636E61, 0x00000073, 0x00050006, 
+0x00000159, 0x00000000, 0x61746144, 0x00000000, 0x00050005, 0x0000015B, 0x6E495F75, 0x6E617473, 
+0x00736563, 0x00040005, 0x0000016E, 0x63746162, 0x00000068, 0x00040005, 0x00000181, 0x746E6563, 
+0x00006572, 0x00040005, 0x00000185, 0x65747865, 0x0000746E, 0x00040005, 0x00000189, 0x61726170, 
+0x0000006D, 0x00040005, 0x0000018B, 0x61726170, 0x0000006D, 0x00040005, 0x0000018D, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000199, 0x61726170, 0x0000006D, 0x00040005, 0x0000019B, 0x61726170, 
+0x0000006D, 0x00040005, 0x0000019D, 0x61726170, 0x0000006D, 0x00050005, 0x000001A4, 0x75677261, 
+0x746E656D, 0x00000073, 0x00040005, 0x000001A9, 0x746F6C73, 0x00000000, 0x00060005, 0x000001AA, 
+0x77617244, 0x75677241, 0x746E656D, 0x00000073, 0x00060006, 0x000001AA, 0x00000000, 0x65646E49, 
+0x756F4378, 0x0000746E, 0x00070006, 0x000001AA, 0x00000001, 0x74736E49, 0x65636E61, 0x6E756F43, 
+0x00000074, 0x00060006, 0x000001AA, 0x00000002, 0x73726946, 0x646E4974, 0x00007865, 0x00070006, 
+0x000001AA, 0x00000003, 0x74726556, 0x664F7865, 0x74657366, 0x00000000, 0x00070006, 0x000001AA, 
+0x00000004, 0x73726946, 0x736E4974, 0x636E6174, 0x00000065, 0x00050005, 0x000001AC, 0x75677241, 
+0x746E656D, 0x00000073, 0x00050006, 0x000001AC, 0x00000000, 0x61746144, 0x00000000, 0x00050005, 
+0x000001AE, 0x72415F75, 0x656D7567, 0x0073746E, 0x00070005, 0x000001B4, 0x7074754F, 0x72547475, 
+0x66736E61, 0x736D726F, 0x00000000, 0x00050006, 0x000001B4, 0x00000000, 0x61746144, 0x00000000, 
+0x00050005, 0x000001B6, 0x754F5F75, 0x74757074, 0x00000000, 0x00030047, 0x0000009F, 0x00000002, 
+0x00050048, 0x0000009F, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000009F, 0x00000001, 
+0x00000023, 0x00000004, 0x00050048, 0x0000009F, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 
+0x0000009F, 0x00000003, 0x00000023, 0x0000000C, 0x00050048, 0x0000009F, 0x00000004, 0x00000023, 
+0x00000010, 0x00040047, 0x000000DE, 0x00000021, 0x00000004, 0x00040047, 0x000000DE, 0x00000022, 
+0x00000000, 0x00040047, 0x00000122, 0x0000000B, 0x0000001C, 0x00040047, 0x0000012E, 0x00000006, 
+0x00000010, 0x00050048, 0x0000012F, 0x00000000, 0x00000023, 0x00000000, 0x00040048, 0x0000012F, 
+0x00000001, 0x00000005, 0x00050048, 0x0000012F, 0x00000001, 0x00000007, 0x00000010, 0x00050048, 
+0x0000012F, 0x00000001, 0x00000023, 0x00000060, 0x00050048, 0x0000012F, 0x00000002, 0x00000023, 
+0x000000A0, 0x00050048, 0x0000012F, 0x00000003, 0x00000023, 0x000000A4, 0x00050048, 0x0000012F, 
+0x00000004, 0x00000023, 0x000000A8, 0x00050048, 0x0000012F, 0x00000005, 0x00000023, 0x000000AC, 
+0x00040047, 0x00000130, 0x00000006, 0x000000B0, 0x00030047, 0x00000131, 0x00000003, 0x00040048, 
+0x00000131, 0x00000000, 0x00000018, 0x00050048, 0x00000131, 0x00000000, 0x00000023, 0x00000000, 
+0x00030047, 0x00000133, 0x00000018, 0x00040047, 0x00000133, 0x00000021, 0x00000001, 0x00040047, 
+0x00000133, 0x00000022, 0x00000000, 0x00040048, 0x00000157, 0x00000000, 0x00000005, 0x00050048, 
+0x00000157, 0x00000000, 0x00000007, 0x00000010, 0x00050048, 0x00000157, 0x00000000, 0x00000023, 
+0x00000000, 0x00050048, 0x00000157, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x00000157, 
+0x00000002, 0x00000023, 0x00000050, 0x00050048, 0x00000157, 0x00000003, 0x00000023, 0x00000060, 
+0x00050048, 0x00000157, 0x00000004, 0x00000023, 0x00000064, 0x00050048, 0x00000157, 0x00000005, 
+0x00000023, 0x00000068, 0x00050048, 0x00000157, 0x00000006, 0x00000023, 0x0000006C, 0x00040047, 
+0x00000158, 0x00000006, 0x00000070, 0x00030047, 0x00000159, 0x00000003, 0x00040048, 0x00000159, 
+0x00000000, 0x00000018, 0x00050048, 0x00000159, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 
+0x0000015B, 0x00000018, 0x00040047, 0x0000015B, 0x00000021, 0x00000000, 0x00040047, 0x0000015B, 
+0x00000022, 0x00000000, 0x00050048, 0x000001AA, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
+0x000001AA, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000001AA, 0x00000002, 0x00000023, 
+0x00000008, 0x00050048, 0x000001AA, 0x00000003, 0x00000023, 0x0000000C, 0x00050048, 0x000001AA, 
+0x00000004, 0x00000023, 0x00000010, 0x00040047, 0x000001AB, 0x00000006, 0x00000014, 0x00030047, 
+0x000001AC, 0x00000003, 0x00050048, 0x000001AC, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 
+0x000001AE, 0x00000021, 0x00000002, 0x00040047, 0x000001AE, 0x00000022, 0x00000000, 0x00040047, 
+0x000001B3, 0x00000006, 0x00000040, 0x00030047, 0x000001B4, 0x00000003, 0x00040048, 0x000001B4, 
+0x00000000, 0x00000005, 0x00050048, 0x000001B4, 0x00000000, 0x00000007, 0x00000010, 0x00040048, 
+0x000001B4, 0x00000000, 0x00000019, 0x00050048, 0x000001B4, 0x00000000, 0x00000023, 0x00000000, 
+0x00030047, 0x000001B6, 0x00000019, 0x00040047, 0x000001B6, 0x00000021, 0x00000003, 0x00040047, 
+0x000001B6, 0x00000022, 0x00000000, 0x00040047, 0x000001C1, 0x0000000B, 0x00000019, 0x00020013, 
+0x00000003, 0x00030021, 0x00000004, 0x00000003, 0x00030016, 0x00000007, 0x00000020, 0x00040017, 
+0x00000008, 0x00000007, 0x00000004, 0x00040015, 0x00000009, 0x00000020, 0x00000000, 0x0004002B, 
+0x00000009, 0x0000000A, 0x00000006, 0x0004001C, 0x0000000B, 0x00000008, 0x0000000A, 0x00040018, 
+0x0000000C, 0x00000008, 0x00000004, 0x0008001E, 0x0000000D, 0x0000000B, 0x0000000C, 0x00000009, 
+0x00000009, 0x00000009, 0x00000009, 0x00040020, 0x0000000E, 0x00000007, 0x0000000D, 0x00040017, 
+0x0000000F, 0x00000007, 0x00000003, 0x00040020, 0x00000010, 0x00000007, 0x0000000F, 0x00020014, 
+0x00000011, 0x00060021, 0x00000012, 0x00000011, 0x0000000E, 0x00000010, 0x00000010, 0x00040015, 
+0x0000001D, 0x00000020, 0x00000001, 0x00040020, 0x0000001E, 0x00000007, 0x0000001D, 0x0004002B, 
+0x0000001D, 0x00000020, 0x00000000, 0x0004002B, 0x0000001D, 0x00000027, 0x00000006, 0x00040020, 
+0x00000029, 0x00000007, 0x00000008, 0x0004002B, 0x00000009, 0x00000032, 0x00000003, 0x00040020, 
+0x00000033, 0x00000007, 0x00000007, 0x0004002B, 0x00000007, 0x0000003D, 0x00000000, 0x0003002A, 
+0x00000011, 0x00000041, 0x0004002B, 0x0000001D, 0x00000044, 0x00000001, 0x00030029, 0x00000011, 
+0x00000046, 0x00040017, 0x00000049, 0x00000007, 0x00000002, 0x00040020, 0x0000004A, 0x00000007, 
+0x00000049, 0x0004002B, 0x00000007, 0x0000004C, 0x3F800000, 0x0005002C, 0x00000049, 0x0000004D, 
+0x0000004C, 0x0000004C, 0x0005002C, 0x00000049, 0x0000004F, 0x0000003D, 0x0000003D, 0x0004002B, 
+0x0000001D, 0x00000058, 0x00000008, 0x0004002B, 0x00000007, 0x00000060, 0xBF800000, 0x0004002B, 
+0x0000001D, 0x00000063, 0x00000002, 0x0004002B, 0x0000001D, 0x00000068, 0x00000004, 0x00040020, 
+0x00000070, 0x00000007, 0x0000000C, 0x0004002B, 0x00000007, 0x00000089, 0x3F000000, 0x0004002B, 
+0x00000009, 0x00000096, 0x00000002, 0x00040017, 0x0000009C, 0x0000001D, 0x00000002, 0x00040020, 
+0x0000009D, 0x00000007, 0x0000009C, 0x0007001E, 0x0000009F, 0x00000009, 0x00000009, 0x00000009, 
+0x00000009, 0x00000049, 0x00040020, 0x000000A0, 0x00000009, 0x0000009F, 0x0004003B, 0x000000A0, 
+0x000000A1, 0x00000009, 0x00040020, 0x000000A2, 0x00000009, 0x00000049, 0x0005002C, 0x0000009C, 
+0x000000AC, 0x00000020, 0x00000020, 0x0004002B, 0x00000009, 0x000000BC, 0x00000000, 0x0004002B, 
+0x00000009, 0x000000C2, 0x00000001, 0x00040020, 0x000000D4, 0x00000009, 0x00000009, 0x00090019, 
+0x000000DB, 0x00000007, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 
+0x0003001B, 0x000000DC, 0x000000DB, 0x00040020, 0x000000DD, 0x00000000, 0x000000DC, 0x0004003B, 
+0x000000DD, 0x000000DE, 0x00000000, 0x00040020, 0x0000011E, 0x00000007, 0x00000009, 0x00040017, 
+0x00000120, 0x00000009, 0x00000003, 0x00040020, 0x00000121, 0x00000001, 0x00000120, 0x0004003B, 
+0x00000121, 0x00000122, 0x00000001, 0x00040020, 0x00000123, 0x00000001, 0x00000009, 0x0004001C, 
+0x0000012E, 0x00000008, 0x0000000A, 0x0008001E, 0x0000012F, 0x0000012E, 0x0000000C, 0x00000009, 
+0x00000009, 0x00000009, 0x00000009, 0x0003001D, 0x00000130, 0x0000012F, 0x0003001E, 0x00000131, 
+0x00000130, 0x00040020, 0x00000132, 0x00000002, 0x00000131, 0x0004003B, 0x00000132, 0x00000133, 
+0x00000002, 0x00040020, 0x00000136, 0x00000002, 0x0000012F, 0x00040020, 0x0000013A, 0x00000007, 
+0x0000000B, 0x0004002B, 0x0000001D, 0x00000143, 0x00000003, 0x0004002B, 0x0000001D, 0x00000148, 
+0x00000005, 0x0009001E, 0x00000154, 0x0000000C, 0x00000008, 0x00000008, 0x00000009, 0x00000009, 
+0x00000009, 0x00000009, 0x00040020, 0x00000155, 0x00000007, 0x00000154, 0x0009001E, 0x00000157, 
+0x0000000C, 0x00000008, 0x00000008, 0x00000009, 0x00000009, 0x00000009, 0x00000009, 0x0003001D, 
+0x00000158, 0x00000157, 0x0003001E, 0x00000159, 0x00000158, 0x00040020, 0x0000015A, 0x00000002, 
+0x00000159, 0x0004003B, 0x0000015A, 0x0000015B, 0x00000002, 0x00040020, 0x0000015D, 0x00000002, 
+0x00000157, 0x0004002B, 0x00000009, 0x0000017C, 0xFFFFFFFF, 0x0007001E, 0x000001AA, 0x00000009, 
+0x00000009, 0x00000009, 0x0000001D, 0x00000009, 0x0003001D, 0x000001AB, 0x000001AA, 0x0003001E, 
+0x000001AC, 0x000001AB, 0x00040020, 0x000001AD, 0x00000002, 0x000001AC, 0x0004003B, 0x000001AD, 
+0x000001AE, 0x00000002, 0x00040020, 0x000001B0, 0x00000002, 0x00000009, 0x0003001D, 0x000001B3, 
+0x0000000C, 0x0003001E, 0x000001B4, 0x000001B3, 0x00040020, 0x000001B5, 0x00000002, 0x000001B4, 
+0x0004003B, 0x000001B5, 0x000001B6, 0x00000002, 0x00040020, 0x000001BE, 0x00000002, 0x0000000C, 
+0x0004002B, 0x00000009, 0x000001C0, 0x00000040, 0x0006002C, 0x00000120, 0x000001C1, 0x000001C0, 
+0x000000C2, 0x000000C2, 0x00050036, 0x00000003, 0x00000005, 0x00000000, 0x00000004, 0x000200F8, 
+0x00000006, 0x0004003B, 0x0000011E, 0x0000011F, 0x00000007, 0x0004003B, 0x0000000E, 0x0000012D, 
+0x00000007, 0x0004003B, 0x00000155, 0x00000156, 0x00000007, 0x0004003B, 0x0000011E, 0x0000016E, 
+0x00000007, 0x0004003B, 0x0000011E, 0x00000172, 0x00000007, 0x0004003B, 0x00000010, 0x00000181, 
+0x00000007, 0x0004003B, 0x00000010, 0x00000185, 0x00000007, 0x0004003B, 0x0000000E, 0x00000189, 
+0x00000007, 0x0004003B, 0x00000010, 0x0000018B, 0x00000007, 0x0004003B, 0x00000010, 0x0000018D, 
+0x00000007, 0x0004003B, 0x0000000E, 0x00000199, 0x00000007, 0x0004003B, 0x00000010, 0x0000019B, 
+0x00000007, 0x0004003B, 0x00000010, 0x0000019D, 0x00000007, 0x0004003B, 0x0000011E, 0x000001A4, 
+0x00000007, 0x0004003B, 0x0000011E, 0x000001A9, 0x00000007, 0x00050041, 0x00000123, 0x00000124, 
+0x00000122, 0x000000BC, 0x0004003D, 0x00000009, 0x00000125, 0x00000124, 0x0003003E, 0x0000011F, 
+0x00000125, 0x0004003D, 0x00000009, 0x00000126, 0x0000011F, 0x00050041, 0x000000D4, 0x00000127, 
+0x000000A1, 0x00000020, 0x0004003D, 0x00000009, 0x00000128, 0x00000127, 0x000500AE, 0x00000011, 
+0x00000129, 0x00000126, 0x00000128, 0x000300F7, 0x0000012B, 0x00000000, 0x000400FA, 0x00000129, 
+0x0000012A, 0x0000012B, 0x000200F8, 0x0000012A, 0x000100FD, 0x000200F8, 0x0000012B, 0x00050041, 
+0x000000D4, 0x00000134, 0x000000A1, 0x00000044, 0x0004003D, 0x00000009, 0x00000135, 0x00000134, 
+0x00060041, 0x00000136, 0x00000137, 0x00000133, 0x00000020, 0x00000135, 0x0004003D, 0x0000012F, 
+0x00000138, 0x00000137, 0x00050051, 0x0000012E, 0x00000139, 0x00000138, 0x00000000, 0x00050041, 
+0x0000013A, 0x0000013B, 0x0000012D, 0x00000020, 0x00050051, 0x00000008, 0x0000013C, 0x00000139, 
+0x00000000, 0x00050041, 0x00000029, 0x0000013D, 0x0000013B, 0x00000020, 0x0003003E, 0x0000013D, 
+0x0000013C, 0x00050051, 0x00000008, 0x0000013E, 0x00000139, 0x00000001, 0x00050041, 0x00000029, 
+0x0000013F, 0x0000013B, 0x00000044, 0x0003003E, 0x0000013F, 0x0000013E, 0x00050051, 0x00000008, 
+0x00000140, 0x00000139, 0x00000002, 0x00050041, 0x00000029, 0x00000141, 0x0000013B, 0x00000063, 
+0x0003003E, 0x00000141, 0x00000140, 0x00050051, 0x00000008, 0x00000142, 0x00000139, 0x00000003, 
+0x00050041, 0x00000029, 0x00000144, 0x0000013B, 0x00000143, 0x0003003E, 0x00000144, 0x00000142, 
+0x00050051, 0x00000008, 0x00000145, 0x00000139, 0x00000004, 0x00050041, 0x00000029, 0x00000146, 
+0x0000013B, 0x00000068, 0x0003003E, 0x00000146, 0x00000145, 0x00050051, 0x00000008, 0x00000147, 
+0x00000139, 0x00000005, 0x00050041, 0x00000029, 0x00000149, 0x0000013B, 0x00000148, 0x0003003E, 
+0x00000149, 0x00000147, 0x00050051, 0x0000000C, 0x0000014A, 0x00000138, 0x00000001, 0x00050041, 
+0x00000070, 0x0000014B, 0x0000012D, 0x00000044, 0x0003003E, 0x0000014B, 0x0000014A, 0x00050051, 
+0x00000009, 0x0000014C, 0x00000138, 0x00000002, 0x00050041, 0x0000011E, 0x0000014D, 0x0000012D, 
+0x00000063, 0x0003003E, 0x0000014D, 0x0000014C, 0x00050051, 0x00000009, 0x0000014E, 0x00000138, 
+0x00000003, 0x00050041, 0x0000011E, 0x0000014F, 0x0000012D, 0x00000143, 0x0003003E, 0x0000014F, 
+0x0000014E, 0x00050051, 0x00000009, 0x00000150, 0x00000138, 0x00000004, 0x00050041, 0x0000011E, 
+0x00000151, 0x0000012D, 0x00000068, 0x0003003E, 0x00000151, 0x00000150, 0x00050051, 0x00000009, 
+0x00000152, 0x00000138, 0x00000005, 0x00050041, 0x0000011E, 0x00000153, 0x0000012D, 0x00000148, 
+0x0003003E, 0x00000153, 0x00000152, 0x0004003D, 0x00000009, 0x0000015C, 0x0000011F, 0x00060041, 
+0x0000015D, 0x0000015E, 0x0000015B, 0x00000020, 0x0000015C, 0x0004003D, 0x00000157, 0x0000015F, 
+0x0000015E, 0x00050051, 0x0000000C, 0x00000160, 0x0000015F, 0x00000000, 0x00050041, 0x00000070, 
+0x00000161, 0x00000156, 0x00000020, 0x0003003E, 0x00000161, 0x00000160, 0x00050051, 0x00000008, 
+0x00000162, 0x0000015F, 0x00000001, 0x00050041, 0x00000029, 0x00000163, 0x00000156, 0x00000044, 
+0x0003003E, 0x00000163, 0x00000162, 0x00050051, 0x00000008, 0x00000164, 0x0000015F, 0x00000002, 
+0x00050041, 0x00000029, 0x00000165, 0x00000156, 0x00000063, 0x0003003E, 0x00000165, 0x00000164, 
+0x00050051, 0x00000009, 0x00000166, 0x0000015F, 0x00000003, 0x00050041, 0x0000011E, 0x00000167, 
+0x00000156, 0x00000143, 0x0003003E, 0x00000167, 0x00000166, 0x00050051, 0x00000009, 0x00000168, 
+0x0000015F, 0x00000004, 0x00050041, 0x0000011E, 0x00000169, 0x00000156, 0x00000068, 0x0003003E, 
+0x00000169, 0x00000168, 0x00050051, 0x00000009, 0x0000016A, 0x0000015F, 0x00000005, 0x00050041, 
+0x0000011E, 0x0000016B, 0x00000156, 0x00000148, 0x0003003E, 0x0000016B, 0x0000016A, 0x00050051, 
+0x00000009, 0x0000016C, 0x0000015F, 0x00000006, 0x00050041, 0x0000011E, 0x0000016D, 0x00000156, 
+0x00000027, 0x0003003E, 0x0000016D, 0x0000016C, 0x00050041, 0x0000011E, 0x0000016F, 0x0000012D, 
+0x00000143, 0x0004003D, 0x00000009, 0x00000170, 0x0000016F, 0x000500AB, 0x00000011, 0x00000171, 
+0x00000170, 0x000000BC, 0x000300F7, 0x00000174, 0x00000000, 0x000400FA, 0x00000171, 0x00000173, 
+0x00000177, 0x000200F8, 0x00000173, 0x00050041, 0x0000011E, 0x00000175, 0x00000156, 0x00000068, 
+0x0004003D, 0x00000009, 0x00000176, 0x00000175, 0x0003003E, 0x00000172, 0x00000176, 0x000200F9, 
+0x00000174, 0x000200F8, 0x00000177, 0x00050041, 0x0000011E, 0x00000178, 0x00000156, 0x00000143, 
+0x0004003D, 0x00000009, 0x00000179, 0x00000178, 0x0003003E, 0x00000172, 0x00000179, 0x000200F9, 
+0x00000174, 0x000200F8, 0x00000174, 0x0004003D, 0x00000009, 0x0000017A, 0x00000172, 0x0003003E, 
+0x0000016E, 0x0000017A, 0x0004003D, 0x00000009, 0x0000017B, 0x0000016E, 0x000500AA, 0x00000011, 
+0x0000017D, 0x0000017B, 0x0000017C, 0x000300F7, 0x0000017F, 0x00000000, 0x000400FA, 0x0000017D, 
+0x0000017E, 0x0000017F, 0x000200F8, 0x0000017E, 0x000100FD, 0x000200F8, 0x0000017F, 0x00050041, 
+0x00000029, 0x00000182, 0x00000156, 0x00000044, 0x0004003D, 0x00000008, 0x00000183, 0x00000182, 
+0x0008004F, 0x0000000F, 0x00000184, 0x00000183, 0x00000183, 0x00000000, 0x00000001, 0x00000002, 
+0x0003003E, 0x00000181, 0x00000184, 0x00050041, 0x00000029, 0x00000186, 0x00000156, 0x00000063, 
+0x0004003D, 0x00000008, 0x00000187, 0x00000186, 0x0008004F, 0x0000000F, 0x00000188, 0x00000187, 
+0x00000187, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000185, 0x00000188, 0x0004003D, 
+0x0000000D, 0x0000018A, 0x0000012D, 0x0003003E, 0x00000189, 0x0000018A, 0x0004003D, 0x0000000F, 
+0x0000018C, 0x00000181, 0x0003003E, 0x0000018B, 0x0000018C, 0x0004003D, 0x0000000F, 0x0000018E, 
+0x00000185, 0x0003003E, 0x0000018D, 0x0000018E, 0x00070039, 0x00000011, 0x0000018F, 0x00000016, 
+0x00000189, 0x0000018B, 0x0000018D, 0x000400A8, 0x00000011, 0x00000190, 0x0000018F, 0x000300F7, 
+0x00000192, 0x00000000, 0x000400FA, 0x00000190, 0x00000191, 0x00000192, 0x000200F8, 0x00000191, 
+0x000100FD, 0x000200F8, 0x00000192, 0x00050041, 0x0000011E, 0x00000194, 0x0000012D, 0x00000068, 
+0x0004003D, 0x00000009, 0x00000195, 0x00000194, 0x000500AB, 0x00000011, 0x00000196, 0x00000195, 
+0x000000BC, 0x000300F7, 0x00000198, 0x00000000, 0x000400FA, 0x00000196, 0x00000197, 0x00000198, 
+0x000200F8, 0x00000197, 0x0004003D, 0x0000000D, 0x0000019A, 0x0000012D, 0x0003003E, 0x00000199, 
+0x0000019A, 0x0004003D, 0x0000000F, 0x0000019C, 0x00000181, 0x0003003E, 0x0000019B, 0x0000019C, 
+0x0004003D, 0x0000000F, 0x0000019E, 0x00000185, 0x0003003E, 0x0000019D, 0x0000019E, 0x00070039, 
+0x00000011, 0x0000019F, 0x0000001B, 0x00000199, 0x0000019B, 0x0000019D, 0x000200F9, 0x00000198, 
+0x000200F8, 0x00000198, 0x000700F5, 0x00000011, 0x000001A0, 0x00000196, 0x00000192, 0x0000019F, 
+0x00000197, 0x000300F7, 0x000001A2, 0x00000000, 0x000400FA, 0x000001A0, 0x000001A1, 0x000001A2, 
+0x000200F8, 0x000001A1, 0x000100FD, 0x000200F8, 0x000001A2, 0x00050041, 0x0000011E, 0x000001A5, 
+0x0000012D, 0x00000063, 0x0004003D, 0x00000009, 0x000001A6, 0x000001A5, 0x0004003D, 0x00000009, 
+0x000001A7, 0x0000016E, 0x00050080, 0x00000009, 0x000001A8, 0x000001A6, 0x000001A7, 0x0003003E, 
+0x000001A4, 0x000001A8, 0x0004003D, 0x00000009, 0x000001AF, 0x000001A4, 0x00070041, 0x000001B0, 
+0x000001B1, 0x000001AE, 0x00000020, 0x000001AF, 0x00000044, 0x000700EA, 0x00000009, 0x000001B2, 
+0x000001B1, 0x000000C2, 0x000000BC, 0x000000C2, 0x0003003E, 0x000001A9, 0x000001B2, 0x0004003D, 
+0x00000009, 0x000001B7, 0x000001A4, 0x00070041, 0x000001B0, 0x000001B8, 0x000001AE, 0x00000020, 
+0x000001B7, 0x00000068, 0x0004003D, 0x00000009, 0x000001B9, 0x000001B8, 0x0004003D, 0x00000009, 
+0x000001BA, 0x000001A9, 0x00050080, 0x00000009, 0x000001BB, 0x000001B9, 0x000001BA, 0x00050041, 
+0x00000070, 0x000001BC, 0x00000156, 0x00000020, 0x0004003D, 0x0000000C, 0x000001BD, 0x000001BC, 
+0x00060041, 0x000001BE, 0x000001BF, 0x000001B6, 0x00000020, 0x000001BB, 0x0003003E, 0x000001BF, 
+0x000001BD, 0x000100FD, 0x00010038, 0x00050036, 0x00000011, 0x00000016, 0x00000000, 0x00000012, 
+0x00030037, 0x0000000E, 0x00000013, 0x00030037, 0x00000010, 0x00000014, 0x00030037, 0x00000010, 
+0x00000015, 0x000200F8, 0x00000017, 0x0004003B, 0x0000001E, 0x0000001F, 0x00000007, 0x0004003B, 
+0x00000029, 0x0000002A, 0x00000007, 0x0003003E, 0x0000001F, 0x00000020, 0x000200F9, 0x00000021, 
+0x000200F8, 0x00000021, 0x000400F6, 0x00000023, 0x00000024, 0x00000000, 0x000200F9, 0x00000025, 
+0x000200F8, 0x00000025, 0x0004003D, 0x0000001D, 0x00000026, 0x0000001F, 0x000500B1, 0x00000011, 
+0x00000028, 0x00000026, 0x00000027, 0x000400FA, 0x00000028, 0x00000022, 0x00000023, 0x000200F8, 
+0x00000022, 0x0004003D, 0x0000001D, 0x0000002B, 0x0000001F, 0x00060041, 0x00000029, 0x0000002C, 
+0x00000013, 0x00000020, 0x0000002B, 0x0004003D, 0x00000008, 0x0000002D, 0x0000002C, 0x0003003E, 
+0x0000002A, 0x0000002D, 0x0004003D, 0x00000008, 0x0000002E, 0x0000002A, 0x0008004F, 0x0000000F, 
+0x0000002F, 0x0000002E, 0x0000002E, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000F, 
+0x00000030, 0x00000014, 0x00050094, 0x00000007, 0x00000031, 0x0000002F, 0x00000030, 0x00050041, 
+0x00000033, 0x00000034, 0x0000002A, 0x00000032, 0x0004003D, 0x00000007, 0x00000035, 0x00000034, 
+0x00050081, 0x00000007, 0x00000036, 0x00000031, 0x00000035, 0x0004003D, 0x00000008, 0x00000037, 
+0x0000002A, 0x0008004F, 0x0000000F, 0x00000038, 0x00000037, 0x00000037, 0x00000000, 0x00000001, 
+0x00000002, 0x0006000C, 0x0000000F, 0x00000039, 0x00000002, 0x00000004, 0x00000038, 0x0004003D, 
+0x0000000F, 0x0000003A, 0x00000015, 0x00050094, 0x00000007, 0x0000003B, 0x00000039, 0x0000003A, 
+0x00050081, 0x00000007, 0x0000003C, 0x00000036, 0x0000003B, 0x000500B8, 0x00000011, 0x0000003E, 
+0x0000003C, 0x0000003D, 0x000300F7, 0x00000040, 0x00000000, 0x000400FA, 0x0000003E, 0x0000003F, 
+0x00000040, 0x000200F8, 0x0000003F, 0x000200FE, 0x00000041, 0x000200F8, 0x00000040, 0x000200F9, 
+0x00000024, 0x000200F8, 0x00000024, 0x0004003D, 0x0000001D, 0x00000043, 0x0000001F, 0x00050080, 
+0x0000001D, 0x00000045, 0x00000043, 0x00000044, 0x0003003E, 0x0000001F, 0x00000045, 0x000200F9, 
+0x00000021, 0x000200F8, 0x00000023, 0x000200FE, 0x00000046, 0x00010038, 0x00050036, 0x00000011, 
+0x0000001B, 0x00000000, 0x00000012, 0x00030037, 0x0000000E, 0x00000018, 0x00030037, 0x00000010, 
+0x00000019, 0x00030037, 0x00000010, 0x0000001A, 0x000200F8, 0x0000001C, 0x0004003B, 0x0000004A, 
+0x0000004B, 0x00000007, 0x0004003B, 0x0000004A, 0x0000004E, 0x00000007, 0x0004003B, 0x00000033, 
+0x00000050, 0x00000007, 0x0004003B, 0x0000001E, 0x00000051, 0x00000007, 0x0004003B, 0x00000010, 
+0x0000005A, 0x00000007, 0x0004003B, 0x00000029, 0x0000006F, 0x00000007, 0x0004003B, 0x00000010, 
+0x0000007F, 0x00000007, 0x0004003B, 0x0000009D, 0x0000009E, 0x00000007, 0x0004003B, 0x0000009D, 
+0x000000A6, 0x00000007, 0x0004003B, 0x0000009D, 0x000000B1, 0x00000007, 0x0004003B, 0x0000001E, 
+0x000000BB, 0x00000007, 0x0004003B, 0x0000001E, 0x000000C9, 0x00000007, 0x0004003B, 0x0000001E, 
+0x000000CC, 0x00000007, 0x0004003B, 0x0000009D, 0x000000DA, 0x00000007, 0x0004003B, 0x0000009D, 
+0x000000E3, 0x00000007, 0x0004003B, 0x0000009D, 0x000000EC, 0x00000007, 0x0004003B, 0x00000033, 
+0x000000F5, 0x00000007, 0x0003003E, 0x0000004B, 0x0000004D, 0x0003003E, 0x0000004E, 0x0000004F, 
+0x0003003E, 0x00000050, 0x0000004C, 0x0003003E, 0x00000051, 0x00000020, 0x000200F9, 0x00000052, 
+0x000200F8, 0x00000052, 0x000400F6, 0x00000054, 0x00000055, 0x00000000, 0x000200F9, 0x00000056, 
+0x000200F8, 0x00000056, 0x0004003D, 0x0000001D, 0x00000057, 0x00000051, 0x000500B1, 0x00000011, 
+0x00000059, 0x00000057, 0x00000058, 0x000400FA, 0x00000059, 0x00000053, 0x00000054, 0x000200F8, 
+0x00000053, 0x0004003D, 0x0000000F, 0x0000005B, 0x00000019, 0x0004003D, 0x0000000F, 0x0000005C, 
+0x0000001A, 0x0004003D, 0x0000001D, 0x0000005D, 0x00000051, 0x000500C7, 0x0000001D, 0x0000005E, 
+0x0000005D, 0x00000044, 0x000500AB, 0x00000011, 0x0000005F, 0x0000005E, 0x00000020, 0x000600A9, 
+0x00000007, 0x00000061, 0x0000005F, 0x0000004C, 0x00000060, 0x0004003D, 0x0000001D, 0x00000062, 
+0x00000051, 0x000500C7, 0x0000001D, 0x00000064, 0x00000062, 0x00000063, 0x000500AB, 0x00000011, 
+0x00000065, 0x00000064, 0x00000020, 0x000600A9, 0x00000007, 0x00000066, 0x00000065, 0x0000004C, 
+0x00000060, 0x0004003D, 0x0000001D, 0x00000067, 0x00000051, 0x000500C7, 0x0000001D, 0x00000069, 
+0x00000067, 0x00000068, 0x000500AB, 0x00000011, 0x0000006A, 0x00000069, 0x00000020, 0x000600A9, 
+0x00000007, 0x0000006B, 0x0000006A, 0x0000004C, 0x00000060, 0x00060050, 0x0000000F, 0x0000006C, 
+0x00000061, 0x00000066, 0x0000006B, 0x00050085, 0x0000000F, 0x0000006D, 0x0000005C, 0x0000006C, 
+0x00050081, 0x0000000F, 0x0000006E, 0x0000005B, 0x0000006D, 0x0003003E, 0x0000005A, 0x0000006E, 
+0x00050041, 0x00000070, 0x00000071, 0x00000018, 0x00000044, 0x0004003D, 0x0000000C, 0x00000072, 
+0x00000071, 0x0004003D, 0x0000000F, 0x00000073, 0x0000005A, 0x00050051, 0x00000007, 0x00000074, 
+0x00000073, 0x00000000, 0x00050051, 0x00000007, 0x00000075, 0x00000073, 0x00000001, 0x00050051, 
+0x00000007, 0x00000076, 0x00000073, 0x00000002, 0x00070050, 0x00000008, 0x00000077, 0x00000074, 
+0x00000075, 0x00000076, 0x0000004C, 0x00050091, 0x00000008, 0x00000078, 0x00000072, 0x00000077, 
+0x0003003E, 0x0000006F, 0x00000078, 0x00050041, 0x00000033, 0x00000079, 0x0000006F, 0x00000032, 
+0x0004003D, 0x00000007, 0x0000007A, 0x00000079, 0x000500BC, 0x00000011, 0x0000007B, 0x0000007A, 
+0x0000003D, 0x000300F7, 0x0000007D, 0x00000000, 0x000400FA, 0x0000007B, 0x0000007C, 0x0000007D, 
+0x000200F8, 0x0000007C, 0x000200FE, 0x00000041, 0x000200F8, 0x0000007D, 0x0004003D, 0x00000008, 
+0x00000080, 0x0000006F, 0x0008004F, 0x0000000F, 0x00000081, 0x00000080, 0x00000080, 0x00000000, 
+0x00000001, 0x00000002, 0x00050041, 0x00000033, 0x00000082, 0x0000006F, 0x00000032, 0x0004003D, 
+0x00000007, 0x00000083, 0x00000082, 0x00060050, 0x0000000F, 0x00000084, 0x00000083, 0x00000083, 
+0x00000083, 0x00050088, 0x0000000F, 0x00000085, 0x00000081, 0x00000084, 0x0003003E, 0x0000007F, 
+0x00000085, 0x0004003D, 0x00000049, 0x00000086, 0x0000004B, 0x0004003D, 0x0000000F, 0x00000087, 
+0x0000007F, 0x0007004F, 0x00000049, 0x00000088, 0x00000087, 0x00000087, 0x00000000, 0x00000001, 
+0x0005008E, 0x00000049, 0x0000008A, 0x00000088, 0x00000089, 0x00050050, 0x00000049, 0x0000008B, 
+0x00000089, 0x00000089, 0x00050081, 0x00000049, 0x0000008C, 0x0000008A, 0x0000008B, 0x0007000C, 
+0x00000049, 0x0000008D, 0x00000002, 0x00000025, 0x00000086, 0x0000008C, 0x0003003E, 0x0000004B, 
+0x0000008D, 0x0004003D, 0x00000049, 0x0000008E, 0x0000004E, 0x0004003D, 0x0000000F, 0x0000008F, 
+0x0000007F, 0x0007004F, 0x00000049, 0x00000090, 0x0000008F, 0x0000008F, 0x00000000, 0x00000001, 
+0x0005008E, 0x00000049, 0x00000091, 0x00000090, 0x00000089, 0x00050050, 0x00000049, 0x00000092, 
+0x00000089, 0x00000089, 0x00050081, 0x00000049, 0x00000093, 0x00000091, 0x00000092, 0x0007000C, 
+0x00000049, 0x00000094, 0x00000002, 0x00000028, 0x0000008E, 0x00000093, 0x0003003E, 0x0000004E, 
+0x00000094, 0x0004003D, 0x00000007, 0x00000095, 0x00000050, 0x00050041, 0x00000033, 0x00000097, 
+0x0000007F, 0x00000096, 0x0004003D, 0x00000007, 0x00000098, 0x00000097, 0x0007000C, 0x00000007, 
+0x00000099, 0x00000002, 0x00000025, 0x00000095, 0x00000098, 0x0003003E, 0x00000050, 0x00000099, 
+0x000200F9, 0x00000055, 0x000200F8, 0x00000055, 0x0004003D, 0x0000001D, 0x0000009A, 0x00000051, 
+0x00050080, 0x0000001D, 0x0000009B, 0x0000009A, 0x00000044, 0x0003003E, 0x00000051, 0x0000009B, 
+0x000200F9, 0x00000052, 0x000200F8, 0x00000054, 0x00050041, 0x000000A2, 0x000000A3, 0x000000A1, 
+0x00000068, 0x0004003D, 0x00000049, 0x000000A4, 0x000000A3, 0x0004006E, 0x0000009C, 0x000000A5, 
+0x000000A4, 0x0003003E, 0x0000009E, 0x000000A5, 0x0004003D, 0x00000049, 0x000000A7, 0x0000004B, 
+0x00050041, 0x000000A2, 0x000000A8, 0x000000A1, 0x00000068, 0x0004003D, 0x00000049, 0x000000A9, 
+0x000000A8, 0x00050085, 0x00000049, 0x000000AA, 0x000000A7, 0x000000A9, 0x0004006E, 0x0000009C, 
+0x000000AB, 0x000000AA, 0x0004003D, 0x0000009C, 0x000000AD, 0x0000009E, 0x00050050, 0x0000009C, 
+0x000000AE, 0x00000044, 0x00000044, 0x00050082, 0x0000009C, 0x000000AF, 0x000000AD, 0x000000AE, 
+0x0008000C, 0x0000009C, 0x000000B0, 0x00000002, 0x0000002D, 0x000000AB, 0x000000AC, 0x000000AF, 
+0x0003003E, 0x000000A6, 0x000000B0, 0x0004003D, 0x00000049, 0x000000B2, 0x0000004E, 0x00050041, 
+0x000000A2, 0x000000B3, 0x000000A1, 0x00000068, 0x0004003D, 0x00000049, 0x000000B4, 0x000000B3, 
+0x00050085, 0x00000049, 0x000000B5, 0x000000B2, 0x000000B4, 0x0004006E, 0x0000009C, 0x000000B6, 
+0x000000B5, 0x0004003D, 0x0000009C, 0x000000B7, 0x0000009E, 0x00050050, 0x0000009C, 0x000000B8, 
+0x00000044, 0x00000044, 0x00050082, 0x0000009C, 0x000000B9, 0x000000B7, 0x000000B8, 0x0008000C, 
+0x0000009C, 0x000000BA, 0x00000002, 0x0000002D, 0x000000B6, 0x000000AC, 0x000000B9, 0x0003003E, 
+0x000000B1, 0x000000BA, 0x00050041, 0x0000001E, 0x000000BD, 0x000000B1, 0x000000BC, 0x0004003D, 
+0x0000001D, 0x000000BE, 0x000000BD, 0x00050041, 0x0000001E, 0x000000BF, 0x000000A6, 0x000000BC, 
+0x0004003D, 0x0000001D, 0x000000C0, 0x000000BF, 0x00050082, 0x0000001D, 0x000000C1, 0x000000BE, 
+0x000000C0, 0x00050041, 0x0000001E, 0x000000C3, 0x000000B1, 0x000000C2, 0x0004003D, 0x0000001D, 
+0x000000C4, 0x000000C3, 0x00050041, 0x0000001E, 0x000000C5, 0x000000A6, 0x000000C2, 0x0004003D, 
+0x0000001D, 0x000000C6, 0x000000C5, 0x00050082, 0x0000001D, 0x000000C7, 0x000000C4, 0x000000C6, 
+0x0007000C, 0x0000001D, 0x000000C8, 0x00000002, 0x0000002A, 0x000000C1, 0x000000C7, 0x0003003E, 
+0x000000BB, 0x000000C8, 0x0004003D, 0x0000001D, 0x000000CA, 0x000000BB, 0x000500AD, 0x00000011, 
+0x000000CB, 0x000000CA, 0x00000020, 0x000300F7, 0x000000CE, 0x00000000, 0x000400FA, 0x000000CB, 
+0x000000CD, 0x000000D2, 0x000200F8, 0x000000CD, 0x0004003D, 0x0000001D, 0x000000CF, 0x000000BB, 
+0x0006000C, 0x0000001D, 0x000000D0, 0x00000002, 0x0000004A, 0x000000CF, 0x00050080, 0x0000001D, 
+0x000000D1, 0x000000D0, 0x00000044, 0x0003003E, 0x000000CC, 0x000000D1, 0x000200F9, 0x000000CE, 
+0x000200F8, 0x000000D2, 0x0003003E, 0x000000CC, 0x00000020, 0x000200F9, 0x000000CE, 0x000200F8, 
+0x000000CE, 0x0004003D, 0x0000001D, 0x000000D3, 0x000000CC, 0x00050041, 0x000000D4, 0x000000D5, 
+0x000000A1, 0x00000063, 0x0004003D, 0x00000009, 0x000000D6, 0x000000D5, 0x0004007C, 0x0000001D, 
+0x000000D7, 0x000000D6, 0x00050082, 0x0000001D, 0x000000D8, 0x000000D7, 0x00000044, 0x0007000C, 
+0x0000001D, 0x000000D9, 0x00000002, 0x00000027, 0x000000D3, 0x000000D8, 0x0003003E, 0x000000C9, 
+0x000000D9, 0x0004003D, 0x000000DC, 0x000000DF, 0x000000DE, 0x0004003D, 0x0000001D, 0x000000E0, 
+0x000000C9, 0x00040064, 0x000000DB, 0x000000E1, 0x000000DF, 0x00050067, 0x0000009C, 0x000000E2, 
+0x000000E1, 0x000000E0, 0x0003003E, 0x000000DA, 0x000000E2, 0x0004003D, 0x0000009C, 0x000000E4, 
+0x000000A6, 0x0004003D, 0x0000001D, 0x000000E5, 0x000000C9, 0x00050050, 0x0000009C, 0x000000E6, 
+0x000000E5, 0x000000E5, 0x000500C3, 0x0000009C, 0x000000E7, 0x000000E4, 0x000000E6, 0x0004003D, 
+0x0000009C, 0x000000E8, 0x000000DA, 0x00050050, 0x0000009C, 0x000000E9, 0x00000044, 0x00000044, 
+0x00050082, 0x0000009C, 0x000000EA, 0x000000E8, 0x000000E9, 0x0007000C, 0x0000009C, 0x000000EB, 
+0x00000002, 0x00000027, 0x000000E7, 0x000000EA, 0x0003003E, 0x000000E3, 0x000000EB, 0x0004003D, 
+0x0000009C, 0x000000ED, 0x000000B1, 0x0004003D, 0x0000001D, 0x000000EE, 0x000000C9, 0x00050050, 
+0x0000009C, 0x000000EF, 0x000000EE, 0x000000EE, 0x000500C3, 0x0000009C, 0x000000F0, 0x000000ED, 
+0x000000EF, 0x0004003D, 0x0000009C, 0x000000F1, 0x000000DA, 0x00050050, 0x0000009C, 0x000000F2, 
+0x00000044, 0x00000044, 0x00050082, 0x0000009C, 0x000000F3, 0x000000F1, 0x000000F2, 0x0007000C, 
+0x0000009C, 0x000000F4, 0x00000002, 0x00000027, 0x000000F0, 0x000000F3, 0x0003003E, 0x000000EC, 
+0x000000F4, 0x0004003D, 0x000000DC, 0x000000F6, 0x000000DE, 0x0004003D, 0x0000009C, 0x000000F7, 
+0x000000E3, 0x0004003D, 0x0000001D, 0x000000F8, 0x000000C9, 0x00040064, 0x000000DB, 0x000000F9, 
+0x000000F6, 0x0007005F, 0x00000008, 0x000000FA, 0x000000F9, 0x000000F7, 0x00000002, 0x000000F8, 
+0x00050051, 0x00000007, 0x000000FB, 0x000000FA, 0x00000000, 0x0004003D, 0x000000DC, 0x000000FC, 
+0x000000DE, 0x00050041, 0x0000001E, 0x000000FD, 0x000000EC, 0x000000BC, 0x0004003D, 0x0000001D, 
+0x000000FE, 0x000000FD, 0x00050041, 0x0000001E, 0x000000FF, 0x000000E3, 0x000000C2, 0x0004003D, 
+0x0000001D, 0x00000100, 0x000000FF, 0x00050050, 0x0000009C, 0x00000101, 0x000000FE, 0x00000100, 
+0x0004003D, 0x0000001D, 0x00000102, 0x000000C9, 0x00040064, 0x000000DB, 0x00000103, 0x000000FC, 
+0x0007005F, 0x00000008, 0x00000104, 0x00000103, 0x00000101, 0x00000002, 0x00000102, 0x00050051, 
+0x00000007, 0x00000105, 0x00000104, 0x00000000, 0x0007000C, 0x00000007, 0x00000106, 0x00000002, 
+0x00000028, 0x000000FB, 0x00000105, 0x0004003D, 0x000000DC, 0x00000107, 0x000000DE, 0x00050041, 
+0x0000001E, 0x00000108, 0x000000E3, 0x000000BC, 0x0004003D, 0x0000001D, 0x00000109, 0x00000108, 
+0x00050041, 0x0000001E, 0x0000010A, 0x000000EC, 0x000000C2, 0x0004003D, 0x0000001D, 0x0000010B, 
+0x0000010A, 0x00050050, 0x0000009C, 0x0000010C, 0x00000109, 0x0000010B, 0x0004003D, 0x0000001D, 
+0x0000010D, 0x000000C9, 0x00040064, 0x000000DB, 0x0000010E, 0x00000107, 0x0007005F, 0x00000008, 
+0x0000010F, 0x0000010E, 0x0000010C, 0x00000002, 0x0000010D, 0x00050051, 0x00000007, 0x00000110, 
+0x0000010F, 0x00000000, 0x0004003D, 0x000000DC, 0x00000111, 0x000000DE, 0x0004003D, 0x0000009C, 
+0x00000112, 0x000000EC, 0x0004003D, 0x0000001D, 0x00000113, 0x000000C9, 0x00040064, 0x000000DB, 
+0x00000114, 0x00000111, 0x0007005F, 0x00000008, 0x00000115, 0x00000114, 0x00000112, 0x00000002, 
+0x00000113, 0x00050051, 0x00000007, 0x00000116, 0x00000115, 0x00000000, 0x0007000C, 0x00000007, 
+0x00000117, 0x00000002, 0x00000028, 0x00000110, 0x00000116, 0x0007000C, 0x00000007, 0x00000118, 
+0x00000002, 0x00000028, 0x00000106, 0x00000117, 0x0003003E, 0x000000F5, 0x00000118, 0x0004003D, 
+0x00000007, 0x00000119, 0x00000050, 0x0004003D, 0x00000007, 0x0000011A, 0x000000F5, 0x000500BA, 
+0x00000011, 0x0000011B, 0x00000119, 0x0000011A, 0x000200FE, 0x0000011B, 0x00010038, 
+    };
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Header generated by Lumos Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_ParticleGPUfragspv_size = 2160;
+constexpr std::array<uint32_t, 540> spirv_ParticleGPUfragspv = {
+    0x07230203, 0x00010000, 0x0008000B, 0x0000005A, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+0x00000002, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
+0x0007000F, 0x00000004, 0x00000005, 0x6E69616D, 0x00000000, 0x00000022, 0x00000058, 0x00030010, 
+0x00000005, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 0x735F4252, 
+0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 0x63656A62, 0x00007374, 0x00090004, 0x415F4C47, 
+0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 0x5F656761, 0x70303234, 0x006B6361, 0x00040005, 
+0x00000005, 0x6E69616D, 0x00000000, 0x00090005, 0x0000000C, 0x6D6D6147, 0x726F4361, 0x74636572, 
+0x74786554, 0x28657275, 0x3B346676, 0x00000000, 0x00040005, 0x0000000B, 0x706D6173, 0x00000000, 
+0x00050005, 0x0000001F, 0x43786574, 0x756F6C6F, 0x00000072, 0x00040005, 0x00000020, 0x41544144, 
+0x00000000, 0x00040006, 0x00000020, 0x00000000, 0x00007675, 0x00050006, 0x00000020, 0x00000001, 
+0x6E656C62, 0x00000064, 0x00050006, 0x00000020, 0x00000002, 0x6F6C6F63, 0x00007275, 0x00040005, 
+0x00000022, 0x695F7366, 0x0000006E, 0x00050005, 0x0000002B, 0x65545F75, 0x72757478, 0x00000065, 
+0x00040005, 0x00000033, 0x61726170, 0x0000006D, 0x00050005, 0x0000003F, 0x43786574, 0x756F6C6F, 
+0x00003272, 0x00040005, 0x00000047, 0x61726170, 0x0000006D, 0x00040005, 0x00000058, 0x6F6C6F63, 
+0x00007275, 0x00030047, 0x00000020, 0x00000002, 0x00040047, 0x00000022, 0x0000001E, 0x00000000, 
+0x00040047, 0x0000002B, 0x00000021, 0x00000000, 0x00040047, 0x0000002B, 0x00000022, 0x00000001, 
+0x00040047, 0x00000058, 0x0000001E, 0x00000000, 0x00020013, 0x00000003, 0x00030021, 0x00000004, 
+0x00000003, 0x00030016, 0x00000007, 0x00000020, 0x00040017, 0x00000008, 0x00000007, 0x00000004, 
+0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00040021, 0x0000000A, 0x00000008, 0x00000009, 
+0x00040017, 0x0000000E, 0x00000007, 0x00000003, 0x0004002B, 0x00000007, 0x00000011, 0x400CCCCD, 
+0x0006002C, 0x0000000E, 0x00000012, 0x00000011, 0x00000011, 0x00000011, 0x00040015, 0x00000014, 
+0x00000020, 0x00000000, 0x0004002B, 0x00000014, 0x00000015, 0x00000003, 0x00040020, 0x00000016, 
+0x00000007, 0x00000007, 0x0005001E, 0x00000020, 0x00000008, 0x00000007, 0x00000008, 0x00040020, 
+0x00000021, 0x00000001, 0x00000020, 0x0004003B, 0x00000021, 0x00000022, 0x00000001, 0x00040015, 
+0x00000023, 0x00000020, 0x00000001, 0x0004002B, 0x00000023, 0x00000024, 0x00000002, 0x00040020, 
+0x00000025, 0x00000001, 0x00000008, 0x00090019, 0x00000028, 0x00000007, 0x00000001, 0x00000000, 
+0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x00000029, 0x00000028, 0x00040020, 
+0x0000002A, 0x00000000, 0x00000029, 0x0004003B, 0x0000002A, 0x0000002B, 0x00000000, 0x0004002B, 
+0x00000023, 0x0000002D, 0x00000000, 0x00040017, 0x0000002E, 0x00000007, 0x00000002, 0x0004002B, 
+0x00000023, 0x00000036, 0x00000001, 0x00040020, 0x00000037, 0x00000001, 0x00000007, 0x0004002B, 
+0x00000007, 0x0000003A, 0x00000000, 0x00020014, 0x0000003B, 0x0004002B, 0x00000007, 0x00000052, 
+0x3DCCCCCD, 0x00040020, 0x00000057, 0x00000003, 0x00000008, 0x0004003B, 0x00000057, 0x00000058, 
+0x00000003, 0x00050036, 0x00000003, 0x00000005, 0x00000000, 0x00000004, 0x000200F8, 0x00000006, 
+0x0004003B, 0x00000009, 0x0000001F, 0x00000007, 0x0004003B, 0x00000009, 0x00000033, 0x00000007, 
+0x0004003B, 0x00000009, 0x0000003F, 0x00000007, 0x0004003B, 0x00000009, 0x00000047, 0x00000007, 
+0x00050041, 0x00000025, 0x00000026, 0x00000022, 0x00000024, 0x0004003D, 0x00000008, 0x00000027, 
+0x00000026, 0x0004003D, 0x00000029, 0x0000002C, 0x0000002B, 0x00050041, 0x00000025, 0x0000002F, 
+0x00000022, 0x0000002D, 0x0004003D, 0x00000008, 0x00000030, 0x0000002F, 0x0007004F, 0x0000002E, 
+0x00000031, 0x00000030, 0x00000030, 0x00000000, 0x00000001, 0x00050057, 0x00000008, 0x00000032, 
+0x0000002C, 0x00000031, 0x0003003E, 0x00000033, 0x00000032, 0x00050039, 0x00000008, 0x00000034, 
+0x0000000C, 0x00000033, 0x00050085, 0x00000008, 0x00000035, 0x00000027, 0x00000034, 0x0003003E, 
+0x0000001F, 0x00000035, 0x00050041, 0x00000037, 0x00000038, 0x00000022, 0x00000036, 0x0004003D, 
+0x00000007, 0x00000039, 0x00000038, 0x000500BE, 0x0000003B, 0x0000003C, 0x00000039, 0x0000003A, 
+0x000300F7, 0x0000003E, 0x00000000, 0x000400FA, 0x0000003C, 0x0000003D, 0x0000003E, 0x000200F8, 
+0x0000003D, 0x00050041, 0x00000025, 0x00000040, 0x00000022, 0x00000024, 0x0004003D, 0x00000008, 
+0x00000041, 0x00000040, 0x0004003D, 0x00000029, 0x00000042, 0x0000002B, 0x00050041, 0x00000025, 
+0x00000043, 0x00000022, 0x0000002D, 0x0004003D, 0x00000008, 0x00000044, 0x00000043, 0x0007004F, 
+0x0000002E, 0x00000045, 0x00000044, 0x00000044, 0x00000002, 0x00000003, 0x00050057, 0x00000008, 
+0x00000046, 0x00000042, 0x00000045, 0x0003003E, 0x00000047, 0x00000046, 0x00050039, 0x00000008, 
+0x00000048, 0x0000000C, 0x00000047, 0x00050085, 0x00000008, 0x00000049, 0x00000041, 0x00000048, 
+0x0003003E, 0x0000003F, 0x00000049, 0x0004003D, 0x00000008, 0x0000004A, 0x0000001F, 0x0004003D, 
+0x00000008, 0x0000004B, 0x0000003F, 0x00050041, 0x00000037, 0x0000004C, 0x00000022, 0x00000036, 
+0x0004003D, 0x00000007, 0x0000004D, 0x0000004C, 0x00070050, 0x00000008, 0x0000004E, 0x0000004D, 
+0x0000004D, 0x0000004D, 0x0000004D, 0x0008000C, 0x00000008, 0x0000004F, 0x00000002, 0x0000002E, 
+0x0000004A, 0x0000004B, 0x0000004E, 0x0003003E, 0x0000001F, 0x0000004F, 0x000200F9, 0x0000003E, 
+0x000200F8, 0x0000003E, 0x00050041, 0x00000016, 0x00000050, 0x0000001F, 0x00000015, 0x0004003D, 
+0x00000007, 0x00000051, 0x00000050, 0x000500B8, 0x0000003B, 0x00000053, 0x00000051, 0x00000052, 
+0x000300F7, 0x00000055, 0x00000000, 0x000400FA, 0x00000053, 0x00000054, 0x00000055, 0x000200F8, 
+0x00000054, 0x000100FC, 0x000200F8, 0x00000055, 0x0004003D, 0x00000008, 0x00000059, 0x0000001F, 
+0x0003003E, 0x00000058, 0x00000059, 0x000100FD, 0x00010038, 0x00050036, 0x00000008, 0x0000000C, 
+0x00000000, 0x0000000A, 0x00030037, 0x00000009, 0x0000000B, 0x000200F8, 0x0000000D, 0x0004003D, 
+0x00000008, 0x0000000F, 0x0000000B, 0x0008004F, 0x0000000E, 0x00000010, 0x0000000F, 0x0000000F, 
+0x00000000, 0x00000001, 0x00000002, 0x0007000C, 0x0000000E, 0x00000013, 0x00000002, 0x0000001A, 
+0x00000010, 0x00000012, 0x00050041, 0x00000016, 0x00000017, 0x0000000B, 0x00000015, 0x0004003D, 
+0x00000007, 0x00000018, 0x00000017, 0x00050051, 0x00000007, 0x00000019, 0x00000013, 0x00000000, 
+0x00050051, 0x00000007, 0x0000001A, 0x00000013, 0x00000001, 0x00050051, 0x00000007, 0x0000001B, 
+0x00000013, 0x00000002, 0x00070050, 0x00000008, 0x0000001C, 0x00000019, 0x0000001A, 0x0000001B, 
+0x00000018, 0x000200FE, 0x0000001C, 0x00010038, 
+    };
\ No newline at end of file
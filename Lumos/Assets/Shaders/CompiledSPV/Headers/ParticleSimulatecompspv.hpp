@@ -0,0 +1,608 @@
+// Header generated by Lumos Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_ParticleSimulatecompspv_size = 19180;
+constexpr std::array<uint32_t, 4795> spirv_ParticleSimulatecompspv = {
+    0x07230203, 0x00010000, 0x0008000B, 0x000002FF, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+0x00000002, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
+0x0006000F, 0x00000005, 0x00000005, 0x6E69616D, 0x00000000, 0x000002CB, 0x00060010, 0x00000005, 
+0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 
+0x415F4C47, 0x735F4252, 0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 0x63656A62, 0x00007374, 
+0x00090004, 0x415F4C47, 0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 0x5F656761, 0x70303234, 
+0x006B6361, 0x00040005, 0x00000005, 0x6E69616D, 0x00000000, 0x00050005, 0x0000000B, 0x68736148, 
+0x3B317528, 0x00000000, 0x00030005, 0x0000000A, 0x00000078, 0x00060005, 0x00000010, 0x646E6152, 
+0x61526D6F, 0x2865676E, 0x003B3175, 0x00040005, 0x0000000F, 0x74617473, 0x00000065, 0x00050005, 
+0x00000014, 0x74696D45, 0x3B317528, 0x00000000, 0x00040005, 0x00000013, 0x65646E69, 0x00000078, 
+0x00070005, 0x0000001B, 0x74706544, 0x576F5468, 0x646C726F, 0x32667628, 0x0000003B, 0x00030005, 
+0x0000001A, 0x00007675, 0x00080005, 0x00000022, 0x6C6C6F43, 0x28656469, 0x3B336676, 0x3B336676, 
+0x3B336676, 0x00000000, 0x00050005, 0x0000001F, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00050005, 
+0x00000020, 0x6F6C6576, 0x79746963, 0x00000000, 0x00050005, 0x00000021, 0x76657270, 0x73756F69, 
+0x00000000, 0x00060005, 0x00000025, 0x756D6953, 0x6574616C, 0x3B317528, 0x00000000, 0x00040005, 
+0x00000024, 0x65646E69, 0x00000078, 0x00050005, 0x00000028, 0x74726F53, 0x28646150, 0x003B3175, 
+0x00040005, 0x00000027, 0x65646E69, 0x00000078, 0x00050005, 0x0000002B, 0x74726F53, 0x3B317528, 
+0x00000000, 0x00040005, 0x0000002A, 0x65646E69, 0x00000078, 0x00040005, 0x0000002D, 0x696E6946, 
+0x00286873, 0x00040005, 0x00000047, 0x61726170, 0x0000006D, 0x00050005, 0x00000057, 0x68737550, 
+0x736E6F43, 0x00007374, 0x00050006, 0x00000057, 0x00000000, 0x67617453, 0x00000065, 0x00050006, 
+0x00000057, 0x00000001, 0x72727543, 0x00746E65, 0x00060006, 0x00000057, 0x00000002, 0x77617053, 
+0x756F436E, 0x0000746E, 0x00070006, 0x00000057, 0x00000003, 0x74726F53, 0x61706143, 0x79746963, 
+0x00000000, 0x00060006, 0x00000057, 0x00000004, 0x74726F53, 0x636F6C42, 0x0000006B, 0x00060006, 
+0x00000057, 0x00000005, 0x74726F53, 0x70657453, 0x00000000, 0x00050006, 0x00000057, 0x00000006, 
+0x64656553, 0x00000000, 0x00050006, 0x00000057, 0x00000007, 0x64646150, 0x00676E69, 0x00040005, 
+0x00000059, 0x75505F75, 0x00006873, 0x00040005, 0x00000064, 0x64616564, 0x00000000, 0x00050005, 
+0x00000067, 0x6E756F43, 0x73726574, 0x00000000, 0x00060006, 0x00000067, 0x00000000, 0x74726556, 
+0x6F437865, 0x00746E75, 0x00070006, 0x00000067, 0x00000001, 0x74736E49, 0x65636E61, 0x6E756F43, 
+0x00000074, 0x00060006, 0x00000067, 0x00000002, 0x73726946, 0x72655674, 0x00786574, 0x00070006, 
+0x00000067, 0x00000003, 0x73726946, 0x736E4974, 0x636E6174, 0x00000065, 0x00060006, 0x00000067, 
+0x00000004, 0x76696C41, 0x756F4365, 0x0000746E, 0x00060006, 0x00000067, 0x00000005, 0x64616544, 
+0x6E756F43, 0x00000074, 0x00050006, 0x00000067, 0x00000006, 0x64646150, 0x00676E69, 0x00050005, 
+0x00000069, 0x6F435F75, 0x65746E75, 0x00007372, 0x00040005, 0x0000007B, 0x746F6C73, 0x00000000, 
+0x00050005, 0x0000007D, 0x64616544, 0x7473694C, 0x00000000, 0x00050006, 0x0000007D, 0x00000000, 
+0x61746144, 0x00000000, 0x00040005, 0x0000007F, 0x65445F75, 0x00006461, 0x00040005, 0x00000084, 
+0x74617473, 0x00000065, 0x00040005, 0x00000088, 0x61726170, 0x0000006D, 0x00040005, 0x0000008C, 
+0x61726170, 0x0000006D, 0x00050005, 0x0000008F, 0x74726150, 0x656C6369, 0x00000000, 0x00070006, 
+0x0000008F, 0x00000000, 0x69736F50, 0x6E6F6974, 0x6566694C, 0x00000000, 0x00070006, 0x0000008F, 
+0x00000001, 0x6F6C6556, 0x79746963, 0x68706C41, 0x00000061, 0x00050005, 0x00000091, 0x74726170, 
+0x656C6369, 0x00000000, 0x00050005, 0x00000093, 0x74696D45, 0x55726574, 0x00004F42, 0x00060006, 
+0x00000093, 0x00000000, 0x77656956, 0x6A6F7250, 0x00000000, 0x00060006, 0x00000093, 0x00000001, 
+0x56766E49, 0x50776569, 0x006A6F72, 0x00060006, 0x00000093, 0x00000002, 0x69736F50, 0x6E6F6974, 
+0x00000000, 0x00050006, 0x00000093, 0x00000003, 0x65727053, 0x00006461, 0x00060006, 0x00000093, 
+0x00000004, 0x6F6C6556, 0x79746963, 0x00000000, 0x00070006, 0x00000093, 0x00000005, 0x6F6C6556, 
+0x79746963, 0x65727053, 0x00006461, 0x00050006, 0x00000093, 0x00000006, 0x76617247, 0x00797469, 
+0x00070006, 0x00000093, 0x00000007, 0x656D6143, 0x6F506172, 0x69746973, 0x00006E6F, 0x00050006, 
+0x00000093, 0x00000008, 0x65646146, 0x00000000, 0x00060006, 0x00000093, 0x00000009, 0x74706544, 
+0x7A695368, 0x00000065, 0x00050005, 0x00000095, 0x6D455F75, 0x65747469, 0x00000072, 0x00040005, 
+0x0000009E, 0x61726170, 0x0000006D, 0x00040005, 0x000000A2, 0x61726170, 0x0000006D, 0x00040005, 
+0x000000A6, 0x61726170, 0x0000006D, 0x00040005, 0x000000BB, 0x61726170, 0x0000006D, 0x00040005, 
+0x000000C8, 0x61726170, 0x0000006D, 0x00040005, 0x000000CC, 0x61726170, 0x0000006D, 0x00040005, 
+0x000000D0, 0x61726170, 0x0000006D, 0x00050005, 0x000000E0, 0x74726150, 0x656C6369, 0x00000000, 
+0x00070006, 0x000000E0, 0x00000000, 0x69736F50, 0x6E6F6974, 0x6566694C, 0x00000000, 0x00070006, 
+0x000000E0, 0x00000001, 0x6F6C6556, 0x79746963, 0x68706C41, 0x00000061, 0x00050005, 0x000000E2, 
+0x74726150, 0x656C6369, 0x00000073, 0x00050006, 0x000000E2, 0x00000000, 0x61746144, 0x00000000, 
+0x00050005, 0x000000E4, 0x61505F75, 0x63697472, 0x0073656C, 0x00050005, 0x000000ED, 0x76696C61, 
+0x646E4965, 0x00007865, 0x00050005, 0x000000F4, 0x76696C41, 0x73694C65, 0x00007374, 0x00050006, 
+0x000000F4, 0x00000000, 0x61746144, 0x00000000, 0x00040005, 0x000000F6, 0x6C415F75, 0x00657669, 
+0x00040005, 0x00000103, 0x6C726F77, 0x00000064, 0x00040005, 0x0000010E, 0x65445F75, 0x00687470, 
+0x00040005, 0x00000120, 0x70696C63, 0x00000000, 0x00030005, 0x0000012F, 0x0063646E, 0x00030005, 
+0x00000136, 0x00007675, 0x00040005, 0x0000014D, 0x66727573, 0x00656361, 0x00040005, 0x0000014E, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000151, 0x656D6163, 0x00006172, 0x00060005, 0x00000156, 
+0x66727573, 0x44656361, 0x61747369, 0x0065636E, 0x00060005, 0x0000015B, 0x74736964, 0x65636E61, 
+0x69686542, 0x0000646E, 0x00040005, 0x0000016F, 0x68676972, 0x00000074, 0x00040005, 0x00000176, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000017A, 0x6E776F64, 0x00000000, 0x00040005, 0x00000180, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000184, 0x6D726F6E, 0x00006C61, 0x00040005, 0x000001A9, 
+0x746F6C73, 0x00000000, 0x00050005, 0x000001B3, 0x74726170, 0x656C6369, 0x00000000, 0x00030005, 
+0x000001BB, 0x00007464, 0x00040005, 0x000001BE, 0x6566696C, 0x00000000, 0x00050005, 0x000001CC, 
+0x6F6C6576, 0x79746963, 0x00000000, 0x00050005, 0x000001D6, 0x76657270, 0x73756F69, 0x00000000, 
+0x00050005, 0x000001DA, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00040005, 0x000001E5, 0x61726170, 
+0x0000006D, 0x00040005, 0x000001E7, 0x61726170, 0x0000006D, 0x00040005, 0x000001E9, 0x61726170, 
+0x0000006D, 0x00040005, 0x000001EE, 0x68706C61, 0x00000061, 0x00060005, 0x000001F1, 0x74726170, 
+0x656C6369, 0x6566694C, 0x00000000, 0x00050005, 0x0000022D, 0x61436F74, 0x6172656D, 0x00000000, 
+0x00030005, 0x00000233, 0x0079656B, 0x00040005, 0x00000241, 0x7478656E, 0x00000000, 0x00050005, 
+0x00000245, 0x76696C61, 0x646E4965, 0x00007865, 0x00040005, 0x00000253, 0x7478656E, 0x00000000, 
+0x00040005, 0x0000026F, 0x6568746F, 0x00000072, 0x00040005, 0x00000282, 0x65736162, 0x00000000, 
+0x00030005, 0x0000028A, 0x00000061, 0x00030005, 0x00000290, 0x00000062, 0x00050005, 0x00000297, 
+0x63736564, 0x69646E65, 0x0000676E, 0x00040005, 0x000002B9, 0x7478656E, 0x00000000, 0x00040005, 
+0x000002C8, 0x65646E69, 0x00000078, 0x00080005, 0x000002CB, 0x475F6C67, 0x61626F6C, 0x766E496C, 
+0x7461636F, 0x496E6F69, 0x00000044, 0x00040005, 0x000002D4, 0x61726170, 0x0000006D, 0x00040005, 
+0x000002DD, 0x61726170, 0x0000006D, 0x00040005, 0x000002E6, 0x61726170, 0x0000006D, 0x00040005, 
+0x000002EF, 0x61726170, 0x0000006D, 0x00030047, 0x00000057, 0x00000002, 0x00050048, 0x00000057, 
+0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000057, 0x00000001, 0x00000023, 0x00000004, 
+0x00050048, 0x00000057, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000057, 0x00000003, 
+0x00000023, 0x0000000C, 0x00050048, 0x00000057, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 
+0x00000057, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000057, 0x00000006, 0x00000023, 
+0x00000018, 0x00050048, 0x00000057, 0x00000007, 0x00000023, 0x0000001C, 0x00040047, 0x00000066, 
+0x00000006, 0x00000004, 0x00030047, 0x00000067, 0x00000003, 0x00050048, 0x00000067, 0x00000000, 
+0x00000023, 0x00000000, 0x00050048, 0x00000067, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 
+0x00000067, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000067, 0x00000003, 0x00000023, 
+0x0000000C, 0x00050048, 0x00000067, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000067, 
+0x00000005, 0x00000023, 0x00000018, 0x00050048, 0x00000067, 0x00000006, 0x00000023, 0x0000001C, 
+0x00040047, 0x00000069, 0x00000021, 0x00000003, 0x00040047, 0x00000069, 0x00000022, 0x00000000, 
+0x00040047, 0x0000007C, 0x00000006, 0x00000004, 0x00030047, 0x0000007D, 0x00000003, 0x00050048, 
+0x0000007D, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x0000007F, 0x00000021, 0x00000001, 
+0x00040047, 0x0000007F, 0x00000022, 0x00000000, 0x00030047, 0x00000093, 0x00000002, 0x00040048, 
+0x00000093, 0x00000000, 0x00000005, 0x00050048, 0x00000093, 0x00000000, 0x00000007, 0x00000010, 
+0x00050048, 0x00000093, 0x00000000, 0x00000023, 0x00000000, 0x00040048, 0x00000093, 0x00000001, 
+0x00000005, 0x00050048, 0x00000093, 0x00000001, 0x00000007, 0x00000010, 0x00050048, 0x00000093, 
+0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x00000093, 0x00000002, 0x00000023, 0x00000080, 
+0x00050048, 0x00000093, 0x00000003, 0x00000023, 0x00000090, 0x00050048, 0x00000093, 0x00000004, 
+0x00000023, 0x000000A0, 0x00050048, 0x00000093, 0x00000005, 0x00000023, 0x000000B0, 0x00050048, 
+0x00000093, 0x00000006, 0x00000023, 0x000000C0, 0x00050048, 0x00000093, 0x00000007, 0x00000023, 
+0x000000D0, 0x00050048, 0x00000093, 0x00000008, 0x00000023, 0x000000E0, 0x00050048, 0x00000093, 
+0x00000009, 0x00000023, 0x000000F0, 0x00040047, 0x00000095, 0x00000021, 0x00000004, 0x00040047, 
+0x00000095, 0x00000022, 0x00000000, 0x00050048, 0x000000E0, 0x00000000, 0x00000023, 0x00000000, 
+0x00050048, 0x000000E0, 0x00000001, 0x00000023, 0x00000010, 0x00040047, 0x000000E1, 0x00000006, 
+0x00000020, 0x00030047, 0x000000E2, 0x00000003, 0x00050048, 0x000000E2, 0x00000000, 0x00000023, 
+0x00000000, 0x00040047, 0x000000E4, 0x00000021, 0x00000000, 0x00040047, 0x000000E4, 0x00000022, 
+0x00000000, 0x00040047, 0x000000F3, 0x00000006, 0x00000008, 0x00030047, 0x000000F4, 0x00000003, 
+0x00050048, 0x000000F4, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x000000F6, 0x00000021, 
+0x00000002, 0x00040047, 0x000000F6, 0x00000022, 0x00000000, 0x00040047, 0x0000010E, 0x00000021, 
+0x00000005, 0x00040047, 0x0000010E, 0x00000022, 0x00000000, 0x00040047, 0x000002CB, 0x0000000B, 
+0x0000001C, 0x00040047, 0x000002FE, 0x0000000B, 0x00000019, 0x00020013, 0x00000003, 0x00030021, 
+0x00000004, 0x00000003, 0x00040015, 0x00000007, 0x00000020, 0x00000000, 0x00040020, 0x00000008, 
+0x00000007, 0x00000007, 0x00040021, 0x00000009, 0x00000007, 0x00000008, 0x00030016, 0x0000000D, 
+0x00000020, 0x00040021, 0x0000000E, 0x0000000D, 0x00000008, 0x00040021, 0x00000012, 0x00000003, 
+0x00000008, 0x00040017, 0x00000016, 0x0000000D, 0x00000002, 0x00040020, 0x00000017, 0x00000007, 
+0x00000016, 0x00040017, 0x00000018, 0x0000000D, 0x00000003, 0x00040021, 0x00000019, 0x00000018, 
+0x00000017, 0x00040020, 0x0000001D, 0x00000007, 0x00000018, 0x00060021, 0x0000001E, 0x00000003, 
+0x0000001D, 0x0000001D, 0x0000001D, 0x00040015, 0x00000030, 0x00000020, 0x00000001, 0x0004002B, 
+0x00000030, 0x00000031, 0x00000010, 0x0004002B, 0x00000007, 0x00000035, 0x7FEB352D, 0x0004002B, 
+0x00000030, 0x00000039, 0x0000000F, 0x0004002B, 0x00000007, 0x0000003D, 0x846CA68B, 0x0004002B, 
+0x00000030, 0x0000004B, 0x00000008, 0x0004002B, 0x0000000D, 0x0000004E, 0x33800000, 0x0004002B, 
+0x0000000D, 0x00000050, 0x40000000, 0x0004002B, 0x0000000D, 0x00000052, 0x3F800000, 0x000A001E, 
+0x00000057, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
+0x00000007, 0x00040020, 0x00000058, 0x00000009, 0x00000057, 0x0004003B, 0x00000058, 0x00000059, 
+0x00000009, 0x0004002B, 0x00000030, 0x0000005A, 0x00000002, 0x00040020, 0x0000005B, 0x00000009, 
+0x00000007, 0x00020014, 0x0000005E, 0x00040020, 0x00000063, 0x00000007, 0x00000030, 0x0004002B, 
+0x00000007, 0x00000065, 0x00000002, 0x0004001C, 0x00000066, 0x00000007, 0x00000065, 0x0009001E, 
+0x00000067, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000066, 0x00000030, 0x00000007, 
+0x00040020, 0x00000068, 0x00000002, 0x00000067, 0x0004003B, 0x00000068, 0x00000069, 0x00000002, 
+0x0004002B, 0x00000030, 0x0000006A, 0x00000005, 0x00040020, 0x0000006B, 0x00000002, 0x00000030, 
+0x0004002B, 0x00000030, 0x0000006D, 0xFFFFFFFF, 0x0004002B, 0x00000007, 0x0000006E, 0x00000001, 
+0x0004002B, 0x00000007, 0x0000006F, 0x00000000, 0x0004002B, 0x00000030, 0x00000071, 0x00000001, 
+0x0004002B, 0x00000030, 0x00000074, 0x00000000, 0x0003001D, 0x0000007C, 0x00000007, 0x0003001E, 
+0x0000007D, 0x0000007C, 0x00040020, 0x0000007E, 0x00000002, 0x0000007D, 0x0004003B, 0x0000007E, 
+0x0000007F, 0x00000002, 0x00040020, 0x00000081, 0x00000002, 0x00000007, 0x0004002B, 0x00000030, 
+0x00000085, 0x00000006, 0x00040017, 0x0000008E, 0x0000000D, 0x00000004, 0x0004001E, 0x0000008F, 
+0x0000008E, 0x0000008E, 0x00040020, 0x00000090, 0x00000007, 0x0000008F, 0x00040018, 0x00000092, 
+0x0000008E, 0x00000004, 0x000C001E, 0x00000093, 0x00000092, 0x00000092, 0x0000008E, 0x0000008E, 
+0x0000008E, 0x0000008E, 0x0000008E, 0x0000008E, 0x0000008E, 0x0000008E, 0x00040020, 0x00000094, 
+0x00000002, 0x00000093, 0x0004003B, 0x00000094, 0x00000095, 0x00000002, 0x00040020, 0x00000096, 
+0x00000002, 0x0000008E, 0x0004002B, 0x00000030, 0x0000009A, 0x00000003, 0x00040020, 0x000000AD, 
+0x00000007, 0x0000000D, 0x0004002B, 0x00000030, 0x000000B4, 0x00000004, 0x0004002B, 0x00000007, 
+0x000000B5, 0x00000003, 0x00040020, 0x000000B6, 0x00000002, 0x0000000D, 0x0004001E, 0x000000E0, 
+0x0000008E, 0x0000008E, 0x0003001D, 0x000000E1, 0x000000E0, 0x0003001E, 0x000000E2, 0x000000E1, 
+0x00040020, 0x000000E3, 0x00000002, 0x000000E2, 0x0004003B, 0x000000E3, 0x000000E4, 0x00000002, 
+0x00040020, 0x000000E7, 0x00000002, 0x000000E0, 0x00040017, 0x000000F2, 0x00000007, 0x00000002, 
+0x0003001D, 0x000000F3, 0x000000F2, 0x0003001E, 0x000000F4, 0x000000F3, 0x00040020, 0x000000F5, 
+0x00000002, 0x000000F4, 0x0004003B, 0x000000F5, 0x000000F6, 0x00000002, 0x00040020, 0x00000100, 
+0x00000002, 0x000000F2, 0x00040020, 0x00000102, 0x00000007, 0x0000008E, 0x00040020, 0x00000104, 
+0x00000002, 0x00000092, 0x00090019, 0x0000010B, 0x0000000D, 0x00000001, 0x00000000, 0x00000000, 
+0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000010C, 0x0000010B, 0x00040020, 0x0000010D, 
+0x00000000, 0x0000010C, 0x0004003B, 0x0000010D, 0x0000010E, 0x00000000, 0x0004002B, 0x0000000D, 
+0x00000111, 0x00000000, 0x0004002B, 0x0000000D, 0x00000139, 0x3F000000, 0x0005002C, 0x00000016, 
+0x0000013E, 0x00000111, 0x00000111, 0x00040017, 0x0000013F, 0x0000005E, 0x00000002, 0x0005002C, 
+0x00000016, 0x00000146, 0x00000052, 0x00000052, 0x0004002B, 0x00000030, 0x00000152, 0x00000007, 
+0x0004002B, 0x00000030, 0x00000171, 0x00000009, 0x0005002C, 0x000000F2, 0x0000026D, 0x0000006F, 
+0x0000006F, 0x00040020, 0x00000289, 0x00000007, 0x000000F2, 0x00040020, 0x00000296, 0x00000007, 
+0x0000005E, 0x0004002B, 0x00000007, 0x000002BD, 0x00000006, 0x00040017, 0x000002C9, 0x00000007, 
+0x00000003, 0x00040020, 0x000002CA, 0x00000001, 0x000002C9, 0x0004003B, 0x000002CA, 0x000002CB, 
+0x00000001, 0x00040020, 0x000002CC, 0x00000001, 0x00000007, 0x0004002B, 0x00000007, 0x000002F5, 
+0x00000004, 0x0004002B, 0x00000007, 0x000002FD, 0x00000040, 0x0006002C, 0x000002C9, 0x000002FE, 
+0x000002FD, 0x0000006E, 0x0000006E, 0x00050036, 0x00000003, 0x00000005, 0x00000000, 0x00000004, 
+0x000200F8, 0x00000006, 0x0004003B, 0x00000008, 0x000002C8, 0x00000007, 0x0004003B, 0x00000008, 
+0x000002D4, 0x00000007, 0x0004003B, 0x00000008, 0x000002DD, 0x00000007, 0x0004003B, 0x00000008, 
+0x000002E6, 0x00000007, 0x0004003B, 0x00000008, 0x000002EF, 0x00000007, 0x00050041, 0x000002CC, 
+0x000002CD, 0x000002CB, 0x0000006F, 0x0004003D, 0x00000007, 0x000002CE, 0x000002CD, 0x0003003E, 
+0x000002C8, 0x000002CE, 0x00050041, 0x0000005B, 0x000002CF, 0x00000059, 0x00000074, 0x0004003D, 
+0x00000007, 0x000002D0, 0x000002CF, 0x000500AA, 0x0000005E, 0x000002D1, 0x000002D0, 0x0000006F, 
+0x000300F7, 0x000002D3, 0x00000000, 0x000400FA, 0x000002D1, 0x000002D2, 0x000002D7, 0x000200F8, 
+0x000002D2, 0x0004003D, 0x00000007, 0x000002D5, 0x000002C8, 0x0003003E, 0x000002D4, 0x000002D5, 
+0x00050039, 0x00000003, 0x000002D6, 0x00000014, 0x000002D4, 0x000200F9, 0x000002D3, 0x000200F8, 
+0x000002D7, 0x00050041, 0x0000005B, 0x000002D8, 0x00000059, 0x00000074, 0x0004003D, 0x00000007, 
+0x000002D9, 0x000002D8, 0x000500AA, 0x0000005E, 0x000002DA, 0x000002D9, 0x0000006E, 0x000300F7, 
+0x000002DC, 0x00000000, 0x000400FA, 0x000002DA, 0x000002DB, 0x000002E0, 0x000200F8, 0x000002DB, 
+0x0004003D, 0x00000007, 0x000002DE, 0x000002C8, 0x0003003E, 0x000002DD, 0x000002DE, 0x00050039, 
+0x00000003, 0x000002DF, 0x00000025, 0x000002DD, 0x000200F9, 0x000002DC, 0x000200F8, 0x000002E0, 
+0x00050041, 0x0000005B, 0x000002E1, 0x00000059, 0x00000074, 0x0004003D, 0x00000007, 0x000002E2, 
+0x000002E1, 0x000500AA, 0x0000005E, 0x000002E3, 0x000002E2, 0x00000065, 0x000300F7, 0x000002E5, 
+0x00000000, 0x000400FA, 0x000002E3, 0x000002E4, 0x000002E9, 0x000200F8, 0x000002E4, 0x0004003D, 
+0x00000007, 0x000002E7, 0x000002C8, 0x0003003E, 0x000002E6, 0x000002E7, 0x00050039, 0x00000003, 
+0x000002E8, 0x00000028, 0x000002E6, 0x000200F9, 0x000002E5, 0x000200F8, 0x000002E9, 0x00050041, 
+0x0000005B, 0x000002EA, 0x00000059, 0x00000074, 0x0004003D, 0x00000007, 0x000002EB, 0x000002EA, 
+0x000500AA, 0x0000005E, 0x000002EC, 0x000002EB, 0x000000B5, 0x000300F7, 0x000002EE, 0x00000000, 
+0x000400FA, 0x000002EC, 0x000002ED, 0x000002F2, 0x000200F8, 0x000002ED, 0x0004003D, 0x00000007, 
+0x000002F0, 0x000002C8, 0x0003003E, 0x000002EF, 0x000002F0, 0x00050039, 0x00000003, 0x000002F1, 
+0x0000002B, 0x000002EF, 0x000200F9, 0x000002EE, 0x000200F8, 0x000002F2, 0x00050041, 0x0000005B, 
+0x000002F3, 0x00000059, 0x00000074, 0x0004003D, 0x00000007, 0x000002F4, 0x000002F3, 0x000500AA, 
+0x0000005E, 0x000002F6, 0x000002F4, 0x000002F5, 0x0004003D, 0x00000007, 0x000002F7, 0x000002C8, 
+0x000500AA, 0x0000005E, 0x000002F8, 0x000002F7, 0x0000006F, 0x000500A7, 0x0000005E, 0x000002F9, 
+0x000002F6, 0x000002F8, 0x000300F7, 0x000002FB, 0x00000000, 0x000400FA, 0x000002F9, 0x000002FA, 
+0x000002FB, 0x000200F8, 0x000002FA, 0x00040039, 0x00000003, 0x000002FC, 0x0000002D, 0x000200F9, 
+0x000002FB, 0x000200F8, 0x000002FB, 0x000200F9, 0x000002EE, 0x000200F8, 0x000002EE, 0x000200F9, 
+0x000002E5, 0x000200F8, 0x000002E5, 0x000200F9, 0x000002DC, 0x000200F8, 0x000002DC, 0x000200F9, 
+0x000002D3, 0x000200F8, 0x000002D3, 0x000100FD, 0x00010038, 0x00050036, 0x00000007, 0x0000000B, 
+0x00000000, 0x00000009, 0x00030037, 0x00000008, 0x0000000A, 0x000200F8, 0x0000000C, 0x0004003D, 
+0x00000007, 0x0000002F, 0x0000000A, 0x000500C2, 0x00000007, 0x00000032, 0x0000002F, 0x00000031, 
+0x0004003D, 0x00000007, 0x00000033, 0x0000000A, 0x000500C6, 0x00000007, 0x00000034, 0x00000033, 
+0x00000032, 0x0003003E, 0x0000000A, 0x00000034, 0x0004003D, 0x00000007, 0x00000036, 0x0000000A, 
+0x00050084, 0x00000007, 0x00000037, 0x00000036, 0x00000035, 0x0003003E, 0x0000000A, 0x00000037, 
+0x0004003D, 0x00000007, 0x00000038, 0x0000000A, 0x000500C2, 0x00000007, 0x0000003A, 0x00000038, 
+0x00000039, 0x0004003D, 0x00000007, 0x0000003B, 0x0000000A, 0x000500C6, 0x00000007, 0x0000003C, 
+0x0000003B, 0x0000003A, 0x0003003E, 0x0000000A, 0x0000003C, 0x0004003D, 0x00000007, 0x0000003E, 
+0x0000000A, 0x00050084, 0x00000007, 0x0000003F, 0x0000003E, 0x0000003D, 0x0003003E, 0x0000000A, 
+0x0000003F, 0x0004003D, 0x00000007, 0x00000040, 0x0000000A, 0x000500C2, 0x00000007, 0x00000041, 
+0x00000040, 0x00000031, 0x0004003D, 0x00000007, 0x00000042, 0x0000000A, 0x000500C6, 0x00000007, 
+0x00000043, 0x00000042, 0x00000041, 0x0003003E, 0x0000000A, 0x00000043, 0x0004003D, 0x00000007, 
+0x00000044, 0x0000000A, 0x000200FE, 0x00000044, 0x00010038, 0x00050036, 0x0000000D, 0x00000010, 
+0x00000000, 0x0000000E, 0x00030037, 0x00000008, 0x0000000F, 0x000200F8, 0x00000011, 0x0004003B, 
+0x00000008, 0x00000047, 0x00000007, 0x0004003D, 0x00000007, 0x00000048, 0x0000000F, 0x0003003E, 
+0x00000047, 0x00000048, 0x00050039, 0x00000007, 0x00000049, 0x0000000B, 0x00000047, 0x0003003E, 
+0x0000000F, 0x00000049, 0x0004003D, 0x00000007, 0x0000004A, 0x0000000F, 0x000500C2, 0x00000007, 
+0x0000004C, 0x0000004A, 0x0000004B, 0x00040070, 0x0000000D, 0x0000004D, 0x0000004C, 0x00050085, 
+0x0000000D, 0x0000004F, 0x0000004D, 0x0000004E, 0x00050085, 0x0000000D, 0x00000051, 0x0000004F, 
+0x00000050, 0x00050083, 0x0000000D, 0x00000053, 0x00000051, 0x00000052, 0x000200FE, 0x00000053, 
+0x00010038, 0x00050036, 0x00000003, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000008, 
+0x00000013, 0x000200F8, 0x00000015, 0x0004003B, 0x00000063, 0x00000064, 0x00000007, 0x0004003B, 
+0x00000008, 0x0000007B, 0x00000007, 0x0004003B, 0x00000008, 0x00000084, 0x00000007, 0x0004003B, 
+0x00000008, 0x00000088, 0x00000007, 0x0004003B, 0x00000008, 0x0000008C, 0x00000007, 0x0004003B, 
+0x00000090, 0x00000091, 0x00000007, 0x0004003B, 0x00000008, 0x0000009E, 0x00000007, 0x0004003B, 
+0x00000008, 0x000000A2, 0x00000007, 0x0004003B, 0x00000008, 0x000000A6, 0x00000007, 0x0004003B, 
+0x00000008, 0x000000BB, 0x00000007, 0x0004003B, 0x00000008, 0x000000C8, 0x00000007, 0x0004003B, 
+0x00000008, 0x000000CC, 0x00000007, 0x0004003B, 0x00000008, 0x000000D0, 0x00000007, 0x0004003B, 
+0x00000008, 0x000000ED, 0x00000007, 0x0004003D, 0x00000007, 0x00000056, 0x00000013, 0x00050041, 
+0x0000005B, 0x0000005C, 0x00000059, 0x0000005A, 0x0004003D, 0x00000007, 0x0000005D, 0x0000005C, 
+0x000500AE, 0x0000005E, 0x0000005F, 0x00000056, 0x0000005D, 0x000300F7, 0x00000061, 0x00000000, 
+0x000400FA, 0x0000005F, 0x00000060, 0x00000061, 0x000200F8, 0x00000060, 0x000100FD, 0x000200F8, 
+0x00000061, 0x00050041, 0x0000006B, 0x0000006C, 0x00000069, 0x0000006A, 0x000700EA, 0x00000030, 
+0x00000070, 0x0000006C, 0x0000006E, 0x0000006F, 0x0000006D, 0x00050082, 0x00000030, 0x00000072, 
+0x00000070, 0x00000071, 0x0003003E, 0x00000064, 0x00000072, 0x0004003D, 0x00000030, 0x00000073, 
+0x00000064, 0x000500B1, 0x0000005E, 0x00000075, 0x00000073, 0x00000074, 0x000300F7, 0x00000077, 
+0x00000000, 0x000400FA, 0x00000075, 0x00000076, 0x00000077, 0x000200F8, 0x00000076, 0x00050041, 
+0x0000006B, 0x00000078, 0x00000069, 0x0000006A, 0x000700EA, 0x00000030, 0x00000079, 0x00000078, 
+0x0000006E, 0x0000006F, 0x00000071, 0x000100FD, 0x000200F8, 0x00000077, 0x0004003D, 0x00000030, 
+0x00000080, 0x00000064, 0x00060041, 0x00000081, 0x00000082, 0x0000007F, 0x00000074, 0x00000080, 
+0x0004003D, 0x00000007, 0x00000083, 0x00000082, 0x0003003E, 0x0000007B, 0x00000083, 0x00050041, 
+0x0000005B, 0x00000086, 0x00000059, 0x00000085, 0x0004003D, 0x00000007, 0x00000087, 0x00000086, 
+0x0004003D, 0x00000007, 0x00000089, 0x00000013, 0x0003003E, 0x00000088, 0x00000089, 0x00050039, 
+0x00000007, 0x0000008A, 0x0000000B, 0x00000088, 0x000500C6, 0x00000007, 0x0000008B, 0x00000087, 
+0x0000008A, 0x0003003E, 0x0000008C, 0x0000008B, 0x00050039, 0x00000007, 0x0000008D, 0x0000000B, 
+0x0000008C, 0x0003003E, 0x00000084, 0x0000008D, 0x00050041, 0x00000096, 0x00000097, 0x00000095, 
+0x0000005A, 0x0004003D, 0x0000008E, 0x00000098, 0x00000097, 0x0008004F, 0x00000018, 0x00000099, 
+0x00000098, 0x00000098, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000096, 0x0000009B, 
+0x00000095, 0x0000009A, 0x0004003D, 0x0000008E, 0x0000009C, 0x0000009B, 0x0008004F, 0x00000018, 
+0x0000009D, 0x0000009C, 0x0000009C, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000007, 
+0x0000009F, 0x00000084, 0x0003003E, 0x0000009E, 0x0000009F, 0x00050039, 0x0000000D, 0x000000A0, 
+0x00000010, 0x0000009E, 0x0004003D, 0x00000007, 0x000000A1, 0x0000009E, 0x0003003E, 0x00000084, 
+0x000000A1, 0x0004003D, 0x00000007, 0x000000A3, 0x00000084, 0x0003003E, 0x000000A2, 0x000000A3, 
+0x00050039, 0x0000000D, 0x000000A4, 0x00000010, 0x000000A2, 0x0004003D, 0x00000007, 0x000000A5, 
+0x000000A2, 0x0003003E, 0x00000084, 0x000000A5, 0x0004003D, 0x00000007, 0x000000A7, 0x00000084, 
+0x0003003E, 0x000000A6, 0x000000A7, 0x00050039, 0x0000000D, 0x000000A8, 0x00000010, 0x000000A6, 
+0x0004003D, 0x00000007, 0x000000A9, 0x000000A6, 0x0003003E, 0x00000084, 0x000000A9, 0x00060050, 
+0x00000018, 0x000000AA, 0x000000A0, 0x000000A4, 0x000000A8, 0x00050085, 0x00000018, 0x000000AB, 
+0x0000009D, 0x000000AA, 0x00050081, 0x00000018, 0x000000AC, 0x00000099, 0x000000AB, 0x00060041, 
+0x000000AD, 0x000000AE, 0x00000091, 0x00000074, 0x0000006F, 0x00050051, 0x0000000D, 0x000000AF, 
+0x000000AC, 0x00000000, 0x0003003E, 0x000000AE, 0x000000AF, 0x00060041, 0x000000AD, 0x000000B0, 
+0x00000091, 0x00000074, 0x0000006E, 0x00050051, 0x0000000D, 0x000000B1, 0x000000AC, 0x00000001, 
+0x0003003E, 0x000000B0, 0x000000B1, 0x00060041, 0x000000AD, 0x000000B2, 0x00000091, 0x00000074, 
+0x00000065, 0x00050051, 0x0000000D, 0x000000B3, 0x000000AC, 0x00000002, 0x0003003E, 0x000000B2, 
+0x000000B3, 0x00060041, 0x000000B6, 0x000000B7, 0x00000095, 0x000000B4, 0x000000B5, 0x0004003D, 
+0x0000000D, 0x000000B8, 0x000000B7, 0x00060041, 0x000000B6, 0x000000B9, 0x00000095, 0x0000009A, 
+0x000000B5, 0x0004003D, 0x0000000D, 0x000000BA, 0x000000B9, 0x0004003D, 0x00000007, 0x000000BC, 
+0x00000084, 0x0003003E, 0x000000BB, 0x000000BC, 0x00050039, 0x0000000D, 0x000000BD, 0x00000010, 
+0x000000BB, 0x0004003D, 0x00000007, 0x000000BE, 0x000000BB, 0x0003003E, 0x00000084, 0x000000BE, 
+0x00050085, 0x0000000D, 0x000000BF, 0x000000BA, 0x000000BD, 0x00050081, 0x0000000D, 0x000000C0, 
+0x000000B8, 0x000000BF, 0x00060041, 0x000000AD, 0x000000C1, 0x00000091, 0x00000074, 0x000000B5, 
+0x0003003E, 0x000000C1, 0x000000C0, 0x00050041, 0x00000096, 0x000000C2, 0x00000095, 0x000000B4, 
+0x0004003D, 0x0000008E, 0x000000C3, 0x000000C2, 0x0008004F, 0x00000018, 0x000000C4, 0x000000C3, 
+0x000000C3, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000096, 0x000000C5, 0x00000095, 
+0x0000006A, 0x0004003D, 0x0000008E, 0x000000C6, 0x000000C5, 0x0008004F, 0x00000018, 0x000000C7, 
+0x000000C6, 0x000000C6, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000007, 0x000000C9, 
+0x00000084, 0x0003003E, 0x000000C8, 0x000000C9, 0x00050039, 0x0000000D, 0x000000CA, 0x00000010, 
+0x000000C8, 0x0004003D, 0x00000007, 0x000000CB, 0x000000C8, 0x0003003E, 0x00000084, 0x000000CB, 
+0x0004003D, 0x00000007, 0x000000CD, 0x00000084, 0x0003003E, 0x000000CC, 0x000000CD, 0x00050039, 
+0x0000000D, 0x000000CE, 0x00000010, 0x000000CC, 0x0004003D, 0x00000007, 0x000000CF, 0x000000CC, 
+0x0003003E, 0x00000084, 0x000000CF, 0x0004003D, 0x00000007, 0x000000D1, 0x00000084, 0x0003003E, 
+0x000000D0, 0x000000D1, 0x00050039, 0x0000000D, 0x000000D2, 0x00000010, 0x000000D0, 0x0004003D, 
+0x00000007, 0x000000D3, 0x000000D0, 0x0003003E, 0x00000084, 0x000000D3, 0x00060050, 0x00000018, 
+0x000000D4, 0x000000CA, 0x000000CE, 0x000000D2, 0x00050085, 0x00000018, 0x000000D5, 0x000000C7, 
+0x000000D4, 0x00050081, 0x00000018, 0x000000D6, 0x000000C4, 0x000000D5, 0x00060041, 0x000000AD, 
+0x000000D7, 0x00000091, 0x00000071, 0x0000006F, 0x00050051, 0x0000000D, 0x000000D8, 0x000000D6, 
+0x00000000, 0x0003003E, 0x000000D7, 0x000000D8, 0x00060041, 0x000000AD, 0x000000D9, 0x00000091, 
+0x00000071, 0x0000006E, 0x00050051, 0x0000000D, 0x000000DA, 0x000000D6, 0x00000001, 0x0003003E, 
+0x000000D9, 0x000000DA, 0x00060041, 0x000000AD, 0x000000DB, 0x00000091, 0x00000071, 0x00000065, 
+0x00050051, 0x0000000D, 0x000000DC, 0x000000D6, 0x00000002, 0x0003003E, 0x000000DB, 0x000000DC, 
+0x00060041, 0x000000B6, 0x000000DD, 0x00000095, 0x0000006A, 0x000000B5, 0x0004003D, 0x0000000D, 
+0x000000DE, 0x000000DD, 0x00060041, 0x000000AD, 0x000000DF, 0x00000091, 0x00000071, 0x000000B5, 
+0x0003003E, 0x000000DF, 0x000000DE, 0x0004003D, 0x00000007, 0x000000E5, 0x0000007B, 0x0004003D, 
+0x0000008F, 0x000000E6, 0x00000091, 0x00060041, 0x000000E7, 0x000000E8, 0x000000E4, 0x00000074, 
+0x000000E5, 0x00050051, 0x0000008E, 0x000000E9, 0x000000E6, 0x00000000, 0x00050041, 0x00000096, 
+0x000000EA, 0x000000E8, 0x00000074, 0x0003003E, 0x000000EA, 0x000000E9, 0x00050051, 0x0000008E, 
+0x000000EB, 0x000000E6, 0x00000001, 0x00050041, 0x00000096, 0x000000EC, 0x000000E8, 0x00000071, 
+0x0003003E, 0x000000EC, 0x000000EB, 0x00050041, 0x0000005B, 0x000000EE, 0x00000059, 0x00000071, 
+0x0004003D, 0x00000007, 0x000000EF, 0x000000EE, 0x00060041, 0x00000081, 0x000000F0, 0x00000069, 
+0x000000B4, 0x000000EF, 0x000700EA, 0x00000007, 0x000000F1, 0x000000F0, 0x0000006E, 0x0000006F, 
+0x0000006E, 0x0003003E, 0x000000ED, 0x000000F1, 0x00050041, 0x0000005B, 0x000000F7, 0x00000059, 
+0x00000071, 0x0004003D, 0x00000007, 0x000000F8, 0x000000F7, 0x00050041, 0x0000005B, 0x000000F9, 
+0x00000059, 0x0000009A, 0x0004003D, 0x00000007, 0x000000FA, 0x000000F9, 0x00050084, 0x00000007, 
+0x000000FB, 0x000000F8, 0x000000FA, 0x0004003D, 0x00000007, 0x000000FC, 0x000000ED, 0x00050080, 
+0x00000007, 0x000000FD, 0x000000FB, 0x000000FC, 0x0004003D, 0x00000007, 0x000000FE, 0x0000007B, 
+0x00050050, 0x000000F2, 0x000000FF, 0x0000006F, 0x000000FE, 0x00060041, 0x00000100, 0x00000101, 
+0x000000F6, 0x00000074, 0x000000FD, 0x0003003E, 0x00000101, 0x000000FF, 0x000100FD, 0x00010038, 
+0x00050036, 0x00000018, 0x0000001B, 0x00000000, 0x00000019, 0x00030037, 0x00000017, 0x0000001A, 
+0x000200F8, 0x0000001C, 0x0004003B, 0x00000102, 0x00000103, 0x00000007, 0x00050041, 0x00000104, 
+0x00000105, 0x00000095, 0x00000071, 0x0004003D, 0x00000092, 0x00000106, 0x00000105, 0x0004003D, 
+0x00000016, 0x00000107, 0x0000001A, 0x0005008E, 0x00000016, 0x00000108, 0x00000107, 0x00000050, 
+0x00050050, 0x00000016, 0x00000109, 0x00000052, 0x00000052, 0x00050083, 0x00000016, 0x0000010A, 
+0x00000108, 0x00000109, 0x0004003D, 0x0000010C, 0x0000010F, 0x0000010E, 0x0004003D, 0x00000016, 
+0x00000110, 0x0000001A, 0x00070058, 0x0000008E, 0x00000112, 0x0000010F, 0x00000110, 0x00000002, 
+0x00000111, 0x00050051, 0x0000000D, 0x00000113, 0x00000112, 0x00000000, 0x00050051, 0x0000000D, 
+0x00000114, 0x0000010A, 0x00000000, 0x00050051, 0x0000000D, 0x00000115, 0x0000010A, 0x00000001, 
+0x00070050, 0x0000008E, 0x00000116, 0x00000114, 0x00000115, 0x00000113, 0x00000052, 0x00050091, 
+0x0000008E, 0x00000117, 0x00000106, 0x00000116, 0x0003003E, 0x00000103, 0x00000117, 0x0004003D, 
+0x0000008E, 0x00000118, 0x00000103, 0x0008004F, 0x00000018, 0x00000119, 0x00000118, 0x00000118, 
+0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x000000AD, 0x0000011A, 0x00000103, 0x000000B5, 
+0x0004003D, 0x0000000D, 0x0000011B, 0x0000011A, 0x00060050, 0x00000018, 0x0000011C, 0x0000011B, 
+0x0000011B, 0x0000011B, 0x00050088, 0x00000018, 0x0000011D, 0x00000119, 0x0000011C, 0x000200FE, 
+0x0000011D, 0x00010038, 0x00050036, 0x00000003, 0x00000022, 0x00000000, 0x0000001E, 0x00030037, 
+0x0000001D, 0x0000001F, 0x00030037, 0x0000001D, 0x00000020, 0x00030037, 0x0000001D, 0x00000021, 
+0x000200F8, 0x00000023, 0x0004003B, 0x00000102, 0x00000120, 0x00000007, 0x0004003B, 0x0000001D, 
+0x0000012F, 0x00000007, 0x0004003B, 0x00000017, 0x00000136, 0x00000007, 0x0004003B, 0x0000001D, 
+0x0000014D, 0x00000007, 0x0004003B, 0x00000017, 0x0000014E, 0x00000007, 0x0004003B, 0x0000001D, 
+0x00000151, 0x00000007, 0x0004003B, 0x000000AD, 0x00000156, 0x00000007, 0x0004003B, 0x000000AD, 
+0x0000015B, 0x00000007, 0x0004003B, 0x0000001D, 0x0000016F, 0x00000007, 0x0004003B, 0x00000017, 
+0x00000176, 0x00000007, 0x0004003B, 0x0000001D, 0x0000017A, 0x00000007, 0x0004003B, 0x00000017, 
+0x00000180, 0x00000007, 0x0004003B, 0x0000001D, 0x00000184, 0x00000007, 0x00050041, 0x00000104, 
+0x00000121, 0x00000095, 0x00000074, 0x0004003D, 0x00000092, 0x00000122, 0x00000121, 0x0004003D, 
+0x00000018, 0x00000123, 0x0000001F, 0x00050051, 0x0000000D, 0x00000124, 0x00000123, 0x00000000, 
+0x00050051, 0x0000000D, 0x00000125, 0x00000123, 0x00000001, 0x00050051, 0x0000000D, 0x00000126, 
+0x00000123, 0x00000002, 0x00070050, 0x0000008E, 0x00000127, 0x00000124, 0x00000125, 0x00000126, 
+0x00000052, 0x00050091, 0x0000008E, 0x00000128, 0x00000122, 0x00000127, 0x0003003E, 0x00000120, 
+0x00000128, 0x00050041, 0x000000AD, 0x00000129, 0x00000120, 0x000000B5, 0x0004003D, 0x0000000D, 
+0x0000012A, 0x00000129, 0x000500BC, 0x0000005E, 0x0000012B, 0x0000012A, 0x00000111, 0x000300F7, 
+0x0000012D, 0x00000000, 0x000400FA, 0x0000012B, 0x0000012C, 0x0000012D, 0x000200F8, 0x0000012C, 
+0x000100FD, 0x000200F8, 0x0000012D, 0x0004003D, 0x0000008E, 0x00000130, 0x00000120, 0x0008004F, 
+0x00000018, 0x00000131, 0x00000130, 0x00000130, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 
+0x000000AD, 0x00000132, 0x00000120, 0x000000B5, 0x0004003D, 0x0000000D, 0x00000133, 0x00000132, 
+0x00060050, 0x00000018, 0x00000134, 0x00000133, 0x00000133, 0x00000133, 0x00050088, 0x00000018, 
+0x00000135, 0x00000131, 0x00000134, 0x0003003E, 0x0000012F, 0x00000135, 0x0004003D, 0x00000018, 
+0x00000137, 0x0000012F, 0x0007004F, 0x00000016, 0x00000138, 0x00000137, 0x00000137, 0x00000000, 
+0x00000001, 0x0005008E, 0x00000016, 0x0000013A, 0x00000138, 0x00000139, 0x00050050, 0x00000016, 
+0x0000013B, 0x00000139, 0x00000139, 0x00050081, 0x00000016, 0x0000013C, 0x0000013A, 0x0000013B, 
+0x0003003E, 0x00000136, 0x0000013C, 0x0004003D, 0x00000016, 0x0000013D, 0x00000136, 0x000500B8, 
+0x0000013F, 0x00000140, 0x0000013D, 0x0000013E, 0x0004009A, 0x0000005E, 0x00000141, 0x00000140, 
+0x000400A8, 0x0000005E, 0x00000142, 0x00000141, 0x000300F7, 0x00000144, 0x00000000, 0x000400FA, 
+0x00000142, 0x00000143, 0x00000144, 0x000200F8, 0x00000143, 0x0004003D, 0x00000016, 0x00000145, 
+0x00000136, 0x000500BA, 0x0000013F, 0x00000147, 0x00000145, 0x00000146, 0x0004009A, 0x0000005E, 
+0x00000148, 0x00000147, 0x000200F9, 0x00000144, 0x000200F8, 0x00000144, 0x000700F5, 0x0000005E, 
+0x00000149, 0x00000141, 0x0000012D, 0x00000148, 0x00000143, 0x000300F7, 0x0000014B, 0x00000000, 
+0x000400FA, 0x00000149, 0x0000014A, 0x0000014B, 0x000200F8, 0x0000014A, 0x000100FD, 0x000200F8, 
+0x0000014B, 0x0004003D, 0x00000016, 0x0000014F, 0x00000136, 0x0003003E, 0x0000014E, 0x0000014F, 
+0x00050039, 0x00000018, 0x00000150, 0x0000001B, 0x0000014E, 0x0003003E, 0x0000014D, 0x00000150, 
+0x00050041, 0x00000096, 0x00000153, 0x00000095, 0x00000152, 0x0004003D, 0x0000008E, 0x00000154, 
+0x00000153, 0x0008004F, 0x00000018, 0x00000155, 0x00000154, 0x00000154, 0x00000000, 0x00000001, 
+0x00000002, 0x0003003E, 0x00000151, 0x00000155, 0x0004003D, 0x00000018, 0x00000157, 0x0000014D, 
+0x0004003D, 0x00000018, 0x00000158, 0x00000151, 0x00050083, 0x00000018, 0x00000159, 0x00000157, 
+0x00000158, 0x0006000C, 0x0000000D, 0x0000015A, 0x00000002, 0x00000042, 0x00000159, 0x0003003E, 
+0x00000156, 0x0000015A, 0x0004003D, 0x00000018, 0x0000015C, 0x0000001F, 0x0004003D, 0x00000018, 
+0x0000015D, 0x00000151, 0x00050083, 0x00000018, 0x0000015E, 0x0000015C, 0x0000015D, 0x0006000C, 
+0x0000000D, 0x0000015F, 0x00000002, 0x00000042, 0x0000015E, 0x0004003D, 0x0000000D, 0x00000160, 
+0x00000156, 0x00050083, 0x0000000D, 0x00000161, 0x0000015F, 0x00000160, 0x0003003E, 0x0000015B, 
+0x00000161, 0x0004003D, 0x0000000D, 0x00000162, 0x0000015B, 0x000500BC, 0x0000005E, 0x00000163, 
+0x00000162, 0x00000111, 0x000400A8, 0x0000005E, 0x00000164, 0x00000163, 0x000300F7, 0x00000166, 
+0x00000000, 0x000400FA, 0x00000164, 0x00000165, 0x00000166, 0x000200F8, 0x00000165, 0x0004003D, 
+0x0000000D, 0x00000167, 0x0000015B, 0x00060041, 0x000000B6, 0x00000168, 0x00000095, 0x00000152, 
+0x000000B5, 0x0004003D, 0x0000000D, 0x00000169, 0x00000168, 0x000500BA, 0x0000005E, 0x0000016A, 
+0x00000167, 0x00000169, 0x000200F9, 0x00000166, 0x000200F8, 0x00000166, 0x000700F5, 0x0000005E, 
+0x0000016B, 0x00000163, 0x0000014B, 0x0000016A, 0x00000165, 0x000300F7, 0x0000016D, 0x00000000, 
+0x000400FA, 0x0000016B, 0x0000016C, 0x0000016D, 0x000200F8, 0x0000016C, 0x000100FD, 0x000200F8, 
+0x0000016D, 0x0004003D, 0x00000016, 0x00000170, 0x00000136, 0x00060041, 0x000000B6, 0x00000172, 
+0x00000095, 0x00000171, 0x00000065, 0x0004003D, 0x0000000D, 0x00000173, 0x00000172, 0x00050050, 
+0x00000016, 0x00000174, 0x00000173, 0x00000111, 0x00050081, 0x00000016, 0x00000175, 0x00000170, 
+0x00000174, 0x0003003E, 0x00000176, 0x00000175, 0x00050039, 0x00000018, 0x00000177, 0x0000001B, 
+0x00000176, 0x0004003D, 0x00000018, 0x00000178, 0x0000014D, 0x00050083, 0x00000018, 0x00000179, 
+0x00000177, 0x00000178, 0x0003003E, 0x0000016F, 0x00000179, 0x0004003D, 0x00000016, 0x0000017B, 
+0x00000136, 0x00060041, 0x000000B6, 0x0000017C, 0x00000095, 0x00000171, 0x000000B5, 0x0004003D, 
+0x0000000D, 0x0000017D, 0x0000017C, 0x00050050, 0x00000016, 0x0000017E, 0x00000111, 0x0000017D, 
+0x00050081, 0x00000016, 0x0000017F, 0x0000017B, 0x0000017E, 0x0003003E, 0x00000180, 0x0000017F, 
+0x00050039, 0x00000018, 0x00000181, 0x0000001B, 0x00000180, 0x0004003D, 0x00000018, 0x00000182, 
+0x0000014D, 0x00050083, 0x00000018, 0x00000183, 0x00000181, 0x00000182, 0x0003003E, 0x0000017A, 
+0x00000183, 0x0004003D, 0x00000018, 0x00000185, 0x0000017A, 0x0004003D, 0x00000018, 0x00000186, 
+0x0000016F, 0x0007000C, 0x00000018, 0x00000187, 0x00000002, 0x00000044, 0x00000185, 0x00000186, 
+0x0006000C, 0x00000018, 0x00000188, 0x00000002, 0x00000045, 0x00000187, 0x0003003E, 0x00000184, 
+0x00000188, 0x0004003D, 0x00000018, 0x00000189, 0x00000184, 0x0004003D, 0x00000018, 0x0000018A, 
+0x00000151, 0x0004003D, 0x00000018, 0x0000018B, 0x0000014D, 0x00050083, 0x00000018, 0x0000018C, 
+0x0000018A, 0x0000018B, 0x00050094, 0x0000000D, 0x0000018D, 0x00000189, 0x0000018C, 0x000500B8, 
+0x0000005E, 0x0000018E, 0x0000018D, 0x00000111, 0x000300F7, 0x00000190, 0x00000000, 0x000400FA, 
+0x0000018E, 0x0000018F, 0x00000190, 0x000200F8, 0x0000018F, 0x0004003D, 0x00000018, 0x00000191, 
+0x00000184, 0x0004007F, 0x00000018, 0x00000192, 0x00000191, 0x0003003E, 0x00000184, 0x00000192, 
+0x000200F9, 0x00000190, 0x000200F8, 0x00000190, 0x0004003D, 0x00000018, 0x00000193, 0x00000020, 
+0x0004003D, 0x00000018, 0x00000194, 0x00000184, 0x00050094, 0x0000000D, 0x00000195, 0x00000193, 
+0x00000194, 0x000500B8, 0x0000005E, 0x00000196, 0x00000195, 0x00000111, 0x000300F7, 0x00000198, 
+0x00000000, 0x000400FA, 0x00000196, 0x00000197, 0x00000198, 0x000200F8, 0x00000197, 0x0004003D, 
+0x00000018, 0x00000199, 0x00000020, 0x0004003D, 0x00000018, 0x0000019A, 0x00000184, 0x0007000C, 
+0x00000018, 0x0000019B, 0x00000002, 0x00000047, 0x00000199, 0x0000019A, 0x00060041, 0x000000B6, 
+0x0000019C, 0x00000095, 0x00000085, 0x000000B5, 0x0004003D, 0x0000000D, 0x0000019D, 0x0000019C, 
+0x0005008E, 0x00000018, 0x0000019E, 0x0000019B, 0x0000019D, 0x0003003E, 0x00000020, 0x0000019E, 
+0x000200F9, 0x00000198, 0x000200F8, 0x00000198, 0x0004003D, 0x00000018, 0x0000019F, 0x00000021, 
+0x0003003E, 0x0000001F, 0x0000019F, 0x000100FD, 0x00010038, 0x00050036, 0x00000003, 0x00000025, 
+0x00000000, 0x00000012, 0x00030037, 0x00000008, 0x00000024, 0x000200F8, 0x00000026, 0x0004003B, 
+0x00000008, 0x000001A9, 0x00000007, 0x0004003B, 0x00000090, 0x000001B3, 0x00000007, 0x0004003B, 
+0x000000AD, 0x000001BB, 0x00000007, 0x0004003B, 0x000000AD, 0x000001BE, 0x00000007, 0x0004003B, 
+0x0000001D, 0x000001CC, 0x00000007, 0x0004003B, 0x0000001D, 0x000001D6, 0x00000007, 0x0004003B, 
+0x0000001D, 0x000001DA, 0x00000007, 0x0004003B, 0x0000001D, 0x000001E5, 0x00000007, 0x0004003B, 
+0x0000001D, 0x000001E7, 0x00000007, 0x0004003B, 0x0000001D, 0x000001E9, 0x00000007, 0x0004003B, 
+0x000000AD, 0x000001EE, 0x00000007, 0x0004003B, 0x000000AD, 0x000001F1, 0x00000007, 0x0004003B, 
+0x0000001D, 0x0000022D, 0x00000007, 0x0004003B, 0x00000008, 0x00000233, 0x00000007, 0x0004003B, 
+0x00000008, 0x00000237, 0x00000007, 0x0004003B, 0x00000008, 0x00000241, 0x00000007, 0x0004003B, 
+0x00000008, 0x00000245, 0x00000007, 0x0004003D, 0x00000007, 0x000001A0, 0x00000024, 0x00050041, 
+0x0000005B, 0x000001A1, 0x00000059, 0x00000071, 0x0004003D, 0x00000007, 0x000001A2, 0x000001A1, 
+0x00060041, 0x00000081, 0x000001A3, 0x00000069, 0x000000B4, 0x000001A2, 0x0004003D, 0x00000007, 
+0x000001A4, 0x000001A3, 0x000500AE, 0x0000005E, 0x000001A5, 0x000001A0, 0x000001A4, 0x000300F7, 
+0x000001A7, 0x00000000, 0x000400FA, 0x000001A5, 0x000001A6, 0x000001A7, 0x000200F8, 0x000001A6, 
+0x000100FD, 0x000200F8, 0x000001A7, 0x00050041, 0x0000005B, 0x000001AA, 0x00000059, 0x00000071, 
+0x0004003D, 0x00000007, 0x000001AB, 0x000001AA, 0x00050041, 0x0000005B, 0x000001AC, 0x00000059, 
+0x0000009A, 0x0004003D, 0x00000007, 0x000001AD, 0x000001AC, 0x00050084, 0x00000007, 0x000001AE, 
+0x000001AB, 0x000001AD, 0x0004003D, 0x00000007, 0x000001AF, 0x00000024, 0x00050080, 0x00000007, 
+0x000001B0, 0x000001AE, 0x000001AF, 0x00070041, 0x00000081, 0x000001B1, 0x000000F6, 0x00000074, 
+0x000001B0, 0x0000006E, 0x0004003D, 0x00000007, 0x000001B2, 0x000001B1, 0x0003003E, 0x000001A9, 
+0x000001B2, 0x0004003D, 0x00000007, 0x000001B4, 0x000001A9, 0x00060041, 0x000000E7, 0x000001B5, 
+0x000000E4, 0x00000074, 0x000001B4, 0x0004003D, 0x000000E0, 0x000001B6, 0x000001B5, 0x00050051, 
+0x0000008E, 0x000001B7, 0x000001B6, 0x00000000, 0x00050041, 0x00000102, 0x000001B8, 0x000001B3, 
+0x00000074, 0x0003003E, 0x000001B8, 0x000001B7, 0x00050051, 0x0000008E, 0x000001B9, 0x000001B6, 
+0x00000001, 0x00050041, 0x00000102, 0x000001BA, 0x000001B3, 0x00000071, 0x0003003E, 0x000001BA, 
+0x000001B9, 0x00060041, 0x000000B6, 0x000001BC, 0x00000095, 0x0000005A, 0x000000B5, 0x0004003D, 
+0x0000000D, 0x000001BD, 0x000001BC, 0x0003003E, 0x000001BB, 0x000001BD, 0x00060041, 0x000000AD, 
+0x000001BF, 0x000001B3, 0x00000074, 0x000000B5, 0x0004003D, 0x0000000D, 0x000001C0, 0x000001BF, 
+0x0004003D, 0x0000000D, 0x000001C1, 0x000001BB, 0x00050083, 0x0000000D, 0x000001C2, 0x000001C0, 
+0x000001C1, 0x0003003E, 0x000001BE, 0x000001C2, 0x0004003D, 0x0000000D, 0x000001C3, 0x000001BE, 
+0x000500BC, 0x0000005E, 0x000001C4, 0x000001C3, 0x00000111, 0x000300F7, 0x000001C6, 0x00000000, 
+0x000400FA, 0x000001C4, 0x000001C5, 0x000001C6, 0x000200F8, 0x000001C5, 0x00050041, 0x0000006B, 
+0x000001C7, 0x00000069, 0x0000006A, 0x000700EA, 0x00000030, 0x000001C8, 0x000001C7, 0x0000006E, 
+0x0000006F, 0x00000071, 0x0004003D, 0x00000007, 0x000001C9, 0x000001A9, 0x00060041, 0x00000081, 
+0x000001CA, 0x0000007F, 0x00000074, 0x000001C8, 0x0003003E, 0x000001CA, 0x000001C9, 0x000100FD, 
+0x000200F8, 0x000001C6, 0x00050041, 0x00000102, 0x000001CD, 0x000001B3, 0x00000071, 0x0004003D, 
+0x0000008E, 0x000001CE, 0x000001CD, 0x0008004F, 0x00000018, 0x000001CF, 0x000001CE, 0x000001CE, 
+0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000096, 0x000001D0, 0x00000095, 0x00000085, 
+0x0004003D, 0x0000008E, 0x000001D1, 0x000001D0, 0x0008004F, 0x00000018, 0x000001D2, 0x000001D1, 
+0x000001D1, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000D, 0x000001D3, 0x000001BB, 
+0x0005008E, 0x00000018, 0x000001D4, 0x000001D2, 0x000001D3, 0x00050081, 0x00000018, 0x000001D5, 
+0x000001CF, 0x000001D4, 0x0003003E, 0x000001CC, 0x000001D5, 0x00050041, 0x00000102, 0x000001D7, 
+0x000001B3, 0x00000074, 0x0004003D, 0x0000008E, 0x000001D8, 0x000001D7, 0x0008004F, 0x00000018, 
+0x000001D9, 0x000001D8, 0x000001D8, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000001D6, 
+0x000001D9, 0x0004003D, 0x00000018, 0x000001DB, 0x000001D6, 0x0004003D, 0x00000018, 0x000001DC, 
+0x000001CC, 0x0004003D, 0x0000000D, 0x000001DD, 0x000001BB, 0x0005008E, 0x00000018, 0x000001DE, 
+0x000001DC, 0x000001DD, 0x00050081, 0x00000018, 0x000001DF, 0x000001DB, 0x000001DE, 0x0003003E, 
+0x000001DA, 0x000001DF, 0x00060041, 0x000000B6, 0x000001E0, 0x00000095, 0x0000004B, 0x00000065, 
+0x0004003D, 0x0000000D, 0x000001E1, 0x000001E0, 0x000500BA, 0x0000005E, 0x000001E2, 0x000001E1, 
+0x00000111, 0x000300F7, 0x000001E4, 0x00000000, 0x000400FA, 0x000001E2, 0x000001E3, 0x000001E4, 
+0x000200F8, 0x000001E3, 0x0004003D, 0x00000018, 0x000001E6, 0x000001DA, 0x0003003E, 0x000001E5, 
+0x000001E6, 0x0004003D, 0x00000018, 0x000001E8, 0x000001CC, 0x0003003E, 0x000001E7, 0x000001E8, 
+0x0004003D, 0x00000018, 0x000001EA, 0x000001D6, 0x0003003E, 0x000001E9, 0x000001EA, 0x00070039, 
+0x00000003, 0x000001EB, 0x00000022, 0x000001E5, 0x000001E7, 0x000001E9, 0x0004003D, 0x00000018, 
+0x000001EC, 0x000001E5, 0x0003003E, 0x000001DA, 0x000001EC, 0x0004003D, 0x00000018, 0x000001ED, 
+0x000001E7, 0x0003003E, 0x000001CC, 0x000001ED, 0x000200F9, 0x000001E4, 0x000200F8, 0x000001E4, 
+0x00060041, 0x000000AD, 0x000001EF, 0x000001B3, 0x00000071, 0x000000B5, 0x0004003D, 0x0000000D, 
+0x000001F0, 0x000001EF, 0x0003003E, 0x000001EE, 0x000001F0, 0x00060041, 0x000000B6, 0x000001F2, 
+0x00000095, 0x000000B4, 0x000000B5, 0x0004003D, 0x0000000D, 0x000001F3, 0x000001F2, 0x0003003E, 
+0x000001F1, 0x000001F3, 0x00060041, 0x000000B6, 0x000001F4, 0x00000095, 0x0000004B, 0x0000006E, 
+0x0004003D, 0x0000000D, 0x000001F5, 0x000001F4, 0x000500BA, 0x0000005E, 0x000001F6, 0x000001F5, 
+0x00000111, 0x000300F7, 0x000001F8, 0x00000000, 0x000400FA, 0x000001F6, 0x000001F7, 0x000001F8, 
+0x000200F8, 0x000001F7, 0x0004003D, 0x0000000D, 0x000001F9, 0x000001BE, 0x00060041, 0x000000B6, 
+0x000001FA, 0x00000095, 0x0000004B, 0x0000006E, 0x0004003D, 0x0000000D, 0x000001FB, 0x000001FA, 
+0x000500B8, 0x0000005E, 0x000001FC, 0x000001F9, 0x000001FB, 0x000200F9, 0x000001F8, 0x000200F8, 
+0x000001F8, 0x000700F5, 0x0000005E, 0x000001FD, 0x000001F6, 0x000001E4, 0x000001FC, 0x000001F7, 
+0x000300F7, 0x000001FF, 0x00000000, 0x000400FA, 0x000001FD, 0x000001FE, 0x000001FF, 0x000200F8, 
+0x000001FE, 0x0004003D, 0x0000000D, 0x00000200, 0x000001BE, 0x00060041, 0x000000B6, 0x00000201, 
+0x00000095, 0x0000004B, 0x0000006E, 0x0004003D, 0x0000000D, 0x00000202, 0x00000201, 0x00050088, 
+0x0000000D, 0x00000203, 0x00000200, 0x00000202, 0x0003003E, 0x000001EE, 0x00000203, 0x000200F9, 
+0x000001FF, 0x000200F8, 0x000001FF, 0x00060041, 0x000000B6, 0x00000204, 0x00000095, 0x0000004B, 
+0x0000006F, 0x0004003D, 0x0000000D, 0x00000205, 0x00000204, 0x000500BA, 0x0000005E, 0x00000206, 
+0x00000205, 0x00000111, 0x000300F7, 0x00000208, 0x00000000, 0x000400FA, 0x00000206, 0x00000207, 
+0x00000208, 0x000200F8, 0x00000207, 0x0004003D, 0x0000000D, 0x00000209, 0x000001BE, 0x0004003D, 
+0x0000000D, 0x0000020A, 0x000001F1, 0x00060041, 0x000000B6, 0x0000020B, 0x00000095, 0x0000004B, 
+0x0000006F, 0x0004003D, 0x0000000D, 0x0000020C, 0x0000020B, 0x00050083, 0x0000000D, 0x0000020D, 
+0x0000020A, 0x0000020C, 0x000500BA, 0x0000005E, 0x0000020E, 0x00000209, 0x0000020D, 0x000200F9, 
+0x00000208, 0x000200F8, 0x00000208, 0x000700F5, 0x0000005E, 0x0000020F, 0x00000206, 0x000001FF, 
+0x0000020E, 0x00000207, 0x000300F7, 0x00000211, 0x00000000, 0x000400FA, 0x0000020F, 0x00000210, 
+0x00000211, 0x000200F8, 0x00000210, 0x0004003D, 0x0000000D, 0x00000212, 0x000001F1, 0x0004003D, 
+0x0000000D, 0x00000213, 0x000001BE, 0x00050083, 0x0000000D, 0x00000214, 0x00000212, 0x00000213, 
+0x00060041, 0x000000B6, 0x00000215, 0x00000095, 0x0000004B, 0x0000006F, 0x0004003D, 0x0000000D, 
+0x00000216, 0x00000215, 0x00050088, 0x0000000D, 0x00000217, 0x00000214, 0x00000216, 0x0003003E, 
+0x000001EE, 0x00000217, 0x000200F9, 0x00000211, 0x000200F8, 0x00000211, 0x0004003D, 0x00000018, 
+0x00000218, 0x000001DA, 0x0004003D, 0x0000000D, 0x00000219, 0x000001BE, 0x00050051, 0x0000000D, 
+0x0000021A, 0x00000218, 0x00000000, 0x00050051, 0x0000000D, 0x0000021B, 0x00000218, 0x00000001, 
+0x00050051, 0x0000000D, 0x0000021C, 0x00000218, 0x00000002, 0x00070050, 0x0000008E, 0x0000021D, 
+0x0000021A, 0x0000021B, 0x0000021C, 0x00000219, 0x00050041, 0x00000102, 0x0000021E, 0x000001B3, 
+0x00000074, 0x0003003E, 0x0000021E, 0x0000021D, 0x0004003D, 0x00000018, 0x0000021F, 0x000001CC, 
+0x0004003D, 0x0000000D, 0x00000220, 0x000001EE, 0x00050051, 0x0000000D, 0x00000221, 0x0000021F, 
+0x00000000, 0x00050051, 0x0000000D, 0x00000222, 0x0000021F, 0x00000001, 0x00050051, 0x0000000D, 
+0x00000223, 0x0000021F, 0x00000002, 0x00070050, 0x0000008E, 0x00000224, 0x00000221, 0x00000222, 
+0x00000223, 0x00000220, 0x00050041, 0x00000102, 0x00000225, 0x000001B3, 0x00000071, 0x0003003E, 
+0x00000225, 0x00000224, 0x0004003D, 0x00000007, 0x00000226, 0x000001A9, 0x0004003D, 0x0000008F, 
+0x00000227, 0x000001B3, 0x00060041, 0x000000E7, 0x00000228, 0x000000E4, 0x00000074, 0x00000226, 
+0x00050051, 0x0000008E, 0x00000229, 0x00000227, 0x00000000, 0x00050041, 0x00000096, 0x0000022A, 
+0x00000228, 0x00000074, 0x0003003E, 0x0000022A, 0x00000229, 0x00050051, 0x0000008E, 0x0000022B, 
+0x00000227, 0x00000001, 0x00050041, 0x00000096, 0x0000022C, 0x00000228, 0x00000071, 0x0003003E, 
+0x0000022C, 0x0000022B, 0x0004003D, 0x00000018, 0x0000022E, 0x000001DA, 0x00050041, 0x00000096, 
+0x0000022F, 0x00000095, 0x00000152, 0x0004003D, 0x0000008E, 0x00000230, 0x0000022F, 0x0008004F, 
+0x00000018, 0x00000231, 0x00000230, 0x00000230, 0x00000000, 0x00000001, 0x00000002, 0x00050083, 
+0x00000018, 0x00000232, 0x0000022E, 0x00000231, 0x0003003E, 0x0000022D, 0x00000232, 0x00060041, 
+0x000000B6, 0x00000234, 0x00000095, 0x0000004B, 0x000000B5, 0x0004003D, 0x0000000D, 0x00000235, 
+0x00000234, 0x000500BA, 0x0000005E, 0x00000236, 0x00000235, 0x00000111, 0x000300F7, 0x00000239, 
+0x00000000, 0x000400FA, 0x00000236, 0x00000238, 0x0000023F, 0x000200F8, 0x00000238, 0x0004003D, 
+0x00000018, 0x0000023A, 0x0000022D, 0x0004003D, 0x00000018, 0x0000023B, 0x0000022D, 0x00050094, 
+0x0000000D, 0x0000023C, 0x0000023A, 0x0000023B, 0x0004007C, 0x00000007, 0x0000023D, 0x0000023C, 
+0x0007000C, 0x00000007, 0x0000023E, 0x00000002, 0x00000029, 0x0000023D, 0x0000006E, 0x0003003E, 
+0x00000237, 0x0000023E, 0x000200F9, 0x00000239, 0x000200F8, 0x0000023F, 0x0003003E, 0x00000237, 
+0x0000006E, 0x000200F9, 0x00000239, 0x000200F8, 0x00000239, 0x0004003D, 0x00000007, 0x00000240, 
+0x00000237, 0x0003003E, 0x00000233, 0x00000240, 0x00050041, 0x0000005B, 0x00000242, 0x00000059, 
+0x00000071, 0x0004003D, 0x00000007, 0x00000243, 0x00000242, 0x00050082, 0x00000007, 0x00000244, 
+0x0000006E, 0x00000243, 0x0003003E, 0x00000241, 0x00000244, 0x0004003D, 0x00000007, 0x00000246, 
+0x00000241, 0x00060041, 0x00000081, 0x00000247, 0x00000069, 0x000000B4, 0x00000246, 0x000700EA, 
+0x00000007, 0x00000248, 0x00000247, 0x0000006E, 0x0000006F, 0x0000006E, 0x0003003E, 0x00000245, 
+0x00000248, 0x0004003D, 0x00000007, 0x00000249, 0x00000241, 0x00050041, 0x0000005B, 0x0000024A, 
+0x00000059, 0x0000009A, 0x0004003D, 0x00000007, 0x0000024B, 0x0000024A, 0x00050084, 0x00000007, 
+0x0000024C, 0x00000249, 0x0000024B, 0x0004003D, 0x00000007, 0x0000024D, 0x00000245, 0x00050080, 
+0x00000007, 0x0000024E, 0x0000024C, 0x0000024D, 0x0004003D, 0x00000007, 0x0000024F, 0x00000233, 
+0x0004003D, 0x00000007, 0x00000250, 0x000001A9, 0x00050050, 0x000000F2, 0x00000251, 0x0000024F, 
+0x00000250, 0x00060041, 0x00000100, 0x00000252, 0x000000F6, 0x00000074, 0x0000024E, 0x0003003E, 
+0x00000252, 0x00000251, 0x000100FD, 0x00010038, 0x00050036, 0x00000003, 0x00000028, 0x00000000, 
+0x00000012, 0x00030037, 0x00000008, 0x00000027, 0x000200F8, 0x00000029, 0x0004003B, 0x00000008, 
+0x00000253, 0x00000007, 0x00050041, 0x0000005B, 0x00000254, 0x00000059, 0x00000071, 0x0004003D, 
+0x00000007, 0x00000255, 0x00000254, 0x00050082, 0x00000007, 0x00000256, 0x0000006E, 0x00000255, 
+0x0003003E, 0x00000253, 0x00000256, 0x0004003D, 0x00000007, 0x00000257, 0x00000027, 0x0004003D, 
+0x00000007, 0x00000258, 0x00000253, 0x00060041, 0x00000081, 0x00000259, 0x00000069, 0x000000B4, 
+0x00000258, 0x0004003D, 0x00000007, 0x0000025A, 0x00000259, 0x000500B0, 0x0000005E, 0x0000025B, 
+0x00000257, 0x0000025A, 0x000400A8, 0x0000005E, 0x0000025C, 0x0000025B, 0x000300F7, 0x0000025E, 
+0x00000000, 0x000400FA, 0x0000025C, 0x0000025D, 0x0000025E, 0x000200F8, 0x0000025D, 0x0004003D, 
+0x00000007, 0x0000025F, 0x00000027, 0x00050041, 0x0000005B, 0x00000260, 0x00000059, 0x0000009A, 
+0x0004003D, 0x00000007, 0x00000261, 0x00000260, 0x000500AE, 0x0000005E, 0x00000262, 0x0000025F, 
+0x00000261, 0x000200F9, 0x0000025E, 0x000200F8, 0x0000025E, 0x000700F5, 0x0000005E, 0x00000263, 
+0x0000025B, 0x00000029, 0x00000262, 0x0000025D, 0x000300F7, 0x00000265, 0x00000000, 0x000400FA, 
+0x00000263, 0x00000264, 0x00000265, 0x000200F8, 0x00000264, 0x000100FD, 0x000200F8, 0x00000265, 
+0x0004003D, 0x00000007, 0x00000267, 0x00000253, 0x00050041, 0x0000005B, 0x00000268, 0x00000059, 
+0x0000009A, 0x0004003D, 0x00000007, 0x00000269, 0x00000268, 0x00050084, 0x00000007, 0x0000026A, 
+0x00000267, 0x00000269, 0x0004003D, 0x00000007, 0x0000026B, 0x00000027, 0x00050080, 0x00000007, 
+0x0000026C, 0x0000026A, 0x0000026B, 0x00060041, 0x00000100, 0x0000026E, 0x000000F6, 0x00000074, 
+0x0000026C, 0x0003003E, 0x0000026E, 0x0000026D, 0x000100FD, 0x00010038, 0x00050036, 0x00000003, 
+0x0000002B, 0x00000000, 0x00000012, 0x00030037, 0x00000008, 0x0000002A, 0x000200F8, 0x0000002C, 
+0x0004003B, 0x00000008, 0x0000026F, 0x00000007, 0x0004003B, 0x00000008, 0x00000282, 0x00000007, 
+0x0004003B, 0x00000289, 0x0000028A, 0x00000007, 0x0004003B, 0x00000289, 0x00000290, 0x00000007, 
+0x0004003B, 0x00000296, 0x00000297, 0x00000007, 0x0004003B, 0x00000296, 0x0000029E, 0x00000007, 
+0x0004003D, 0x00000007, 0x00000270, 0x0000002A, 0x00050041, 0x0000005B, 0x00000271, 0x00000059, 
+0x0000006A, 0x0004003D, 0x00000007, 0x00000272, 0x00000271, 0x000500C6, 0x00000007, 0x00000273, 
+0x00000270, 0x00000272, 0x0003003E, 0x0000026F, 0x00000273, 0x0004003D, 0x00000007, 0x00000274, 
+0x0000026F, 0x0004003D, 0x00000007, 0x00000275, 0x0000002A, 0x000500B2, 0x0000005E, 0x00000276, 
+0x00000274, 0x00000275, 0x000400A8, 0x0000005E, 0x00000277, 0x00000276, 0x000300F7, 0x00000279, 
+0x00000000, 0x000400FA, 0x00000277, 0x00000278, 0x00000279, 0x000200F8, 0x00000278, 0x0004003D, 
+0x00000007, 0x0000027A, 0x0000026F, 0x00050041, 0x0000005B, 0x0000027B, 0x00000059, 0x0000009A, 
+0x0004003D, 0x00000007, 0x0000027C, 0x0000027B, 0x000500AE, 0x0000005E, 0x0000027D, 0x0000027A, 
+0x0000027C, 0x000200F9, 0x00000279, 0x000200F8, 0x00000279, 0x000700F5, 0x0000005E, 0x0000027E, 
+0x00000276, 0x0000002C, 0x0000027D, 0x00000278, 0x000300F7, 0x00000280, 0x00000000, 0x000400FA, 
+0x0000027E, 0x0000027F, 0x00000280, 0x000200F8, 0x0000027F, 0x000100FD, 0x000200F8, 0x00000280, 
+0x00050041, 0x0000005B, 0x00000283, 0x00000059, 0x00000071, 0x0004003D, 0x00000007, 0x00000284, 
+0x00000283, 0x00050082, 0x00000007, 0x00000285, 0x0000006E, 0x00000284, 0x00050041, 0x0000005B, 
+0x00000286, 0x00000059, 0x0000009A, 0x0004003D, 0x00000007, 0x00000287, 0x00000286, 0x00050084, 
+0x00000007, 0x00000288, 0x00000285, 0x00000287, 0x0003003E, 0x00000282, 0x00000288, 0x0004003D, 
+0x00000007, 0x0000028B, 0x00000282, 0x0004003D, 0x00000007, 0x0000028C, 0x0000002A, 0x00050080, 
+0x00000007, 0x0000028D, 0x0000028B, 0x0000028C, 0x00060041, 0x00000100, 0x0000028E, 0x000000F6, 
+0x00000074, 0x0000028D, 0x0004003D, 0x000000F2, 0x0000028F, 0x0000028E, 0x0003003E, 0x0000028A, 
+0x0000028F, 0x0004003D, 0x00000007, 0x00000291, 0x00000282, 0x0004003D, 0x00000007, 0x00000292, 
+0x0000026F, 0x00050080, 0x00000007, 0x00000293, 0x00000291, 0x00000292, 0x00060041, 0x00000100, 
+0x00000294, 0x000000F6, 0x00000074, 0x00000293, 0x0004003D, 0x000000F2, 0x00000295, 0x00000294, 
+0x0003003E, 0x00000290, 0x00000295, 0x0004003D, 0x00000007, 0x00000298, 0x0000002A, 0x00050041, 
+0x0000005B, 0x00000299, 0x00000059, 0x000000B4, 0x0004003D, 0x00000007, 0x0000029A, 0x00000299, 
+0x000500C7, 0x00000007, 0x0000029B, 0x00000298, 0x0000029A, 0x000500AA, 0x0000005E, 0x0000029C, 
+0x0000029B, 0x0000006F, 0x0003003E, 0x00000297, 0x0000029C, 0x0004003D, 0x0000005E, 0x0000029D, 
+0x00000297, 0x000300F7, 0x000002A0, 0x00000000, 0x000400FA, 0x0000029D, 0x0000029F, 0x000002A6, 
+0x000200F8, 0x0000029F, 0x00050041, 0x00000008, 0x000002A1, 0x0000028A, 0x0000006F, 0x0004003D, 
+0x00000007, 0x000002A2, 0x000002A1, 0x00050041, 0x00000008, 0x000002A3, 0x00000290, 0x0000006F, 
+0x0004003D, 0x00000007, 0x000002A4, 0x000002A3, 0x000500B0, 0x0000005E, 0x000002A5, 0x000002A2, 
+0x000002A4, 0x0003003E, 0x0000029E, 0x000002A5, 0x000200F9, 0x000002A0, 0x000200F8, 0x000002A6, 
+0x00050041, 0x00000008, 0x000002A7, 0x0000028A, 0x0000006F, 0x0004003D, 0x00000007, 0x000002A8, 
+0x000002A7, 0x00050041, 0x00000008, 0x000002A9, 0x00000290, 0x0000006F, 0x0004003D, 0x00000007, 
+0x000002AA, 0x000002A9, 0x000500AC, 0x0000005E, 0x000002AB, 0x000002A8, 0x000002AA, 0x0003003E, 
+0x0000029E, 0x000002AB, 0x000200F9, 0x000002A0, 0x000200F8, 0x000002A0, 0x0004003D, 0x0000005E, 
+0x000002AC, 0x0000029E, 0x000300F7, 0x000002AE, 0x00000000, 0x000400FA, 0x000002AC, 0x000002AD, 
+0x000002AE, 0x000200F8, 0x000002AD, 0x0004003D, 0x00000007, 0x000002AF, 0x00000282, 0x0004003D, 
+0x00000007, 0x000002B0, 0x0000002A, 0x00050080, 0x00000007, 0x000002B1, 0x000002AF, 0x000002B0, 
+0x0004003D, 0x000000F2, 0x000002B2, 0x00000290, 0x00060041, 0x00000100, 0x000002B3, 0x000000F6, 
+0x00000074, 0x000002B1, 0x0003003E, 0x000002B3, 0x000002B2, 0x0004003D, 0x00000007, 0x000002B4, 
+0x00000282, 0x0004003D, 0x00000007, 0x000002B5, 0x0000026F, 0x00050080, 0x00000007, 0x000002B6, 
+0x000002B4, 0x000002B5, 0x0004003D, 0x000000F2, 0x000002B7, 0x0000028A, 0x00060041, 0x00000100, 
+0x000002B8, 0x000000F6, 0x00000074, 0x000002B6, 0x0003003E, 0x000002B8, 0x000002B7, 0x000200F9, 
+0x000002AE, 0x000200F8, 0x000002AE, 0x000100FD, 0x00010038, 0x00050036, 0x00000003, 0x0000002D, 
+0x00000000, 0x00000004, 0x000200F8, 0x0000002E, 0x0004003B, 0x00000008, 0x000002B9, 0x00000007, 
+0x00050041, 0x0000005B, 0x000002BA, 0x00000059, 0x00000071, 0x0004003D, 0x00000007, 0x000002BB, 
+0x000002BA, 0x00050082, 0x00000007, 0x000002BC, 0x0000006E, 0x000002BB, 0x0003003E, 0x000002B9, 
+0x000002BC, 0x00050041, 0x00000081, 0x000002BE, 0x00000069, 0x00000074, 0x0003003E, 0x000002BE, 
+0x000002BD, 0x0004003D, 0x00000007, 0x000002BF, 0x000002B9, 0x00060041, 0x00000081, 0x000002C0, 
+0x00000069, 0x000000B4, 0x000002BF, 0x0004003D, 0x00000007, 0x000002C1, 0x000002C0, 0x00050041, 
+0x00000081, 0x000002C2, 0x00000069, 0x00000071, 0x0003003E, 0x000002C2, 0x000002C1, 0x00050041, 
+0x00000081, 0x000002C3, 0x00000069, 0x0000005A, 0x0003003E, 0x000002C3, 0x0000006F, 0x00050041, 
+0x00000081, 0x000002C4, 0x00000069, 0x0000009A, 0x0003003E, 0x000002C4, 0x0000006F, 0x00050041, 
+0x0000005B, 0x000002C5, 0x00000059, 0x00000071, 0x0004003D, 0x00000007, 0x000002C6, 0x000002C5, 
+0x00060041, 0x00000081, 0x000002C7, 0x00000069, 0x000000B4, 0x000002C6, 0x0003003E, 0x000002C7, 
+0x0000006F, 0x000100FD, 0x00010038, 
+    };
\ No newline at end of file
@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBRAnimPalette.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/DepthPrePass.frag.spv
+#shader end
\ No newline at end of file
@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/DepthPrePassCompact.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/DepthPrePassCompact.frag.spv
+#shader end
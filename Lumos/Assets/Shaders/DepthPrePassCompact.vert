@@ -0,0 +1,23 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+} pushConsts;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+// Position stream only, used when nothing reads the prepass normals
+layout(location = 0) in uvec2 inPosition;
+
+void main()
+{
+    gl_Position = u_CameraData.projView * pushConsts.transform * vec4(CompactPosition(inPosition), 1.0);
+}
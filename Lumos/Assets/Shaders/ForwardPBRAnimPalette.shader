@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBRAnimPalette.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ForwardPBR.frag.spv
+#shader end
@@ -0,0 +1,3 @@
+#version 450
+#define CLUSTERED_LIGHTING
+#include "ForwardPBR.glslh"
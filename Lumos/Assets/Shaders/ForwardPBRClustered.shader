@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBR.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ForwardPBRClustered.frag.spv
+#shader end
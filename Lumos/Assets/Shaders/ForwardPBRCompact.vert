@@ -0,0 +1,49 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+	vec4 texCoordScaleBias;
+} pushConsts;
+
+layout(location = 0) in uvec2 inPosition;
+layout(location = 1) in uvec3 inAttributes;
+
+struct VertexData
+{
+	vec3 Colour;
+	vec2 TexCoord;
+	vec4 Position;
+	vec3 Normal;
+	mat3 WorldNormal;
+};
+
+layout(location = 0) out VertexData VertexOutput;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void main()
+{
+	VertexOutput.Position = pushConsts.transform * vec4(CompactPosition(inPosition), 1.0);
+    gl_Position = u_CameraData.projView * VertexOutput.Position;
+
+	VertexOutput.Colour = vec3(1.0);
+	VertexOutput.TexCoord = CompactTexCoord(inAttributes, pushConsts.texCoordScaleBias);
+
+	mat3 transposeInv = transpose(inverse(mat3(pushConsts.transform)));
+
+	vec3 N = normalize(transposeInv * CompactNormal(inAttributes));
+	vec3 T = normalize(transposeInv * CompactTangent(inAttributes));
+	vec3 B = normalize(cross(N, T)) * CompactBitangentSign(inPosition);
+
+	VertexOutput.Normal = N;
+	VertexOutput.WorldNormal = mat3(T, B, N);
+
+}
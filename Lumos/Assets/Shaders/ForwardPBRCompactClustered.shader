@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBRCompact.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ForwardPBRClustered.frag.spv
+#shader end
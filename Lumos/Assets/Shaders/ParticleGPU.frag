@@ -0,0 +1,38 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+layout (location = 0) out vec4 colour;
+
+// Particle.frag for one emitter at a time, so there's a single texture instead of a batch's array
+
+layout (location = 0) in DATA
+{
+	vec4 uv;
+	float blend;
+	vec4 colour;
+} fs_in;
+
+layout(set = 1, binding = 0) uniform sampler2D u_Texture;
+
+#define GAMMA 2.2
+
+vec4 GammaCorrectTexture(vec4 samp)
+{
+	return vec4(pow(samp.rgb, vec3(GAMMA)), samp.a);
+}
+
+void main()
+{
+	vec4 texColour = fs_in.colour * GammaCorrectTexture(texture(u_Texture, fs_in.uv.xy));
+
+	if(fs_in.blend >= 0.0)
+	{
+		vec4 texColour2 = fs_in.colour * GammaCorrectTexture(texture(u_Texture, fs_in.uv.zw));
+		texColour = mix(texColour, texColour2, fs_in.blend);
+	}
+
+	if(texColour.w < 0.1)
+		discard;
+
+	colour = texColour;
+}
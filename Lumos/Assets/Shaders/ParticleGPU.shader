@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ParticleGPU.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ParticleGPU.frag.spv
+#shader end
\ No newline at end of file
@@ -0,0 +1,79 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+// Draws GPU simulated particles straight from the simulation buffers, one instance per alive particle and six
+// vertices per quad.
+
+struct Particle
+{
+	vec4 PositionLife;
+	vec4 VelocityAlpha;
+};
+
+layout(set = 0, binding = 0) uniform UBO
+{
+	mat4 projView;
+	vec4 Right;     // xyz quad right axis, w particle size
+	vec4 Up;        // xyz quad up axis, w particle life
+	vec4 Colour;    // rgb emitter colour
+	uvec4 Options;  // x first entry of the drawn alive list, y animated texture rows or 0
+} ubo;
+
+layout(std430, set = 0, binding = 1) readonly buffer Particles
+{
+	Particle Data[];
+} u_Particles;
+
+layout(std430, set = 0, binding = 2) readonly buffer AliveLists
+{
+	uvec2 Data[];
+} u_Alive;
+
+layout (location = 0) out DATA
+{
+	vec4 uv;
+	float blend;
+	vec4 colour;
+} vs_out;
+
+// Two triangles over the corners in the order the CPU path writes them
+const uint Corners[6] = uint[](0, 1, 2, 2, 3, 0);
+const vec2 Offsets[4] = vec2[](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+const vec2 UVs[4]     = vec2[](vec2(0.0, 1.0), vec2(1.0, 1.0), vec2(1.0, 0.0), vec2(0.0, 0.0));
+
+void main()
+{
+	uint slot         = u_Alive.Data[ubo.Options.x + gl_InstanceIndex].y;
+	Particle particle = u_Particles.Data[slot];
+
+	uint corner   = Corners[gl_VertexIndex % 6];
+	vec2 offset   = Offsets[corner] * ubo.Right.w;
+	vec3 position = particle.PositionLife.xyz + ubo.Right.xyz * offset.x + ubo.Up.xyz * offset.y;
+
+	// Same frames as ParticleEmitter::GetBlendedAnimatedUVs
+	uint rows = ubo.Options.y;
+	if(rows > 0)
+	{
+		float life   = clamp(1.0 - particle.PositionLife.w / ubo.Up.w, 0.0, 1.0);
+		uint frames  = rows * rows;
+		uint frame   = uint(life * float(frames));
+		uint row     = frame / rows;
+		uint col     = frame % rows;
+		uint nextCol = (col + 1) % rows;
+		uint nextRow = row + (nextCol == 0 ? 1 : 0);
+		float size   = 1.0 / float(rows);
+
+		vec2 cornerOffset = vec2((corner == 1 || corner == 2) ? 1.0 : 0.0, (corner == 0 || corner == 1) ? 1.0 : 0.0);
+		vs_out.uv         = vec4((vec2(col, row) + cornerOffset) * size, (vec2(nextCol, nextRow) + cornerOffset) * size);
+		vs_out.blend      = fract(life * float(frames));
+	}
+	else
+	{
+		vs_out.uv    = vec4(UVs[corner], 0.0, 0.0);
+		vs_out.blend = -1.0;
+	}
+
+	gl_Position   = ubo.projView * vec4(position, 1.0);
+	vs_out.colour = vec4(ubo.Colour.rgb, particle.VelocityAlpha.w);
+}
@@ -0,0 +1,3 @@
+#shader compute
+CompiledSPV/ParticleSimulate.comp.spv
+#shader end
\ No newline at end of file
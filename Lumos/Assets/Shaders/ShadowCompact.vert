@@ -0,0 +1,27 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+	uint cascadeIndex;
+} pushConsts;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+// Position stream only
+layout(location = 0) in uvec2 inPosition;
+
+layout(location = 0) out vec2 uv;
+
+void main()
+{
+    gl_Position = pushConsts.transform * vec4(CompactPosition(inPosition), 1.0);
+    uv = vec2(0.0);
+}
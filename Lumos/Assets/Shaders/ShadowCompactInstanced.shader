@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ShadowCompactInstanced.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/Shadow.frag.spv
+#shader end
@@ -0,0 +1,34 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	uint cascadeIndex;
+	uint instanceOffset;
+} pushConsts;
+
+// Binding 0 of set 3 is the bone buffer from Buffers.glslh, kept so the layout matches Shadow.frag
+layout(std430, set = 3, binding = 1) readonly buffer InstanceTransforms
+{
+	mat4 Transforms[];
+} u_Instances;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+// Position stream only
+layout(location = 0) in uvec2 inPosition;
+
+layout(location = 0) out vec2 uv;
+
+void main()
+{
+    mat4 transform = u_DirShadow.DirLightMatrices[pushConsts.cascadeIndex] * u_Instances.Transforms[pushConsts.instanceOffset + gl_InstanceIndex];
+    gl_Position = transform * vec4(CompactPosition(inPosition), 1.0);
+    uv = vec2(0.0);
+}
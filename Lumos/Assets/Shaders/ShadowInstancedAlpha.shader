@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ShadowInstanced.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ShadowAlpha.frag.spv
+#shader end
@@ -34,7 +34,7 @@ namespace Lumos
 
     float PathEdge::StaticCost() const
     {
-        return Maths::Length(Vec3(m_NodeA->GetWorldSpaceTransform().Translation() - m_NodeB->GetWorldSpaceTransform().Translation()));
+        return Maths::Length(m_NodeA->GetPosition() - m_NodeB->GetPosition());
     }
 
     void PathEdge::SetTraversable(bool traversable)
@@ -7,9 +7,8 @@ namespace Lumos
 {
 
     PathNode::PathNode(const Vec3& position)
-        : RigidBody3D()
+        : m_Position(position)
     {
-        SetPosition(position);
     }
 
     PathNode::~PathNode()
@@ -23,7 +22,7 @@ namespace Lumos
 
     float PathNode::HeuristicValue(const PathNode& other) const
     {
-        return Maths::Length(Vec3(GetWorldSpaceTransform().Translation() - other.GetWorldSpaceTransform().Translation()));
+        return Maths::Length(m_Position - other.m_Position);
     }
 
 }
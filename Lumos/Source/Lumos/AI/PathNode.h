@@ -1,5 +1,4 @@
 #pragma once
-#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
 #include "Maths/Vector3.h"
 #include <vector>
 
@@ -8,7 +7,7 @@ namespace Lumos
 
     class PathEdge;
 
-    class PathNode : public RigidBody3D
+    class PathNode
     {
     public:
         explicit PathNode(const Vec3& position = Vec3());
@@ -28,9 +27,13 @@ namespace Lumos
 
         virtual float HeuristicValue(const PathNode& other) const;
 
+        const Vec3& GetPosition() const { return m_Position; }
+        void SetPosition(const Vec3& position) { m_Position = position; }
+
     private:
         friend class PathEdge;
         std::vector<PathEdge*> m_connections;
+        Vec3 m_Position;
     };
 
 }
@@ -1,6 +1,9 @@
 #include "Precompiled.h"
 #include "Sound.h"
 #include "Core/OS/FileSystem.h"
+#include "WavLoader.h"
+#include "OggLoader.h"
+#include "Utilities/StringUtilities.h"
 
 #ifdef LUMOS_OPENAL
 #include "Platform/OpenAL/ALSound.h"
@@ -14,15 +17,32 @@ namespace Lumos
     {
     }
 
-    SharedPtr<Sound> Sound::Create(const std::string& name, const std::string& extension)
+    SharedPtr<Sound> Sound::Create(const std::string& name, const std::string& extension, bool load)
     {
 #ifdef LUMOS_OPENAL
-        return SharedPtr<ALSound>(new ALSound(name, extension));
+        return SharedPtr<ALSound>(new ALSound(name, extension, load));
 #else
         return nullptr;
 #endif
     }
 
+    bool Sound::Decode(const std::string& physicalPath)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const std::string extension = StringUtilities::GetFilePathExtension(physicalPath);
+        if(extension == "wav")
+            m_Data = LoadWav(physicalPath);
+        else if(extension == "ogg")
+            m_Data = LoadOgg(physicalPath);
+        else
+        {
+            LERROR("Unsupported audio format : %s", extension.c_str());
+            return false;
+        }
+
+        return m_Data.Size > 0;
+    }
+
     double Sound::GetLength() const
     {
         return m_Data.Length;
@@ -1,16 +1,18 @@
 #pragma once
 
 #include "Core/Core.h"
+#include "Core/Asset/Asset.h"
 #include "AudioData.h"
 
 namespace Lumos
 {
-    class LUMOS_EXPORT Sound
+    class LUMOS_EXPORT Sound : public Asset
     {
         friend class SoundManager;
 
     public:
-        static SharedPtr<Sound> Create(const std::string& name, const std::string& extension);
+        // load false leaves the sound empty for Decode and Upload, e.g. from the asset streamer
+        static SharedPtr<Sound> Create(const std::string& name, const std::string& extension, bool load = true);
         virtual ~Sound() = default;
 
         const u8* GetData() const
@@ -45,6 +47,14 @@ namespace Lumos
 
         const std::string& GetFilePath() const { return m_FilePath; }
 
+        // Reads a wav or ogg file into m_Data. Doesn't touch the audio device so it can run on a worker.
+        bool Decode(const std::string& physicalPath);
+
+        // Creates the device buffer from the decoded data, main thread only
+        virtual void Upload() { }
+
+        SET_ASSET_TYPE(AssetType::Audio);
+
         static void ConvertToMono(const uint8_t* inputData, int dataSize, uint8_t* monoData, int channels, int bitsPerSample);
 
     protected:
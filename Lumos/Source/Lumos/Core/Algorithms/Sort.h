@@ -32,5 +32,166 @@ namespace Lumos
                 }
             }
         }
+
+        template <typename T, typename CompareFunc = SmallerThan<T>>
+        constexpr void InsertionSort(T* first, T* last, CompareFunc compare = CompareFunc())
+        {
+            if(last - first < 2)
+                return;
+
+            for(T* it = first + 1; it != last; ++it)
+            {
+                T value = Move(*it);
+                T* hole = it;
+                while(hole != first && compare(value, *(hole - 1)))
+                {
+                    *hole = Move(*(hole - 1));
+                    --hole;
+                }
+                *hole = Move(value);
+            }
+        }
+
+        template <typename T, typename CompareFunc = SmallerThan<T>>
+        constexpr void HeapSort(T* first, T* last, CompareFunc compare = CompareFunc())
+        {
+            const ptrdiff_t count = last - first;
+
+            auto siftDown = [&](ptrdiff_t root, ptrdiff_t end)
+            {
+                while(2 * root + 1 < end)
+                {
+                    ptrdiff_t child = 2 * root + 1;
+                    if(child + 1 < end && compare(first[child], first[child + 1]))
+                        ++child;
+                    if(!compare(first[root], first[child]))
+                        return;
+                    Swap(first[root], first[child]);
+                    root = child;
+                }
+            };
+
+            for(ptrdiff_t start = count / 2 - 1; start >= 0; --start)
+                siftDown(start, count);
+
+            for(ptrdiff_t end = count - 1; end > 0; --end)
+            {
+                Swap(first[0], first[end]);
+                siftDown(0, end);
+            }
+        }
+
+        namespace Detail
+        {
+            static constexpr ptrdiff_t IntroSortThreshold = 16;
+
+            template <typename T, typename CompareFunc>
+            constexpr void IntroSortLoop(T* first, T* last, uint32_t depthLimit, CompareFunc& compare)
+            {
+                while(last - first > IntroSortThreshold)
+                {
+                    if(depthLimit == 0)
+                    {
+                        HeapSort(first, last, compare);
+                        return;
+                    }
+                    --depthLimit;
+
+                    // Median of three moved to the front as the pivot
+                    T* mid = first + (last - first) / 2;
+                    T* a   = first + 1;
+                    T* c   = last - 1;
+                    if(compare(*mid, *a))
+                        Swap(*mid, *a);
+                    if(compare(*c, *mid))
+                        Swap(*c, *mid);
+                    if(compare(*mid, *a))
+                        Swap(*mid, *a);
+                    Swap(*first, *mid);
+
+                    // Hoare partition around *first
+                    T* left  = first + 1;
+                    T* right = last;
+                    for(;;)
+                    {
+                        while(compare(*left, *first))
+                            ++left;
+                        --right;
+                        while(compare(*first, *right))
+                            --right;
+                        if(!(left < right))
+                            break;
+                        Swap(*left, *right);
+                        ++left;
+                    }
+
+                    IntroSortLoop(left, last, depthLimit, compare);
+                    last = left;
+                }
+            }
+        }
+
+        // Quicksort that falls back to heapsort when recursion gets too deep and finishes
+        // small ranges with insertion sort. O(n log n) worst case, not stable.
+        template <typename T, typename CompareFunc = SmallerThan<T>>
+        constexpr void IntroSort(T* first, T* last, CompareFunc compare = CompareFunc())
+        {
+            const ptrdiff_t count = last - first;
+            if(count < 2)
+                return;
+
+            uint32_t depthLimit = 0;
+            for(ptrdiff_t n = count; n > 1; n >>= 1)
+                depthLimit += 2;
+
+            Detail::IntroSortLoop(first, last, depthLimit, compare);
+            InsertionSort(first, last, compare);
+        }
+
+        // Stable LSD radix sort on an unsigned integer key, 8 bits per pass.
+        // Passes where every element shares the same byte are skipped, so sparse keys only pay for the bytes they use.
+        // scratch must hold (last - first) elements. The sorted result is always written back to [first, last).
+        template <typename T, typename KeyFunc>
+        void RadixSort(T* first, T* last, T* scratch, KeyFunc getKey)
+        {
+            using KeyType = decltype(getKey(*first));
+            static_assert(KeyType(-1) > KeyType(0), "RadixSort requires an unsigned integer key");
+
+            const size_t count = size_t(last - first);
+            if(count < 2)
+                return;
+
+            T* src = first;
+            T* dst = scratch;
+
+            for(uint32_t shift = 0; shift < sizeof(KeyType) * 8; shift += 8)
+            {
+                size_t histogram[256] = {};
+                for(size_t i = 0; i < count; i++)
+                    histogram[(getKey(src[i]) >> shift) & 0xFF]++;
+
+                if(histogram[(getKey(src[0]) >> shift) & 0xFF] == count)
+                    continue;
+
+                size_t offset = 0;
+                for(uint32_t bucket = 0; bucket < 256; bucket++)
+                {
+                    size_t bucketCount = histogram[bucket];
+                    histogram[bucket]  = offset;
+                    offset += bucketCount;
+                }
+
+                for(size_t i = 0; i < count; i++)
+                    dst[histogram[(getKey(src[i]) >> shift) & 0xFF]++] = src[i];
+
+                Swap(src, dst);
+            }
+
+            if(src != first)
+            {
+                for(size_t i = 0; i < count; i++)
+                    first[i] = Move(src[i]);
+            }
+        }
     }
-}
\ No newline at end of file
+}
@@ -221,6 +221,8 @@ namespace Lumos
         m_SceneRenderer = CreateUniquePtr<Graphics::SceneRenderer>(screenWidth, screenHeight);
         LINFO("Initialised SceneRenderer");
 
+        Graphics::Pipeline::WarmUp();
+
         LINFO("Waiting for JobSystem");
         System::JobSystem::Wait(context);
 
@@ -262,6 +264,7 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
         Serialise();
+        Graphics::Pipeline::SaveManifest();
 
         MutexDestroy(m_EventQueueMutex);
         MutexDestroy(m_MainThreadQueueMutex);
@@ -284,6 +287,7 @@ namespace Lumos
         m_SceneRenderer.reset();
         LuaManager::Release();
         m_SystemManager.reset();
+        FileSystem::Get().UnmountPack();
 
         Graphics::Pipeline::ClearCache();
         Graphics::RenderPass::ClearCache();
@@ -300,6 +304,7 @@ namespace Lumos
     void Application::OpenProject(const std::string& filePath)
     {
         LUMOS_PROFILE_FUNCTION();
+        Graphics::Pipeline::SaveManifest(); // Previous project is still mounted
         m_ProjectSettings.m_ProjectName = StringUtilities::GetFileName(filePath);
         m_ProjectSettings.m_ProjectName = StringUtilities::RemoveFilePathExtension(m_ProjectSettings.m_ProjectName);
 
@@ -337,7 +342,7 @@ namespace Lumos
                 LINFO("Embedded %i shaders.", EmbedShaderCount);
             }
             Graphics::Renderer::Init(loadEmbeddedShaders, m_ProjectSettings.m_EngineAssetPath);
-
+            Graphics::Pipeline::WarmUp();
         }
 
         m_SceneManager->LoadCurrentList();
@@ -383,6 +388,17 @@ namespace Lumos
     {
         m_AssetPath = Str8F(m_AssetPath, "%sAssets", m_ProjectSettings.m_ProjectRoot.c_str());
         FileSystem::Get().SetAssetPath(m_AssetPath);
+
+        // A cooked <ProjectName>.lpak next to the project shadows its loose assets
+        FileSystem::Get().UnmountPack();
+        if(m_UsePackedAssets && !Internal::CoreSystem::GetCmdLine()->OptionBool(Str8Lit("loose-assets")))
+        {
+            ArenaTemp scratch = ScratchBegin(0, 0);
+            String8 packPath  = PushStr8F(scratch.arena, "%s%s.lpak", m_ProjectSettings.m_ProjectRoot.c_str(), m_ProjectSettings.m_ProjectName.c_str());
+            if(FileSystem::FileExists(packPath))
+                FileSystem::Get().MountPack(packPath);
+            ScratchEnd(scratch);
+        }
     }
 
     Scene* Application::GetCurrentScene() const
@@ -429,6 +445,7 @@ namespace Lumos
         Input::Get().ResetGestures();
         m_Window->ProcessInput();
 
+        UpdateArenaStats();
         ArenaClear(m_FrameArena);
 
         if(m_SceneManager->GetSwitchingScene())
@@ -680,6 +697,11 @@ namespace Lumos
             LuaManager::Get().OnUpdate(m_SceneManager->GetCurrentScene());
             m_SceneManager->GetCurrentScene()->OnUpdate(dt);
         }
+        else if(Application::Get().GetEditorState() == EditorState::Preview)
+        {
+            // Emitters keep running while editing, the scene update isn't
+            m_SceneManager->GetCurrentScene()->UpdateParticles(dt);
+        }
         m_ImGuiManager->OnUpdate(dt, m_SceneManager->GetCurrentScene());
     }
 
@@ -202,7 +202,8 @@ namespace Lumos
 
     protected:
         ProjectSettings m_ProjectSettings;
-        bool m_ProjectLoaded = false;
+        bool m_ProjectLoaded   = false;
+        bool m_UsePackedAssets = true; // Mount the project's asset pack if it has one
 
     private:
         void AddDefaultScene();
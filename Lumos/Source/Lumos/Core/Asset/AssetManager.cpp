@@ -2,20 +2,20 @@
 #include "AssetManager.h"
 #include "AssetRegistry.h"
 #include "Core/Application.h"
+#include "Core/OS/FileSystem.h"
 #include "Graphics/RHI/Texture.h"
 #include "Utilities/StringPool.h"
-#include <future>
+#include "Utilities/StringUtilities.h"
 #include <inttypes.h>
 
 namespace Lumos
 {
-    static TDArray<std::future<void>> m_Futures;
-
     AssetManager::AssetManager()
     {
         m_Arena         = ArenaAlloc(Megabytes(4));
         m_StringPool    = CreateSharedPtr<StringPool>(m_Arena, 260);
         m_AssetRegistry = CreateSharedPtr<AssetRegistry>();
+        m_Streamer      = CreateSharedPtr<AssetStreamer>(m_AssetRegistry.get());
     }
 
     AssetManager::~AssetManager()
@@ -49,6 +49,9 @@ namespace Lumos
     AssetMetaData& AssetManager::AddAsset(UUID ID, SharedPtr<Asset> data, bool keepUnreferenced)
     {
         AssetRegistry& registry = *m_AssetRegistry;
+        if(data)
+            data->Handle = ID;
+
         if(m_AssetRegistry->Contains(ID))
         {
             AssetMetaData& metaData = registry[ID];
@@ -103,6 +106,7 @@ namespace Lumos
 
     void AssetManager::Update(float elapsedSeconds)
     {
+        m_Streamer->Update();
         m_AssetRegistry->Update(elapsedSeconds);
     }
 
@@ -134,38 +138,189 @@ namespace Lumos
         return true;
     }
 
-    static void LoadTexture2D(Graphics::Texture2D* tex, const String8& path)
+    static void ReleaseNone(AssetStreamRequest& request)
+    {
+    }
+
+    static bool LoadTexturePixels(AssetStreamRequest& request)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ImageLoadDesc* imageLoadDesc = new ImageLoadDesc();
+        imageLoadDesc->filePath      = request.PhysicalPath.c_str();
+        imageLoadDesc->maxWidth      = request.MaxDimension;
+        imageLoadDesc->maxHeight     = request.MaxDimension;
+        request.Payload              = imageLoadDesc;
+
+        if(!Lumos::LoadImageFromFile(*imageLoadDesc))
+            return false;
+
+        request.PayloadSize = uint64_t(imageLoadDesc->outWidth) * imageLoadDesc->outHeight * imageLoadDesc->outBits / 8;
+        return true;
+    }
+
+    static uint64_t UploadTexture(AssetStreamRequest& request)
     {
         LUMOS_PROFILE_FUNCTION();
-        ImageLoadDesc imageLoadDesc = {};
-        imageLoadDesc.filePath      = (const char*)path.str;
-        imageLoadDesc.maxHeight     = 256;
-        imageLoadDesc.maxWidth      = 256;
-        Lumos::LoadImageFromFile(imageLoadDesc);
+        ImageLoadDesc* imageLoadDesc = (ImageLoadDesc*)request.Payload;
 
         Graphics::TextureDesc desc;
-        desc.format = imageLoadDesc.outBits / 4 == 8 ? Graphics::RHIFormat::R8G8B8A8_Unorm : Graphics::RHIFormat::R32G32B32A32_Float;
+        desc.format = imageLoadDesc->outBits / 4 == 8 ? Graphics::RHIFormat::R8G8B8A8_Unorm : Graphics::RHIFormat::R32G32B32A32_Float;
 
-        Application::Get().SubmitToMainThread([tex, imageLoadDesc, desc]()
-                                              { tex->Load(imageLoadDesc.outWidth, imageLoadDesc.outHeight, imageLoadDesc.outPixels, desc); });
+        request.Data.As<Graphics::Texture2D>()->Load(imageLoadDesc->outWidth, imageLoadDesc->outHeight, imageLoadDesc->outPixels, desc);
+        return request.PayloadSize;
     }
 
-    bool AssetManager::LoadTexture(const String8& filePath, SharedPtr<Graphics::Texture2D>& texture, bool thread)
+    // Texture2D::Load copies the pixels into its staging buffer, they aren't needed after the upload
+    static void ReleaseTexturePixels(AssetStreamRequest& request)
     {
-        texture = SharedPtr<Graphics::Texture2D>(Graphics::Texture2D::Create({}, 1, 1));
-        if(thread)
-            m_Futures.PushBack(std::async(std::launch::async, &LoadTexture2D, texture.get(), filePath));
-        else
-            LoadTexture2D(texture.get(), filePath);
+        ImageLoadDesc* imageLoadDesc = (ImageLoadDesc*)request.Payload;
+        if(imageLoadDesc)
+            delete[] imageLoadDesc->outPixels;
+
+        delete imageLoadDesc;
+        request.Payload     = nullptr;
+        request.PayloadSize = 0;
+    }
+
+    // Reading, inflating and checking a cooked model happens here, the upload only creates its meshes and textures.
+    // Models without a current cooked copy are imported during the upload, the importers create meshes as they parse
+    static bool ReadCookedModel(AssetStreamRequest& request)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Graphics::CookedModel* cooked = Graphics::Model::ReadCooked(request.PhysicalPath);
+        request.Payload               = cooked;
+        request.PayloadSize           = Graphics::Model::GetCookedSize(cooked);
+        return true;
+    }
+
+    static uint64_t UploadModel(AssetStreamRequest& request)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        request.Data.As<Graphics::Model>()->LoadModelFromCooked(request.PhysicalPath, (const Graphics::CookedModel*)request.Payload);
+        return request.PayloadSize;
+    }
+
+    static void ReleaseCookedModel(AssetStreamRequest& request)
+    {
+        Graphics::Model::ReleaseCooked((Graphics::CookedModel*)request.Payload);
+        request.Payload     = nullptr;
+        request.PayloadSize = 0;
+    }
+
+    static bool DecodeSound(AssetStreamRequest& request)
+    {
+        Sound* sound        = (Sound*)request.Data.get();
+        bool decoded        = sound->Decode(request.PhysicalPath);
+        request.PayloadSize = sound->GetSize();
+        return decoded;
+    }
+
+    static uint64_t UploadSound(AssetStreamRequest& request)
+    {
+        ((Sound*)request.Data.get())->Upload();
+        return request.PayloadSize;
+    }
+
+    static bool BuildFontAtlas(AssetStreamRequest& request)
+    {
+        Graphics::Font* font = (Graphics::Font*)request.Data.get();
+        bool built           = font->BuildAtlas();
+        request.PayloadSize  = font->GetPendingAtlasSize();
+        return built;
+    }
+
+    static uint64_t UploadFontAtlas(AssetStreamRequest& request)
+    {
+        return ((Graphics::Font*)request.Data.get())->UploadAtlas();
+    }
+
+    static const AssetStreamHandler s_TextureStreamHandler = { &LoadTexturePixels, &UploadTexture, &ReleaseTexturePixels };
+    static const AssetStreamHandler s_ModelStreamHandler   = { &ReadCookedModel, &UploadModel, &ReleaseCookedModel };
+    static const AssetStreamHandler s_SoundStreamHandler   = { &DecodeSound, &UploadSound, &ReleaseNone };
+    static const AssetStreamHandler s_FontStreamHandler    = { &BuildFontAtlas, &UploadFontAtlas, &ReleaseNone };
+
+    template <typename T>
+    static SharedPtr<T> AssetAs(const SharedPtr<Asset>& asset)
+    {
+        return asset && asset->GetAssetType() == T::GetStaticType() ? asset.As<T>() : nullptr;
+    }
+
+    SharedPtr<Asset> AssetManager::FindAsset(const String8& filePath)
+    {
+        UUID ID;
+        if(m_AssetRegistry->GetID(filePath, ID) && m_AssetRegistry->Contains(ID))
+            return (*m_AssetRegistry)[ID].Data;
+
+        return nullptr;
+    }
+
+    void AssetManager::LoadStreamed(const String8& filePath, const SharedPtr<Asset>& asset, const AssetStreamHandler& handler, bool thread, float priority, uint32_t maxDimension)
+    {
+        m_Streamer->Request(asset->Handle, asset, filePath, handler, thread ? priority : AssetStreamer::PriorityImmediate, maxDimension);
+
+        if(!thread)
+            m_Streamer->Flush(asset->Handle);
+    }
 
+    bool AssetManager::LoadTexture(const String8& filePath, SharedPtr<Graphics::Texture2D>& texture, bool thread, uint32_t maxDimension)
+    {
+        texture = AssetAs<Graphics::Texture2D>(FindAsset(filePath));
+        if(texture)
+            return true;
+
+        texture = SharedPtr<Graphics::Texture2D>(Graphics::Texture2D::Create({}, 1, 1));
         AddAsset(filePath, texture);
+        LoadStreamed(filePath, texture, s_TextureStreamHandler, thread, AssetStreamer::PriorityImmediate, maxDimension);
         return true;
     }
 
-    SharedPtr<Graphics::Texture2D> AssetManager::LoadTextureAsset(const String8& filePath, bool thread)
+    SharedPtr<Graphics::Texture2D> AssetManager::LoadTextureAsset(const String8& filePath, bool thread, uint32_t maxDimension)
     {
         SharedPtr<Graphics::Texture2D> texture;
-        LoadTexture(filePath, texture, thread);
+        LoadTexture(filePath, texture, thread, maxDimension);
         return texture;
     }
+
+    SharedPtr<Graphics::Model> AssetManager::LoadModelAsset(const String8& filePath, bool thread, float priority)
+    {
+        // Not shared through the name like the other types, each entity animates its own model
+        SharedPtr<Graphics::Model> model = CreateSharedPtr<Graphics::Model>(ToStdString(filePath), false);
+        AddAsset(UUID(), model, false);
+        LoadStreamed(filePath, model, s_ModelStreamHandler, thread, priority);
+        return model;
+    }
+
+    SharedPtr<Sound> AssetManager::LoadSoundAsset(const String8& filePath, bool thread)
+    {
+        SharedPtr<Sound> sound = AssetAs<Sound>(FindAsset(filePath));
+        if(sound)
+            return sound;
+
+        const std::string path = ToStdString(filePath);
+        sound                  = Sound::Create(path, StringUtilities::GetFilePathExtension(path), false);
+        if(sound)
+        {
+            AddAsset(filePath, sound);
+            LoadStreamed(filePath, sound, s_SoundStreamHandler, thread, AssetStreamer::PriorityImmediate);
+        }
+        return sound;
+    }
+
+    SharedPtr<Graphics::Font> AssetManager::LoadFontAsset(const String8& filePath, bool thread)
+    {
+        SharedPtr<Graphics::Font> font = AssetAs<Graphics::Font>(FindAsset(filePath));
+        if(font)
+            return font;
+
+        // Font::BuildAtlas resolves its own path on the worker, so hand it the physical one
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 physicalPath;
+        FileSystem::Get().ResolvePhysicalPath(scratch.arena, filePath, &physicalPath);
+        font = CreateSharedPtr<Graphics::Font>(ToStdString(physicalPath), false);
+        ScratchEnd(scratch);
+
+        AddAsset(filePath, font);
+        LoadStreamed(filePath, font, s_FontStreamHandler, thread, AssetStreamer::PriorityImmediate);
+        return font;
+    }
 }
@@ -10,6 +10,7 @@
 #include "Asset.h"
 #include "AssetMetaData.h"
 #include "AssetRegistry.h"
+#include "AssetStreamer.h"
 
 namespace Lumos
 {
@@ -43,15 +44,27 @@ namespace Lumos
         bool LoadAsset(const String8& filePath, SharedPtr<Graphics::Shader>& shader, bool keepUnreferenced = true);
 
         SharedPtr<Asset> operator[](UUID name) { return GetAsset(name); }
-        SharedPtr<Graphics::Texture2D> LoadTextureAsset(const String8& filePath, bool thread);
+
+        // thread true returns a placeholder straight away and loads it through the streamer, the asset's metadata
+        // reports its progress. Loading a path that is already registered returns the existing asset, except for
+        // models which get a new instance each time.
+        SharedPtr<Graphics::Texture2D> LoadTextureAsset(const String8& filePath, bool thread, uint32_t maxDimension = 256);
+        SharedPtr<Graphics::Model> LoadModelAsset(const String8& filePath, bool thread, float priority = AssetStreamer::PriorityLowest);
+        SharedPtr<Sound> LoadSoundAsset(const String8& filePath, bool thread);
+        SharedPtr<Graphics::Font> LoadFontAsset(const String8& filePath, bool thread);
 
         SharedPtr<AssetRegistry> GetAssetRegistry() { return m_AssetRegistry; }
+        AssetStreamer& GetStreamer() { return *m_Streamer; }
 
     protected:
-        bool LoadTexture(const String8& filePath, SharedPtr<Graphics::Texture2D>& texture, bool thread);
+        bool LoadTexture(const String8& filePath, SharedPtr<Graphics::Texture2D>& texture, bool thread, uint32_t maxDimension);
+        SharedPtr<Asset> FindAsset(const String8& filePath);
+        // asset must already be registered
+        void LoadStreamed(const String8& filePath, const SharedPtr<Asset>& asset, const AssetStreamHandler& handler, bool thread, float priority, uint32_t maxDimension = 0);
 
         Arena* m_Arena;
         SharedPtr<AssetRegistry> m_AssetRegistry;
         SharedPtr<StringPool> m_StringPool;
+        SharedPtr<AssetStreamer> m_Streamer;
     };
 }
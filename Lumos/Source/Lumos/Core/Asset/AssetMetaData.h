@@ -5,6 +5,39 @@ namespace Lumos
     class Asset;
     enum class AssetType : uint16_t;
 
+    enum class AssetLoadState : uint8_t
+    {
+        Unloaded,
+        Queued,    // Waiting for a free streaming slot
+        Loading,   // Being read and decoded on a worker
+        Uploading, // Decoded, waiting for its share of the main thread upload budget
+        Loaded,
+        Failed,
+        Cancelled
+    };
+
+    inline const char* AssetLoadStateToString(AssetLoadState state)
+    {
+        switch(state)
+        {
+        case AssetLoadState::Unloaded:
+            return "Unloaded";
+        case AssetLoadState::Queued:
+            return "Queued";
+        case AssetLoadState::Loading:
+            return "Loading";
+        case AssetLoadState::Uploading:
+            return "Uploading";
+        case AssetLoadState::Loaded:
+            return "Loaded";
+        case AssetLoadState::Failed:
+            return "Failed";
+        case AssetLoadState::Cancelled:
+            return "Cancelled";
+        }
+        return "Unknown";
+    }
+
     struct AssetMetaData
     {
         float TimeSinceReload = 0.0f;
@@ -13,8 +46,9 @@ namespace Lumos
         bool bEmbeddedAsset   = false;
         bool Expire           = true;
         AssetType Type;
-        bool IsDataLoaded       = false;
-        bool IsMemoryAsset      = false;
-        uint64_t ParameterCache = 0;
+        bool IsDataLoaded        = false;
+        bool IsMemoryAsset       = false;
+        uint64_t ParameterCache  = 0;
+        AssetLoadState LoadState = AssetLoadState::Loaded;
     };
 }
@@ -0,0 +1,422 @@
+#include "Precompiled.h"
+#include "AssetPack.h"
+#include "AssetRegistry.h"
+#include "Graphics/ModelLoader/MeshCache.h"
+#include "Utilities/Hash.h"
+#include "Utilities/LoadImage.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/Timer.h"
+
+// A private copy for stbi_zlib_compress, GLTFLoader.cpp builds the shared one for tinygltf
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image.h>
+#include <stb_image_write.h>
+#include <algorithm>
+#include <filesystem>
+
+namespace Lumos
+{
+    AssetPack::~AssetPack()
+    {
+        Close();
+    }
+
+    bool AssetPack::Open(const String8& physicalPath)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Close();
+
+        if(!FileSystem::MapFile(physicalPath, &m_File))
+        {
+            LERROR("Failed to map asset pack %s", (const char*)physicalPath.str);
+            return false;
+        }
+
+        const AssetPackHeader* header = (const AssetPackHeader*)m_File.Data;
+        const bool valid              = m_File.Size >= sizeof(AssetPackHeader) && header->Magic == Magic && header->Version == Version && header->EntrySize == sizeof(AssetPackEntry)
+            && header->TOCOffset + uint64_t(header->EntryCount) * sizeof(AssetPackEntry) <= m_File.Size && header->StringsOffset + header->StringsSize <= m_File.Size;
+
+        if(!valid)
+        {
+            LERROR("Invalid or out of date asset pack %s", (const char*)physicalPath.str);
+            FileSystem::UnmapFile(&m_File);
+            return false;
+        }
+
+        m_Entries    = (const AssetPackEntry*)(m_File.Data + header->TOCOffset);
+        m_Strings    = (const char*)(m_File.Data + header->StringsOffset);
+        m_EntryCount = header->EntryCount;
+
+        m_Arena = ArenaAlloc(Kilobytes(64));
+        HashMapInit(&m_IDMap);
+        m_IDMap.arena = m_Arena;
+
+        for(uint32_t i = 0; i < m_EntryCount; i++)
+        {
+            const AssetPackEntry& entry = m_Entries[i];
+            if(entry.Offset + entry.Size > m_File.Size || uint64_t(entry.PathOffset) + entry.PathLength > header->StringsSize)
+            {
+                LERROR("Corrupt asset pack entry %u in %s", i, (const char*)physicalPath.str);
+                Close();
+                return false;
+            }
+
+            if(entry.ID != 0)
+                HashMapInsert(&m_IDMap, entry.ID, i);
+        }
+
+        return true;
+    }
+
+    void AssetPack::Close()
+    {
+        if(m_Arena)
+        {
+            ArenaRelease(m_Arena);
+            m_Arena = nullptr;
+        }
+
+        FileSystem::UnmapFile(&m_File);
+        m_Entries    = nullptr;
+        m_Strings    = nullptr;
+        m_EntryCount = 0;
+    }
+
+    const AssetPackEntry* AssetPack::Find(const String8& path) const
+    {
+        if(!m_Entries || path.size == 0)
+            return nullptr;
+
+        const uint64_t hash         = MurmurHash64A(path.str, (int)path.size, 0);
+        const AssetPackEntry* end   = m_Entries + m_EntryCount;
+        const AssetPackEntry* entry = std::lower_bound(m_Entries, end, hash, [](const AssetPackEntry& a, uint64_t b)
+                                                       { return a.PathHash < b; });
+
+        for(; entry != end && entry->PathHash == hash; entry++)
+        {
+            if(Str8Match(GetPath(*entry), path))
+                return entry;
+        }
+
+        return nullptr;
+    }
+
+    const AssetPackEntry* AssetPack::Find(UUID id) const
+    {
+        uint64_t key   = id;
+        uint32_t index = 0;
+        if(!m_Entries || !HashMapFind(&m_IDMap, key, &index))
+            return nullptr;
+
+        return &m_Entries[index];
+    }
+
+    String8 AssetPack::GetPath(const AssetPackEntry& entry) const
+    {
+        return Str8((uint8_t*)m_Strings + entry.PathOffset, entry.PathLength);
+    }
+
+    bool AssetPack::Read(Arena* arena, const AssetPackEntry& entry, String8* outData) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        uint8_t* data = m_File.Data + entry.Offset;
+
+        if(entry.Compression == AssetPackCompression::None)
+        {
+            *outData = Str8(data, entry.Size);
+            return true;
+        }
+
+        uint8_t* buffer = PushArrayNoZero(arena, uint8_t, entry.UncompressedSize);
+        if(!buffer || !ReadInto(entry, buffer))
+            return false;
+
+        *outData = Str8(buffer, entry.UncompressedSize);
+        return true;
+    }
+
+    bool AssetPack::ReadInto(const AssetPackEntry& entry, void* buffer) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint8_t* data = m_File.Data + entry.Offset;
+
+        if(entry.Compression == AssetPackCompression::None)
+        {
+            MemoryCopy(buffer, data, entry.Size);
+            return true;
+        }
+
+        const int size = stbi_zlib_decode_buffer((char*)buffer, (int)entry.UncompressedSize, (const char*)data, (int)entry.Size);
+        if(size != (int)entry.UncompressedSize)
+        {
+            LERROR("Failed to inflate %s from asset pack", ToCChar(GetPath(entry)));
+            return false;
+        }
+
+        return true;
+    }
+
+    static bool IsCookableImage(const std::string& extension)
+    {
+        return extension == "png" || extension == "jpg" || extension == "jpeg" || extension == "tga" || extension == "bmp" || extension == "hdr" || extension == "psd";
+    }
+
+    static bool ReadSource(const std::string& path, uint64_t size, TDArray<uint8_t>& buffer)
+    {
+        FILE* file = fopen(path.c_str(), FileSystem::GetFileOpenModeString(FileOpenFlags::READ));
+        if(!file)
+            return false;
+
+        buffer.Resize(size);
+        const bool success = fread(buffer.Data(), 1, size, file) == size;
+        fclose(file);
+        return success;
+    }
+
+    static bool WritePadding(FILE* file, uint64_t& offset)
+    {
+        static const uint8_t zeros[AssetPack::DataAlignment] = {};
+        const uint64_t padding                               = (AssetPack::DataAlignment - offset % AssetPack::DataAlignment) % AssetPack::DataAlignment;
+        offset += padding;
+        return padding == 0 || fwrite(zeros, 1, padding, file) == padding;
+    }
+
+    bool AssetPack::Cook(const String8& assetsPath, const String8& outPath, AssetRegistry* registry, const CookSettings& settings, CookStats* outStats)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        namespace fs = std::filesystem;
+
+        Timer timer;
+        CookStats stats;
+
+        const fs::path root = ToStdString(assetsPath);
+        if(!fs::is_directory(root))
+        {
+            LERROR("Asset folder %s not found", (const char*)assetsPath.str);
+            return false;
+        }
+
+        // Written next to the target then moved over it, a mounted pack keeps reading its old mapping
+        const std::string finalPath = ToStdString(outPath);
+        const std::string tempPath  = finalPath + ".tmp";
+        FILE* file                  = fopen(tempPath.c_str(), FileSystem::GetFileOpenModeString(FileOpenFlags::WRITE));
+        if(!file)
+        {
+            LERROR("Failed to create asset pack %s", tempPath.c_str());
+            return false;
+        }
+
+        AssetPackHeader header = {};
+        bool success           = fwrite(&header, sizeof(header), 1, file) == 1;
+        uint64_t offset        = sizeof(header);
+
+        TDArray<AssetPackEntry> entries;
+        TDArray<uint8_t> buffer; // Source or cooked bytes of the current file
+        std::string strings;
+
+        for(const fs::directory_entry& item : fs::recursive_directory_iterator(root))
+        {
+            if(!success)
+                break;
+
+            if(!item.is_regular_file())
+                continue;
+
+            // Cache holds machine specific data, e.g. the pipeline cache. Cooked meshes only depend on their source files
+            const std::string relative  = item.path().lexically_relative(root).generic_string();
+            const std::string extension = StringUtilities::ToLower(StringUtilities::GetFilePathExtension(relative));
+            const bool machineCache     = relative.rfind("Cache/", 0) == 0 && relative.rfind("Cache/Meshes/", 0) != 0;
+            if(machineCache || item.path().filename().string()[0] == '.' || extension == "lpak" || extension == "tmp")
+                continue;
+
+            const std::string vfsPath    = "//Assets/" + relative;
+            const std::string sourcePath = item.path().string();
+            const int64_t sourceSize     = FileSystem::GetFileSize(Str8StdS(sourcePath));
+
+            AssetPackEntry entry = {};
+            entry.PathHash       = MurmurHash64A(vfsPath.c_str(), (int)vfsPath.size(), 0);
+            entry.Kind           = extension == "spv" ? AssetPackEntryKind::Shader : (extension == "lmesh" ? AssetPackEntryKind::Mesh : AssetPackEntryKind::Raw);
+            entry.Compression    = AssetPackCompression::None;
+            entry.PathOffset     = (uint32_t)strings.size();
+            entry.PathLength     = (uint16_t)vfsPath.size();
+
+            UUID id(0);
+            entry.ID = registry && registry->GetID(Str8StdS(vfsPath), id) ? (uint64_t)id : 0;
+
+            // Images are stored as the pixels the texture upload takes, so loads from the pack skip the decode
+            uint8_t* data = nullptr;
+            if(settings.CookTextures && IsCookableImage(extension))
+            {
+                ImageLoadDesc desc = {};
+                desc.filePath      = sourcePath.c_str();
+                GetMaxImageDimensions(desc.maxWidth, desc.maxHeight);
+
+                if(LoadImageFromFile(desc))
+                {
+                    const uint64_t pixelSize = uint64_t(desc.outWidth) * desc.outHeight * (desc.outBits / 8);
+                    entry.UncompressedSize   = sizeof(AssetPackTexture) + pixelSize;
+                    buffer.Resize(entry.UncompressedSize);
+                    data = buffer.Data();
+
+                    AssetPackTexture* texture = (AssetPackTexture*)data;
+                    texture->Width            = desc.outWidth;
+                    texture->Height           = desc.outHeight;
+                    texture->Bits             = desc.outBits;
+                    texture->IsHDR            = desc.isHDR ? 1 : 0;
+                    MemoryCopy(data + sizeof(AssetPackTexture), desc.outPixels, pixelSize);
+
+                    entry.Kind = AssetPackEntryKind::Texture;
+                    stats.Textures++;
+                }
+
+                delete[] desc.outPixels;
+            }
+
+            if(!data)
+            {
+                entry.UncompressedSize = sourceSize > 0 ? (uint64_t)sourceSize : 0;
+                if(entry.UncompressedSize > 0 && !ReadSource(sourcePath, entry.UncompressedSize, buffer))
+                {
+                    LWARN("Skipping unreadable asset %s", sourcePath.c_str());
+                    continue;
+                }
+                data = buffer.Data();
+            }
+
+            // Loads from the pack trust its cooked meshes, so ones built from older sources are left out and reimported instead
+            if(entry.Kind == AssetPackEntryKind::Mesh && !Graphics::MeshCache::IsCurrent(Str8(data, entry.UncompressedSize)))
+            {
+                LINFO("Skipping stale mesh cache %s", vfsPath.c_str());
+                continue;
+            }
+
+            const uint8_t* stored     = data;
+            entry.Size                = entry.UncompressedSize;
+            unsigned char* compressed = nullptr;
+            const bool compressKind   = entry.Kind == AssetPackEntryKind::Texture ? settings.CompressTextures : entry.Kind != AssetPackEntryKind::Mesh || settings.CompressMeshes;
+            const bool compress       = settings.Compress && compressKind;
+            if(compress && entry.UncompressedSize > 0 && entry.UncompressedSize < uint64_t(INT_MAX))
+            {
+                int compressedSize = 0;
+                compressed         = stbi_zlib_compress(data, (int)entry.UncompressedSize, &compressedSize, settings.CompressionLevel);
+                if(compressed && compressedSize < entry.UncompressedSize * settings.MinCompressionRatio)
+                {
+                    stored            = compressed;
+                    entry.Size        = (uint64_t)compressedSize;
+                    entry.Compression = AssetPackCompression::Deflate;
+                    stats.Compressed++;
+                }
+            }
+
+            success      = WritePadding(file, offset);
+            entry.Offset = offset;
+            success      = success && (entry.Size == 0 || fwrite(stored, 1, entry.Size, file) == entry.Size);
+            offset += entry.Size;
+
+            free(compressed);
+
+            entries.PushBack(entry);
+            strings += vfsPath;
+
+            stats.Files++;
+            stats.SourceBytes += sourceSize > 0 ? (uint64_t)sourceSize : 0;
+        }
+
+        std::sort(entries.Data(), entries.Data() + entries.Size(), [](const AssetPackEntry& a, const AssetPackEntry& b)
+                  { return a.PathHash < b.PathHash; });
+
+        success              = success && WritePadding(file, offset);
+        header.Magic         = Magic;
+        header.Version       = Version;
+        header.EntryCount    = (uint32_t)entries.Size();
+        header.EntrySize     = sizeof(AssetPackEntry);
+        header.TOCOffset     = offset;
+        header.StringsOffset = offset + entries.Size() * sizeof(AssetPackEntry);
+        header.StringsSize   = strings.size();
+
+        success = success && (entries.Empty() || fwrite(entries.Data(), sizeof(AssetPackEntry), entries.Size(), file) == entries.Size());
+        success = success && (strings.empty() || fwrite(strings.data(), 1, strings.size(), file) == strings.size());
+        success = success && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+        success = fclose(file) == 0 && success;
+
+        std::error_code error;
+        if(success)
+            fs::rename(tempPath, finalPath, error);
+
+        if(!success || error)
+        {
+            LERROR("Failed to write asset pack %s", finalPath.c_str());
+            fs::remove(tempPath, error);
+            return false;
+        }
+
+        stats.PackedBytes = header.StringsOffset + header.StringsSize;
+        stats.Seconds     = (float)timer.GetElapsedS();
+        LINFO("Packed %u assets (%u textures cooked, %u compressed) into %s : %.2fMB -> %.2fMB in %.2fs", stats.Files, stats.Textures, stats.Compressed, finalPath.c_str(),
+              stats.SourceBytes / (1024.0f * 1024.0f), stats.PackedBytes / (1024.0f * 1024.0f), stats.Seconds);
+
+        if(outStats)
+            *outStats = stats;
+
+        return true;
+    }
+
+    bool AssetPack::Benchmark(const String8& assetsPath, const String8& outPath, AssetRegistry* registry, const CookSettings& settings)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        CookStats stats;
+        if(!Cook(assetsPath, outPath, registry, settings, &stats))
+            return false;
+
+        AssetPack pack;
+        if(!pack.Open(outPath))
+            return false;
+
+        const std::string root = ToStdString(assetsPath);
+        const String8 prefix   = Str8Lit("//Assets/");
+        Arena* arena           = ArenaAlloc(Megabytes(64));
+        uint32_t failed        = 0;
+
+        Timer looseTimer;
+        for(uint32_t i = 0; i < pack.GetEntryCount(); i++)
+        {
+            const AssetPackEntry& entry = pack.GetEntries()[i];
+            const String8 path          = pack.GetPath(entry);
+            const std::string source    = root + "/" + ToStdString(Str8Skip(path, prefix.size));
+            ArenaTemp temp              = ArenaTempBegin(arena);
+
+            if(entry.Kind == AssetPackEntryKind::Texture)
+            {
+                ImageLoadDesc desc = {};
+                desc.filePath      = source.c_str();
+                GetMaxImageDimensions(desc.maxWidth, desc.maxHeight);
+                failed += LoadImageFromFile(desc) ? 0 : 1;
+                delete[] desc.outPixels;
+            }
+            else
+            {
+                failed += entry.UncompressedSize == 0 || FileSystem::ReadFile(temp.arena, Str8StdS(source)) ? 0 : 1;
+            }
+
+            ArenaTempEnd(temp);
+        }
+        const float looseMS = looseTimer.GetElapsedMS();
+
+        Timer packedTimer;
+        for(uint32_t i = 0; i < pack.GetEntryCount(); i++)
+        {
+            const AssetPackEntry& entry = pack.GetEntries()[i];
+            ArenaTemp temp              = ArenaTempBegin(arena);
+            failed += pack.ReadInto(entry, PushArrayNoZero(temp.arena, uint8_t, entry.UncompressedSize)) ? 0 : 1;
+            ArenaTempEnd(temp);
+        }
+        const float packedMS = packedTimer.GetElapsedMS();
+        ArenaRelease(arena);
+
+        LINFO("Asset pack benchmark, %u assets (%u textures, %u compressed, %.2fMB) : loose %.1fms, packed %.1fms, %u failed", pack.GetEntryCount(), stats.Textures, stats.Compressed,
+              stats.PackedBytes / (1024.0f * 1024.0f), looseMS, packedMS, failed);
+
+        return failed == 0;
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "Core/OS/FileSystem.h"
+#include "Core/DataStructures/Map.h"
+#include "Core/UUID.h"
+
+namespace Lumos
+{
+    class AssetRegistry;
+
+    enum class AssetPackEntryKind : uint8_t
+    {
+        Raw,     // Source file as is
+        Texture, // AssetPackTexture header followed by decoded pixels
+        Shader,  // SPIR-V
+        Mesh     // Cooked model from the mesh cache
+    };
+
+    enum class AssetPackCompression : uint8_t
+    {
+        None,
+        Deflate
+    };
+
+    struct AssetPackHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t EntryCount;
+        uint32_t EntrySize;
+        uint64_t TOCOffset;
+        uint64_t StringsOffset;
+        uint64_t StringsSize;
+    };
+
+    struct AssetPackEntry
+    {
+        uint64_t PathHash; // MurmurHash64A of the VFS path, the table is sorted by it
+        uint64_t ID;       // Asset registry UUID, 0 when the file isn't a registered asset
+        uint64_t Offset;
+        uint64_t Size; // Bytes stored in the pack
+        uint64_t UncompressedSize;
+        uint32_t PathOffset;
+        uint16_t PathLength;
+        AssetPackEntryKind Kind;
+        AssetPackCompression Compression;
+    };
+
+    struct AssetPackTexture
+    {
+        uint32_t Width;
+        uint32_t Height;
+        uint32_t Bits; // Per pixel, always four channels
+        uint32_t IsHDR;
+    };
+
+    // Read only archive of a project's cooked assets, keyed by VFS path and asset UUID.
+    // The file is memory mapped, uncompressed entries are read in place.
+    // Layout is the header, entry data aligned to DataAlignment, then the table of contents and the path strings.
+    class AssetPack
+    {
+    public:
+        static constexpr uint32_t Magic         = 0x4B41504C; // LPAK
+        static constexpr uint32_t Version       = 3;
+        static constexpr uint64_t DataAlignment = 16;
+
+        struct CookSettings
+        {
+            bool Compress             = true;
+            bool CompressTextures     = false; // About a quarter of the pixel size, but inflating them costs most of the decode cooking saved
+            bool CompressMeshes       = false; // Smaller pack, but inflating them costs most of what cooking saved
+            bool CookTextures         = true;
+            int CompressionLevel      = 5;
+            float MinCompressionRatio = 0.9f; // Entries that don't shrink below this are stored uncompressed
+        };
+
+        struct CookStats
+        {
+            uint32_t Files       = 0;
+            uint32_t Textures    = 0;
+            uint32_t Compressed  = 0;
+            uint64_t SourceBytes = 0;
+            uint64_t PackedBytes = 0;
+            float Seconds        = 0.0f;
+        };
+
+        AssetPack() = default;
+        ~AssetPack();
+
+        NONCOPYABLEANDMOVE(AssetPack);
+
+        bool Open(const String8& physicalPath);
+        void Close();
+        bool IsOpen() const { return m_Entries != nullptr; }
+
+        const AssetPackEntry* Find(const String8& path) const;
+        const AssetPackEntry* Find(UUID id) const;
+        String8 GetPath(const AssetPackEntry& entry) const;
+
+        // Points into the mapping when the entry is stored uncompressed, otherwise inflates into arena
+        bool Read(Arena* arena, const AssetPackEntry& entry, String8* outData) const;
+
+        // Copies or inflates into buffer, which holds at least UncompressedSize bytes
+        bool ReadInto(const AssetPackEntry& entry, void* buffer) const;
+
+        uint32_t GetEntryCount() const { return m_EntryCount; }
+        const AssetPackEntry* GetEntries() const { return m_Entries; }
+
+        // Writes every file under assetsPath, the physical folder mounted as //Assets, into a new pack.
+        // Images are decoded up front and SPIR-V is tagged so the loaders can skip the source formats.
+        static bool Cook(const String8& assetsPath, const String8& outPath, AssetRegistry* registry, const CookSettings& settings, CookStats* outStats = nullptr);
+
+        // Cooks outPath then times loading every entry from its loose source, decoding images, against reading it from the pack.
+        // Both passes run on a warm file cache, so this measures parsing and copying rather than the disk.
+        static bool Benchmark(const String8& assetsPath, const String8& outPath, AssetRegistry* registry, const CookSettings& settings);
+
+    private:
+        MappedFile m_File;
+        const AssetPackEntry* m_Entries = nullptr;
+        const char* m_Strings           = nullptr;
+        uint32_t m_EntryCount           = 0;
+
+        Arena* m_Arena = nullptr;
+        HashMap(u64, u32) m_IDMap;
+    };
+}
@@ -0,0 +1,369 @@
+#include "Precompiled.h"
+#include "AssetStreamer.h"
+#include "AssetRegistry.h"
+#include "AssetPack.h"
+#include "Core/OS/FileSystem.h"
+#include "Core/Thread.h"
+#include "Core/Mutex.h"
+#include "Utilities/Timer.h"
+#include "Maths/MathsUtilities.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace Lumos
+{
+    static void RunLoad(AssetStreamRequest* request)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(!request->CancelRequested.load(std::memory_order_relaxed))
+            request->LoadSucceeded = request->Handler->Load(*request);
+
+        request->State.store(AssetLoadState::Uploading, std::memory_order_release);
+    }
+
+    AssetStreamer::AssetStreamer(AssetRegistry* registry)
+        : m_AssetRegistry(registry)
+    {
+        m_Arena = ArenaAlloc(Megabytes(1));
+        HashMapInit(&m_Requests);
+        m_Requests.arena = m_Arena;
+
+        m_Mutex = PushArray(m_Arena, Mutex, 1);
+        MutexInit(m_Mutex);
+    }
+
+    AssetStreamer::~AssetStreamer()
+    {
+        // Loads that already started can't be stopped, wait for them before freeing what they write to
+        for(AssetStreamRequest* request : m_Active)
+            request->CancelRequested.store(true, std::memory_order_relaxed);
+
+        while(System::JobSystem::IsBusy(m_Context))
+            std::this_thread::yield();
+
+        for(AssetStreamRequest* request : m_Pending)
+            delete request;
+
+        for(AssetStreamRequest* request : m_Active)
+        {
+            request->Handler->Release(*request);
+            delete request;
+        }
+
+        MutexDestroy(m_Mutex);
+        ArenaRelease(m_Arena);
+    }
+
+    void AssetStreamer::Request(UUID id, const SharedPtr<Asset>& data, const String8& path, const AssetStreamHandler& handler, float priority, uint32_t maxDimension)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ScopedMutex lock(m_Mutex);
+        AssetStreamRequest* existing = nullptr;
+        if(HashMapFind(&m_Requests, id, &existing))
+        {
+            existing->CancelRequested.store(false, std::memory_order_relaxed);
+            SetMetaDataState(id, existing->State.load(std::memory_order_relaxed));
+            SetRequestPriority(existing, Maths::Min(priority, existing->Priority));
+            return;
+        }
+
+        // Cooked textures in the mounted pack load straight from it by VFS path, everything else streams from loose files
+        // when they exist. Files that are only packed keep their VFS path too, e.g. models with a cooked mesh cache
+        AssetPack* pack             = FileSystem::Get().GetPack();
+        const AssetPackEntry* entry = pack ? pack->Find(path) : nullptr;
+        const bool cooked           = entry && entry->Kind == AssetPackEntryKind::Texture;
+
+        ArenaTemp scratch    = ScratchBegin(nullptr, 0);
+        String8 physicalPath = path;
+        const bool loose     = !cooked && FileSystem::Get().ResolvePhysicalPath(scratch.arena, path, &physicalPath);
+        if(!cooked && !loose)
+            physicalPath = path;
+
+        if(!cooked && !loose && !entry)
+        {
+            LWARN("Failed to stream asset %s : File Not Found", (const char*)path.str);
+            data->SetFlag(AssetFlag::Missing);
+            SetMetaDataState(id, AssetLoadState::Failed);
+            m_Stats.Failed++;
+            ScratchEnd(scratch);
+            return;
+        }
+
+        AssetStreamRequest* request = new AssetStreamRequest();
+        request->ID                 = id;
+        request->Data               = data;
+        request->PhysicalPath       = ToStdString(physicalPath);
+        request->Handler            = &handler;
+        request->Priority           = priority;
+        request->MaxDimension       = maxDimension;
+        ScratchEnd(scratch);
+
+        data->SetFlag(AssetFlag::UnLoaded);
+        data->SetFlag(AssetFlag::Loaded, false);
+
+        HashMapInsert(&m_Requests, id, request);
+        m_Pending.PushBack(request);
+        m_PendingDirty = true;
+        SetMetaDataState(id, AssetLoadState::Queued);
+    }
+
+    bool AssetStreamer::Cancel(UUID id)
+    {
+        ScopedMutex lock(m_Mutex);
+        AssetStreamRequest* request = nullptr;
+        if(!HashMapFind(&m_Requests, id, &request))
+            return false;
+
+        for(size_t i = 0; i < m_Pending.Size(); i++)
+        {
+            if(m_Pending[i] == request)
+            {
+                m_Pending[i] = m_Pending.Back();
+                m_Pending.PopBack();
+                m_PendingDirty = true;
+                Finish(request, AssetLoadState::Cancelled);
+                return true;
+            }
+        }
+
+        // Running or waiting for upload, Update frees it once the worker is done with it
+        request->CancelRequested.store(true, std::memory_order_relaxed);
+        SetMetaDataState(id, AssetLoadState::Cancelled);
+        return true;
+    }
+
+    void AssetStreamer::SetPriority(UUID id, float priority)
+    {
+        ScopedMutex lock(m_Mutex);
+        AssetStreamRequest* request = nullptr;
+        if(HashMapFind(&m_Requests, id, &request))
+            SetRequestPriority(request, priority);
+    }
+
+    void AssetStreamer::SetRequestPriority(AssetStreamRequest* request, float priority)
+    {
+        if(request->Priority != priority)
+        {
+            request->Priority = priority;
+            m_PendingDirty    = true;
+        }
+    }
+
+    AssetLoadState AssetStreamer::GetLoadState(UUID id) const
+    {
+        ScopedMutex lock(m_Mutex);
+        AssetStreamRequest* request = nullptr;
+        if(HashMapFind(&m_Requests, id, &request))
+            return request->CancelRequested.load(std::memory_order_relaxed) ? AssetLoadState::Cancelled : request->State.load(std::memory_order_acquire);
+
+        if(m_AssetRegistry->Contains(id))
+            return m_AssetRegistry->Get(id).LoadState;
+
+        return AssetLoadState::Unloaded;
+    }
+
+    bool AssetStreamer::IsStreaming(UUID id) const
+    {
+        ScopedMutex lock(m_Mutex);
+        AssetStreamRequest* request = nullptr;
+        return HashMapFind(&m_Requests, id, &request);
+    }
+
+    bool AssetStreamer::HasWork() const
+    {
+        ScopedMutex lock(m_Mutex);
+        return m_Requests.length > 0;
+    }
+
+    void AssetStreamer::Update()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Upload(true);
+        StartLoads();
+    }
+
+    void AssetStreamer::Flush()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        while(HasWork())
+        {
+            StartLoads();
+            Upload(false);
+
+            if(System::JobSystem::IsBusy(m_Context))
+                std::this_thread::yield();
+        }
+    }
+
+    void AssetStreamer::Flush(UUID id)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        SetPriority(id, PriorityImmediate);
+        while(IsStreaming(id))
+        {
+            StartLoads();
+            Upload(false);
+
+            if(System::JobSystem::IsBusy(m_Context))
+                std::this_thread::yield();
+        }
+    }
+
+    uint32_t AssetStreamer::GetMaxInFlight() const
+    {
+        if(m_Budget.MaxInFlight > 0)
+            return m_Budget.MaxInFlight;
+
+        // Leave a worker free for the frame's own jobs
+        const uint32_t threadCount = System::JobSystem::GetThreadCount();
+        return threadCount > 1 ? threadCount - 1 : 1;
+    }
+
+    void AssetStreamer::StartLoads()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ScopedMutex lock(m_Mutex);
+        if(m_PendingDirty)
+        {
+            std::sort(m_Pending.Data(), m_Pending.Data() + m_Pending.Size(), [](const AssetStreamRequest* a, const AssetStreamRequest* b)
+                      { return a->Priority > b->Priority; });
+            m_PendingDirty = false;
+        }
+
+        uint32_t loading       = 0;
+        uint64_t bufferedBytes = 0;
+        for(const AssetStreamRequest* request : m_Active)
+        {
+            if(request->State.load(std::memory_order_acquire) == AssetLoadState::Loading)
+                loading++;
+            else
+                bufferedBytes += request->PayloadSize;
+        }
+
+        // Sizes are only known once decoded, so the buffered bound applies to what is already waiting
+        const uint32_t maxInFlight = GetMaxInFlight();
+        while(!m_Pending.Empty() && loading < maxInFlight && bufferedBytes < m_Budget.MaxBufferedBytes)
+        {
+            AssetStreamRequest* request = m_Pending.Back();
+            m_Pending.PopBack();
+
+            request->State.store(AssetLoadState::Loading, std::memory_order_relaxed);
+            SetMetaDataState(request->ID, AssetLoadState::Loading);
+            m_Active.PushBack(request);
+            loading++;
+
+            System::JobSystem::ExecuteBackground(m_Context, [request](JobDispatchArgs args)
+                                                 { RunLoad(request); });
+        }
+
+        m_Stats.Pending       = m_Pending.Size();
+        m_Stats.Loading       = loading;
+        m_Stats.BufferedBytes = bufferedBytes;
+    }
+
+    void AssetStreamer::Upload(bool budgeted)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Timer timer;
+        uint32_t uploaded      = 0;
+        uint64_t uploadedBytes = 0;
+        uint32_t waiting       = 0;
+
+        // Finished loads leave m_Active under the lock. The handlers run without it, uploads may request more assets
+        m_Ready.Clear();
+        {
+            ScopedMutex lock(m_Mutex);
+            std::sort(m_Active.Data(), m_Active.Data() + m_Active.Size(), [](const AssetStreamRequest* a, const AssetStreamRequest* b)
+                      { return a->Priority < b->Priority; });
+
+            uint32_t kept = 0;
+            for(uint32_t i = 0; i < m_Active.Size(); i++)
+            {
+                AssetStreamRequest* request = m_Active[i];
+                if(request->State.load(std::memory_order_acquire) == AssetLoadState::Loading)
+                    m_Active[kept++] = request;
+                else
+                    m_Ready.PushBack(request);
+            }
+
+            m_Active.Resize(kept);
+        }
+
+        uint32_t kept = 0;
+        for(uint32_t i = 0; i < m_Ready.Size(); i++)
+        {
+            AssetStreamRequest* request = m_Ready[i];
+            const bool cancelled        = request->CancelRequested.load(std::memory_order_relaxed);
+            if(cancelled || !request->LoadSucceeded)
+            {
+                request->Handler->Release(*request);
+                ScopedMutex lock(m_Mutex);
+                Finish(request, cancelled ? AssetLoadState::Cancelled : AssetLoadState::Failed);
+                continue;
+            }
+
+            const bool overBudget = (float)timer.GetElapsedMS() >= m_Budget.UploadMilliseconds || uploadedBytes >= m_Budget.UploadBytes;
+            if(budgeted && uploaded > 0 && overBudget)
+            {
+                SetMetaDataState(request->ID, AssetLoadState::Uploading);
+                m_Ready[kept++] = request;
+                waiting++;
+                continue;
+            }
+
+            uploadedBytes += request->Handler->Upload(*request);
+            request->Handler->Release(*request);
+            uploaded++;
+
+            ScopedMutex lock(m_Mutex);
+            Finish(request, AssetLoadState::Loaded);
+        }
+
+        {
+            ScopedMutex lock(m_Mutex);
+            for(uint32_t i = 0; i < kept; i++)
+                m_Active.PushBack(m_Ready[i]);
+        }
+
+        m_Stats.AwaitingUpload         = waiting;
+        m_Stats.UploadedLastFrame      = uploaded;
+        m_Stats.UploadedBytesLastFrame = uploadedBytes;
+        m_Stats.UploadMsLastFrame      = (float)timer.GetElapsedMS();
+    }
+
+    void AssetStreamer::Finish(AssetStreamRequest* request, AssetLoadState state)
+    {
+        HashMapRemove(&m_Requests, request->ID);
+        SetMetaDataState(request->ID, state);
+
+        Asset* data = request->Data.get();
+        switch(state)
+        {
+        case AssetLoadState::Loaded:
+            data->SetFlag(AssetFlag::UnLoaded, false);
+            data->SetFlag(AssetFlag::Loaded);
+            m_Stats.Completed++;
+            break;
+        case AssetLoadState::Failed:
+            data->SetFlag(AssetFlag::Invalid);
+            m_Stats.Failed++;
+            break;
+        default:
+            m_Stats.Cancelled++;
+            break;
+        }
+
+        delete request;
+    }
+
+    void AssetStreamer::SetMetaDataState(UUID id, AssetLoadState state)
+    {
+        if(!m_AssetRegistry->Contains(id))
+            return;
+
+        AssetMetaData& metaData = m_AssetRegistry->Get(id);
+        metaData.LoadState      = state;
+        metaData.IsDataLoaded   = state == AssetLoadState::Loaded;
+    }
+}
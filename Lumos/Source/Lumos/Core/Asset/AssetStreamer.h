@@ -0,0 +1,123 @@
+#pragma once
+#include "Asset.h"
+#include "AssetMetaData.h"
+#include "Core/JobSystem.h"
+#include "Core/DataStructures/Map.h"
+#include "Core/DataStructures/TDArray.h"
+
+namespace Lumos
+{
+    class AssetRegistry;
+    struct AssetStreamRequest;
+    struct Mutex;
+
+    // Per asset type callbacks. Load runs as a background job on a job system worker and must not touch the graphics
+    // or audio device, Upload and Release run on the main thread.
+    struct AssetStreamHandler
+    {
+        bool (*Load)(AssetStreamRequest& request);       // Read and decode PhysicalPath into Payload
+        uint64_t (*Upload)(AssetStreamRequest& request); // Create device resources from Payload, returns bytes uploaded
+        void (*Release)(AssetStreamRequest& request);    // Free Payload, called after Upload and for cancelled requests
+    };
+
+    struct AssetStreamRequest
+    {
+        UUID ID;
+        SharedPtr<Asset> Data;
+        std::string PhysicalPath; // Resolved by Request. Cooked textures and files only in the pack keep their VFS path
+        const AssetStreamHandler* Handler = nullptr;
+        float Priority                    = 0.0f;
+        uint32_t MaxDimension             = 0; // Textures are downscaled to fit when non zero
+
+        std::atomic<AssetLoadState> State = AssetLoadState::Queued;
+        std::atomic<bool> CancelRequested = false;
+        bool LoadSucceeded                = false;
+
+        void* Payload        = nullptr;
+        uint64_t PayloadSize = 0; // Decoded bytes waiting for upload, counted against the buffered budget
+    };
+
+    // Loads assets in the background on the job system and uploads them on the main thread a few at a time.
+    // Pending requests start in priority order, lower first, while fewer than MaxInFlight loads are running and
+    // decoded data waiting for upload stays under MaxBufferedBytes. Update uploads finished loads, again in priority
+    // order, until either per frame budget runs out. At least one upload happens every frame so large assets still finish.
+    // Cancel, SetPriority and the queries can be called from any thread. Request, Update and Flush are main thread only,
+    // Request updates the asset registry's metadata, which is only safe to write from the main thread.
+    class AssetStreamer
+    {
+    public:
+        static constexpr float PriorityImmediate = 0.0f;    // Explicit requests, e.g. from the editor or scene load
+        static constexpr float PriorityLowest    = FLT_MAX; // Until something, e.g. the scene renderer, gives a better one
+
+        struct Budget
+        {
+            float UploadMilliseconds  = 4.0f;
+            uint64_t UploadBytes      = Megabytes(64);
+            uint64_t MaxBufferedBytes = Megabytes(256);
+            uint32_t MaxInFlight      = 0; // 0 uses one less than the job system thread count
+        };
+
+        struct Stats
+        {
+            uint32_t Pending                = 0;
+            uint32_t Loading                = 0;
+            uint32_t AwaitingUpload         = 0;
+            uint64_t BufferedBytes          = 0;
+            uint32_t UploadedLastFrame      = 0;
+            uint64_t UploadedBytesLastFrame = 0;
+            float UploadMsLastFrame         = 0.0f;
+            uint64_t Completed              = 0;
+            uint64_t Failed                 = 0;
+            uint64_t Cancelled              = 0;
+        };
+
+        AssetStreamer(AssetRegistry* registry);
+        ~AssetStreamer();
+
+        NONCOPYABLEANDMOVE(AssetStreamer);
+
+        // data must already be in the registry under id. Its metadata reports the load state from here on.
+        // Requesting an id that is already streaming only updates its priority.
+        void Request(UUID id, const SharedPtr<Asset>& data, const String8& path, const AssetStreamHandler& handler, float priority = PriorityImmediate, uint32_t maxDimension = 0);
+
+        // Drops the request if it hasn't been uploaded yet. Data stays as the unloaded placeholder.
+        bool Cancel(UUID id);
+        void SetPriority(UUID id, float priority);
+        AssetLoadState GetLoadState(UUID id) const;
+        bool IsStreaming(UUID id) const;
+        bool HasWork() const;
+
+        // Main thread, once per frame
+        void Update();
+
+        // Finishes every request, or just id, without the upload budget
+        void Flush();
+        void Flush(UUID id);
+
+        void SetBudget(const Budget& budget) { m_Budget = budget; }
+        const Budget& GetBudget() const { return m_Budget; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        void StartLoads();
+        void Upload(bool budgeted);
+        void SetRequestPriority(AssetStreamRequest* request, float priority);
+        void Finish(AssetStreamRequest* request, AssetLoadState state); // With m_Mutex held
+        void SetMetaDataState(UUID id, AssetLoadState state);
+        uint32_t GetMaxInFlight() const;
+
+        AssetRegistry* m_AssetRegistry;
+        Arena* m_Arena;
+        HashMap(UUID, AssetStreamRequest*) m_Requests;
+
+        TDArray<AssetStreamRequest*> m_Pending; // Sorted highest priority value first, so the next load is at the back
+        TDArray<AssetStreamRequest*> m_Active;  // Loading or loaded and waiting for upload
+        TDArray<AssetStreamRequest*> m_Ready;   // Taken out of m_Active by Upload while their handlers run
+        bool m_PendingDirty = false;
+        Mutex* m_Mutex; // Guards m_Requests, m_Pending, m_Active and m_PendingDirty
+
+        System::JobSystem::Context m_Context;
+        Budget m_Budget;
+        Stats m_Stats;
+    };
+}
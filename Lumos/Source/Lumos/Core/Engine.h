@@ -29,7 +29,12 @@ namespace Lumos
             uint32_t TriangleCount      = 0;
             uint32_t BoundPipelines     = 0;
             uint32_t BoundRenderPasses = 0;
+            uint32_t NumAnimatedSkeletons = 0;
+            uint32_t NumSampledSkeletons  = 0;
+            uint32_t NumBlendedSkeletons  = 0; // Between two samples of a lower update rate
+            uint32_t NumSkippedSkeletons  = 0; // Off screen or over the animation budget
             double FrameTime            = 0.0;
+            float AnimationTime         = 0.0f; // ms, set by the scene update so not reset with the render stats
             float UsedGPUMemory         = 0.0f;
             float UsedRam               = 0.0f;
             float TotalGPUMemory        = 0.0f;
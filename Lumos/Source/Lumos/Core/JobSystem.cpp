@@ -2,9 +2,9 @@
 #include "JobSystem.h"
 #include "Maths/MathsUtilities.h"
 #include "Core/DataStructures/TDArray.h"
-#include "Core/DataStructures/TSQueue.h"
 #include "Core/Thread.h"
 #include "Core/Mutex.h"
+#include "Utilities/Timer.h"
 
 #ifdef LUMOS_PLATFORM_WINDOWS
 #define NOMINMAX
@@ -65,48 +65,163 @@ namespace Lumos
         {
             struct Job
             {
-                Context* ctx;
                 Function<void(JobDispatchArgs)> task;
-                uint32_t groupID;
-                uint32_t groupJobOffset;
-                uint32_t groupJobEnd;
-                uint32_t sharedmemory_size;
+                Context* ctx = nullptr;
+                Job* parent  = nullptr; // Dispatch job that owns this group
+
+                std::atomic<uint32_t> unfinished { 1 };   // Groups still running for dispatch jobs
+                std::atomic<uint32_t> dependencies { 1 }; // Unfinished dependencies, plus one until submitted
+                std::atomic<uint32_t> refs { 1 };
+                std::atomic<bool> complete { false };
+                bool submitted  = false;
+                bool background = false; // Only picked up by idle workers, see ExecuteBackground
+
+                uint32_t groupID           = 0;
+                uint32_t groupJobOffset    = 0;
+                uint32_t groupJobEnd       = 1;
+                uint32_t jobCount          = 0; // Non zero for dispatch jobs
+                uint32_t groupSize         = 0;
+                uint32_t sharedmemory_size = 0;
+
+                SpinLock continuationLock;
+                TDArray<Job*> continuations;
             };
 
-            struct JobQueue
+            // Chase-Lev work stealing deque. The owning worker pushes and pops at the bottom (LIFO, cache warm),
+            // any other thread steals from the top (FIFO, oldest and usually largest work first).
+            // Fixed capacity, Push fails when full and the caller falls back to the overflow queue.
+            class WorkStealingDeque
             {
-                TSQueue<Job> queue;
-                Mutex* locker;
+            public:
+                static constexpr int64_t Capacity = 1024;
+                static constexpr int64_t Mask     = Capacity - 1;
 
-                JobQueue()
+                bool Push(Job* job)
                 {
-                    locker = new Mutex();
-                    MutexInit(locker);
+                    int64_t b = m_Bottom.load(std::memory_order_relaxed);
+                    int64_t t = m_Top.load(std::memory_order_acquire);
+                    if(b - t >= Capacity)
+                        return false;
+
+                    m_Buffer[b & Mask].store(job, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+                    m_Bottom.store(b + 1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                Job* Pop()
+                {
+                    int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+                    m_Bottom.store(b, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    int64_t t = m_Top.load(std::memory_order_relaxed);
+
+                    if(t > b)
+                    {
+                        m_Bottom.store(b + 1, std::memory_order_relaxed);
+                        return nullptr;
+                    }
+
+                    Job* job = m_Buffer[b & Mask].load(std::memory_order_relaxed);
+                    if(t == b)
+                    {
+                        // Last item, race any thieves for it
+                        if(!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                            job = nullptr;
+                        m_Bottom.store(b + 1, std::memory_order_relaxed);
+                    }
+                    return job;
+                }
+
+                Job* Steal()
+                {
+                    int64_t t = m_Top.load(std::memory_order_acquire);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    int64_t b = m_Bottom.load(std::memory_order_acquire);
+                    if(t >= b)
+                        return nullptr;
+
+                    Job* job = m_Buffer[t & Mask].load(std::memory_order_relaxed);
+                    if(!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        return nullptr;
+                    return job;
+                }
+
+            private:
+                alignas(64) std::atomic<int64_t> m_Top { 0 };
+                alignas(64) std::atomic<int64_t> m_Bottom { 0 };
+                std::atomic<Job*> m_Buffer[Capacity];
+            };
+
+            // Unbounded FIFO for jobs submitted from non worker threads and for full deques
+            class OverflowQueue
+            {
+            public:
+                OverflowQueue()
+                {
+                    MutexInit(&m_Lock);
+                    m_Buffer.Resize(256);
                 }
 
-                ~JobQueue()
+                ~OverflowQueue()
                 {
-                    MutexDestroy(locker);
-                    delete locker;
+                    MutexDestroy(&m_Lock);
                 }
 
-                inline void push_back(const Job& item)
+                void Push(Job* job)
                 {
-                    ScopedMutex lock(locker);
-                    queue.PushBack(item);
+                    ScopedMutex lock(&m_Lock);
+                    if(m_Count == m_Buffer.Size())
+                        Grow();
+
+                    m_Buffer[(m_Head + m_Count) % m_Buffer.Size()] = job;
+                    m_Count++;
+                    m_ApproxCount.store(m_Count, std::memory_order_relaxed);
                 }
 
-                inline bool pop_front(Job& item)
+                // Pops up to maxCount jobs from the front
+                uint32_t Pop(Job** outJobs, uint32_t maxCount)
                 {
-                    ScopedMutex lock(locker);
-                    if(queue.Empty())
+                    if(m_ApproxCount.load(std::memory_order_relaxed) == 0)
+                        return 0;
+
+                    ScopedMutex lock(&m_Lock);
+                    uint32_t count = (uint32_t)Maths::Min<size_t>(maxCount, m_Count);
+                    for(uint32_t i = 0; i < count; i++)
                     {
-                        return false;
+                        outJobs[i] = m_Buffer[m_Head];
+                        m_Head     = (m_Head + 1) % m_Buffer.Size();
                     }
-                    item = Move(queue.Front());
-                    queue.PopFront();
-                    return true;
+                    m_Count -= count;
+                    m_ApproxCount.store(m_Count, std::memory_order_relaxed);
+                    return count;
+                }
+
+            private:
+                void Grow()
+                {
+                    TDArray<Job*> buffer;
+                    buffer.Resize(m_Buffer.Size() * 2);
+                    for(size_t i = 0; i < m_Count; i++)
+                        buffer[i] = m_Buffer[(m_Head + i) % m_Buffer.Size()];
+                    m_Buffer = Move(buffer);
+                    m_Head   = 0;
                 }
+
+                Mutex m_Lock;
+                TDArray<Job*> m_Buffer;
+                size_t m_Head  = 0;
+                size_t m_Count = 0;
+                std::atomic<size_t> m_ApproxCount { 0 };
+            };
+
+            // Padded so workers don't share cache lines. Each worker writes its own slot, non worker threads
+            //    all share the last one, which is why the counters are atomic
+            struct alignas(64) ThreadStats
+            {
+                std::atomic<uint64_t> jobsExecuted { 0 };
+                std::atomic<uint64_t> jobsStolen { 0 };
+                std::atomic<uint64_t> overflowPushes { 0 };
             };
 
             // This structure is responsible to stop worker thread loops.
@@ -115,11 +230,15 @@ namespace Lumos
             {
                 uint32_t numCores   = 0;
                 uint32_t numThreads = 0;
-                JobQueue* jobQueuePerThread;
+                WorkStealingDeque* dequePerThread = nullptr;
+                ThreadStats* statsPerThread       = nullptr; // numThreads + 1, last slot shared by non worker threads
+                OverflowQueue overflowQueue;
+                OverflowQueue backgroundQueue;
                 std::atomic_bool alive { true };
+                std::atomic<uint32_t> pendingJobs { 0 };
+                std::atomic<uint32_t> sleepingThreads { 0 };
                 ConditionVar* wakeCondition;
                 Mutex* wakeMutex;
-                std::atomic<uint32_t> nextQueue { 0 };
                 TDArray<std::thread> threads;
 
                 InternalState()
@@ -135,37 +254,20 @@ namespace Lumos
                 {
                     LUMOS_PROFILE_FUNCTION_LOW();
 
-                    alive.store(false); // indicate that new jobs cannot be started from this point
-                    bool bWakeLoop = true;
-
-#ifdef LUMOS_PLATFORM_LINUX
-                    for(auto& thread : threads)
-                    {
-                        if(thread.joinable())
-                            thread.join();
-                    }
-                    bWakeLoop = false;
+                    // indicate that new jobs cannot be started from this point
+                    MutexLock(wakeMutex);
+                    alive.store(false);
                     ConditionNotifyAll(wakeCondition);
-#else
-                    std::thread waker([&]
-                                      {
-                        while (bWakeLoop)
-                        {
-                            ConditionNotifyAll(wakeCondition);
-                           // wakeCondition.notify_all(); // wakes up sleeping worker threads
-                        } });
+                    MutexUnlock(wakeMutex);
 
                     for(auto& thread : threads)
                     {
                         if(thread.joinable())
                             thread.join();
                     }
-                    bWakeLoop = false;
-                    if(waker.joinable())
-                        waker.join();
-#endif
 
-                    delete[] jobQueuePerThread;
+                    delete[] dequePerThread;
+                    delete[] statsPerThread;
                     ConditionDestroy(wakeCondition);
                     delete wakeCondition;
 
@@ -175,42 +277,302 @@ namespace Lumos
             };
             static InternalState* internal_state = nullptr;
 
-            // Start working on a job queue
-            //    After the job queue is finished, it can switch to an other queue and steal jobs from there
-            inline void work(uint32_t startingQueue)
+            // Index into dequePerThread for worker threads, -1 for any other thread
+            thread_local static int32_t s_WorkerIndex = -1;
+
+            // Finished jobs are recycled on whichever thread released them
+            struct JobFreeList
             {
-                LUMOS_PROFILE_FUNCTION_LOW();
-                Job job;
-                for(uint32_t i = 0; i < internal_state->numThreads; ++i)
+                static constexpr uint32_t MaxCached = 512;
+                TDArray<Job*> jobs;
+
+                ~JobFreeList()
                 {
-                    JobQueue& job_queue = internal_state->jobQueuePerThread[startingQueue % internal_state->numThreads];
-                    while(job_queue.pop_front(job))
+                    for(Job* job : jobs)
+                        delete job;
+                }
+            };
+            thread_local static JobFreeList s_JobFreeList;
+
+            static Job* AllocateJob()
+            {
+                Job* job;
+                if(!s_JobFreeList.jobs.Empty())
+                {
+                    job = s_JobFreeList.jobs.Back();
+                    s_JobFreeList.jobs.PopBack();
+                }
+                else
+                    job = new Job();
+
+                job->ctx    = nullptr;
+                job->parent = nullptr;
+                job->unfinished.store(1, std::memory_order_relaxed);
+                job->dependencies.store(1, std::memory_order_relaxed);
+                job->refs.store(1, std::memory_order_relaxed);
+                job->complete.store(false, std::memory_order_relaxed);
+                job->submitted         = false;
+                job->background        = false;
+                job->groupID           = 0;
+                job->groupJobOffset    = 0;
+                job->groupJobEnd       = 1;
+                job->jobCount          = 0;
+                job->groupSize         = 0;
+                job->sharedmemory_size = 0;
+                job->continuations.Clear();
+                return job;
+            }
+
+            static void ReleaseJob(Job* job)
+            {
+                if(job->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    return;
+
+                job->task = Function<void(JobDispatchArgs)>();
+                if(s_JobFreeList.jobs.Size() < JobFreeList::MaxCached)
+                    s_JobFreeList.jobs.PushBack(job);
+                else
+                    delete job;
+            }
+
+            static ThreadStats& GetThreadStats()
+            {
+                return internal_state->statsPerThread[s_WorkerIndex >= 0 ? (uint32_t)s_WorkerIndex : internal_state->numThreads];
+            }
+
+            static void WakeWorkers(uint32_t count)
+            {
+                // Taking the lock orders this against a worker that has checked pendingJobs but not started waiting yet
+                if(internal_state->sleepingThreads.load() == 0)
+                    return;
+
+                MutexLock(internal_state->wakeMutex);
+                MutexUnlock(internal_state->wakeMutex);
+                if(count > 1)
+                    ConditionNotifyAll(internal_state->wakeCondition);
+                else
+                    ConditionNotifyOne(internal_state->wakeCondition);
+            }
+
+            static void Enqueue(Job* job)
+            {
+                internal_state->pendingJobs.fetch_add(1);
+
+                if(job->background)
+                {
+                    internal_state->backgroundQueue.Push(job);
+                    return;
+                }
+
+                if(s_WorkerIndex >= 0 && internal_state->dequePerThread[s_WorkerIndex].Push(job))
+                    return;
+
+                if(s_WorkerIndex >= 0)
+                    GetThreadStats().overflowPushes.fetch_add(1, std::memory_order_relaxed);
+                internal_state->overflowQueue.Push(job);
+            }
+
+            static void CompleteJob(Job* job);
+
+            // Called once a job is submitted and all of its dependencies have finished
+            static void ScheduleJob(Job* job)
+            {
+                if(job->groupSize == 0)
+                {
+                    Enqueue(job);
+                    WakeWorkers(1);
+                    return;
+                }
+
+                const uint32_t groupCount = DispatchGroupCount(job->jobCount, job->groupSize);
+                if(groupCount == 0)
+                {
+                    CompleteJob(job);
+                    return;
+                }
+
+                job->unfinished.store(groupCount);
+                for(uint32_t groupID = 0; groupID < groupCount; ++groupID)
+                {
+                    Job* group              = AllocateJob();
+                    group->parent           = job;
+                    group->groupID          = groupID;
+                    group->groupJobOffset   = groupID * job->groupSize;
+                    group->groupJobEnd      = Maths::Min(group->groupJobOffset + job->groupSize, job->jobCount);
+                    group->sharedmemory_size = job->sharedmemory_size;
+                    Enqueue(group);
+                }
+
+                WakeWorkers(groupCount);
+            }
+
+            static void ResolveDependency(Job* job)
+            {
+                if(job->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    ScheduleJob(job);
+            }
+
+            static void CompleteJob(Job* job)
+            {
+                // Nothing can be appended once complete is set, so the list can be walked without the lock
+                job->continuationLock.lock();
+                job->complete.store(true, std::memory_order_release);
+                job->continuationLock.unlock();
+
+                for(Job* continuation : job->continuations)
+                {
+                    ResolveDependency(continuation);
+                    ReleaseJob(continuation);
+                }
+                job->continuations.Clear();
+
+                if(job->ctx)
+                    job->ctx->counter.fetch_sub(1);
+
+                ReleaseJob(job);
+            }
+
+            static void RunJob(Job* job)
+            {
+                Job* owner = job->parent ? job->parent : job;
+
+                JobDispatchArgs args;
+                args.groupID = job->groupID;
+                if(job->sharedmemory_size > 0)
+                {
+                    thread_local static TDArray<uint8_t> shared_allocation_data;
+                    shared_allocation_data.Reserve(job->sharedmemory_size);
+                    args.sharedmemory = shared_allocation_data.Data();
+                }
+                else
+                {
+                    args.sharedmemory = nullptr;
+                }
+
+                for(uint32_t j = job->groupJobOffset; j < job->groupJobEnd; ++j)
+                {
+                    args.jobIndex          = j;
+                    args.groupIndex        = j - job->groupJobOffset;
+                    args.isFirstJobInGroup = (j == job->groupJobOffset);
+                    args.isLastJobInGroup  = (j == job->groupJobEnd - 1);
+                    owner->task(args);
+                }
+
+                GetThreadStats().jobsExecuted.fetch_add(1, std::memory_order_relaxed);
+
+                if(job->parent)
+                {
+                    ReleaseJob(job);
+                    if(owner->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        CompleteJob(owner);
+                }
+                else
+                    CompleteJob(job);
+            }
+
+            // Background jobs are only taken by a worker with nothing else to do, never by a thread waiting on its own work
+            static Job* FindJob(bool allowBackground)
+            {
+                const int32_t workerIndex = s_WorkerIndex;
+                Job* job                  = nullptr;
+
+                if(workerIndex >= 0)
+                    job = internal_state->dequePerThread[workerIndex].Pop();
+
+                if(!job)
+                {
+                    // Workers take a few extra so the overflow lock is hit less often, the rest can be stolen from their deque
+                    static constexpr uint32_t OverflowBatch = 8;
+                    Job* jobs[OverflowBatch];
+                    uint32_t count = internal_state->overflowQueue.Pop(jobs, workerIndex >= 0 ? OverflowBatch : 1);
+                    if(count > 0)
                     {
-                        JobDispatchArgs args;
-                        args.groupID = job.groupID;
-                        if(job.sharedmemory_size > 0)
+                        job = jobs[0];
+                        for(uint32_t i = 1; i < count; i++)
                         {
-                            thread_local static TDArray<uint8_t> shared_allocation_data;
-                            shared_allocation_data.Reserve(job.sharedmemory_size);
-                            args.sharedmemory = shared_allocation_data.Data();
-                        }
-                        else
-                        {
-                            args.sharedmemory = nullptr;
+                            if(!internal_state->dequePerThread[workerIndex].Push(jobs[i]))
+                                internal_state->overflowQueue.Push(jobs[i]);
                         }
+                    }
+                }
 
-                        for(uint32_t j = job.groupJobOffset; j < job.groupJobEnd; ++j)
-                        {
-                            args.jobIndex          = j;
-                            args.groupIndex        = j - job.groupJobOffset;
-                            args.isFirstJobInGroup = (j == job.groupJobOffset);
-                            args.isLastJobInGroup  = (j == job.groupJobEnd - 1);
-                            job.task(args);
-                        }
+                if(!job)
+                {
+                    // Start at a different victim each time to spread contention
+                    thread_local static uint32_t s_StealSeed = 0x9E3779B9u ^ (uint32_t)(workerIndex + 1);
+                    s_StealSeed ^= s_StealSeed << 13;
+                    s_StealSeed ^= s_StealSeed >> 17;
+                    s_StealSeed ^= s_StealSeed << 5;
+
+                    const uint32_t numThreads = internal_state->numThreads;
+                    const uint32_t start      = s_StealSeed % numThreads;
+                    for(uint32_t i = 0; i < numThreads && !job; i++)
+                    {
+                        uint32_t victim = (start + i) % numThreads;
+                        if((int32_t)victim == workerIndex)
+                            continue;
+                        job = internal_state->dequePerThread[victim].Steal();
+                    }
+
+                    if(job)
+                        GetThreadStats().jobsStolen.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                if(!job && allowBackground && workerIndex >= 0)
+                    internal_state->backgroundQueue.Pop(&job, 1);
+
+                if(job)
+                    internal_state->pendingJobs.fetch_sub(1);
+
+                return job;
+            }
+
+            // Runs one queued job on the calling thread if any are available
+            static bool RunOneJob(bool allowBackground = false)
+            {
+                Job* job = FindJob(allowBackground);
+                if(!job)
+                    return false;
+
+                RunJob(job);
+                return true;
+            }
 
-                        job.ctx->counter.fetch_sub(1);
+            static void YieldThread()
+            {
+#ifdef LUMOS_PLATFORM_WINDOWS
+                SwitchToThread();
+#else
+                sched_yield();
+#endif
+            }
+
+            static void WorkerLoop()
+            {
+                while(internal_state->alive.load())
+                {
+                    if(RunOneJob(true))
+                        continue;
+
+                    // Spin briefly before sleeping, jobs often arrive in bursts
+                    bool found = false;
+                    for(int spin = 0; spin < 64 && !found; spin++)
+                    {
+#if !defined(LUMOS_PLATFORM_MACOS) && !defined(LUMOS_PLATFORM_IOS)
+                        _mm_pause();
+#endif
+                        found = internal_state->pendingJobs.load(std::memory_order_relaxed) > 0;
                     }
-                    startingQueue++; // go to next queue
+                    if(found)
+                        continue;
+
+                    // finished with jobs, put to sleep
+                    MutexLock(internal_state->wakeMutex);
+                    internal_state->sleepingThreads.fetch_add(1);
+                    while(internal_state->pendingJobs.load() == 0 && internal_state->alive.load())
+                        ConditionWait(internal_state->wakeCondition, internal_state->wakeMutex);
+                    internal_state->sleepingThreads.fetch_sub(1);
+                    MutexUnlock(internal_state->wakeMutex);
                 }
             }
 
@@ -231,7 +593,8 @@ namespace Lumos
                 internal_state->numThreads = Lumos::Maths::Max(1u, internal_state->numCores - reservedThreads);
 
                 // Keep one for update thread
-                internal_state->jobQueuePerThread = new JobQueue[internal_state->numThreads];
+                internal_state->dequePerThread = new WorkStealingDeque[internal_state->numThreads];
+                internal_state->statsPerThread = new ThreadStats[internal_state->numThreads + 1];
                 internal_state->threads.Reserve(internal_state->numThreads);
 
                 for(uint32_t threadID = 0; threadID < internal_state->numThreads; ++threadID)
@@ -244,15 +607,8 @@ namespace Lumos
                                 LUMOS_PROFILE_SETTHREADNAME((const char*)name.str);
                                 SetThreadName(name);
 
-                                while (internal_state->alive.load())
-                                {
-                                    work(threadID);
-
-                                    // finished with jobs, put to sleep
-                                    MutexLock(internal_state->wakeMutex);
-                                    ConditionWait(internal_state->wakeCondition, internal_state->wakeMutex);
-                                    MutexUnlock(internal_state->wakeMutex);
-                                } });
+                                s_WorkerIndex = (int32_t)threadID;
+                                WorkerLoop(); });
 
 #ifdef LUMOS_PLATFORM_WINDOWS
                     // Do Windows-specific thread setup:
@@ -307,8 +663,6 @@ namespace Lumos
 
                     // pthread_setname_np((const char*)name.str);
 #endif
-
-                    worker.detach();
                 }
 
                 LINFO("Initialised JobSystem with [%i cores] [%i threads]", internal_state->numCores, internal_state->numThreads);
@@ -325,22 +679,77 @@ namespace Lumos
                 return internal_state->numThreads;
             }
 
+            uint32_t GetCurrentThreadIndex()
+            {
+                return s_WorkerIndex >= 0 ? (uint32_t)s_WorkerIndex : internal_state->numThreads;
+            }
+
+            JobHandle::JobHandle(Job* job)
+                : m_Job(job)
+            {
+            }
+
+            JobHandle::JobHandle(const JobHandle& other)
+                : m_Job(other.m_Job)
+            {
+                if(m_Job)
+                    m_Job->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            JobHandle::JobHandle(JobHandle&& other) noexcept
+                : m_Job(other.m_Job)
+            {
+                other.m_Job = nullptr;
+            }
+
+            JobHandle::~JobHandle()
+            {
+                if(m_Job)
+                    ReleaseJob(m_Job);
+            }
+
+            JobHandle& JobHandle::operator=(const JobHandle& other)
+            {
+                if(this != &other)
+                {
+                    if(other.m_Job)
+                        other.m_Job->refs.fetch_add(1, std::memory_order_relaxed);
+                    if(m_Job)
+                        ReleaseJob(m_Job);
+                    m_Job = other.m_Job;
+                }
+                return *this;
+            }
+
+            JobHandle& JobHandle::operator=(JobHandle&& other) noexcept
+            {
+                Swap(m_Job, other.m_Job);
+                return *this;
+            }
+
             void Execute(Context& ctx, const Function<void(JobDispatchArgs)>& task)
             {
                 LUMOS_PROFILE_FUNCTION_LOW();
-                // Context state is updated:
+                Job* job  = AllocateJob();
+                job->task = task;
+
+                job->ctx       = &ctx;
+                job->submitted = true;
                 ctx.counter.fetch_add(1);
+                ResolveDependency(job);
+            }
 
-                Job job;
-                job.ctx               = &ctx;
-                job.task              = task;
-                job.groupID           = 0;
-                job.groupJobOffset    = 0;
-                job.groupJobEnd       = 1;
-                job.sharedmemory_size = 0;
+            void ExecuteBackground(Context& ctx, const Function<void(JobDispatchArgs)>& task)
+            {
+                LUMOS_PROFILE_FUNCTION_LOW();
+                Job* job  = AllocateJob();
+                job->task = task;
 
-                internal_state->jobQueuePerThread[internal_state->nextQueue.fetch_add(1) % internal_state->numThreads].push_back(job);
-                ConditionNotifyOne(internal_state->wakeCondition);
+                job->ctx        = &ctx;
+                job->submitted  = true;
+                job->background = true;
+                ctx.counter.fetch_add(1);
+                ResolveDependency(job);
             }
 
             void Dispatch(Context& ctx, uint32_t jobCount, uint32_t groupSize, const Function<void(JobDispatchArgs)>& task, size_t sharedmemory_size)
@@ -351,27 +760,16 @@ namespace Lumos
                     return;
                 }
 
-                const uint32_t groupCount = DispatchGroupCount(jobCount, groupSize);
-
-                // Context state is updated:
-                ctx.counter.fetch_add(groupCount);
-
-                Job job;
-                job.ctx               = &ctx;
-                job.task              = task;
-                job.sharedmemory_size = (uint32_t)sharedmemory_size;
-
-                for(uint32_t groupID = 0; groupID < groupCount; ++groupID)
-                {
-                    // For each group, generate one real job:
-                    job.groupID        = groupID;
-                    job.groupJobOffset = groupID * groupSize;
-                    job.groupJobEnd    = std::min(job.groupJobOffset + groupSize, jobCount);
-
-                    internal_state->jobQueuePerThread[internal_state->nextQueue.fetch_add(1) % internal_state->numThreads].push_back(job);
-                }
+                Job* job               = AllocateJob();
+                job->task              = task;
+                job->jobCount          = jobCount;
+                job->groupSize         = groupSize;
+                job->sharedmemory_size = (uint32_t)sharedmemory_size;
 
-                ConditionNotifyOne(internal_state->wakeCondition);
+                job->ctx       = &ctx;
+                job->submitted = true;
+                ctx.counter.fetch_add(1);
+                ResolveDependency(job);
             }
 
             uint32_t DispatchGroupCount(uint32_t jobCount, uint32_t groupSize)
@@ -389,27 +787,168 @@ namespace Lumos
             void Wait(const Context& ctx)
             {
                 LUMOS_PROFILE_FUNCTION_LOW();
-                if(IsBusy(ctx))
+                while(IsBusy(ctx))
                 {
-                    // Wake any threads that might be sleeping:
-                    ConditionNotifyAll(internal_state->wakeCondition);
+                    // Help out with any queued jobs. If there are none left the remaining ones are
+                    //    executing on other threads, so allow the OS to swap this thread out instead of spinning
+                    if(!RunOneJob())
+                        YieldThread();
+                }
+            }
 
-                    // work() will pick up any jobs that are on stand by and execute them on this thread:
-                    work(internal_state->nextQueue.fetch_add(1) % internal_state->numThreads);
+            JobHandle CreateJob(const Function<void(JobDispatchArgs)>& task)
+            {
+                Job* job  = AllocateJob();
+                job->task = task;
 
-                    while(IsBusy(ctx))
-                    {
-                        // If we are here, then there are still remaining jobs that work() couldn't pick up.
-                        //    In this case those jobs are not standing by on a queue but currently executing
-                        //    on other threads, so they cannot be picked up by this thread.
-                        //    Allow to swap out this thread by OS to not spin endlessly for nothing
-#ifdef LUMOS_PLATFORM_WINDOWS
-                        SwitchToThread();
-#else
-                        sched_yield();
-#endif
-                    }
+                // The returned handle holds the only reference until Submit adds the scheduler's,
+                //    so a job that is never submitted is freed with its last handle
+                return JobHandle(job);
+            }
+
+            JobHandle CreateDispatchJob(uint32_t jobCount, uint32_t groupSize, const Function<void(JobDispatchArgs)>& task, size_t sharedmemory_size)
+            {
+                ASSERT(groupSize > 0);
+                Job* job               = AllocateJob();
+                job->task              = task;
+                job->jobCount          = jobCount;
+                job->groupSize         = groupSize;
+                job->sharedmemory_size = (uint32_t)sharedmemory_size;
+                return JobHandle(job);
+            }
+
+            void AddDependency(const JobHandle& job, const JobHandle& dependency)
+            {
+                Job* target = job.Get();
+                Job* source = dependency.Get();
+                ASSERT(target && source && target != source);
+                ASSERT(!target->submitted, "Dependencies must be added before a job is submitted");
+
+                source->continuationLock.lock();
+                if(!source->complete.load(std::memory_order_acquire))
+                {
+                    target->dependencies.fetch_add(1, std::memory_order_relaxed);
+                    target->refs.fetch_add(1, std::memory_order_relaxed);
+                    source->continuations.PushBack(target);
+                }
+                source->continuationLock.unlock();
+            }
+
+            JobHandle Then(const JobHandle& job, const Function<void(JobDispatchArgs)>& task, Context* ctx)
+            {
+                JobHandle continuation = CreateJob(task);
+                AddDependency(continuation, job);
+                Submit(continuation, ctx);
+                return continuation;
+            }
+
+            void Submit(const JobHandle& job, Context* ctx)
+            {
+                Job* target = job.Get();
+                ASSERT(target && !target->submitted);
+
+                // Reference for the scheduler, released by CompleteJob
+                target->refs.fetch_add(1, std::memory_order_relaxed);
+                target->submitted = true;
+                target->ctx       = ctx;
+                if(ctx)
+                    ctx->counter.fetch_add(1);
+
+                ResolveDependency(target);
+            }
+
+            bool IsComplete(const JobHandle& job)
+            {
+                return job.Get()->complete.load(std::memory_order_acquire);
+            }
+
+            void Wait(const JobHandle& job)
+            {
+                LUMOS_PROFILE_FUNCTION_LOW();
+                ASSERT(job.Get()->submitted, "Waiting on a job that was never submitted");
+                while(!IsComplete(job))
+                {
+                    if(!RunOneJob())
+                        YieldThread();
+                }
+            }
+
+            Stats GetStats()
+            {
+                Stats stats;
+                for(uint32_t i = 0; i <= internal_state->numThreads; i++)
+                {
+                    const ThreadStats& threadStats = internal_state->statsPerThread[i];
+                    stats.JobsExecuted += threadStats.jobsExecuted.load(std::memory_order_relaxed);
+                    stats.JobsStolen += threadStats.jobsStolen.load(std::memory_order_relaxed);
+                    stats.OverflowPushes += threadStats.overflowPushes.load(std::memory_order_relaxed);
                 }
+                return stats;
+            }
+
+            // Small fixed amount of work per job, so scheduling overhead isn't hidden behind it
+            static uint64_t BenchmarkWork(uint32_t index)
+            {
+                uint64_t value = index;
+                for(uint32_t i = 0; i < 256; i++)
+                    value = value * 6364136223846793005ull + 1442695040888963407ull;
+                return value;
+            }
+
+            BenchmarkResult Benchmark(uint32_t jobCount, uint32_t iterations)
+            {
+                LUMOS_PROFILE_FUNCTION();
+                BenchmarkResult result;
+                if(jobCount == 0 || iterations == 0)
+                    return result;
+
+                TDArray<uint64_t> values;
+                values.Resize(jobCount);
+                uint64_t* data = values.Data();
+
+                uint64_t expected = 0;
+                for(uint32_t i = 0; i < jobCount; i++)
+                    expected += BenchmarkWork(i);
+
+                result.Valid = true;
+
+                Timer graphTimer;
+                for(uint32_t i = 0; i < iterations; i++)
+                {
+                    uint64_t sum     = 0;
+                    uint64_t* sumPtr = &sum;
+                    JobHandle fanOut = CreateDispatchJob(jobCount, 64, [data](JobDispatchArgs args)
+                                                         { data[args.jobIndex] = BenchmarkWork(args.jobIndex); });
+                    JobHandle fanIn  = Then(fanOut, [data, jobCount, sumPtr](JobDispatchArgs)
+                                            {
+                                                uint64_t total = 0;
+                                                for(uint32_t j = 0; j < jobCount; j++)
+                                                    total += data[j];
+                                                *sumPtr = total; });
+                    Submit(fanOut);
+                    Wait(fanIn);
+                    result.Valid = result.Valid && sum == expected;
+                }
+                result.GraphMS = graphTimer.GetElapsedMS() / iterations;
+
+                Timer dispatchTimer;
+                for(uint32_t i = 0; i < iterations; i++)
+                {
+                    Context ctx;
+                    Dispatch(ctx, jobCount, 64, [data](JobDispatchArgs args)
+                             { data[args.jobIndex] = BenchmarkWork(args.jobIndex); });
+                    Wait(ctx);
+
+                    uint64_t sum = 0;
+                    for(uint32_t j = 0; j < jobCount; j++)
+                        sum += data[j];
+                    result.Valid = result.Valid && sum == expected;
+                }
+                result.DispatchMS = dispatchTimer.GetElapsedMS() / iterations;
+
+                LINFO("JobSystem benchmark, %u jobs x %u iterations on %u threads : graph %.3fms, dispatch %.3fms%s", jobCount, iterations, internal_state->numThreads,
+                      result.GraphMS, result.DispatchMS, result.Valid ? "" : " (wrong results)");
+                return result;
             }
         }
     }
@@ -22,14 +22,58 @@ namespace Lumos
 
             uint32_t GetThreadCount();
 
+            // Worker threads return their index, every other thread returns GetThreadCount()
+            uint32_t GetCurrentThreadIndex();
+
             struct Context
             {
                 std::atomic<uint32_t> counter = 0;
             };
 
+            struct Job;
+
+            // Reference counted handle to a job created with CreateJob / CreateDispatchJob.
+            // Keeps the job alive so it can be waited on or used as a dependency after it has finished.
+            class JobHandle
+            {
+            public:
+                JobHandle() = default;
+                explicit JobHandle(Job* job);
+                JobHandle(const JobHandle& other);
+                JobHandle(JobHandle&& other) noexcept;
+                ~JobHandle();
+
+                JobHandle& operator=(const JobHandle& other);
+                JobHandle& operator=(JobHandle&& other) noexcept;
+
+                bool IsValid() const { return m_Job != nullptr; }
+                Job* Get() const { return m_Job; }
+
+            private:
+                Job* m_Job = nullptr;
+            };
+
+            struct Stats
+            {
+                uint64_t JobsExecuted   = 0;
+                uint64_t JobsStolen     = 0;
+                uint64_t OverflowPushes = 0;
+            };
+
+            struct BenchmarkResult
+            {
+                float GraphMS    = 0.0f; // Average per iteration
+                float DispatchMS = 0.0f;
+                bool Valid       = false;
+            };
+
             // Add a job to execute asynchronously. Any idle thread will execute this job.
             void Execute(Context& ctx, const Function<void(JobDispatchArgs)>& task);
 
+            // Like Execute, for long running work such as streaming loads. Only worker threads run it, and only from their
+            // idle loop, so a thread in Wait never picks one up in the middle of a frame.
+            void ExecuteBackground(Context& ctx, const Function<void(JobDispatchArgs)>& task);
+
             // Divide a job onto multiple jobs and execute in parallel.
             //	jobCount	: how many jobs to generate for this task.
             //	groupSize	: how many jobs to execute per thread. Jobs inside a group execute serially. It might be worth to increase for small jobs
@@ -43,6 +87,33 @@ namespace Lumos
 
             // Wait until all threads become idle
             void Wait(const Context& ctx);
+
+            // Job graph API. Jobs are created unsubmitted so dependencies can be added before they are allowed to run.
+            // A job runs once it has been submitted and every dependency has finished. A job that is never submitted
+            // never runs and is freed along with its last handle.
+            JobHandle CreateJob(const Function<void(JobDispatchArgs)>& task);
+            JobHandle CreateDispatchJob(uint32_t jobCount, uint32_t groupSize, const Function<void(JobDispatchArgs)>& task, size_t sharedmemory_size = 0);
+
+            // job will not start until dependency has finished. job must not have been submitted yet.
+            void AddDependency(const JobHandle& job, const JobHandle& dependency);
+
+            // Creates and submits a job that runs after job has finished
+            JobHandle Then(const JobHandle& job, const Function<void(JobDispatchArgs)>& task, Context* ctx = nullptr);
+
+            // ctx is optional and is counted as busy until the job finishes, so existing Wait(ctx) code can join a graph
+            void Submit(const JobHandle& job, Context* ctx = nullptr);
+
+            bool IsComplete(const JobHandle& job);
+
+            // Runs other jobs on the calling thread until job has finished
+            void Wait(const JobHandle& job);
+
+            // Totals since OnInit, summed across threads
+            Stats GetStats();
+
+            // Times a fan-out / fan-in graph, a jobCount wide dispatch job joined by a continuation that sums its results,
+            // against the same work through Dispatch and Wait(ctx). Jobs queued by anything else are counted in the timings.
+            BenchmarkResult Benchmark(uint32_t jobCount = 4096, uint32_t iterations = 100);
         }
     }
 }
@@ -1,8 +1,8 @@
 #include "Precompiled.h"
 #include "FileSystem.h"
-#include "Core/Application.h"
 #include "Maths/MathsUtilities.h"
 #include "Core/Thread.h"
+#include "Core/Asset/AssetPack.h"
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -61,7 +61,7 @@ namespace Lumos
         String8 pathSub2  = Substr8(path, { 2, Maths::Min(path.size, 8) });
         if(!Str8Match(pathSub2, assetsStr))
         {
-            *outPhysicalPath = PushStr8F(Application::Get().GetFrameArena(), "%s%s",
+            *outPhysicalPath = PushStr8F(arena, "%s%s",
                                          (char*)m_AssetsPath.str,
                                          ToCChar(Substr8(path, { 1, path.size })));
             NullTerminate((*outPhysicalPath));
@@ -70,7 +70,7 @@ namespace Lumos
         else
 #endif
         {
-            *outPhysicalPath = PushStr8F(Application::Get().GetFrameArena(), "%s%s",
+            *outPhysicalPath = PushStr8F(arena, "%s%s",
                                          (char*)m_AssetsPath.str,
                                          ToCChar(Substr8(path, { 8, path.size })));
             NullTerminate((*outPhysicalPath));
@@ -80,9 +80,26 @@ namespace Lumos
         return false;
     }
 
+    // Cooked textures aren't the source file's bytes, the image loader reads those itself
+    static const AssetPackEntry* FindPackedFile(AssetPack* pack, const String8& path)
+    {
+        if(!pack || !(path.size >= 2 && path.str[0] == '/' && path.str[1] == '/'))
+            return nullptr;
+
+        const AssetPackEntry* entry = pack->Find(path);
+        return entry && entry->Kind != AssetPackEntryKind::Texture ? entry : nullptr;
+    }
+
     uint8_t* FileSystem::ReadFileVFS(Arena* arena, const String8& path)
     {
         LUMOS_PROFILE_FUNCTION();
+        // Always a copy, the caller owns the buffer and the mapping is read only
+        if(const AssetPackEntry* entry = FindPackedFile(m_Pack, path))
+        {
+            uint8_t* buffer = PushArrayNoZero(arena, uint8_t, entry->UncompressedSize);
+            return buffer && m_Pack->ReadInto(*entry, buffer) ? buffer : nullptr;
+        }
+
         String8 physicalPath;
         return ResolvePhysicalPath(arena, path, &physicalPath) ? FileSystem::ReadFile(arena, physicalPath) : nullptr;
     }
@@ -90,6 +107,25 @@ namespace Lumos
     String8 FileSystem::ReadTextFileVFS(Arena* arena, const String8& path)
     {
         LUMOS_PROFILE_FUNCTION();
+        if(const AssetPackEntry* entry = FindPackedFile(m_Pack, path))
+        {
+            String8 text = PushStr8FillByte(arena, entry->UncompressedSize + 1, 0);
+            text.size    = entry->UncompressedSize;
+            if(!m_Pack->ReadInto(*entry, text.str))
+                return Str8Lit("");
+
+            // Strip carriage returns like ReadTextFile
+            uint64_t j = 0;
+            for(uint64_t i = 0; i < text.size; i++)
+            {
+                if(text.str[i] != '\r')
+                    text.str[j++] = text.str[i];
+            }
+            text.size = j;
+            NullTerminate(text);
+            return text;
+        }
+
         String8 physicalPath;
         if(ResolvePhysicalPath(arena, path, &physicalPath))
         {
@@ -99,6 +135,57 @@ namespace Lumos
         return Str8Lit("");
     }
 
+    bool FileSystem::ExistsVFS(const String8& path)
+    {
+        if(m_Pack && m_Pack->Find(path))
+            return true;
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 physicalPath;
+        const bool exists = ResolvePhysicalPath(scratch.arena, path, &physicalPath);
+        ScratchEnd(scratch);
+        return exists;
+    }
+
+    bool FileSystem::MapFileVFS(Arena* arena, const String8& path, String8* outData)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(const AssetPackEntry* entry = FindPackedFile(m_Pack, path))
+            return m_Pack->Read(arena, *entry, outData);
+
+        String8 physicalPath;
+        if(!ResolvePhysicalPath(arena, path, &physicalPath))
+            return false;
+
+        const int64_t size = FileSystem::GetFileSize(physicalPath);
+        uint8_t* data      = size > 0 ? FileSystem::ReadFile(arena, physicalPath) : nullptr;
+        *outData           = Str8(data, data ? size : 0);
+        return data != nullptr;
+    }
+
+    bool FileSystem::MountPack(const String8& physicalPath)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UnmountPack();
+
+        AssetPack* pack = new AssetPack();
+        if(!pack->Open(physicalPath))
+        {
+            delete pack;
+            return false;
+        }
+
+        m_Pack = pack;
+        LINFO("Mounted asset pack %s : %u files", (const char*)physicalPath.str, pack->GetEntryCount());
+        return true;
+    }
+
+    void FileSystem::UnmountPack()
+    {
+        delete m_Pack;
+        m_Pack = nullptr;
+    }
+
     bool FileSystem::WriteFileVFS(const String8& path, uint8_t* buffer, uint32_t size)
     {
         LUMOS_PROFILE_FUNCTION();
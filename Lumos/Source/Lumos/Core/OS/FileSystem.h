@@ -5,6 +5,8 @@
 
 namespace Lumos
 {
+    class AssetPack;
+
     enum class FileOpenFlags
     {
         READ,
@@ -13,11 +15,20 @@ namespace Lumos
         WRITE_READ
     };
 
+    // Read only view of a whole file. Handle is the platform mapping object
+    struct MappedFile
+    {
+        uint8_t* Data = nullptr;
+        uint64_t Size = 0;
+        void* Handle  = nullptr;
+    };
+
     class FileSystem : public ThreadSafeSingleton<FileSystem>
     {
         friend class ThreadSafeSingleton<FileSystem>;
 
     public:
+        // outPhysicalPath is allocated from arena, so workers can resolve paths with their own scratch arena
         bool ResolvePhysicalPath(Arena* arena, const String8& path, String8* outPhysicalPath, bool folder = false);
         bool AbsolutePathToFileSystem(Arena* arena, const String8& path, String8& outFileSystemPath, bool folder = false);
         String8 AbsolutePathToFileSystem(Arena* arena, const String8& path, bool folder = false);
@@ -28,6 +39,16 @@ namespace Lumos
         bool WriteFileVFS(const String8& path, uint8_t* buffer, uint32_t size);
         bool WriteTextFileVFS(const String8& path, const String8& text);
 
+        // Packed files shadow loose ones while a pack is mounted
+        bool ExistsVFS(const String8& path);
+
+        // Points straight into the mounted pack for uncompressed entries, otherwise reads or inflates into arena
+        bool MapFileVFS(Arena* arena, const String8& path, String8* outData);
+
+        bool MountPack(const String8& physicalPath);
+        void UnmountPack();
+        AssetPack* GetPack() const { return m_Pack; }
+
         void SetAssetPath(const String8& Path)
         {
             m_AssetsPath = Path;
@@ -38,6 +59,7 @@ namespace Lumos
         static bool FolderExists(const String8& path);
         static void CreateFolderIfDoesntExist(const String8& path);
         static int64_t GetFileSize(const String8& path);
+        static int64_t GetFileModifiedTime(const String8& path); // -1 if the file doesn't exist
 
         static uint8_t* ReadFile(Arena* arena, const String8& path);
         static bool ReadFile(Arena* arena, const String8& path, void* buffer, int64_t size = -1);
@@ -46,6 +68,9 @@ namespace Lumos
         static bool WriteFile(const String8& path, uint8_t* buffer, uint32_t size);
         static bool WriteTextFile(const String8& path, const String8& text);
 
+        static bool MapFile(const String8& path, MappedFile* outFile);
+        static void UnmapFile(MappedFile* file);
+
         static String8 GetWorkingDirectory(Arena* arena);
 
         static bool IsRelativePath(const char* path);
@@ -56,5 +81,6 @@ namespace Lumos
 
     private:
         String8 m_AssetsPath;
+        AssetPack* m_Pack = nullptr;
     };
 }
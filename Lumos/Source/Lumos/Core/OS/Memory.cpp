@@ -1,6 +1,14 @@
 #include "Precompiled.h"
 #include "Memory.h"
 
+#ifdef LUMOS_PLATFORM_WINDOWS
+#include <windows.h>
+#define LUMOS_ARENA_VIRTUAL_MEMORY
+#elif defined(LUMOS_PLATFORM_UNIX) && !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#define LUMOS_ARENA_VIRTUAL_MEMORY
+#endif
+
 namespace Lumos
 {
 #ifndef LUMOS_PRODUCTION
@@ -35,6 +43,38 @@ namespace Lumos
 #endif
     }
 
+    ArenaStats GetArenaStats(Arena* arena)
+    {
+        ArenaStats stats        = {};
+        stats.Used              = ArenaPos(arena);
+        stats.HighWater         = std::max(arena->HighWater, stats.Used);
+        stats.PushCountPerFrame = arena->PushCountPerFrame;
+        stats.PushBytesPerFrame = arena->PushBytesPerFrame;
+
+        for(Arena* block = arena->Ptr; block; block = block->Prev)
+        {
+            stats.Reserved += block->Size;
+            stats.Committed += block->Committed;
+            stats.BlockCount++;
+        }
+        return stats;
+    }
+
+    void UpdateArenaStats()
+    {
+#ifndef LUMOS_PRODUCTION
+        ArenaLockGuard lock;
+        for(int i = 0; i < s_CurrentArenaCount; i++)
+        {
+            Arena* arena             = s_Arenas[i];
+            arena->PushCountPerFrame = arena->PushCount - arena->SampledPushCount;
+            arena->PushBytesPerFrame = arena->PushBytes - arena->SampledPushBytes;
+            arena->SampledPushCount  = arena->PushCount;
+            arena->SampledPushBytes  = arena->PushBytes;
+        }
+#endif
+    }
+
     void* Memory::AlignedAlloc(size_t size, size_t alignment)
     {
         void* data;
@@ -84,13 +124,188 @@ namespace Lumos
     }
 
     // Arenas
-    Arena* ArenaAlloc(uint64_t size)
+    static constexpr uint64_t ARENA_RESERVE_SIZE       = uint64_t(Megabytes(64));
+    static constexpr uint64_t ARENA_COMMIT_SIZE        = uint64_t(Kilobytes(64));
+    static constexpr uint64_t ARENA_DECOMMIT_THRESHOLD = uint64_t(Megabytes(1));
+    static_assert(sizeof(Arena) % alignof(std::max_align_t) == 0, "Arena header must keep pushes aligned");
+
+    static uint64_t AlignUp(uint64_t value, uint64_t alignment)
     {
-        Arena* arena    = (Arena*)malloc(sizeof(Arena) + size);
-        arena->Position = sizeof(Arena);
-        arena->Align    = alignof(std::max_align_t);
-        arena->Size     = sizeof(Arena) + size;
-        arena->Ptr      = arena;
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+#ifdef LUMOS_ARENA_VIRTUAL_MEMORY
+    static void* ReserveMemory(uint64_t size)
+    {
+#ifdef LUMOS_PLATFORM_WINDOWS
+        return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        void* memory = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return memory == MAP_FAILED ? nullptr : memory;
+#endif
+    }
+
+    static bool CommitMemory(void* ptr, uint64_t size)
+    {
+#ifdef LUMOS_PLATFORM_WINDOWS
+        return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+        return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    static void DecommitMemory(void* ptr, uint64_t size)
+    {
+#ifdef LUMOS_PLATFORM_WINDOWS
+        VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+        madvise(ptr, size, MADV_DONTNEED);
+        mprotect(ptr, size, PROT_NONE);
+#endif
+    }
+
+    static void ReleaseMemory(void* ptr, uint64_t size)
+    {
+#ifdef LUMOS_PLATFORM_WINDOWS
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, size);
+#endif
+    }
+#endif
+
+    static Arena* ArenaAllocBlock(uint64_t size)
+    {
+        Arena* block        = nullptr;
+        uint64_t reserved   = size;
+        uint64_t committed  = size;
+        uint64_t blockFlags = ArenaFlags_None;
+
+#ifdef LUMOS_ARENA_VIRTUAL_MEMORY
+        reserved     = AlignUp(std::max(size, ARENA_RESERVE_SIZE), ARENA_COMMIT_SIZE);
+        committed    = ARENA_COMMIT_SIZE;
+        void* memory = ReserveMemory(reserved);
+        if(memory && !CommitMemory(memory, committed))
+        {
+            ReleaseMemory(memory, reserved);
+            memory = nullptr;
+        }
+        block = (Arena*)memory;
+#endif
+
+        if(!block)
+        {
+            // No address space reservation on this platform, so blocks are malloced and fully committed
+            reserved   = size;
+            committed  = size;
+            blockFlags = ArenaFlags_Malloc;
+            block      = (Arena*)malloc(size);
+            if(!block)
+                return nullptr;
+        }
+
+        memset(block, 0, sizeof(Arena));
+        block->Ptr       = block;
+        block->Position  = sizeof(Arena);
+        block->Align     = alignof(std::max_align_t);
+        block->Size      = reserved;
+        block->Committed = committed;
+        block->Flags     = blockFlags;
+        block->HighWater = sizeof(Arena);
+
+#if defined(LUMOS_PROFILE) && defined(TRACY_ENABLE) && LUMOS_TRACK_MEMORY
+        TracyAlloc(block, reserved);
+#endif
+        return block;
+    }
+
+    static void ArenaReleaseBlock(Arena* block)
+    {
+#if defined(LUMOS_PROFILE) && defined(TRACY_ENABLE) && LUMOS_TRACK_MEMORY
+        TracyFree(block);
+#endif
+#ifdef LUMOS_ARENA_VIRTUAL_MEMORY
+        if(!(block->Flags & ArenaFlags_Malloc))
+        {
+            ReleaseMemory(block, block->Size);
+            return;
+        }
+#endif
+        free(block);
+    }
+
+    static void ArenaDecommitTail(Arena* block)
+    {
+#ifdef LUMOS_ARENA_VIRTUAL_MEMORY
+        if(block->Flags & ArenaFlags_Malloc)
+            return;
+
+        // Keep a page range above the position so pushing back up doesn't fault straight away
+        uint64_t keep = std::min(AlignUp(block->Position, ARENA_COMMIT_SIZE) + ARENA_COMMIT_SIZE, block->Committed);
+        if(block->Committed - keep >= ARENA_DECOMMIT_THRESHOLD)
+        {
+            DecommitMemory((u8*)block + keep, block->Committed - keep);
+            block->Committed = keep;
+        }
+#endif
+    }
+
+    static void* ArenaPushImpl(Arena* arena, uint64_t size, uint64_t alignment)
+    {
+        Arena* current = arena->Ptr;
+        uint64_t start = AlignUp(reinterpret_cast<uintptr_t>(current) + current->Position, alignment) - reinterpret_cast<uintptr_t>(current);
+        uint64_t end   = start + size;
+
+        if(end > current->Size)
+        {
+            if(arena->Flags & ArenaFlags_NoChain)
+            {
+                ASSERT(false, "Not enough space in the arena");
+                return nullptr;
+            }
+
+            Arena* block = ArenaAllocBlock(std::max(arena->Size, sizeof(Arena) + size + alignment));
+            if(!block)
+            {
+                ASSERT(false, "Failed to allocate arena block");
+                return nullptr;
+            }
+
+            block->BasePos = current->BasePos + current->Size;
+            block->Prev    = current;
+            arena->Ptr     = block;
+            current        = block;
+
+            start = AlignUp(reinterpret_cast<uintptr_t>(current) + current->Position, alignment) - reinterpret_cast<uintptr_t>(current);
+            end   = start + size;
+        }
+
+#ifdef LUMOS_ARENA_VIRTUAL_MEMORY
+        if(end > current->Committed)
+        {
+            uint64_t commitEnd = std::min(AlignUp(end, ARENA_COMMIT_SIZE), current->Size);
+            if(!CommitMemory((u8*)current + current->Committed, commitEnd - current->Committed))
+            {
+                ASSERT(false, "Failed to commit arena memory");
+                return nullptr;
+            }
+            current->Committed = commitEnd;
+        }
+#endif
+
+        current->Position = end;
+
+        arena->PushCount++;
+        arena->PushBytes += size;
+
+        return (u8*)current + start;
+    }
+
+    Arena* ArenaAlloc(uint64_t size, uint64_t flags)
+    {
+        Arena* arena = ArenaAllocBlock(sizeof(Arena) + size);
+        ASSERT(arena, "Failed to allocate arena");
+        arena->Flags |= flags;
 
 #ifndef LUMOS_PRODUCTION
         {
@@ -99,9 +314,6 @@ namespace Lumos
                 s_Arenas[s_CurrentArenaCount++] = arena;
         }
 #endif
-#if defined(LUMOS_PROFILE) && defined(TRACY_ENABLE) && LUMOS_TRACK_MEMORY
-        TracyAlloc(arena, size);
-#endif
 
         return arena;
     }
@@ -115,9 +327,6 @@ namespace Lumos
     {
         if(arena)
         {
-#if defined(LUMOS_PROFILE) && defined(TRACY_ENABLE) && LUMOS_TRACK_MEMORY
-            TracyFree(arena);
-#endif
 #ifndef LUMOS_PRODUCTION
             {
                 ArenaLockGuard lock;
@@ -131,7 +340,12 @@ namespace Lumos
                 }
             }
 #endif
-            free(arena);
+            for(Arena* block = arena->Ptr; block;)
+            {
+                Arena* prev = block->Prev;
+                ArenaReleaseBlock(block);
+                block = prev;
+            }
         }
     }
 
@@ -139,38 +353,27 @@ namespace Lumos
     {
         ASSERT(arena != nullptr);
         uint64_t alignedSize = (size + arena->Align - 1) & ~(arena->Align - 1);
-        uint64_t newPos      = arena->Position + alignedSize;
 
-        if(newPos > arena->Size)
+        // Fast path when the push fits in the committed part of the current block
+        Arena* current = arena->Ptr;
+        uint64_t end   = current->Position + alignedSize;
+        if(end <= current->Committed)
         {
-            ASSERT(false, "Not enough space in the arena");
-            return nullptr;
+            void* ptr         = (u8*)current + current->Position;
+            current->Position = end;
+            arena->PushCount++;
+            arena->PushBytes += alignedSize;
+            return ptr;
         }
 
-        void* ptr       = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(arena->Ptr) + arena->Position);
-        arena->Position = newPos;
-        return ptr;
+        return ArenaPushImpl(arena, alignedSize, 1);
     }
 
     void* ArenaPushAligner(Arena* arena, uint64_t alignment)
     {
         ASSERT(arena != nullptr);
         ASSERT((alignment & (alignment - 1)) == 0); // Ensure alignment is a power of 2
-
-        uint64_t currentAddr      = reinterpret_cast<uintptr_t>(arena->Ptr) + arena->Position;
-        uint64_t alignedAddr      = (currentAddr + alignment - 1) & ~(alignment - 1);
-        uint64_t alignmentPadding = alignedAddr - currentAddr;
-        uint64_t newPos           = arena->Position + alignmentPadding;
-
-        if(newPos > arena->Size)
-        {
-            ASSERT(false, "Not enough space in the arena");
-            return nullptr; // Not enough space in the arena
-        }
-
-        void* ptr       = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(arena->Ptr) + newPos);
-        arena->Position = newPos;
-        return ptr;
+        return ArenaPushImpl(arena, 0, alignment);
     }
 
     void* ArenaPush(Arena* arena, uint64_t size)
@@ -186,8 +389,25 @@ namespace Lumos
     void ArenaPopTo(Arena* arena, uint64_t pos)
     {
         ASSERT(arena != nullptr);
-        ASSERT(pos <= arena->Position);
-        arena->Position = pos;
+        ASSERT(pos <= ArenaPos(arena));
+        pos = std::max(pos, uint64_t(sizeof(Arena)));
+
+        // The position only drops here, so the high water mark is tracked on pops rather than every push
+        arena->HighWater = std::max(arena->HighWater, ArenaPos(arena));
+
+        Arena* current = arena->Ptr;
+        while(current->BasePos >= pos)
+        {
+            Arena* prev = current->Prev;
+            ArenaReleaseBlock(current);
+            current = prev;
+        }
+
+        arena->Ptr        = current;
+        current->Position = pos - current->BasePos;
+
+        if(arena->Flags & ArenaFlags_Decommit)
+            ArenaDecommitTail(current);
     }
 
     void ArenaSetAutoAlign(Arena* arena, uint64_t align)
@@ -199,33 +419,38 @@ namespace Lumos
     void ArenaPopToPointer(Arena* arena, u8* ptr)
     {
         ASSERT(arena != nullptr);
-        ASSERT(ptr >= (u8*)arena->Ptr + sizeof(Arena) && ptr <= (u8*)arena->Ptr + arena->Position);
-        arena->Position = uint64_t(ptr - (u8*)arena->Ptr);
+        Arena* block = arena->Ptr;
+        while(block && !(ptr >= (u8*)block + sizeof(Arena) && ptr <= (u8*)block + block->Position))
+            block = block->Prev;
+
+        ASSERT(block, "Pointer is not in the arena");
+        if(block)
+            ArenaPopTo(arena, block->BasePos + uint64_t(ptr - (u8*)block));
     }
 
     void ArenaPop(Arena* arena, uint64_t size)
     {
         ASSERT(arena != nullptr);
-        ASSERT(size <= arena->Position - sizeof(Arena));
-        arena->Position -= size;
+        uint64_t pos = ArenaPos(arena);
+        ASSERT(size <= pos - sizeof(Arena));
+        ArenaPopTo(arena, pos - size);
     }
 
     void ArenaClear(Arena* arena)
     {
-        ASSERT(arena != nullptr);
-        arena->Position = sizeof(Arena);
+        ArenaPopTo(arena, sizeof(Arena));
     }
 
     uint64_t ArenaPos(Arena* arena)
     {
         ASSERT(arena != nullptr);
-        return arena->Position;
+        return arena->Ptr->BasePos + arena->Ptr->Position;
     }
 
     ArenaTemp ArenaTempBegin(Arena* arena)
     {
         ASSERT(arena != nullptr);
-        return { arena, arena->Position };
+        return { arena, ArenaPos(arena) };
     }
 
     void ArenaTempEnd(ArenaTemp temp)
@@ -13,13 +13,47 @@ namespace Lumos
         static void DeleteFunc(void* p);
     };
 
+    enum ArenaFlags : uint64_t
+    {
+        ArenaFlags_None     = 0,
+        ArenaFlags_NoChain  = 1 << 0, // Assert on overflow instead of chaining a new block. Keeps memory contiguous
+        ArenaFlags_Decommit = 1 << 1, // Return committed pages to the OS on ArenaClear/ArenaPopTo
+        ArenaFlags_Malloc   = 1 << 2, // Block was malloced rather than reserved
+    };
+
+    // An arena is a chain of blocks, each starting with this header. The first block is the handle
+    // callers hold: Ptr points at the current block, and the flags and stats are only kept on it.
+    // Blocks reserve address space up front and commit pages as the position grows past them.
     struct Arena
     {
-        uint64_t Position;
+        Arena* Prev;        // Previous block in the chain
+        Arena* Ptr;         // Current block
+        uint64_t Position;  // Offset into this block, including the header
         uint64_t Align;
-        uint64_t Size;
-        Arena* Ptr;
-        uint64_t _unused_[4];
+        uint64_t Size;      // Reserved bytes of this block
+        uint64_t Committed; // Committed bytes of this block
+        uint64_t BasePos;   // Offset of this block in the whole chain
+        uint64_t Flags;
+
+        uint64_t HighWater;
+        uint64_t PushCount;
+        uint64_t PushBytes;
+        uint64_t SampledPushCount;
+        uint64_t SampledPushBytes;
+        uint64_t PushCountPerFrame;
+        uint64_t PushBytesPerFrame;
+        uint64_t _unused_[1];
+    };
+
+    struct ArenaStats
+    {
+        uint64_t Used;
+        uint64_t HighWater;
+        uint64_t Reserved;
+        uint64_t Committed;
+        uint64_t PushCountPerFrame;
+        uint64_t PushBytesPerFrame;
+        uint32_t BlockCount;
     };
 
     struct ArenaTemp
@@ -31,7 +65,10 @@ namespace Lumos
     int GetArenaCount();
     Arena* GetArena(int index);
 
-    Arena* ArenaAlloc(uint64_t size);
+    ArenaStats GetArenaStats(Arena* arena);
+    void UpdateArenaStats();
+
+    Arena* ArenaAlloc(uint64_t size, uint64_t flags = ArenaFlags_None);
     Arena* ArenaAllocDefault();
     void ArenaRelease(Arena* arena);
     void* ArenaPushNoZero(Arena* arena, uint64_t size);
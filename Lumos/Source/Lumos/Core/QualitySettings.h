@@ -38,6 +38,29 @@ namespace Lumos
         bool EnableSSAO  = false;
         bool EnableFXAA  = true;
 
+        // Models loaded afterwards upload quantised vertex streams and 16 bit indices where possible
+        bool CompactVertices = true;
+
+        // Mesh LODs. Each mesh draws its coarsest LOD whose simplification error covers at most LODErrorPixels on screen.
+        // Going coarser needs the error to be LODHysteresis below that, so meshes near a threshold don't flicker between LODs.
+        bool EnableMeshLODs  = true;
+        float LODErrorPixels = 1.0f;
+        float LODHysteresis  = 0.25f;
+        u32 ShadowLODBias    = 1; // Extra LODs shadow casters drop by
+
+        // Skeleton update rates, from how big the renderer last drew them. Skeletons AnimationNearPixels across or more
+        // sample every frame, ones down to AnimationFarPixels every AnimationMidInterval frames and the rest, or ones only
+        // seen by shadows, every AnimationFarInterval frames with joints past AnimationFarJointDepth left in their rest pose.
+        // Frames in between blend the cached palettes. Skeletons nothing drew only move their clock on, or freeze.
+        bool EnableAnimationLOD        = true;
+        bool FreezeOffscreenAnimations = false;
+        float AnimationNearPixels      = 250.0f;
+        float AnimationFarPixels       = 60.0f;
+        u32 AnimationMidInterval       = 2;
+        u32 AnimationFarInterval       = 4;
+        u32 AnimationFarJointDepth     = 5;
+        float AnimationBudgetMs        = 2.0f; // Samples past this are put off to later frames, 0 for no limit
+
         u32 IrradianceMapSize = 64;
 #ifdef LUMOS_PLATFORM_MACOS
         u32 EnvironmentMapSize = 128;
@@ -57,7 +57,7 @@ namespace Lumos
             if(is_conflicting == 0)
             {
                 scratch.arena = tctx->ScratchArenas[tctx_idx];
-                scratch.pos   = scratch.arena->Position;
+                scratch.pos   = ArenaPos(scratch.arena);
                 break;
             }
         }
@@ -10,7 +10,7 @@ namespace Lumos
     void InitialiseUndo()
     {
         s_Undo                  = new UndoData();
-        s_Undo->copy            = ArenaAlloc(UNDO_MEMORY);
+        s_Undo->copy            = ArenaAlloc(UNDO_MEMORY, ArenaFlags_NoChain);
         s_Undo->copyTempStart = (u8*)s_Undo->copy->Ptr + s_Undo->copy->Position;
         s_Undo->copyRedoStart = (u8*)s_Undo->copy->Ptr + s_Undo->copy->Position;
     }
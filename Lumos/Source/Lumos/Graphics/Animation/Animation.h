@@ -31,6 +31,8 @@ namespace Lumos
             static AssetType GetStaticType() { return AssetType::Animation; }
             virtual AssetType GetAssetType() const override { return GetStaticType(); }
 
+            bool Valid() const { return m_Animation != nullptr; }
+
             const ozz::animation::Animation& GetAnimation() const
             {
                 ASSERT(m_Animation, "Attempted to access null animation!");
@@ -2,11 +2,8 @@
 #include "Skeleton.h"
 #include "AnimationController.h"
 #include "SamplingContext.h"
+#include "AnimationInstance.h"
 #include "Graphics/Renderers/DebugRenderer.h"
-#include "Graphics/RHI/DescriptorSet.h"
-#include "Graphics/RHI/Shader.h"
-#include "Core/Application.h"
-#include "Core/Asset/AssetManager.h"
 #include "Maths/MathsUtilities.h"
 
 #include <ozz/animation/runtime/animation.h>
@@ -14,13 +11,14 @@
 #include <ozz/animation/runtime/skeleton.h>
 #include <ozz/base/containers/vector.h>
 #include <ozz/base/maths/soa_transform.h>
+#include <ozz/base/maths/soa_float4x4.h>
 #include <ozz/base/memory/unique_ptr.h>
 
 #include <ozz/animation/offline/raw_skeleton.h>
 #include <ozz/animation/offline/skeleton_builder.h>
 #include <ozz/animation/offline/raw_animation.h>
 #include <ozz/animation/offline/animation_builder.h>
-#include <ozz/animation/runtime/animation.h>
+#include <ozz/animation/runtime/blending_job.h>
 #include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/animation/runtime/sampling_job.h>
 #include <ozz/base/span.h>
@@ -36,33 +34,28 @@ namespace Lumos
         {
             TDArray<SharedPtr<Animation>> m_AnimationStates;
             TDArray<std::string> m_AnimationNames;
-            ozz::vector<ozz::math::Float4x4> m_JointWorldMats;
-            TDArray<Mat4> m_BindPoses;
+            ozz::vector<ozz::math::Float4x4> m_InverseBindPoses;
             ozz::vector<uint16_t> m_JointRemap;
+
+            // For sampling with fewer joints, filled in by SetSkeleton
+            ozz::vector<ozz::math::Float4x4> m_RestTransforms;
+            ozz::vector<uint8_t> m_JointDepths;
+            uint32_t m_MaxJointDepth = 0;
         };
 
-        Mat4 ConvertToGLM(const ozz::math::Float4x4& ozzMat)
+        static float WrapTime(float time, float duration)
         {
-            LUMOS_PROFILE_FUNCTION_LOW();
-            Mat4 glmMat;
-
-            // Assuming ozz::math::Float4x4 is column-major
-            float matrix[16];
-            for(int r = 0; r < 4; r++)
-            {
-                float result[4];
-                std::memcpy(result, ozzMat.cols + r, sizeof(ozzMat.cols[r]));
-                float dresult[4];
-                for(int j = 0; j < 4; j++)
-                {
-                    dresult[j] = result[j];
-                }
-                //_mm_store_ps(result,p.cols[r]);
-                std::memcpy(matrix + r * 4, dresult, sizeof(dresult));
-            }
+            if(duration <= 0.0f)
+                return 0.0f;
+            time = fmodf(time, duration);
+            return time < 0.0f ? time + duration : time;
+        }
 
-            glmMat = Mat4(matrix);
-            return glmMat;
+        // Same conversion LocalToModelJob does, four joints at a time
+        static void ToLocalMatrices(const ozz::math::SoaTransform& transform, ozz::math::Float4x4 matrices[4])
+        {
+            const ozz::math::SoaFloat4x4 soaMatrices = ozz::math::SoaFloat4x4::FromAffine(transform.translation, transform.rotation, transform.scale);
+            ozz::math::Transpose16x16(&soaMatrices.cols[0].x, matrices->cols);
         }
 
         AnimationController::AnimationController()
@@ -77,46 +70,154 @@ namespace Lumos
             delete m_Data;
         }
 
-        void AnimationController::Update(float& animationTime, SamplingContext& context)
+        void AnimationController::Advance(AnimationInstance& instance, float dt) const
         {
-            LUMOS_PROFILE_FUNCTION();
-            if(m_Data->m_AnimationStates.Empty())
+            if(!instance.Playing || m_Data->m_AnimationStates.Empty())
                 return;
-            m_Data->m_JointWorldMats = ozz::vector<ozz::math::Float4x4>();
 
-            float ratio = animationTime / m_Data->m_AnimationStates[m_StateIndex]->GetAnimation().duration();
-            if(ratio >= 1.0f)
+            instance.State = Maths::Min(instance.State, (uint32_t)m_Data->m_AnimationStates.Size() - 1);
+            instance.Time  = WrapTime(instance.Time + dt * instance.Speed, GetDuration(instance.State));
+
+            if(instance.BlendWeight < 1.0f)
             {
-                animationTime = 0.0f;
-                ratio         = 0.0f;
+                instance.PreviousTime = WrapTime(instance.PreviousTime + dt * instance.Speed, GetDuration(instance.PreviousState));
+                instance.BlendWeight  = instance.BlendDuration > 0.0f ? Maths::Min(instance.BlendWeight + dt / instance.BlendDuration, 1.0f) : 1.0f;
             }
+        }
+
+        void AnimationController::Sample(AnimationInstance& instance, float timeAhead, uint32_t maxJointDepth) const
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(m_Data->m_AnimationStates.Empty() || !m_Skeleton || !m_Skeleton->IsValid())
+                return;
+
+            const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+            const int numJoints                      = skeleton.num_joints();
+            const int numSoaJoints                   = skeleton.num_soa_joints();
 
-            if(m_Skeleton.get() && m_Skeleton->IsValid())
+            instance.State = Maths::Min(instance.State, (uint32_t)m_Data->m_AnimationStates.Size() - 1);
+            instance.Context.resize(numJoints);
+            instance.Context.resizeSao(numSoaJoints);
+
+            // Looking ahead only happens while playing, the clock and cross fade are moved on as Advance would
+            if(!instance.Playing)
+                timeAhead = 0.0f;
+            const float ahead       = timeAhead * instance.Speed;
+            const float blendWeight = instance.BlendWeight < 1.0f && instance.BlendDuration > 0.0f ? Maths::Min(instance.BlendWeight + timeAhead / instance.BlendDuration, 1.0f) : 1.0f;
+            SampleState(instance.State, WrapTime(instance.Time + ahead, GetDuration(instance.State)), instance.Context);
+
+            ozz::span<const ozz::math::SoaTransform> localTransforms = ozz::make_span(instance.Context.m_LocalSpaceSoaTransforms);
+
+            if(blendWeight < 1.0f && instance.PreviousState < m_Data->m_AnimationStates.Size())
             {
-                context.resize(m_Skeleton->GetSkeleton().num_joints());
-                context.resizeSao(m_Skeleton->GetSkeleton().num_soa_joints());
-                UpdateSampling(ratio, context);
+                instance.PreviousContext.resize(numJoints);
+                instance.PreviousContext.resizeSao(numSoaJoints);
+                SampleState(instance.PreviousState, WrapTime(instance.PreviousTime + ahead, GetDuration(instance.PreviousState)), instance.PreviousContext);
+
+                ozz::animation::BlendingJob::Layer layers[2];
+                layers[0].weight    = 1.0f - blendWeight;
+                layers[0].transform = ozz::make_span(instance.PreviousContext.m_LocalSpaceSoaTransforms);
+                layers[1].weight    = blendWeight;
+                layers[1].transform = localTransforms;
+
+                instance.BlendedTransforms.resize(numSoaJoints);
+
+                ozz::animation::BlendingJob blendJob;
+                blendJob.threshold = 0.1f;
+                blendJob.layers    = layers;
+                blendJob.rest_pose = skeleton.joint_rest_poses();
+                blendJob.output    = ozz::make_span(instance.BlendedTransforms);
+
+                if(blendJob.Run())
+                    localTransforms = ozz::make_span(instance.BlendedTransforms);
+                else
+                    LERROR("Failed to run ozz BlendingJob");
+            }
 
-                if(m_Data->m_JointWorldMats.size() != m_Skeleton->GetSkeleton().num_joints())
-                    m_Data->m_JointWorldMats.resize(m_Skeleton->GetSkeleton().num_joints());
+            instance.ModelTransforms.resize(numJoints);
 
-                // Setup local-to-model conversion job.
+            if(maxJointDepth >= m_Data->m_MaxJointDepth || m_Data->m_JointDepths.size() != (size_t)numJoints)
+            {
                 ozz::animation::LocalToModelJob ltmJob;
-                ltmJob.skeleton = &m_Skeleton->GetSkeleton();
-                ltmJob.input    = ozz::make_span(context.GetLocalTransforms());
-                ltmJob.output   = ozz::make_span(m_Data->m_JointWorldMats);
+                ltmJob.skeleton = &skeleton;
+                ltmJob.input    = localTransforms;
+                ltmJob.output   = ozz::make_span(instance.ModelTransforms);
 
-                // Runs ltm job.
                 if(!ltmJob.Run())
                 {
                     LERROR("Failed to run ozz LocalToModelJob");
+                    return;
                 }
             }
+            else
+            {
+                // LocalToModelJob with the joints past maxJointDepth swapped for their rest pose, so they follow their
+                // parent rigidly. Groups of four with no joint shallow enough skip converting the sampled transforms
+                const ozz::span<const int16_t>& parents = skeleton.joint_parents();
+                ozz::math::Float4x4 localMatrices[4];
+                for(int soa = 0; soa < numSoaJoints; soa++)
+                {
+                    const int first = soa * 4;
+                    const int last  = Maths::Min(first + 4, numJoints);
+
+                    bool anySampled = false;
+                    for(int i = first; i < last; i++)
+                        anySampled |= m_Data->m_JointDepths[i] <= maxJointDepth;
+                    if(anySampled)
+                        ToLocalMatrices(localTransforms[soa], localMatrices);
+
+                    for(int i = first; i < last; i++)
+                    {
+                        const ozz::math::Float4x4& local = m_Data->m_JointDepths[i] <= maxJointDepth ? localMatrices[i & 3] : m_Data->m_RestTransforms[i];
+                        instance.ModelTransforms[i]      = parents[i] == ozz::animation::Skeleton::kNoParent ? local : instance.ModelTransforms[parents[i]] * local;
+                    }
+                }
+            }
+
+            // Mat4 and Float4x4 are both column major, so columns are stored straight into the palette
+            const size_t bindPoseCount = Maths::Min(m_Data->m_InverseBindPoses.size(), (size_t)numJoints);
+            instance.Palette.Resize(numJoints);
+            for(int i = 0; i < numJoints; i++)
+            {
+                const ozz::math::Float4x4 skinMatrix = i < (int)bindPoseCount ? instance.ModelTransforms[i] * m_Data->m_InverseBindPoses[i] : instance.ModelTransforms[i];
+                float* values                        = Maths::ValuePtr(instance.Palette[i]);
+                for(int c = 0; c < 4; c++)
+                    ozz::math::StorePtrU(skinMatrix.cols[c], values + c * 4);
+            }
+        }
+
+        float AnimationController::GetDuration(size_t state) const
+        {
+            if(state >= m_Data->m_AnimationStates.Size())
+                return 0.0f;
+            return m_Data->m_AnimationStates[state]->GetAnimation().duration();
         }
 
         void AnimationController::SetSkeleton(const SharedPtr<Skeleton>& skeleton)
         {
             m_Skeleton = skeleton;
+
+            m_Data->m_RestTransforms.clear();
+            m_Data->m_JointDepths.clear();
+            m_Data->m_MaxJointDepth = 0;
+            if(!m_Skeleton || !m_Skeleton->IsValid())
+                return;
+
+            // Parents always come before their children
+            const ozz::animation::Skeleton& ozzSkeleton = m_Skeleton->GetSkeleton();
+            const int numJoints                         = ozzSkeleton.num_joints();
+            const ozz::span<const int16_t>& parents     = ozzSkeleton.joint_parents();
+            m_Data->m_JointDepths.resize(numJoints);
+            for(int i = 0; i < numJoints; i++)
+            {
+                const uint32_t depth     = parents[i] == ozz::animation::Skeleton::kNoParent ? 0 : Maths::Min(m_Data->m_JointDepths[parents[i]] + 1u, 255u);
+                m_Data->m_JointDepths[i] = (uint8_t)depth;
+                m_Data->m_MaxJointDepth  = Maths::Max(m_Data->m_MaxJointDepth, depth);
+            }
+
+            m_Data->m_RestTransforms.resize(ozzSkeleton.num_soa_joints() * 4);
+            for(int soa = 0; soa < ozzSkeleton.num_soa_joints(); soa++)
+                ToLocalMatrices(ozzSkeleton.joint_rest_poses()[soa], &m_Data->m_RestTransforms[soa * 4]);
         }
 
         void AnimationController::SetCurrentState(const std::string& name)
@@ -159,44 +260,7 @@ namespace Lumos
             return m_Data->m_AnimationStates;
         }
 
-        SharedPtr<DescriptorSet> AnimationController::GetDescriptorSet()
-        {
-            LUMOS_PROFILE_FUNCTION_LOW();
-            if(!m_Descriptor)
-            {
-                Graphics::DescriptorDesc descriptorDesc {};
-                descriptorDesc.layoutIndex = 3;
-                descriptorDesc.shader      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRAnim")).As<Graphics::Shader>();
-                m_Descriptor               = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
-            }
-
-            auto test = GetJointMatrices();
-            m_Descriptor->SetUniformBufferData(0, test.Data(), (uint32_t)(sizeof(Mat4) * test.Size()));
-            m_Descriptor->Update();
-
-            return m_Descriptor;
-        }
-
-        TDArray<Mat4> AnimationController::GetJointMatrices()
-        {
-            LUMOS_PROFILE_FUNCTION_LOW();
-            TDArray<Mat4> glmMats;
-            for(size_t i = 0; i < m_Data->m_JointWorldMats.size(); i++)
-            {
-                ozz::math::Float4x4 skin_matrix = m_Data->m_JointWorldMats[i];
-                glmMats.PushBack(ConvertToGLM(skin_matrix) * m_Data->m_BindPoses[i]);
-            }
-
-            if(m_Data->m_JointWorldMats.empty())
-            {
-                LINFO("Using identy for joint matrices");
-                for(size_t i = 0; i < 100; i++)
-                    glmMats.PushBack(Mat4(1.0f));
-            }
-            return glmMats;
-        }
-
-        bool IsLeaf(const ozz::animation::Skeleton& _skeleton, int _joint)
+        static bool IsLeaf(const ozz::animation::Skeleton& _skeleton, int _joint)
         {
             const int num_joints = _skeleton.num_joints();
             assert(_joint >= 0 && _joint < num_joints && "_joint index out of range");
@@ -205,9 +269,12 @@ namespace Lumos
             return next == num_joints || parents[next] != _joint;
         }
 
-        void AnimationController::DebugDraw(const Mat4& transform)
+        void AnimationController::DebugDraw(const AnimationInstance& instance, const Mat4& transform) const
         {
             using namespace ozz;
+            if(!m_Skeleton || instance.ModelTransforms.size() != (size_t)m_Skeleton->GetSkeleton().num_joints())
+                return;
+
             const int num_joints               = m_Skeleton->GetSkeleton().num_joints();
             const span<const int16_t>& parents = m_Skeleton->GetSkeleton().joint_parents();
 
@@ -223,8 +290,8 @@ namespace Lumos
                 }
 
                 // Selects joint matrices.
-                const math::Float4x4& parent  = m_Data->m_JointWorldMats[parent_id];
-                const math::Float4x4& current = m_Data->m_JointWorldMats[i];
+                const math::Float4x4& parent  = instance.ModelTransforms[parent_id];
+                const math::Float4x4& current = instance.ModelTransforms[i];
 
                 // Copy parent joint's raw matrix, to render a bone between the parent
                 // and current matrix.
@@ -265,43 +332,28 @@ namespace Lumos
 
         void AnimationController::SetBindPoses(const TDArray<Mat4>& mats)
         {
-            m_Data->m_BindPoses = mats;
+            m_Data->m_InverseBindPoses.resize(mats.Size());
+            for(size_t i = 0; i < mats.Size(); i++)
+            {
+                const float* values = Maths::ValuePtr(mats[i]);
+                for(int c = 0; c < 4; c++)
+                    m_Data->m_InverseBindPoses[i].cols[c] = ozz::math::simd_float4::LoadPtrU(values + c * 4);
+            }
         }
 
-        void AnimationController::UpdateSampling(float ratio, SamplingContext& context)
+        void AnimationController::SampleState(size_t state, float time, SamplingContext& context) const
         {
-            LUMOS_PROFILE_FUNCTION();
-            ozz::animation::SamplingJob sampling_job;
-            sampling_job.animation = &m_Data->m_AnimationStates[m_StateIndex]->GetAnimation();
-            sampling_job.context   = &context.m_Context;
-            sampling_job.ratio     = ratio;
-            sampling_job.output    = ozz::make_span(context.m_LocalSpaceSoaTransforms);
-            if(!sampling_job.Run())
+            const ozz::animation::Animation& animation = m_Data->m_AnimationStates[state]->GetAnimation();
+
+            ozz::animation::SamplingJob samplingJob;
+            samplingJob.animation = &animation;
+            samplingJob.context   = &context.m_Context;
+            samplingJob.ratio     = animation.duration() > 0.0f ? Maths::Min(time / animation.duration(), 1.0f) : 0.0f;
+            samplingJob.output    = ozz::make_span(context.m_LocalSpaceSoaTransforms);
+            if(!samplingJob.Run())
             {
                 LERROR("ozz animation sampling job failed!");
             }
-
-            for(int i = 0; i < context.m_LocalSpaceSoaTransforms.size(); ++i)
-            {
-                ozz::math::SimdFloat4 translations[4];
-                ozz::math::SimdFloat4 scales[4];
-                ozz::math::SimdFloat4 rotations[4];
-
-                ozz::math::Transpose3x4(&context.m_LocalSpaceSoaTransforms[i].translation.x, translations);
-                ozz::math::Transpose3x4(&context.m_LocalSpaceSoaTransforms[i].scale.x, scales);
-                ozz::math::Transpose4x4(&context.m_LocalSpaceSoaTransforms[i].rotation.x, rotations);
-
-                for(int j = 0; j < 4; ++j)
-                {
-                    auto index = i * 4 + j;
-                    if(index >= context.LocalTranslations.size())
-                        break;
-
-                    ozz::math::Store3PtrU(translations[j], Maths::ValuePtr(context.LocalTranslations[index]));
-                    ozz::math::Store3PtrU(scales[j], Maths::ValuePtr(context.LocalScales[index]));
-                    ozz::math::StorePtrU(rotations[j], Maths::ValuePtr(context.LocalRotations[index]));
-                }
-            }
         }
     }
 }
@@ -9,11 +9,12 @@ namespace Lumos
 {
     namespace Graphics
     {
-        class DescriptorSet;
         struct SamplingContext;
+        struct AnimationInstance;
         struct AnimationData;
 
-        // Controls which animation (or animations) is playing on a mesh.
+        // The animations a skeleton can play. Shared by every entity using the same model, the playback state of each
+        // entity is kept in its AnimationInstance.
         class AnimationController : public Asset
         {
             friend class Model;
@@ -24,7 +25,13 @@ namespace Lumos
 
             virtual ~AnimationController();
 
-            void Update(float& animationTime, SamplingContext& context);
+            // Moves the instance's clock and cross fade on by dt
+            void Advance(AnimationInstance& instance, float dt) const;
+
+            // Samples the instance's pose timeAhead seconds past its clock into its model transforms and skinning
+            // palette. Joints deeper in the hierarchy than maxJointDepth keep their rest pose under their parent. Only
+            // writes to the instance, so different instances can be sampled on job threads at the same time
+            void Sample(AnimationInstance& instance, float timeAhead = 0.0f, uint32_t maxJointDepth = ~0u) const;
 
             void SetSkeleton(const SharedPtr<Skeleton>& skeleton);
             void SetCurrentState(size_t index) { m_StateIndex = index; };
@@ -32,27 +39,26 @@ namespace Lumos
             void AddState(const std::string_view name, const SharedPtr<Animation>& animation);
             void SetState(size_t index, const std::string_view name, const SharedPtr<Animation>& animation);
 
+            // State new instances start in
             size_t GetCurrentState() const { return m_StateIndex; }
+            float GetDuration(size_t state) const;
 
             const SharedPtr<Skeleton>& GetSkeleton() const { return m_Skeleton; }
             const TDArray<std::string>& GetStateNames() const;
             const TDArray<SharedPtr<Animation>>& GetAnimationStates() const;
-            SharedPtr<DescriptorSet> GetDescriptorSet();
 
             static AssetType GetStaticType() { return AssetType::AnimationController; }
             virtual AssetType GetAssetType() const override { return GetStaticType(); }
 
-            TDArray<Mat4> GetJointMatrices();
-            void DebugDraw(const Mat4& transform);
+            void DebugDraw(const AnimationInstance& instance, const Mat4& transform) const;
 
             void SetBindPoses(const TDArray<Mat4>& mats);
 
         private:
-            void UpdateSampling(float ratio, SamplingContext& context);
+            void SampleState(size_t state, float time, SamplingContext& context) const;
 
         private:
             SharedPtr<Skeleton> m_Skeleton;
-            SharedPtr<DescriptorSet> m_Descriptor;
             AnimationData* m_Data;
 
             size_t m_StateIndex = 0;
@@ -0,0 +1,102 @@
+#include "Precompiled.h"
+#include "AnimationInstance.h"
+#include "Graphics/RHI/DescriptorSet.h"
+#include "Graphics/RHI/Shader.h"
+#include "Core/Application.h"
+#include "Core/Asset/AssetManager.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        // Matches MAX_BONES in Buffers.glslh
+        static constexpr uint32_t MaxUniformJoints = 100;
+
+        void AnimationInstance::SetState(uint32_t state)
+        {
+            if(state == State)
+                return;
+
+            // Fading out of a fade keeps whichever of the two states was stronger
+            if(BlendWeight >= 0.5f || BlendDuration <= 0.0f)
+            {
+                PreviousState   = State;
+                PreviousTime    = Time;
+                PreviousContext = Context;
+            }
+
+            State       = state;
+            Time        = 0.0f;
+            BlendWeight = BlendDuration > 0.0f ? 0.0f : 1.0f;
+        }
+
+        DescriptorSet* AnimationInstance::GetDescriptorSet()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(!Descriptor)
+            {
+                Graphics::DescriptorDesc descriptorDesc {};
+                descriptorDesc.layoutIndex = 3;
+                descriptorDesc.shader      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRAnim")).As<Graphics::Shader>();
+                Descriptor                 = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            }
+
+            if(Palette.Empty())
+                Palette.Resize(MaxUniformJoints, Mat4(1.0f));
+
+            // Vertices weighted to joints past the uniform limit won't skin correctly, the palette buffer path has no limit
+            if(Palette.Size() > MaxUniformJoints && !JointLimitWarned)
+            {
+                LWARN("Skeleton has %u joints, only the first %u are skinned without storage buffer support", (uint32_t)Palette.Size(), MaxUniformJoints);
+                JointLimitWarned = true;
+            }
+
+            const uint32_t jointCount = Maths::Min((uint32_t)Palette.Size(), MaxUniformJoints);
+            Descriptor->SetUniformBufferData(0, Palette.Data(), (uint32_t)(sizeof(Mat4) * jointCount));
+            Descriptor->Update();
+
+            return Descriptor.get();
+        }
+
+        void AnimationInstance::BeginInterval(uint32_t frames)
+        {
+            Swap(Palette, PaletteFrom);
+            UpdateInterval = Maths::Max(frames, 1u);
+            UpdateStep     = 0;
+        }
+
+        void AnimationInstance::EndInterval()
+        {
+            Swap(Palette, PaletteTo);
+
+            // Nothing was on screen yet, or the skeleton changed, so there's nothing to blend from
+            if(PaletteFrom.Size() != PaletteTo.Size())
+            {
+                PaletteFrom.Resize(PaletteTo.Size());
+                for(uint32_t i = 0; i < PaletteTo.Size(); i++)
+                    PaletteFrom[i] = PaletteTo[i];
+            }
+
+            InterpolatePalette();
+        }
+
+        void AnimationInstance::InterpolatePalette()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(PaletteTo.Empty() || PaletteFrom.Size() != PaletteTo.Size())
+                return;
+
+            // The interval's last frame lands on the sample, deferred instances hold it until they're sampled again
+            const float t     = Maths::Min((float)(UpdateStep + 1) / (float)UpdateInterval, 1.0f);
+            const size_t size = PaletteTo.Size() * 16;
+            Palette.Resize(PaletteTo.Size());
+
+            const float* from = Maths::ValuePtr(PaletteFrom[0]);
+            const float* to   = Maths::ValuePtr(PaletteTo[0]);
+            float* out        = Maths::ValuePtr(Palette[0]);
+            for(size_t i = 0; i < size; i++)
+                out[i] = from[i] + (to[i] - from[i]) * t;
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Core/Reference.h"
+#include "SamplingContext.h"
+#include "Maths/Matrix4.h"
+#include "Core/DataStructures/TDArray.h"
+
+#include <ozz/base/containers/vector.h>
+#include <ozz/base/maths/simd_math.h>
+#include <ozz/base/maths/soa_transform.h>
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class DescriptorSet;
+
+        // Playback state of one skinned entity. The AnimationController it plays is shared by every entity using the
+        // same model, so all the per-entity data (time, blend, ozz caches and the skinning palette) lives here.
+        struct AnimationInstance
+        {
+            // Cross fades from the current state when the state changes
+            void SetState(uint32_t state);
+
+            // Uniform buffer with this instance's palette, used when the renderer can't read the shared palette buffer
+            DescriptorSet* GetDescriptorSet();
+
+            // Call around sampling ahead to the last frame of an update interval. The palette on screen becomes the
+            // start of the blend and the sample its end
+            void BeginInterval(uint32_t frames);
+            void EndInterval();
+
+            // Sets Palette to how far through the update interval this frame is
+            void InterpolatePalette();
+
+            uint32_t State         = 0;
+            uint32_t PreviousState = 0;
+            float Time             = 0.0f;
+            float PreviousTime     = 0.0f;
+            float Speed            = 1.0f;
+            float BlendDuration    = 0.25f;
+            float BlendWeight      = 1.0f; // Weight of State, PreviousState gets the rest
+            bool Playing           = true;
+
+            SamplingContext Context;
+            SamplingContext PreviousContext;
+            ozz::vector<ozz::math::SoaTransform> BlendedTransforms;
+            ozz::vector<ozz::math::Float4x4> ModelTransforms;
+
+            // Model space joint matrices times the inverse bind poses, ready for skinning
+            TDArray<Mat4> Palette;
+
+            // Update rate LOD, see Scene::UpdateAnimations. Instances sampled every UpdateInterval frames blend
+            // between the two cached palettes on the frames in between
+            TDArray<Mat4> PaletteFrom;
+            TDArray<Mat4> PaletteTo;
+            uint32_t UpdateInterval = 1;
+            uint32_t UpdateStep     = 0; // Frames since the last sample
+
+            // Written by the renderer while merging its commands, read and cleared by the next animation update
+            float ScreenSize   = 0.0f; // Largest projected diameter of its meshes in any camera, in pixels
+            bool ShadowVisible = false;
+
+            // Where the renderer placed Palette in this frame's palette buffer
+            uint32_t PaletteOffset = 0;
+            uint64_t PaletteFrame  = ~0ull;
+
+            SharedPtr<DescriptorSet> Descriptor;
+            bool JointLimitWarned = false; // GetDescriptorSet logs a truncated palette once
+        };
+    }
+}
@@ -10,10 +10,9 @@ namespace Lumos
         }
 
         SamplingContext::SamplingContext(const SamplingContext& other)
-            : LocalTranslations(other.LocalTranslations)
-            , LocalScales(other.LocalScales)
-            , LocalRotations(other.LocalRotations)
-            , m_LocalSpaceSoaTransforms(other.m_LocalSpaceSoaTransforms)
+            : m_LocalSpaceSoaTransforms(other.m_LocalSpaceSoaTransforms)
+            , m_SaoSize(other.m_SaoSize)
+            , m_Size(other.m_Size)
         {
             m_Context.Resize(other.m_Context.max_tracks());
         }
@@ -24,10 +23,9 @@ namespace Lumos
 
         SamplingContext& SamplingContext::operator=(const SamplingContext& other)
         {
-            LocalTranslations         = other.LocalTranslations;
-            LocalScales               = other.LocalScales;
-            LocalRotations            = other.LocalRotations;
             m_LocalSpaceSoaTransforms = other.m_LocalSpaceSoaTransforms;
+            m_SaoSize                 = other.m_SaoSize;
+            m_Size                    = other.m_Size;
 
             m_Context.Resize(other.m_Context.max_tracks());
             return *this;
@@ -39,9 +37,6 @@ namespace Lumos
             {
                 m_Size = size;
                 m_Context.Resize(size);
-                LocalTranslations.resize(size);
-                LocalScales.resize(size);
-                LocalRotations.resize(size);
             }
         }
 
@@ -3,9 +3,6 @@
 #include "Utilities/TimeStep.h"
 #include "Animation.h"
 
-#include "Maths/Vector3.h"
-#include "Maths/Quaternion.h"
-
 #include <ozz/animation/runtime/sampling_job.h>
 #include <ozz/base/containers/vector.h>
 #include <ozz/base/maths/soa_transform.h>
@@ -26,10 +23,6 @@ namespace Lumos
 
             SamplingContext& operator=(const SamplingContext& other);
 
-            std::vector<Vec3> LocalTranslations;
-            std::vector<Vec3> LocalScales;
-            std::vector<Quat> LocalRotations;
-
             ozz::vector<ozz::math::SoaTransform>& GetLocalTransforms() { return m_LocalSpaceSoaTransforms; }
             const ozz::vector<ozz::math::SoaTransform>& GetLocalTransforms() const { return m_LocalSpaceSoaTransforms; }
 
@@ -186,7 +186,7 @@ namespace Lumos
         }
 
         template <typename T, typename S, int N, GeneratorFunction<S, N> GEN_FN>
-        static SharedPtr<Texture2D> CreateAndCacheAtlas(const std::string& fontName, float fontSize, const std::vector<GlyphGeometry>& glyphs, const FontGeometry& fontGeometry, const Configuration& config)
+        static void BuildAndCacheAtlas(const std::string& fontName, float fontSize, const std::vector<GlyphGeometry>& glyphs, const Configuration& config, AtlasHeader& header, Buffer& pixels)
         {
             LUMOS_PROFILE_FUNCTION();
             ImmediateAtlasGenerator<S, N, GEN_FN, BitmapAtlasStorage<T, N>> generator(config.width, config.height);
@@ -196,20 +196,11 @@ namespace Lumos
 
             msdfgen::BitmapConstRef<T, N> bitmap = (msdfgen::BitmapConstRef<T, N>)generator.atlasStorage();
 
-            AtlasHeader header;
             header.Width  = bitmap.width;
             header.Height = bitmap.height;
             CacheFontAtlas(fontName, fontSize, header, bitmap.pixels);
 
-            TextureDesc param;
-            param.minFilter       = TextureFilter::LINEAR;
-            param.magFilter       = TextureFilter::LINEAR;
-            param.format          = RHIFormat::R32G32B32A32_Float;
-            param.srgb            = false;
-            param.wrap            = TextureWrap::CLAMP;
-            param.generateMipMaps = false;
-            param.flags           = TextureFlags::Texture_Sampled;
-            return CreateCachedAtlas(header, (void*)bitmap.pixels);
+            pixels = Buffer::Copy(bitmap.pixels, header.Width * header.Height * sizeof(T) * N);
         }
 
         Font::Font(uint8_t* data, uint32_t dataSize, const std::string& name)
@@ -221,21 +212,29 @@ namespace Lumos
             Init();
         }
 
-        Font::Font(const std::string& filepath)
+        Font::Font(const std::string& filepath, bool load)
             : m_FilePath(filepath)
             , m_MSDFData(new MSDFData())
             , m_FontData(nullptr)
             , m_FontDataSize(0)
         {
-            Init();
+            if(load)
+                Init();
         }
 
         Font::~Font()
         {
+            m_AtlasStorage.Release();
             delete m_MSDFData;
         }
 
         void Font::Init()
+        {
+            if(BuildAtlas())
+                UploadAtlas();
+        }
+
+        bool Font::BuildAtlas()
         {
             LUMOS_PROFILE_FUNCTION();
             FontInput fontInput           = {};
@@ -328,7 +327,7 @@ namespace Lumos
                 if(!FileSystem::Get().ResolvePhysicalPath(temp, Str8StdS(m_FilePath), &outPath))
                 {
                     ArenaRelease(temp);
-                    return;
+                    return false;
                 }
 
                 FONT_LOG("Font: Loading Font %s", m_FilePath);
@@ -340,7 +339,7 @@ namespace Lumos
                 if(!font.load(fontInput.fontFilename))
                 {
                     FONT_LOG("Font: Failed to load font! - %s", fontInput.fontFilename);
-                    return;
+                    return false;
                 }
             }
             else
@@ -348,7 +347,7 @@ namespace Lumos
                 if(!font.load(m_FontData, m_FontDataSize))
                 {
                     FONT_LOG("Font: Failed to load font from data!");
-                    return;
+                    return false;
                 }
             }
 
@@ -460,36 +459,49 @@ namespace Lumos
             std::string fontName = m_FilePath;
 
             // Check cache here
-            Buffer storageBuffer;
             AtlasHeader header;
-            void* pixels;
-            if(TryReadFontAtlasFromCache(fontName, (float)config.emSize, header, pixels, storageBuffer))
-            {
-                m_TextureAtlas = CreateCachedAtlas(header, pixels);
-                storageBuffer.Release();
-            }
-            else
+            if(!TryReadFontAtlasFromCache(fontName, (float)config.emSize, header, m_AtlasPixels, m_AtlasStorage))
             {
                 bool floatingPointFormat = true;
-                SharedPtr<Texture2D> texture;
                 switch(config.imageType)
                 {
                 case ImageType::MSDF:
                     if(floatingPointFormat)
-                        texture = CreateAndCacheAtlas<float, float, 3, msdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, m_MSDFData->FontGeometry, config);
+                        BuildAndCacheAtlas<float, float, 3, msdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, config, header, m_AtlasStorage);
                     else
-                        texture = CreateAndCacheAtlas<byte, float, 3, msdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, m_MSDFData->FontGeometry, config);
+                        BuildAndCacheAtlas<byte, float, 3, msdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, config, header, m_AtlasStorage);
                     break;
                 case ImageType::MTSDF:
                     if(floatingPointFormat)
-                        texture = CreateAndCacheAtlas<float, float, 4, mtsdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, m_MSDFData->FontGeometry, config);
+                        BuildAndCacheAtlas<float, float, 4, mtsdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, config, header, m_AtlasStorage);
                     else
-                        texture = CreateAndCacheAtlas<byte, float, 4, mtsdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, m_MSDFData->FontGeometry, config);
+                        BuildAndCacheAtlas<byte, float, 4, mtsdfGenerator>(fontName, (float)config.emSize, m_MSDFData->Glyphs, config, header, m_AtlasStorage);
                     break;
                 }
 
-                m_TextureAtlas = texture;
+                m_AtlasPixels = m_AtlasStorage.Data;
             }
+
+            m_AtlasWidth  = header.Width;
+            m_AtlasHeight = header.Height;
+            return m_AtlasPixels != nullptr;
+        }
+
+        uint64_t Font::UploadAtlas()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            if(!m_AtlasPixels)
+                return 0;
+
+            AtlasHeader header;
+            header.Width   = m_AtlasWidth;
+            header.Height  = m_AtlasHeight;
+            m_TextureAtlas = CreateCachedAtlas(header, m_AtlasPixels);
+
+            const uint64_t size = m_AtlasStorage.Size;
+            m_AtlasStorage.Release();
+            m_AtlasPixels = nullptr;
+            return size;
         }
 
         SharedPtr<Font> Font::s_DefaultFont;
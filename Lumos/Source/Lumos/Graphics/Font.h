@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Asset/Asset.h"
+#include "Core/Buffer.h"
 
 namespace Lumos
 {
@@ -13,7 +14,8 @@ namespace Lumos
             class FontHolder;
 
         public:
-            Font(const std::string& filepath);
+            // load false leaves the font empty for BuildAtlas and UploadAtlas, e.g. from the asset streamer
+            Font(const std::string& filepath, bool load = true);
             Font(uint8_t* data, uint32_t dataSize, const std::string& name);
 
             virtual ~Font();
@@ -26,6 +28,14 @@ namespace Lumos
 
             void Init();
 
+            // Loads the glyphs and generates the atlas pixels, or reads them from the atlas cache.
+            // Doesn't touch the graphics device so it can run on a worker, but filepath must already be a physical path.
+            bool BuildAtlas();
+
+            // Creates the atlas texture from the pixels BuildAtlas left behind and frees them, main thread only
+            uint64_t UploadAtlas();
+            uint64_t GetPendingAtlasSize() const { return m_AtlasStorage.Size; }
+
             static void InitDefaultFont();
             static void ShutdownDefaultFont();
             static SharedPtr<Font> GetDefaultFont();
@@ -39,6 +49,11 @@ namespace Lumos
             uint8_t* m_FontData;
             uint32_t m_FontDataSize;
 
+            Buffer m_AtlasStorage;
+            void* m_AtlasPixels    = nullptr;
+            uint32_t m_AtlasWidth  = 0;
+            uint32_t m_AtlasHeight = 0;
+
         private:
             static SharedPtr<Font> s_DefaultFont;
         };
@@ -107,6 +107,7 @@ namespace Lumos
             static void ReleaseDefaultTexture();
 
             uint32_t GetFlags() const { return m_Flags; };
+            void SetFlags(uint32_t flags) { m_Flags = flags; }
             bool GetFlag(RenderFlags flag) const { return (uint32_t)flag & m_Flags; };
             void SetFlag(RenderFlags flag, bool value = true)
             {
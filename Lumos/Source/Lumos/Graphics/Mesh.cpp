@@ -7,6 +7,9 @@
 #include "Core/OS/FileSystem.h"
 #include "Maths/MathsUtilities.h"
 #include "Maths/Vector3.h"
+#include "ModelLoader/MeshCache.h"
+#include "Core/Application.h"
+#include "Core/QualitySettings.h"
 
 #include <cereal/archives/json.hpp>
 #include <ModelLoaders/meshoptimizer/src/meshoptimizer.h>
@@ -15,6 +18,65 @@ namespace Lumos
 {
     namespace Graphics
     {
+        static PerThread bool s_CompactVertexScope = false;
+
+        CompactVertexScope::CompactVertexScope()
+            : m_Previous(s_CompactVertexScope)
+        {
+            s_CompactVertexScope = true;
+        }
+
+        CompactVertexScope::~CompactVertexScope()
+        {
+            s_CompactVertexScope = m_Previous;
+        }
+
+        bool CompactVertexScope::IsActive()
+        {
+            return s_CompactVertexScope;
+        }
+
+        bool CompactVertexScope::IsEnabled()
+        {
+            return s_CompactVertexScope && Renderer::GetCapabilities().SupportCompactVertices && Application::Get().GetQualitySettings().CompactVertices;
+        }
+
+        static int16_t PackSnorm16(float value)
+        {
+            return (int16_t)std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+        }
+
+        static uint16_t PackUnorm16(float value)
+        {
+            return (uint16_t)std::round(std::clamp(value, 0.0f, 1.0f) * 65535.0f);
+        }
+
+        static uint32_t PackUnorm8(float value)
+        {
+            return (uint32_t)std::round(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+        }
+
+        // Simplification stops once the surface would move further than this, relative to the mesh extent
+        static const float MaxLODError = 0.05f;
+
+        static uint32_t PackUnorm4x8(const Vec4& value)
+        {
+            return PackUnorm8(value.x) | PackUnorm8(value.y) << 8 | PackUnorm8(value.z) << 16 | PackUnorm8(value.w) << 24;
+        }
+
+        // Projects onto the octahedron and folds the lower half over, zero vectors come back as +Z
+        static Vec2 OctahedralEncode(const Vec3& n)
+        {
+            const float length = Maths::Abs(n.x) + Maths::Abs(n.y) + Maths::Abs(n.z);
+            if(length < Maths::M_EPSILON)
+                return Vec2(0.0f);
+
+            Vec2 p(n.x / length, n.y / length);
+            if(n.z < 0.0f)
+                p = Vec2((1.0f - Maths::Abs(p.y)) * (p.x >= 0.0f ? 1.0f : -1.0f), (1.0f - Maths::Abs(p.x)) * (p.y >= 0.0f ? 1.0f : -1.0f));
+            return p;
+        }
+
         Mesh::Mesh()
             : m_VertexBuffer(nullptr)
             , m_IndexBuffer(nullptr)
@@ -25,10 +87,17 @@ namespace Lumos
         Mesh::Mesh(const Mesh& mesh)
             : m_VertexBuffer(mesh.m_VertexBuffer)
             , m_IndexBuffer(mesh.m_IndexBuffer)
+            , m_PositionBuffer(mesh.m_PositionBuffer)
+            , m_AttributeBuffer(mesh.m_AttributeBuffer)
+            , m_ColourBuffer(mesh.m_ColourBuffer)
+            , m_PositionDequantise(mesh.m_PositionDequantise)
+            , m_TexCoordScaleBias(mesh.m_TexCoordScaleBias)
             , m_BoundingBox(mesh.m_BoundingBox)
             , m_Name(mesh.m_Name)
             , m_Material(mesh.m_Material)
+            , m_LODCount(mesh.m_LODCount)
         {
+            MemoryCopy(m_LODs, mesh.m_LODs, sizeof(m_LODs));
         }
 
         Mesh::Mesh(const TDArray<uint32_t>& indices, const TDArray<Vertex>& vertices)
@@ -40,14 +109,7 @@ namespace Lumos
                 m_BoundingBox.Merge(vertex.Position);
             }
 
-            m_IndexBuffer  = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create((uint32_t*)indices.Data(), (uint32_t)indices.Size()));
-            m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::Vertex) * vertices.Size()), vertices.Data(), BufferUsage::STATIC));
-
-#ifndef LUMOS_PRODUCTION
-            m_Stats.VertexCount   = (uint32_t)vertices.Size();
-            m_Stats.TriangleCount = m_Stats.VertexCount / 3;
-            m_Stats.IndexCount    = (uint32_t)indices.Size();
-#endif
+            CreateBuffersWithLODs(indices, vertices.Data(), (uint32_t)vertices.Size(), false);
         }
 
         Mesh::Mesh(const TDArray<uint32_t>& indices, const TDArray<AnimVertex>& vertices)
@@ -59,16 +121,247 @@ namespace Lumos
                 m_BoundingBox.Merge(vertex.Position);
             }
 
-            m_IndexBuffer      = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create((u32*)indices.Data(), (uint32_t)indices.Size()));
-            m_AnimVertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::AnimVertex) * vertices.Size()), vertices.Data(), BufferUsage::STATIC));
+            CreateBuffersWithLODs(indices, vertices.Data(), (uint32_t)vertices.Size(), true);
+        }
+
+        Mesh::Mesh(const uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, bool animated, const Maths::BoundingBox& boundingBox, const MeshLOD* lods, uint32_t lodCount)
+            : m_BoundingBox(boundingBox)
+        {
+            SetLODs(lods, lodCount, indexCount);
+            CreateBuffers(indices, indexCount, vertices, vertexCount, animated);
+        }
+
+        Mesh::Mesh(const uint32_t* indices, uint32_t indexCount, const CompactVertexData& compact, uint32_t vertexCount, const Maths::BoundingBox& boundingBox, const MeshLOD* lods, uint32_t lodCount)
+            : m_BoundingBox(boundingBox)
+        {
+            SetLODs(lods, lodCount, indexCount);
+            CreateIndexBuffer(indices, indexCount, vertexCount, true);
+            UploadCompactBuffers(compact, vertexCount);
+
+#ifndef LUMOS_PRODUCTION
+            m_Stats.VertexCount   = vertexCount;
+            m_Stats.TriangleCount = m_Stats.VertexCount / 3;
+            m_Stats.IndexCount    = m_LODs[0].IndexCount;
+#endif
+        }
+
+        void Mesh::SetLODs(const MeshLOD* lods, uint32_t lodCount, uint32_t indexCount)
+        {
+            if(lods && lodCount > 0)
+            {
+                m_LODCount = Maths::Min(lodCount, (uint32_t)MESH_LOD_MAX);
+                MemoryCopy(m_LODs, lods, sizeof(MeshLOD) * m_LODCount);
+            }
+            else
+                m_LODs[0] = { 0, indexCount, 0.0f };
+        }
+
+        void Mesh::CreateBuffersWithLODs(const TDArray<uint32_t>& indices, const void* vertices, uint32_t vertexCount, bool animated)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            const uint32_t vertexSize    = animated ? sizeof(AnimVertex) : sizeof(Vertex);
+            TDArray<uint32_t> lodIndices = indices;
+
+            // The OBJ and FBX importers emit three vertices per triangle. Welding the identical ones shrinks the vertex
+            // buffer and gives the simplifier connected triangles, it can't collapse edges between separate ones.
+            TDArray<uint32_t> remap;
+            remap.Resize(vertexCount);
+            const uint32_t uniqueCount = (uint32_t)meshopt_generateVertexRemap(remap.Data(), indices.Data(), indices.Size(), vertices, vertexCount, vertexSize);
+
+            TDArray<uint8_t> welded;
+            if(uniqueCount > 0 && uniqueCount < vertexCount)
+            {
+                welded.Resize(size_t(uniqueCount) * vertexSize);
+                meshopt_remapVertexBuffer(welded.Data(), vertices, vertexCount, vertexSize, remap.Data());
+                meshopt_remapIndexBuffer(lodIndices.Data(), indices.Data(), indices.Size(), remap.Data());
+                vertices    = welded.Data();
+                vertexCount = uniqueCount;
+            }
+
+            // Position is the first member of both vertex layouts
+            m_LODCount = GenerateLODs(lodIndices, (const Vec3*)vertices, vertexCount, vertexSize, m_LODs);
+
+            CreateBuffers(lodIndices.Data(), (uint32_t)lodIndices.Size(), vertices, vertexCount, animated);
+        }
+
+        uint32_t Mesh::GenerateLODs(TDArray<uint32_t>& indices, const Vec3* positions, uint32_t vertexCount, uint32_t vertexStride, MeshLOD* outLODs)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            const uint32_t baseIndexCount = (uint32_t)indices.Size();
+            outLODs[0]                    = { 0, baseIndexCount, 0.0f };
+
+            if(baseIndexCount / 3 < MinLODTriangles || vertexCount == 0)
+                return 1;
+
+            // meshopt works in errors relative to this, the LODs store them in model space
+            const float errorScale = meshopt_simplifyScale((const float*)positions, vertexCount, vertexStride);
+
+            TDArray<uint32_t> simplified;
+            simplified.Resize(baseIndexCount);
+
+            uint32_t lodCount         = 1;
+            uint32_t targetIndexCount = baseIndexCount;
+            while(lodCount < MESH_LOD_MAX)
+            {
+                // Every LOD is simplified from the full mesh, so its error is measured against what LOD 0 draws
+                targetIndexCount     = targetIndexCount / 6 * 3;
+                float error          = 0.0f;
+                const uint32_t count = (uint32_t)meshopt_simplify(simplified.Data(), indices.Data(), baseIndexCount, (const float*)positions, vertexCount, vertexStride, targetIndexCount, MaxLODError, &error);
+
+                // Hit the error limit well short of the target, a LOD this close to the last isn't worth selecting
+                const MeshLOD& previous = outLODs[lodCount - 1];
+                if(count == 0 || count > previous.IndexCount / 4 * 3)
+                    break;
+
+                meshopt_optimizeVertexCache(simplified.Data(), simplified.Data(), count, vertexCount);
+
+                MeshLOD& lod    = outLODs[lodCount++];
+                lod.IndexOffset = (uint32_t)indices.Size();
+                lod.IndexCount  = count;
+                lod.Error       = Maths::Max(error * errorScale, previous.Error);
+
+                indices.Reserve(indices.Size() + count);
+                for(uint32_t i = 0; i < count; i++)
+                    indices.PushBack(simplified[i]);
+
+                targetIndexCount = count;
+            }
+
+            return lodCount;
+        }
+
+        void Mesh::CreateBuffers(const uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, bool animated)
+        {
+            const uint32_t vertexSize = animated ? sizeof(Graphics::AnimVertex) : sizeof(Graphics::Vertex);
+            const bool compact        = CompactVertexScope::IsEnabled();
+
+            // A model import is in progress, keep what was uploaded for its cache. Compact streams are added to it below
+            if(MeshCacheCapture* capture = MeshCacheCapture::GetActive())
+                capture->AddMesh(this, vertices, vertexSize, vertexCount, indices, indexCount, animated);
+
+            CreateIndexBuffer(indices, indexCount, vertexCount, compact);
+
+            if(animated)
+                m_AnimVertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create(vertexSize * vertexCount, vertices, BufferUsage::STATIC));
+            else if(compact)
+                CreateCompactBuffers((const Vertex*)vertices, vertexCount);
+            else
+                m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create(vertexSize * vertexCount, vertices, BufferUsage::STATIC));
 
 #ifndef LUMOS_PRODUCTION
-            m_Stats.VertexCount   = (uint32_t)vertices.Size();
+            m_Stats.VertexCount   = vertexCount;
             m_Stats.TriangleCount = m_Stats.VertexCount / 3;
-            m_Stats.IndexCount    = (uint32_t)indices.Size();
+            m_Stats.IndexCount    = m_LODs[0].IndexCount;
 #endif
         }
 
+        void Mesh::CreateIndexBuffer(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, bool compact)
+        {
+            if(compact && vertexCount <= 65536)
+            {
+                TDArray<uint16_t> shortIndices;
+                shortIndices.Resize(indexCount);
+                for(uint32_t i = 0; i < indexCount; i++)
+                    shortIndices[i] = (uint16_t)indices[i];
+
+                m_IndexBuffer = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(shortIndices.Data(), indexCount));
+            }
+            else
+                m_IndexBuffer = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create((uint32_t*)indices, indexCount));
+        }
+
+        void Mesh::CreateCompactBuffers(const Vertex* vertices, uint32_t vertexCount)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            Vec3 minPosition(FLT_MAX), maxPosition(-FLT_MAX);
+            Vec2 minTexCoord(FLT_MAX), maxTexCoord(-FLT_MAX);
+            bool uniformColour = true;
+
+            for(uint32_t i = 0; i < vertexCount; i++)
+            {
+                const Vertex& vertex = vertices[i];
+                minPosition          = Vec3(Maths::Min(minPosition.x, vertex.Position.x), Maths::Min(minPosition.y, vertex.Position.y), Maths::Min(minPosition.z, vertex.Position.z));
+                maxPosition          = Vec3(Maths::Max(maxPosition.x, vertex.Position.x), Maths::Max(maxPosition.y, vertex.Position.y), Maths::Max(maxPosition.z, vertex.Position.z));
+                minTexCoord          = Vec2(Maths::Min(minTexCoord.x, vertex.TexCoords.x), Maths::Min(minTexCoord.y, vertex.TexCoords.y));
+                maxTexCoord          = Vec2(Maths::Max(maxTexCoord.x, vertex.TexCoords.x), Maths::Max(maxTexCoord.y, vertex.TexCoords.y));
+                uniformColour        = uniformColour && vertex.Colours == vertices[0].Colours;
+            }
+
+            if(vertexCount == 0)
+            {
+                minPosition = maxPosition = Vec3(0.0f);
+                minTexCoord = maxTexCoord = Vec2(0.0f);
+            }
+
+            // Uniform scale, so the inverse transpose the shaders build for normals still only needs normalising
+            const Vec3 centre     = (minPosition + maxPosition) * 0.5f;
+            const Vec3 halfExtent = (maxPosition - minPosition) * 0.5f;
+            float scale           = Maths::Max(halfExtent.x, Maths::Max(halfExtent.y, halfExtent.z));
+            scale                 = scale > Maths::M_EPSILON ? scale : 1.0f;
+            const float invScale  = 1.0f / scale;
+
+            Vec2 texCoordSize = maxTexCoord - minTexCoord;
+            texCoordSize.x    = texCoordSize.x > Maths::M_EPSILON ? texCoordSize.x : 1.0f;
+            texCoordSize.y    = texCoordSize.y > Maths::M_EPSILON ? texCoordSize.y : 1.0f;
+
+            TDArray<CompactVertexPosition> positions;
+            TDArray<CompactVertexAttributes> attributes;
+            positions.Resize(vertexCount);
+            attributes.Resize(vertexCount);
+
+            for(uint32_t i = 0; i < vertexCount; i++)
+            {
+                const Vertex& vertex = vertices[i];
+
+                CompactVertexPosition& position = positions[i];
+                const Vec3 local                = (vertex.Position - centre) * invScale;
+                position.Position[0]            = PackSnorm16(local.x);
+                position.Position[1]            = PackSnorm16(local.y);
+                position.Position[2]            = PackSnorm16(local.z);
+                position.BitangentSign          = Maths::Dot(Maths::Cross(vertex.Normal, vertex.Tangent), vertex.Bitangent) < 0.0f ? -32767 : 32767;
+
+                CompactVertexAttributes& attribute = attributes[i];
+                const Vec2 normal                  = OctahedralEncode(vertex.Normal);
+                const Vec2 tangent                 = OctahedralEncode(vertex.Tangent);
+                attribute.Normal[0]                = PackSnorm16(normal.x);
+                attribute.Normal[1]                = PackSnorm16(normal.y);
+                attribute.Tangent[0]               = PackSnorm16(tangent.x);
+                attribute.Tangent[1]               = PackSnorm16(tangent.y);
+                attribute.TexCoords[0]             = PackUnorm16((vertex.TexCoords.x - minTexCoord.x) / texCoordSize.x);
+                attribute.TexCoords[1]             = PackUnorm16((vertex.TexCoords.y - minTexCoord.y) / texCoordSize.y);
+            }
+
+            // The lit shaders don't read vertex colours, so they're only kept when they vary across the mesh
+            TDArray<uint32_t> colours;
+            if(!uniformColour)
+            {
+                colours.Resize(vertexCount);
+                for(uint32_t i = 0; i < vertexCount; i++)
+                    colours[i] = PackUnorm4x8(vertices[i].Colours);
+            }
+
+            CompactVertexData compact;
+            compact.Positions          = positions.Data();
+            compact.Attributes         = attributes.Data();
+            compact.Colours            = colours.Empty() ? nullptr : colours.Data();
+            compact.PositionDequantise = Mat4::Translation(centre) * Mat4::Scale(Vec3(scale));
+            compact.TexCoordScaleBias  = Vec4(texCoordSize.x, texCoordSize.y, minTexCoord.x, minTexCoord.y);
+            UploadCompactBuffers(compact, vertexCount);
+
+            if(MeshCacheCapture* capture = MeshCacheCapture::GetActive())
+                capture->AddCompactStreams(this, compact, vertexCount);
+        }
+
+        void Mesh::UploadCompactBuffers(const CompactVertexData& compact, uint32_t vertexCount)
+        {
+            m_PositionDequantise = compact.PositionDequantise;
+            m_TexCoordScaleBias  = compact.TexCoordScaleBias;
+            m_PositionBuffer     = SharedPtr<VertexBuffer>(VertexBuffer::Create(uint32_t(sizeof(CompactVertexPosition) * vertexCount), compact.Positions, BufferUsage::STATIC));
+            m_AttributeBuffer    = SharedPtr<VertexBuffer>(VertexBuffer::Create(uint32_t(sizeof(CompactVertexAttributes) * vertexCount), compact.Attributes, BufferUsage::STATIC));
+            if(compact.Colours)
+                m_ColourBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create(uint32_t(sizeof(uint32_t) * vertexCount), compact.Colours, BufferUsage::STATIC));
+        }
+
         Mesh::~Mesh()
         {
         }
@@ -3,7 +3,9 @@
 #include "Maths/Vector2.h"
 #include "Maths/Vector3.h"
 #include "Maths/Vector4.h"
+#include "Maths/Matrix4.h"
 #include "Maths/BoundingBox.h"
+#include "Graphics/RHI/RHIDefinitions.h"
 
 namespace Lumos
 {
@@ -112,6 +114,52 @@ namespace Lumos
             }
         };
 
+        // Compact meshes upload these streams instead of Vertex, each to its own buffer. Shaders read every stream as unsigned
+        // integers at location N from binding N and unpack it themselves, see CompactVertex.glslh. They're loaded with
+        // VertexInputLayout::CompactStreams so their pipelines bind the streams that way.
+        struct CompactVertexPosition
+        {
+            int16_t Position[3];   // snorm16, back to model space through Mesh::GetPositionDequantise
+            int16_t BitangentSign; // snorm16 -1 or 1, the bitangent is cross(Normal, Tangent) * sign
+        };
+
+        struct CompactVertexAttributes
+        {
+            int16_t Normal[2];     // snorm16 octahedral
+            int16_t Tangent[2];    // snorm16 octahedral
+            uint16_t TexCoords[2]; // unorm16 over the mesh's UV range, see Mesh::GetTexCoordScaleBias
+        };
+
+        // A compact mesh's streams as uploaded, so the mesh cache can store them and later loads skip quantising
+        struct CompactVertexData
+        {
+            const CompactVertexPosition* Positions;
+            const CompactVertexAttributes* Attributes;
+            const uint32_t* Colours; // unorm8x4, null when every vertex has the same colour
+            Mat4 PositionDequantise;
+            Vec4 TexCoordScaleBias;
+        };
+
+        // Meshes created on this thread while one is alive upload compact streams, when the renderer supports them and
+        // QualitySettings::CompactVertices is on. Model opens one around its loads. Meshes drawn with shaders that read
+        // the full Vertex layout, e.g. the grid quad, are created outside of one.
+        class LUMOS_EXPORT CompactVertexScope
+        {
+        public:
+            CompactVertexScope();
+            ~CompactVertexScope();
+
+            NONCOPYABLEANDMOVE(CompactVertexScope);
+
+            static bool IsActive();
+
+            // Active, and the renderer and QualitySettings::CompactVertices allow compact streams
+            static bool IsEnabled();
+
+        private:
+            bool m_Previous;
+        };
+
         struct Triangle
         {
             Triangle(const Vertex& v0, const Vertex& v1, const Vertex& v2)
@@ -128,6 +176,14 @@ namespace Lumos
             Vertex p2;
         };
 
+        // A range of the mesh's index buffer. LOD 0 is the full mesh, later ones are simplified from it and reuse its vertices.
+        struct MeshLOD
+        {
+            uint32_t IndexOffset;
+            uint32_t IndexCount;
+            float Error; // Model space distance the surface moved by, 0 for LOD 0
+        };
+
         struct MeshStats
         {
             uint32_t TriangleCount;
@@ -143,11 +199,30 @@ namespace Lumos
             Mesh(const Mesh& mesh);
             Mesh(const TDArray<uint32_t>& indices, const TDArray<Vertex>& vertices);
             Mesh(const TDArray<uint32_t>& indices, const TDArray<AnimVertex>& vertices);
+
+            // Uploads already built vertex and index data as is, e.g. straight from the mesh cache. indices holds every LOD's
+            // range, without a LOD table it's all LOD 0.
+            Mesh(const uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, bool animated, const Maths::BoundingBox& boundingBox, const MeshLOD* lods = nullptr, uint32_t lodCount = 0);
+
+            // Uploads already quantised compact streams as is
+            Mesh(const uint32_t* indices, uint32_t indexCount, const CompactVertexData& compact, uint32_t vertexCount, const Maths::BoundingBox& boundingBox, const MeshLOD* lods = nullptr, uint32_t lodCount = 0);
             virtual ~Mesh();
 
             const SharedPtr<VertexBuffer>& GetVertexBuffer() const { return m_VertexBuffer; }
             const SharedPtr<VertexBuffer>& GetAnimVertexBuffer() const { return m_AnimVertexBuffer; }
             const SharedPtr<IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
+
+            // Compact meshes have no vertex buffer, they're drawn from position, attribute and, when the vertex
+            // colours vary, colour streams bound at 0, 1 and 2
+            bool IsCompact() const { return m_PositionBuffer != nullptr; }
+            const SharedPtr<VertexBuffer>& GetPositionBuffer() const { return m_PositionBuffer; }
+            const SharedPtr<VertexBuffer>& GetAttributeBuffer() const { return m_AttributeBuffer; }
+            const SharedPtr<VertexBuffer>& GetColourBuffer() const { return m_ColourBuffer; }
+            const Mat4& GetPositionDequantise() const { return m_PositionDequantise; }
+            const Vec4& GetTexCoordScaleBias() const { return m_TexCoordScaleBias; }
+
+            uint32_t GetLODCount() const { return m_LODCount; }
+            const MeshLOD& GetLOD(uint32_t lod) const { return m_LODs[lod]; }
             const SharedPtr<Material>& GetMaterial() const { return m_Material; }
             const Maths::BoundingBox& GetBoundingBox() const { return m_BoundingBox; }
 
@@ -160,6 +235,12 @@ namespace Lumos
             static void GenerateNormals(Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount);
             static void GenerateTangentsAndBitangents(Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount);
 
+            // Appends up to MESH_LOD_MAX - 1 simplified copies of indices, each aiming for half the triangles of the one before.
+            // Meshes under MinLODTriangles, or that can't be simplified much further, get fewer. Returns the LOD count.
+            static uint32_t GenerateLODs(TDArray<uint32_t>& indices, const Vec3* positions, uint32_t vertexCount, uint32_t vertexStride, MeshLOD* outLODs);
+
+            static constexpr uint32_t MinLODTriangles = 256;
+
 #ifndef LUMOS_PRODUCTION
             const MeshStats& GetStats() const
             {
@@ -178,9 +259,24 @@ namespace Lumos
             static Vec3* GenerateNormals(uint32_t numVertices, Vec3* vertices, uint32_t* indices, uint32_t numIndices);
             static Vec3* GenerateTangents(uint32_t numVertices, Vec3* vertices, uint32_t* indices, uint32_t numIndices, Vec2* texCoords);
 
+            void CreateBuffers(const uint32_t* indices, uint32_t indexCount, const void* vertices, uint32_t vertexCount, bool animated);
+            void CreateBuffersWithLODs(const TDArray<uint32_t>& indices, const void* vertices, uint32_t vertexCount, bool animated);
+            void CreateIndexBuffer(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, bool compact);
+            void CreateCompactBuffers(const Vertex* vertices, uint32_t vertexCount);
+            void UploadCompactBuffers(const CompactVertexData& compact, uint32_t vertexCount);
+            void SetLODs(const MeshLOD* lods, uint32_t lodCount, uint32_t indexCount);
+
             SharedPtr<VertexBuffer> m_VertexBuffer;
             SharedPtr<VertexBuffer> m_AnimVertexBuffer;
             SharedPtr<IndexBuffer> m_IndexBuffer;
+
+            SharedPtr<VertexBuffer> m_PositionBuffer;
+            SharedPtr<VertexBuffer> m_AttributeBuffer;
+            SharedPtr<VertexBuffer> m_ColourBuffer;
+            Mat4 m_PositionDequantise = Mat4(1.0f);
+            Vec4 m_TexCoordScaleBias  = Vec4(1.0f, 1.0f, 0.0f, 0.0f);
+            MeshLOD m_LODs[MESH_LOD_MAX] = {};
+            uint32_t m_LODCount          = 1;
             SharedPtr<Material> m_Material;
             Maths::BoundingBox m_BoundingBox;
 
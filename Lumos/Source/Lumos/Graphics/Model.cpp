@@ -7,7 +7,8 @@
 #include "Animation/Skeleton.h"
 #include "Animation/Animation.h"
 #include "Animation/AnimationController.h"
-#include "Animation/SamplingContext.h"
+#include "ModelLoader/MeshCache.h"
+#include "Utilities/Timer.h"
 
 namespace Lumos::Graphics
 {
@@ -17,11 +18,12 @@ namespace Lumos::Graphics
     {
     }
 
-    Model::Model(const std::string& filePath)
+    Model::Model(const std::string& filePath, bool load)
         : m_FilePath(filePath)
         , m_PrimitiveType(PrimitiveType::File)
     {
-        LoadModel(m_FilePath);
+        if(load)
+            LoadModel(m_FilePath);
     }
 
     Model::Model(const SharedPtr<Mesh>& mesh, PrimitiveType type)
@@ -35,6 +37,7 @@ namespace Lumos::Graphics
         : m_FilePath("Primitive")
         , m_PrimitiveType(type)
     {
+        CompactVertexScope compactVertices;
         m_Meshes.PushBack(SharedPtr<Mesh>(CreatePrimative(type)));
     }
 
@@ -47,10 +50,40 @@ namespace Lumos::Graphics
     Model::Model(Model&&)                 = default;
     Model& Model::operator=(Model&&)      = default;
 
+    String8 Model::GetCachePath(Arena* arena, const std::string& path, uint64_t* outPathHash)
+    {
+        std::string sourcePath = path;
+        StringUtilities::BackSlashesToSlashes(sourcePath);
+        ArenaTemp scratch = ScratchBegin(&arena, 1);
+        String8 vfsPath   = FileSystem::Get().AbsolutePathToFileSystem(scratch.arena, Str8StdS(sourcePath));
+        *outPathHash      = MeshCache::HashPath(vfsPath);
+        ScratchEnd(scratch);
+        return MeshCache::GetCachePath(arena, *outPathHash);
+    }
+
     void Model::LoadModel(const std::string& path)
+    {
+        // Anything imported before loads from its cooked copy, named after the source's path and checked against the files it was built from
+        CookedModel* cooked = ReadCooked(path);
+        LoadModelFromCooked(path, cooked);
+        ReleaseCooked(cooked);
+    }
+
+    void Model::LoadModelFromCooked(const std::string& path, const CookedModel* cooked)
     {
         LUMOS_PROFILE_FUNCTION();
+        Timer timer;
+        CompactVertexScope compactVertices;
+        if(cooked)
+        {
+            LoadCooked(*cooked);
+            LINFO("Loaded Model - %s : cooked in %.2fms", path.c_str(), timer.GetElapsedMS());
+            return;
+        }
+
         ArenaTemp Scratch = ScratchBegin(0, 0);
+        uint64_t pathHash;
+        String8 cachePath = GetCachePath(Scratch.arena, path, &pathHash);
 
         String8 physicalPath;
         if(!Lumos::FileSystem::Get().ResolvePhysicalPath(Scratch.arena, Str8StdS(path), &physicalPath))
@@ -64,6 +97,8 @@ namespace Lumos::Graphics
 
         const std::string fileExtension = StringUtilities::GetFilePathExtension(path);
 
+        MeshCacheCapture capture;
+        capture.AddDependency(path);
         if(fileExtension == "obj")
             LoadOBJ(resolvedPath);
         else if(fileExtension == "gltf" || fileExtension == "glb")
@@ -73,75 +108,12 @@ namespace Lumos::Graphics
         else
             LERROR("Unsupported File Type : %s", fileExtension.c_str());
 
-        LINFO("Loaded Model - %s", path.c_str());
-        ScratchEnd(Scratch);
-    }
-
-    void Model::UpdateAnimation(const TimeStep& dt)
-    {
-        if(m_Animation.Empty())
-            return;
-
-        if(!m_SamplingContext)
-        {
-            m_SamplingContext = CreateSharedPtr<SamplingContext>();
-        }
-
-        if(!m_AnimationController)
-        {
-            m_AnimationController = CreateSharedPtr<AnimationController>();
-            m_AnimationController->SetSkeleton(m_Skeleton);
-            for(auto anim : m_Animation)
-            {
-                m_AnimationController->AddState(anim->GetName(), anim);
-            }
-            m_AnimationController->SetBindPoses(m_BindPoses);
-        }
-
-        static float time = 0.0f;
-        time += (float)dt.GetSeconds();
-        m_AnimationController->SetCurrentState(m_CurrentAnimation);
-        m_AnimationController->Update(time, *m_SamplingContext.get());
-    }
-
-    void Model::UpdateAnimation(const TimeStep& dt, float overrideTime)
-    {
-        if(m_Animation.Empty())
-            return;
-
-        if(!m_SamplingContext)
-        {
-            m_SamplingContext = CreateSharedPtr<SamplingContext>();
-        }
-
-        if(!m_AnimationController)
-        {
-            m_AnimationController = CreateSharedPtr<AnimationController>();
-            m_AnimationController->SetSkeleton(m_Skeleton);
-            for(auto anim : m_Animation)
-            {
-                m_AnimationController->AddState(anim->GetName(), anim);
-            }
-            m_AnimationController->SetBindPoses(m_BindPoses);
-        }
-
-        m_AnimationController->SetCurrentState(m_CurrentAnimation);
-        m_AnimationController->Update(overrideTime, *m_SamplingContext.get());
-    }
-
-    TDArray<Mat4> Model::GetJointMatrices()
-    {
-        if(m_Animation.Empty())
-            return {};
+        const float importMs = timer.GetElapsedMS();
+        if(!m_Meshes.Empty())
+            SaveCooked(capture, cachePath, pathHash);
 
-        auto matrices = m_AnimationController->GetJointMatrices();
-
-        for(int i = 0; i < matrices.Size(); i++)
-        {
-            // matrices[i] = m_BindPoses[i] * matrices[i];
-        }
-
-        return matrices;
+        LINFO("Loaded Model - %s : imported in %.2fms, cached in %.2fms", path.c_str(), importMs, timer.GetElapsedMS() - importMs);
+        ScratchEnd(Scratch);
     }
 
     TDArray<SharedPtr<Mesh>>& Model::GetMeshesRef()
@@ -165,13 +137,20 @@ namespace Lumos::Graphics
     {
         return m_Animation;
     }
-    SharedPtr<SamplingContext> Model::GetSamplingContext() const
+    const SharedPtr<AnimationController>& Model::GetAnimationController()
     {
-        return m_SamplingContext;
-    }
+        if(!m_AnimationController && !m_Animation.Empty())
+        {
+            m_AnimationController = CreateSharedPtr<AnimationController>();
+            m_AnimationController->SetSkeleton(m_Skeleton);
+            for(auto anim : m_Animation)
+            {
+                m_AnimationController->AddState(anim->GetName(), anim);
+            }
+            m_AnimationController->SetBindPoses(m_BindPoses);
+            m_AnimationController->SetCurrentState(m_CurrentAnimation);
+        }
 
-    SharedPtr<AnimationController> Model::GetAnimationController() const
-    {
         return m_AnimationController;
     }
 }
@@ -13,8 +13,9 @@ namespace Lumos
         class Skeleton;
         class Animation;
         class AnimationController;
-        struct SamplingContext;
         class Mesh;
+        class MeshCacheCapture;
+        struct CookedModel;
 
         class Model : public Asset
         {
@@ -26,7 +27,8 @@ namespace Lumos
 
         public:
             Model();
-            Model(const std::string& filePath);
+            // load false leaves the model without meshes until LoadModel, e.g. from the asset streamer
+            Model(const std::string& filePath, bool load = true);
             Model(const SharedPtr<Mesh>& mesh, PrimitiveType type);
             Model(PrimitiveType type);
 
@@ -38,9 +40,10 @@ namespace Lumos
 
             SharedPtr<Skeleton> GetSkeleton() const;
             const TDArray<SharedPtr<Animation>>& GetAnimations() const;
-            SharedPtr<SamplingContext> GetSamplingContext() const;
-            SharedPtr<AnimationController> GetAnimationController() const;
+            // Built on first use from the model's skeleton and animations, null for models without animations
+            const SharedPtr<AnimationController>& GetAnimationController();
 
+            // State new animation instances of this model start in
             uint32_t GetCurrentAnimationIndex() const { return m_CurrentAnimation; }
             void SetCurrentAnimationIndex(uint32_t index) { m_CurrentAnimation = index; }
 
@@ -49,11 +52,6 @@ namespace Lumos
             void SetPrimitiveType(PrimitiveType type) { m_PrimitiveType = type; }
             SET_ASSET_TYPE(AssetType::Model);
 
-            void UpdateAnimation(const TimeStep& dt);
-            void UpdateAnimation(const TimeStep& dt, float overrideTime);
-
-            TDArray<Mat4> GetJointMatrices();
-
             Model(const Model&);
             Model& operator=(const Model&);
             Model(Model&&);
@@ -68,7 +66,6 @@ namespace Lumos
 
             SharedPtr<Skeleton> m_Skeleton;
             TDArray<SharedPtr<Animation>> m_Animation;
-            SharedPtr<SamplingContext> m_SamplingContext;
             SharedPtr<AnimationController> m_AnimationController;
 
             uint32_t m_CurrentAnimation = 0;
@@ -79,8 +76,23 @@ namespace Lumos
             void LoadGLTF(const std::string& path);
             void LoadFBX(const std::string& path);
 
+            // Path of the cooked copy of a source model, named after the hash of its VFS path
+            static String8 GetCachePath(Arena* arena, const std::string& path, uint64_t* outPathHash);
+
+            // Implemented in ModelLoader/MeshCache.cpp
+            void LoadCooked(const CookedModel& cooked);
+            void SaveCooked(MeshCacheCapture& capture, const String8& cachePath, uint64_t pathHash);
+
         public:
             void LoadModel(const std::string& path);
+            // Creates the meshes from a cooked copy read by ReadCooked, or imports path when cooked is null
+            void LoadModelFromCooked(const std::string& path, const CookedModel* cooked);
+
+            // Maps and checks the cooked copy of path without creating any meshes or textures, so it can run on a worker.
+            // Null when there is no current cooked copy. Implemented in ModelLoader/MeshCache.cpp
+            static CookedModel* ReadCooked(const std::string& path);
+            static void ReleaseCooked(CookedModel* cooked);
+            static uint64_t GetCookedSize(const CookedModel* cooked);
         };
     }
 }
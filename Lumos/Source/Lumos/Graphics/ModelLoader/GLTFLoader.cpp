@@ -20,6 +20,7 @@
 #include "Core/Asset/AssetManager.h"
 #include "Maths/MathsUtilities.h"
 #include "Maths/Matrix3.h"
+#include "MeshCache.h"
 
 #define TINYGLTF_IMPLEMENTATION
 #define TINYGLTF_USE_CPP14
@@ -908,6 +909,22 @@ namespace Lumos::Graphics
             LERROR(warn.c_str());
         }
 
+        // External buffers and images end up in the mesh cache, so it has to notice when they change
+        if(Graphics::MeshCacheCapture* capture = Graphics::MeshCacheCapture::GetActive())
+        {
+            const std::string directory = StringUtilities::GetFileLocation(path);
+            for(const tinygltf::Buffer& buffer : model.buffers)
+            {
+                if(!buffer.uri.empty() && !tinygltf::IsDataURI(buffer.uri))
+                    capture->AddDependency(directory + tinygltf::dlib::urldecode(buffer.uri));
+            }
+            for(const tinygltf::Image& image : model.images)
+            {
+                if(!image.uri.empty() && !tinygltf::IsDataURI(image.uri))
+                    capture->AddDependency(directory + tinygltf::dlib::urldecode(image.uri));
+            }
+        }
+
         if(!ret || model.defaultScene < 0 || model.scenes.empty())
         {
             LERROR("Failed to parse glTF");
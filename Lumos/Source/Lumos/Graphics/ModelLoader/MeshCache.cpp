@@ -0,0 +1,922 @@
+#include "Precompiled.h"
+#include "MeshCache.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Material.h"
+#include "Graphics/RHI/Texture.h"
+#include "Graphics/RHI/Shader.h"
+#include "Graphics/Animation/Skeleton.h"
+#include "Graphics/Animation/Animation.h"
+#include "Core/OS/FileSystem.h"
+#include "Core/Asset/AssetPack.h"
+#include "Core/Asset/AssetManager.h"
+#include "Core/Application.h"
+#include "Utilities/Hash.h"
+#include "Utilities/StringUtilities.h"
+
+#include <ozz/animation/runtime/skeleton.h>
+#include <ozz/animation/runtime/animation.h>
+#include <ozz/base/io/archive.h>
+#include <ozz/base/io/stream.h>
+#include <ozz/base/memory/allocator.h>
+
+namespace Lumos::Graphics
+{
+    struct MeshCacheString
+    {
+        uint64_t Offset;
+        uint64_t Length;
+    };
+
+    struct MeshCacheHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t PathHash;
+        uint64_t FileSize;
+        uint32_t MeshCount;
+        uint32_t MaterialCount;
+        uint32_t TextureCount;
+        uint32_t AnimationCount;
+        uint32_t BindPoseCount;
+        uint32_t DependencyCount;
+        uint64_t DependenciesOffset;
+        uint64_t MeshesOffset;
+        uint64_t MaterialsOffset;
+        uint64_t TexturesOffset;
+        uint64_t AnimationsOffset;
+        uint64_t BindPosesOffset;
+        uint64_t SkeletonOffset;
+        uint64_t SkeletonSize; // 0 without a skeleton
+    };
+
+    struct MeshCacheMesh
+    {
+        MeshCacheString Name;
+        uint64_t VertexOffset;
+        uint64_t IndexOffset;
+        uint32_t VertexCount;
+        uint32_t IndexCount;
+        int32_t MaterialIndex;
+        uint32_t Animated;
+        float BoundsMin[3];
+        float BoundsMax[3];
+        uint32_t LODCount; // LOD index ranges are within IndexCount
+        MeshLOD LODs[MESH_LOD_MAX];
+        uint64_t PositionOffset; // Compact streams of VertexCount entries, 0 when the mesh was uploaded with full vertices
+        uint64_t AttributeOffset;
+        uint64_t ColourOffset; // 0 when the colours are uniform
+        Mat4 PositionDequantise;
+        Vec4 TexCoordScaleBias;
+    };
+
+    struct MeshCacheTexture
+    {
+        MeshCacheString Name;
+        MeshCacheString Path; // Loaded through the asset paths when the pixels aren't stored
+        uint64_t PixelOffset;
+        uint64_t PixelSize;
+        uint32_t Width;
+        uint32_t Height;
+        TextureDesc Desc;
+        TextureLoadOptions Options;
+    };
+
+    enum MeshCacheTextureSlot
+    {
+        Slot_Albedo,
+        Slot_Normal,
+        Slot_Metallic,
+        Slot_Roughness,
+        Slot_AO,
+        Slot_Emissive,
+        Slot_Count
+    };
+
+    struct MeshCacheMaterial
+    {
+        MaterialProperties Properties;
+        MeshCacheString Name;
+        MeshCacheString Shader; // Asset name, empty for the default
+        uint32_t Flags;
+        int32_t Textures[Slot_Count]; // Index into the texture table or -1
+    };
+
+    struct MeshCacheAnimation
+    {
+        MeshCacheString Name;
+        uint64_t Offset;
+        uint64_t Size;
+    };
+
+    static constexpr uint64_t MissingFile = ~0ull;
+
+    struct MeshCacheDependency
+    {
+        MeshCacheString Path;
+        uint64_t Size; // MissingFile if it didn't exist
+        int64_t ModifiedTime;
+        uint64_t Hash;
+    };
+
+    // Source or cache bytes, either mapped, pointing into the mounted pack or inflated from it
+    struct MeshCacheFile
+    {
+        String8 Data;
+        MappedFile Mapping;
+        uint8_t* Inflated = nullptr;
+        bool Packed       = false;
+    };
+
+    static bool OpenFile(const String8& path, MeshCacheFile* file)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        AssetPack* pack             = FileSystem::Get().GetPack();
+        const bool vfsPath          = path.size >= 2 && path.str[0] == '/' && path.str[1] == '/';
+        const AssetPackEntry* entry = pack && vfsPath ? pack->Find(path) : nullptr;
+
+        if(entry && entry->Kind != AssetPackEntryKind::Texture)
+        {
+            file->Packed = true;
+            if(entry->Compression == AssetPackCompression::None)
+                return pack->Read(nullptr, *entry, &file->Data);
+
+            file->Inflated = new uint8_t[entry->UncompressedSize];
+            file->Data     = Str8(file->Inflated, entry->UncompressedSize);
+            return pack->ReadInto(*entry, file->Inflated);
+        }
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 physicalPath;
+        bool opened = FileSystem::Get().ResolvePhysicalPath(scratch.arena, path, &physicalPath) && FileSystem::MapFile(physicalPath, &file->Mapping);
+        file->Data  = Str8(file->Mapping.Data, file->Mapping.Size);
+        ScratchEnd(scratch);
+        return opened;
+    }
+
+    static void CloseFile(MeshCacheFile* file)
+    {
+        FileSystem::UnmapFile(&file->Mapping);
+        delete[] file->Inflated;
+        *file = MeshCacheFile();
+    }
+
+    static bool InFile(const String8& file, uint64_t offset, uint64_t size)
+    {
+        return offset <= file.size && size <= file.size - offset;
+    }
+
+    static bool ReadString(const String8& file, const MeshCacheString& string, std::string& outString)
+    {
+        if(!InFile(file, string.Offset, string.Length))
+            return false;
+
+        outString.assign((const char*)file.str + string.Offset, string.Length);
+        return true;
+    }
+
+    template <typename T>
+    static bool ReadTable(const String8& file, uint64_t offset, uint32_t count, TDArray<T>& outTable)
+    {
+        if(!InFile(file, offset, uint64_t(count) * sizeof(T)))
+            return false;
+
+        // Copied out, compressed pack entries inflate into a buffer with no alignment guarantees.
+        // The records only hold integers and maths types, which are plain floats with user defined constructors
+        outTable.Resize(count);
+        if(count > 0)
+            MemoryCopy((void*)outTable.Data(), file.str + offset, count * sizeof(T));
+        return true;
+    }
+
+    // Read only ozz stream over the cache, so the skeleton and animations load without another copy
+    class MeshCacheStream : public ozz::io::Stream
+    {
+    public:
+        MeshCacheStream(const uint8_t* data, size_t size)
+            : m_Data(data)
+            , m_Size(size)
+        {
+        }
+
+        bool opened() const override { return m_Data != nullptr; }
+
+        size_t Read(void* buffer, size_t size) override
+        {
+            size = std::min(size, m_Size - m_Position);
+            MemoryCopy(buffer, m_Data + m_Position, size);
+            m_Position += size;
+            return size;
+        }
+
+        size_t Write(const void* buffer, size_t size) override { return 0; }
+
+        int Seek(int offset, Origin origin) override
+        {
+            const int64_t base     = origin == kSet ? 0 : (origin == kEnd ? (int64_t)m_Size : (int64_t)m_Position);
+            const int64_t position = base + offset;
+            if(position < 0 || position > (int64_t)m_Size)
+                return -1;
+
+            m_Position = (size_t)position;
+            return 0;
+        }
+
+        int Tell() const override { return (int)m_Position; }
+        size_t Size() const override { return m_Size; }
+
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Position = 0;
+    };
+
+    template <typename T>
+    static uint64_t AppendOzz(MeshCacheCapture& capture, const T& object, uint64_t* outSize)
+    {
+        ozz::io::MemoryStream stream;
+        ozz::io::OArchive archive(&stream);
+        archive << object;
+
+        TDArray<uint8_t> bytes(stream.Size());
+        stream.Seek(0, ozz::io::Stream::kSet);
+        stream.Read(bytes.Data(), bytes.Size());
+
+        *outSize = bytes.Size();
+        return capture.Append(bytes.Data(), bytes.Size());
+    }
+
+    bool MeshCache::HashSource(const String8& path, uint64_t* outHash, uint64_t* outSize)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        MeshCacheFile file;
+        if(!OpenFile(path, &file) || file.Data.size > uint64_t(INT_MAX))
+        {
+            CloseFile(&file);
+            return false;
+        }
+
+        *outHash = MurmurHash64A(file.Data.str, (int)file.Data.size, 0);
+        if(outSize)
+            *outSize = file.Data.size;
+
+        CloseFile(&file);
+        return true;
+    }
+
+    uint64_t MeshCache::HashPath(const String8& path)
+    {
+        return MurmurHash64A(path.str, (int)path.size, 0);
+    }
+
+    String8 MeshCache::GetCachePath(Arena* arena, uint64_t pathHash)
+    {
+        return PushStr8F(arena, "//Assets/Cache/Meshes/%016llx.lmesh", (unsigned long long)pathHash);
+    }
+
+    // Size and modified time of a loose file, outPhysicalPath is only set when it exists
+    static void StatDependency(Arena* arena, const String8& path, uint64_t* outSize, int64_t* outModifiedTime, String8* outPhysicalPath)
+    {
+        *outSize         = MissingFile;
+        *outModifiedTime = -1;
+        if(!FileSystem::Get().ResolvePhysicalPath(arena, path, outPhysicalPath))
+            return;
+
+        const int64_t size = FileSystem::GetFileSize(*outPhysicalPath);
+        *outSize           = size < 0 ? MissingFile : (uint64_t)size;
+        *outModifiedTime   = FileSystem::GetFileModifiedTime(*outPhysicalPath);
+    }
+
+    // Hashes files whose modified time changed, as touching a file leaves its contents alone. outDependencies gets the table
+    // with the new times and outTouched is set when any changed, so they can be saved and the next load skips the hashing
+    static bool CheckDependencies(const String8& file, const MeshCacheHeader& header, TDArray<MeshCacheDependency>& outDependencies, bool* outTouched)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        *outTouched = false;
+        if(header.DependencyCount == 0 || !ReadTable(file, header.DependenciesOffset, header.DependencyCount, outDependencies))
+            return false;
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        bool current      = true;
+        for(uint32_t i = 0; current && i < outDependencies.Size(); i++)
+        {
+            MeshCacheDependency& dependency = outDependencies[i];
+            current                         = InFile(file, dependency.Path.Offset, dependency.Path.Length);
+            if(!current)
+                break;
+
+            uint64_t size;
+            int64_t modifiedTime;
+            String8 physicalPath;
+            StatDependency(scratch.arena, Str8(file.str + dependency.Path.Offset, dependency.Path.Length), &size, &modifiedTime, &physicalPath);
+
+            current = size == dependency.Size;
+            if(!current || size == MissingFile || modifiedTime == dependency.ModifiedTime)
+                continue;
+
+            uint64_t hash = 0;
+            current       = MeshCache::HashSource(physicalPath, &hash) && hash == dependency.Hash;
+
+            dependency.ModifiedTime = modifiedTime;
+            *outTouched             = true;
+        }
+        ScratchEnd(scratch);
+        return current;
+    }
+
+    bool MeshCache::IsCurrent(const String8& cacheData)
+    {
+        MeshCacheHeader header = {};
+        if(cacheData.size < sizeof(header))
+            return false;
+
+        MemoryCopy(&header, cacheData.str, sizeof(header));
+
+        TDArray<MeshCacheDependency> dependencies;
+        bool touched;
+        return header.Magic == Magic && header.Version == Version && header.FileSize == cacheData.size && CheckDependencies(cacheData, header, dependencies, &touched);
+    }
+
+    // Writes new modified times into a loose cache file's dependency table
+    static void SaveDependencies(const String8& cachePath, const MeshCacheHeader& header, const TDArray<MeshCacheDependency>& dependencies)
+    {
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 physicalPath;
+        if(FileSystem::Get().ResolvePhysicalPath(scratch.arena, cachePath, &physicalPath))
+        {
+            if(FILE* file = fopen((const char*)physicalPath.str, "r+b"))
+            {
+                if(fseek(file, (long)header.DependenciesOffset, SEEK_SET) == 0)
+                    fwrite(dependencies.Data(), sizeof(MeshCacheDependency), dependencies.Size(), file);
+                fclose(file);
+            }
+        }
+        ScratchEnd(scratch);
+    }
+
+    static PerThread MeshCacheCapture* s_ActiveCapture = nullptr;
+
+    MeshCacheCapture::MeshCacheCapture()
+        : m_Previous(s_ActiveCapture)
+    {
+        m_Data.Resize(sizeof(MeshCacheHeader));
+        s_ActiveCapture = this;
+    }
+
+    MeshCacheCapture::~MeshCacheCapture()
+    {
+        s_ActiveCapture = m_Previous;
+    }
+
+    MeshCacheCapture* MeshCacheCapture::GetActive()
+    {
+        return s_ActiveCapture;
+    }
+
+    uint64_t MeshCacheCapture::Append(const void* data, uint64_t size)
+    {
+        const uint64_t offset = (m_Data.Size() + MeshCache::DataAlignment - 1) & ~(MeshCache::DataAlignment - 1);
+        const uint64_t end    = offset + size;
+
+        // Resize only reserves what it is asked for, grow geometrically so large imports don't copy on every append
+        if(end > m_Data.Capacity())
+            m_Data.Reserve(std::max<uint64_t>(end, m_Data.Capacity() * 2));
+
+        m_Data.Resize(end);
+        if(size > 0)
+            MemoryCopy(m_Data.Data() + offset, data, size);
+        return offset;
+    }
+
+    void MeshCacheCapture::AddMesh(const Mesh* mesh, const void* vertices, uint32_t vertexSize, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, bool animated)
+    {
+        CapturedMesh captured = {};
+        captured.Source       = mesh;
+        captured.VertexOffset = Append(vertices, uint64_t(vertexSize) * vertexCount);
+        captured.IndexOffset  = Append(indices, uint64_t(indexCount) * sizeof(uint32_t));
+        captured.VertexCount  = vertexCount;
+        captured.IndexCount   = indexCount;
+        captured.Animated     = animated;
+        m_Meshes.PushBack(captured);
+    }
+
+    void MeshCacheCapture::AddCompactStreams(const Mesh* mesh, const CompactVertexData& compact, uint32_t vertexCount)
+    {
+        // Added right after the mesh's vertices, so it is almost always the last one
+        for(uint32_t i = (uint32_t)m_Meshes.Size(); i > 0; i--)
+        {
+            CapturedMesh& captured = m_Meshes[i - 1];
+            if(captured.Source != mesh)
+                continue;
+
+            captured.PositionOffset  = Append(compact.Positions, uint64_t(vertexCount) * sizeof(CompactVertexPosition));
+            captured.AttributeOffset = Append(compact.Attributes, uint64_t(vertexCount) * sizeof(CompactVertexAttributes));
+            captured.ColourOffset    = compact.Colours ? Append(compact.Colours, uint64_t(vertexCount) * sizeof(uint32_t)) : 0;
+            return;
+        }
+    }
+
+    void MeshCacheCapture::AddTexture(const Texture2D* texture, const void* pixels, uint32_t width, uint32_t height, const TextureDesc& desc, const TextureLoadOptions& options)
+    {
+        if(!texture || !pixels)
+            return;
+
+        CapturedTexture captured = {};
+        captured.Source          = texture;
+        captured.PixelSize       = uint64_t(width) * height * (Texture::GetBitsFromFormat(desc.format) / 8);
+        captured.PixelOffset     = Append(pixels, captured.PixelSize);
+        captured.Width           = width;
+        captured.Height          = height;
+        captured.Desc            = desc;
+        captured.Options         = options;
+        m_Textures.PushBack(captured);
+    }
+
+    void MeshCacheCapture::AddTexture(const Texture2D* texture, const std::string& name, const std::string& filePath, const TextureDesc& desc, const TextureLoadOptions& options)
+    {
+        if(!texture || filePath.empty())
+            return;
+
+        // Stored as a VFS path where possible, so the texture can come from the pack on other machines
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 path      = FileSystem::Get().AbsolutePathToFileSystem(scratch.arena, Str8StdS(filePath));
+
+        CapturedTexture captured = {};
+        captured.Source          = texture;
+        captured.NameOffset      = Append(name.data(), name.size());
+        captured.NameLength      = (uint32_t)name.size();
+        captured.PathOffset      = Append(path.str, path.size);
+        captured.PathLength      = (uint32_t)path.size;
+        captured.Desc            = desc;
+        captured.Options         = options;
+        m_Textures.PushBack(captured);
+        ScratchEnd(scratch);
+    }
+
+    void MeshCacheCapture::AddDependency(const std::string& filePath)
+    {
+        std::string slashedPath = filePath;
+        StringUtilities::BackSlashesToSlashes(slashedPath);
+
+        ArenaTemp scratch      = ScratchBegin(nullptr, 0);
+        const std::string path = ToStdString(FileSystem::Get().AbsolutePathToFileSystem(scratch.arena, Str8StdS(slashedPath)));
+        ScratchEnd(scratch);
+
+        for(const std::string& dependency : m_Dependencies)
+        {
+            if(dependency == path)
+                return;
+        }
+        m_Dependencies.PushBack(path);
+    }
+
+    const MeshCacheCapture::CapturedMesh* MeshCacheCapture::FindMesh(const Mesh* mesh) const
+    {
+        for(const CapturedMesh& captured : m_Meshes)
+        {
+            if(captured.Source == mesh)
+                return &captured;
+        }
+        return nullptr;
+    }
+
+    int32_t MeshCacheCapture::FindTexture(const Texture2D* texture) const
+    {
+        for(uint32_t i = 0; i < m_Textures.Size(); i++)
+        {
+            if(m_Textures[i].Source == texture)
+                return (int32_t)i;
+        }
+        return -1;
+    }
+
+    void Model::SaveCooked(MeshCacheCapture& capture, const String8& cachePath, uint64_t pathHash)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        TDArray<MeshCacheMesh> meshes;
+        TDArray<MeshCacheMaterial> materials;
+        TDArray<const Material*> materialSources;
+        TDArray<MeshCacheTexture> textures;
+        TDArray<int32_t> textureRemap(capture.GetTextures().Size(), -1);
+
+        auto AppendString = [&capture](const std::string& string)
+        {
+            MeshCacheString cooked = {};
+            cooked.Offset          = capture.Append(string.data(), string.size());
+            cooked.Length          = string.size();
+            return cooked;
+        };
+
+        // Only textures the materials still use are written, in the order they're first referenced
+        auto TextureIndex = [&](const SharedPtr<Texture2D>& texture)
+        {
+            const int32_t captured = texture ? capture.FindTexture(texture.get()) : -1;
+            if(captured < 0)
+                return -1;
+
+            if(textureRemap[captured] < 0)
+            {
+                const MeshCacheCapture::CapturedTexture& source = capture.GetTextures()[captured];
+
+                MeshCacheTexture cooked = {};
+                cooked.Name             = { source.NameOffset, source.NameLength };
+                cooked.Path             = { source.PathOffset, source.PathLength };
+                cooked.PixelOffset      = source.PixelOffset;
+                cooked.PixelSize        = source.PixelSize;
+                cooked.Width            = source.Width;
+                cooked.Height           = source.Height;
+                cooked.Desc             = source.Desc;
+                cooked.Options          = source.Options;
+
+                textureRemap[captured] = (int32_t)textures.Size();
+                textures.PushBack(cooked);
+            }
+            return textureRemap[captured];
+        };
+
+        auto& assetManager = Application::Get().GetAssetManager();
+
+        for(const SharedPtr<Mesh>& mesh : m_Meshes)
+        {
+            const MeshCacheCapture::CapturedMesh* captured = capture.FindMesh(mesh.get());
+            if(!captured)
+            {
+                LWARN("Not caching model %s : mesh %s wasn't created by the importer", m_FilePath.c_str(), mesh->GetName().c_str());
+                return;
+            }
+
+            int32_t materialIndex          = -1;
+            const SharedPtr<Material>& material = mesh->GetMaterial();
+            for(uint32_t i = 0; material && i < materialSources.Size(); i++)
+            {
+                if(materialSources[i] == material.get())
+                    materialIndex = (int32_t)i;
+            }
+
+            if(material && materialIndex < 0)
+            {
+                MeshCacheMaterial cooked = {};
+                cooked.Name              = AppendString(material->GetName());
+                cooked.Flags             = material->GetFlags();
+                if(material->GetProperties())
+                    cooked.Properties = *material->GetProperties();
+
+                String8 shaderName;
+                if(material->GetShader() && assetManager && assetManager->GetAssetRegistry()->GetName(material->GetShader()->Handle, shaderName))
+                    cooked.Shader = AppendString(ToStdString(shaderName));
+
+                const PBRMataterialTextures& sourceTextures = material->GetTextures();
+                cooked.Textures[Slot_Albedo]                = TextureIndex(sourceTextures.albedo);
+                cooked.Textures[Slot_Normal]                = TextureIndex(sourceTextures.normal);
+                cooked.Textures[Slot_Metallic]              = TextureIndex(sourceTextures.metallic);
+                cooked.Textures[Slot_Roughness]             = TextureIndex(sourceTextures.roughness);
+                cooked.Textures[Slot_AO]                    = TextureIndex(sourceTextures.ao);
+                cooked.Textures[Slot_Emissive]              = TextureIndex(sourceTextures.emissive);
+
+                materialIndex = (int32_t)materials.Size();
+                materials.PushBack(cooked);
+                materialSources.PushBack(material.get());
+            }
+
+            const Vec3 boundsMin = mesh->GetBoundingBox().Min();
+            const Vec3 boundsMax = mesh->GetBoundingBox().Max();
+
+            MeshCacheMesh cooked = {};
+            cooked.Name          = AppendString(mesh->GetName());
+            cooked.VertexOffset  = captured->VertexOffset;
+            cooked.IndexOffset   = captured->IndexOffset;
+            cooked.VertexCount   = captured->VertexCount;
+            cooked.IndexCount    = captured->IndexCount;
+            cooked.MaterialIndex = materialIndex;
+            cooked.Animated      = captured->Animated ? 1 : 0;
+            cooked.LODCount      = mesh->GetLODCount();
+            if(captured->PositionOffset && mesh->IsCompact())
+            {
+                cooked.PositionOffset     = captured->PositionOffset;
+                cooked.AttributeOffset    = captured->AttributeOffset;
+                cooked.ColourOffset       = captured->ColourOffset;
+                cooked.PositionDequantise = mesh->GetPositionDequantise();
+                cooked.TexCoordScaleBias  = mesh->GetTexCoordScaleBias();
+            }
+            for(int i = 0; i < 3; i++)
+            {
+                cooked.BoundsMin[i] = boundsMin[i];
+                cooked.BoundsMax[i] = boundsMax[i];
+            }
+            for(uint32_t i = 0; i < cooked.LODCount; i++)
+                cooked.LODs[i] = mesh->GetLOD(i);
+            meshes.PushBack(cooked);
+        }
+
+        // Hashed after the import so the contents match the times recorded with them
+        TDArray<MeshCacheDependency> dependencies;
+        {
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            for(const std::string& path : capture.GetDependencies())
+            {
+                String8 physicalPath;
+                MeshCacheDependency dependency = {};
+                dependency.Path                = AppendString(path);
+                StatDependency(scratch.arena, Str8StdS(path), &dependency.Size, &dependency.ModifiedTime, &physicalPath);
+                if(dependency.Size != MissingFile && !MeshCache::HashSource(physicalPath, &dependency.Hash))
+                {
+                    LWARN("Not caching model %s : couldn't read %s", m_FilePath.c_str(), path.c_str());
+                    ScratchEnd(scratch);
+                    return;
+                }
+                dependencies.PushBack(dependency);
+            }
+            ScratchEnd(scratch);
+        }
+
+        MeshCacheHeader header    = {};
+        header.Magic              = MeshCache::Magic;
+        header.Version            = MeshCache::Version;
+        header.PathHash           = pathHash;
+        header.DependencyCount    = (uint32_t)dependencies.Size();
+        header.DependenciesOffset = capture.Append(dependencies.Data(), dependencies.Size() * sizeof(MeshCacheDependency));
+
+        if(m_Skeleton && m_Skeleton->Valid())
+        {
+            header.SkeletonOffset = AppendOzz(capture, m_Skeleton->GetSkeleton(), &header.SkeletonSize);
+
+            TDArray<MeshCacheAnimation> animations;
+            for(const SharedPtr<Animation>& animation : m_Animation)
+            {
+                // Animations the importer failed to build aren't worth keeping
+                if(!animation->Valid())
+                    continue;
+
+                MeshCacheAnimation cooked = {};
+                cooked.Name               = AppendString(animation->GetName());
+                cooked.Offset             = AppendOzz(capture, animation->GetAnimation(), &cooked.Size);
+                animations.PushBack(cooked);
+            }
+
+            header.AnimationCount   = (uint32_t)animations.Size();
+            header.AnimationsOffset = capture.Append(animations.Data(), animations.Size() * sizeof(MeshCacheAnimation));
+            header.BindPoseCount    = (uint32_t)m_BindPoses.Size();
+            header.BindPosesOffset  = capture.Append(m_BindPoses.Data(), m_BindPoses.Size() * sizeof(Mat4));
+        }
+
+        header.MeshCount       = (uint32_t)meshes.Size();
+        header.MeshesOffset    = capture.Append(meshes.Data(), meshes.Size() * sizeof(MeshCacheMesh));
+        header.MaterialCount   = (uint32_t)materials.Size();
+        header.MaterialsOffset = capture.Append(materials.Data(), materials.Size() * sizeof(MeshCacheMaterial));
+        header.TextureCount    = (uint32_t)textures.Size();
+        header.TexturesOffset  = capture.Append(textures.Data(), textures.Size() * sizeof(MeshCacheTexture));
+
+        TDArray<uint8_t>& data = capture.GetData();
+        header.FileSize        = data.Size();
+        MemoryCopy(data.Data(), &header, sizeof(header));
+
+        if(data.Size() > UINT32_MAX)
+        {
+            LWARN("Not caching model %s : %llu bytes is too large", m_FilePath.c_str(), (unsigned long long)data.Size());
+            return;
+        }
+
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        String8 assetFolder, cacheFolder, meshFolder, physicalPath;
+
+        // Resolving fills in the path even when the file or folder doesn't exist yet
+        if(FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8Lit("//Assets"), &assetFolder, true))
+        {
+            FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8Lit("//Assets/Cache"), &cacheFolder, true);
+            FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8Lit("//Assets/Cache/Meshes"), &meshFolder, true);
+            FileSystem::Get().ResolvePhysicalPath(scratch.arena, cachePath, &physicalPath);
+
+            FileSystem::CreateFolderIfDoesntExist(cacheFolder);
+            FileSystem::CreateFolderIfDoesntExist(meshFolder);
+            if(!FileSystem::WriteFile(physicalPath, data.Data(), (uint32_t)data.Size()))
+                LWARN("Failed to write mesh cache %s", (const char*)physicalPath.str);
+        }
+        ScratchEnd(scratch);
+    }
+
+    struct CookedModel
+    {
+        MeshCacheFile File;
+        MeshCacheHeader Header = {};
+        TDArray<MeshCacheMesh> Meshes;
+        TDArray<MeshCacheMaterial> Materials;
+        TDArray<MeshCacheTexture> Textures;
+        TDArray<MeshCacheAnimation> Animations;
+        TDArray<MeshCacheDependency> Dependencies;
+        std::string CachePath;
+        bool Touched = false;
+    };
+
+    CookedModel* Model::ReadCooked(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        uint64_t pathHash;
+        String8 cachePath   = GetCachePath(scratch.arena, path, &pathHash);
+        CookedModel* cooked = new CookedModel();
+        cooked->CachePath   = ToStdString(cachePath);
+        ScratchEnd(scratch);
+
+        MeshCacheFile& cacheFile = cooked->File;
+        if(!OpenFile(Str8StdS(cooked->CachePath), &cacheFile))
+        {
+            ReleaseCooked(cooked);
+            return nullptr;
+        }
+
+        const String8 file                         = cacheFile.Data;
+        MeshCacheHeader& header                    = cooked->Header;
+        TDArray<MeshCacheMesh>& meshes             = cooked->Meshes;
+        TDArray<MeshCacheMaterial>& materials      = cooked->Materials;
+        TDArray<MeshCacheTexture>& textures        = cooked->Textures;
+        TDArray<MeshCacheAnimation>& animations    = cooked->Animations;
+        TDArray<MeshCacheDependency>& dependencies = cooked->Dependencies;
+        bool& touched                              = cooked->Touched;
+        if(file.size >= sizeof(header))
+            MemoryCopy(&header, file.str, sizeof(header));
+
+        // Everything is checked before anything is created, a stale or truncated cache falls back to importing.
+        // AssetPack::Cook only packs current caches, so ones read from the pack skip the dependency checks
+        bool valid = header.Magic == MeshCache::Magic && header.Version == MeshCache::Version && header.PathHash == pathHash && header.FileSize == file.size;
+        valid      = valid && (cacheFile.Packed || CheckDependencies(file, header, dependencies, &touched));
+        valid      = valid && ReadTable(file, header.MeshesOffset, header.MeshCount, meshes);
+        valid      = valid && ReadTable(file, header.MaterialsOffset, header.MaterialCount, materials);
+        valid      = valid && ReadTable(file, header.TexturesOffset, header.TextureCount, textures);
+        valid      = valid && ReadTable(file, header.AnimationsOffset, header.AnimationCount, animations);
+        valid      = valid && InFile(file, header.BindPosesOffset, uint64_t(header.BindPoseCount) * sizeof(Mat4));
+        valid      = valid && InFile(file, header.SkeletonOffset, header.SkeletonSize);
+
+        for(const MeshCacheMesh& mesh : meshes)
+        {
+            const uint64_t vertexSize = mesh.Animated ? sizeof(AnimVertex) : sizeof(Vertex);
+            valid                     = valid && InFile(file, mesh.VertexOffset, mesh.VertexCount * vertexSize) && InFile(file, mesh.IndexOffset, mesh.IndexCount * sizeof(uint32_t));
+            valid                     = valid && InFile(file, mesh.Name.Offset, mesh.Name.Length) && mesh.MaterialIndex < (int32_t)materials.Size();
+            valid                     = valid && mesh.LODCount > 0 && mesh.LODCount <= MESH_LOD_MAX;
+            for(uint32_t i = 0; valid && i < mesh.LODCount; i++)
+                valid = uint64_t(mesh.LODs[i].IndexOffset) + mesh.LODs[i].IndexCount <= mesh.IndexCount;
+
+            if(mesh.PositionOffset)
+            {
+                valid = valid && InFile(file, mesh.PositionOffset, mesh.VertexCount * sizeof(CompactVertexPosition)) && InFile(file, mesh.AttributeOffset, mesh.VertexCount * sizeof(CompactVertexAttributes));
+                valid = valid && InFile(file, mesh.ColourOffset, mesh.ColourOffset ? mesh.VertexCount * sizeof(uint32_t) : 0);
+            }
+        }
+
+        for(const MeshCacheMaterial& material : materials)
+        {
+            valid = valid && InFile(file, material.Name.Offset, material.Name.Length) && InFile(file, material.Shader.Offset, material.Shader.Length);
+            for(int32_t texture : material.Textures)
+                valid = valid && texture < (int32_t)textures.Size();
+        }
+
+        for(const MeshCacheTexture& texture : textures)
+            valid = valid && InFile(file, texture.PixelOffset, texture.PixelSize) && InFile(file, texture.Name.Offset, texture.Name.Length) && InFile(file, texture.Path.Offset, texture.Path.Length);
+
+        for(const MeshCacheAnimation& animation : animations)
+            valid = valid && InFile(file, animation.Offset, animation.Size) && InFile(file, animation.Name.Offset, animation.Name.Length);
+
+        if(!valid)
+        {
+            ReleaseCooked(cooked);
+            return nullptr;
+        }
+
+        return cooked;
+    }
+
+    void Model::ReleaseCooked(CookedModel* cooked)
+    {
+        if(!cooked)
+            return;
+
+        CloseFile(&cooked->File);
+        delete cooked;
+    }
+
+    uint64_t Model::GetCookedSize(const CookedModel* cooked)
+    {
+        return cooked ? cooked->File.Data.size : 0;
+    }
+
+    void Model::LoadCooked(const CookedModel& cooked)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const String8 file                            = cooked.File.Data;
+        const MeshCacheHeader& header                 = cooked.Header;
+        const TDArray<MeshCacheMesh>& meshes          = cooked.Meshes;
+        const TDArray<MeshCacheMaterial>& materials   = cooked.Materials;
+        const TDArray<MeshCacheTexture>& textures     = cooked.Textures;
+        const TDArray<MeshCacheAnimation>& animations = cooked.Animations;
+
+        TDArray<SharedPtr<Texture2D>> loadedTextures;
+        loadedTextures.Reserve(textures.Size());
+        for(const MeshCacheTexture& texture : textures)
+        {
+            std::string name, path;
+            ReadString(file, texture.Name, name);
+            ReadString(file, texture.Path, path);
+
+            Texture2D* texture2D = nullptr;
+            if(texture.PixelSize > 0)
+                texture2D = Texture2D::CreateFromSource(texture.Width, texture.Height, (void*)(file.str + texture.PixelOffset), texture.Desc, texture.Options);
+            else
+                texture2D = Texture2D::CreateFromFile(name, path, texture.Desc, texture.Options);
+
+            loadedTextures.PushBack(SharedPtr<Texture2D>(texture2D));
+        }
+
+        auto Slot = [&loadedTextures](int32_t index)
+        {
+            return index >= 0 ? loadedTextures[index] : SharedPtr<Texture2D>();
+        };
+
+        auto& assetManager = Application::Get().GetAssetManager();
+        TDArray<SharedPtr<Material>> loadedMaterials;
+        loadedMaterials.Reserve(materials.Size());
+        for(const MeshCacheMaterial& material : materials)
+        {
+            std::string name, shaderName;
+            ReadString(file, material.Name, name);
+            ReadString(file, material.Shader, shaderName);
+
+            SharedPtr<Shader> shader = assetManager->GetAssetData(shaderName.empty() ? Str8Lit("ForwardPBR") : Str8StdS(shaderName)).As<Shader>();
+            SharedPtr<Material> pbrMaterial = CreateSharedPtr<Material>(shader);
+
+            PBRMataterialTextures pbrTextures;
+            pbrTextures.albedo    = Slot(material.Textures[Slot_Albedo]);
+            pbrTextures.normal    = Slot(material.Textures[Slot_Normal]);
+            pbrTextures.metallic  = Slot(material.Textures[Slot_Metallic]);
+            pbrTextures.roughness = Slot(material.Textures[Slot_Roughness]);
+            pbrTextures.ao        = Slot(material.Textures[Slot_AO]);
+            pbrTextures.emissive  = Slot(material.Textures[Slot_Emissive]);
+
+            pbrMaterial->SetTextures(pbrTextures);
+            pbrMaterial->SetMaterialProperites(material.Properties);
+            pbrMaterial->SetName(name);
+            pbrMaterial->SetFlags(material.Flags);
+            loadedMaterials.PushBack(pbrMaterial);
+        }
+
+        for(const MeshCacheMesh& mesh : meshes)
+        {
+            std::string name;
+            ReadString(file, mesh.Name, name);
+
+            const Maths::BoundingBox bounds(Vec3(mesh.BoundsMin[0], mesh.BoundsMin[1], mesh.BoundsMin[2]), Vec3(mesh.BoundsMax[0], mesh.BoundsMax[1], mesh.BoundsMax[2]));
+            const uint32_t* indices = (const uint32_t*)(file.str + mesh.IndexOffset);
+
+            // Quantised streams are used as stored when compact vertices are still on, otherwise the full vertices are
+            SharedPtr<Mesh> lMesh;
+            if(mesh.PositionOffset && CompactVertexScope::IsEnabled())
+            {
+                CompactVertexData compact;
+                compact.Positions          = (const CompactVertexPosition*)(file.str + mesh.PositionOffset);
+                compact.Attributes         = (const CompactVertexAttributes*)(file.str + mesh.AttributeOffset);
+                compact.Colours            = mesh.ColourOffset ? (const uint32_t*)(file.str + mesh.ColourOffset) : nullptr;
+                compact.PositionDequantise = mesh.PositionDequantise;
+                compact.TexCoordScaleBias  = mesh.TexCoordScaleBias;
+                lMesh                      = CreateSharedPtr<Mesh>(indices, mesh.IndexCount, compact, mesh.VertexCount, bounds, mesh.LODs, mesh.LODCount);
+            }
+            else
+                lMesh = CreateSharedPtr<Mesh>(indices, mesh.IndexCount, file.str + mesh.VertexOffset, mesh.VertexCount, mesh.Animated != 0, bounds, mesh.LODs, mesh.LODCount);
+            lMesh->SetName(name);
+            if(mesh.MaterialIndex >= 0)
+                lMesh->SetMaterial(loadedMaterials[mesh.MaterialIndex]);
+
+            m_Meshes.PushBack(lMesh);
+        }
+
+        if(header.SkeletonSize > 0)
+        {
+            MeshCacheStream skeletonStream(file.str + header.SkeletonOffset, header.SkeletonSize);
+            ozz::io::IArchive skeletonArchive(&skeletonStream);
+
+            // Skeleton and Animation release these through the ozz allocator
+            ozz::animation::Skeleton* skeleton = ozz::New<ozz::animation::Skeleton>();
+            if(skeletonArchive.TestTag<ozz::animation::Skeleton>())
+                skeletonArchive >> *skeleton;
+            m_Skeleton = CreateSharedPtr<Skeleton>(skeleton);
+
+            for(const MeshCacheAnimation& animation : animations)
+            {
+                std::string name;
+                ReadString(file, animation.Name, name);
+
+                MeshCacheStream animationStream(file.str + animation.Offset, animation.Size);
+                ozz::io::IArchive animationArchive(&animationStream);
+
+                ozz::animation::Animation* ozzAnimation = ozz::New<ozz::animation::Animation>();
+                if(animationArchive.TestTag<ozz::animation::Animation>())
+                    animationArchive >> *ozzAnimation;
+                m_Animation.PushBack(CreateSharedPtr<Animation>(name, ozzAnimation, m_Skeleton));
+            }
+
+            m_BindPoses.Resize(header.BindPoseCount);
+            for(uint32_t i = 0; i < header.BindPoseCount; i++)
+                MemoryCopy(m_BindPoses[i].values, file.str + header.BindPosesOffset + i * sizeof(Mat4), sizeof(m_BindPoses[i].values));
+        }
+
+        if(cooked.Touched)
+            SaveDependencies(Str8StdS(cooked.CachePath), header, cooked.Dependencies);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "Core/DataStructures/TDArray.h"
+#include "Core/String.h"
+#include "Graphics/RHI/RHIDefinitions.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class Mesh;
+        class Texture2D;
+        struct CompactVertexData;
+
+        // Cooked copy of an imported model in //Assets/Cache/Meshes, named after the hash of the source file's VFS path.
+        // Vertex, index and embedded texture data is stored exactly as it was uploaded, alongside the materials, skeleton
+        // and animations, so later loads map the file and skip the glTF/OBJ/FBX importers. Meshes imported with compact
+        // vertices also keep their quantised streams, which loads use instead of encoding the full vertices again.
+        // Every file the import read (the model, glTF buffers and images, OBJ material libraries) is listed with its size,
+        // modified time and content hash. A cache is used while the sizes and times match, or the contents still hash the same.
+        namespace MeshCache
+        {
+            static constexpr uint32_t Magic         = 0x48534D4C; // LMSH
+            static constexpr uint32_t Version       = 4;
+            static constexpr uint64_t DataAlignment = 16;
+
+            // Hashes a loose or packed source file. path may be a VFS or physical path
+            bool HashSource(const String8& path, uint64_t* outHash, uint64_t* outSize = nullptr);
+            uint64_t HashPath(const String8& path);
+            String8 GetCachePath(Arena* arena, uint64_t pathHash);
+
+            // Whether the files a cache was built from are unchanged. cacheData is the whole .lmesh file
+            bool IsCurrent(const String8& cacheData);
+        }
+
+        // Records what the importers upload while it is alive, on the thread that created it.
+        // Model writes it to the mesh cache once the import finishes.
+        class MeshCacheCapture
+        {
+        public:
+            struct CapturedMesh
+            {
+                const Mesh* Source;
+                uint64_t VertexOffset;
+                uint64_t IndexOffset;
+                uint32_t VertexCount;
+                uint32_t IndexCount;
+                bool Animated;
+                uint64_t PositionOffset;  // Compact streams, 0 when the mesh was uploaded with full vertices
+                uint64_t AttributeOffset;
+                uint64_t ColourOffset;    // 0 when the colours are uniform
+            };
+
+            struct CapturedTexture
+            {
+                const Texture2D* Source;
+                uint64_t PixelOffset; // 0 for textures loaded from a file
+                uint64_t PixelSize;
+                uint32_t Width;
+                uint32_t Height;
+                uint64_t NameOffset;
+                uint32_t NameLength;
+                uint64_t PathOffset;
+                uint32_t PathLength;
+                TextureDesc Desc;
+                TextureLoadOptions Options;
+            };
+
+            MeshCacheCapture();
+            ~MeshCacheCapture();
+
+            NONCOPYABLEANDMOVE(MeshCacheCapture);
+
+            static MeshCacheCapture* GetActive();
+
+            void AddMesh(const Mesh* mesh, const void* vertices, uint32_t vertexSize, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, bool animated);
+            void AddCompactStreams(const Mesh* mesh, const CompactVertexData& compact, uint32_t vertexCount);
+            void AddTexture(const Texture2D* texture, const void* pixels, uint32_t width, uint32_t height, const TextureDesc& desc, const TextureLoadOptions& options);
+            void AddTexture(const Texture2D* texture, const std::string& name, const std::string& filePath, const TextureDesc& desc, const TextureLoadOptions& options);
+
+            // A file the import read. Missing files are recorded as well, creating one invalidates the cache
+            void AddDependency(const std::string& filePath);
+
+            // Copies size bytes to the end of the file data, aligned to MeshCache::DataAlignment. Returns the file offset
+            uint64_t Append(const void* data, uint64_t size);
+
+            const CapturedMesh* FindMesh(const Mesh* mesh) const;
+            int32_t FindTexture(const Texture2D* texture) const;
+
+            const TDArray<CapturedTexture>& GetTextures() const { return m_Textures; }
+            const TDArray<std::string>& GetDependencies() const { return m_Dependencies; }
+            TDArray<uint8_t>& GetData() { return m_Data; }
+
+        private:
+            TDArray<uint8_t> m_Data; // Starts with room for the header, so offsets are from the start of the file
+            TDArray<CapturedMesh> m_Meshes;
+            TDArray<CapturedTexture> m_Textures;
+            TDArray<std::string> m_Dependencies; // VFS paths where possible
+            MeshCacheCapture* m_Previous = nullptr;
+        };
+    }
+}
@@ -8,12 +8,36 @@
 #include "Utilities/StringUtilities.h"
 #include "Core/Application.h"
 #include "Core/Asset/AssetManager.h"
+#include "MeshCache.h"
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <ModelLoaders/tinyobjloader/tiny_obj_loader.h>
 
+#include <fstream>
+
 namespace Lumos
 {
+    // Records each material library it reads, the materials end up in the mesh cache
+    class OBJMaterialFileReader : public tinyobj::MaterialFileReader
+    {
+    public:
+        explicit OBJMaterialFileReader(const std::string& directory)
+            : tinyobj::MaterialFileReader(directory)
+            , m_Directory(directory)
+        {
+        }
+
+        bool operator()(const std::string& matId, std::vector<tinyobj::material_t>* materials, std::map<std::string, int>* matMap, std::string* err) override
+        {
+            if(Graphics::MeshCacheCapture* capture = Graphics::MeshCacheCapture::GetActive())
+                capture->AddDependency(m_Directory + matId);
+            return tinyobj::MaterialFileReader::operator()(matId, materials, matMap, err);
+        }
+
+    private:
+        std::string m_Directory;
+    };
+
     std::string m_Directory;
     TDArray<SharedPtr<Graphics::Texture2D>> m_Textures;
 
@@ -53,8 +77,11 @@ namespace Lumos
 
         std::string name = StringUtilities::GetFileName(resolvedPath);
 
-        bool ok = tinyobj::LoadObj(
-            &attrib, &shapes, &materials, &error, (resolvedPath).c_str(), (m_Directory).c_str());
+        std::ifstream stream(resolvedPath);
+        OBJMaterialFileReader materialReader(m_Directory);
+        bool ok = stream && tinyobj::LoadObj(&attrib, &shapes, &materials, &error, &stream, &materialReader);
+        if(!stream)
+            error = "Cannot open file [" + resolvedPath + "]";
 
         if(!ok)
         {
@@ -3,18 +3,267 @@
 #include "Maths/Random.h"
 #include "Maths/MathsUtilities.h"
 #include "Graphics/RHI/Texture.h"
+#include "Graphics/RHI/StorageBuffer.h"
+#include "Graphics/RHI/DescriptorSet.h"
+#include "Core/OS/Memory.h"
+
+#ifdef LUMOS_SSE
+#include <xmmintrin.h>
+#endif
 
 namespace Lumos
 {
+    namespace
+    {
+#ifdef LUMOS_SSE
+        typedef __m128 FloatLane;
+        typedef __m128 MaskLane;
+
+        inline FloatLane LoadLane(const float* p) { return _mm_loadu_ps(p); }
+        inline void StoreLane(float* p, FloatLane v) { _mm_storeu_ps(p, v); }
+        inline FloatLane SplatLane(float v) { return _mm_set1_ps(v); }
+        inline FloatLane Add(FloatLane a, FloatLane b) { return _mm_add_ps(a, b); }
+        inline FloatLane Sub(FloatLane a, FloatLane b) { return _mm_sub_ps(a, b); }
+        inline FloatLane Mul(FloatLane a, FloatLane b) { return _mm_mul_ps(a, b); }
+        inline MaskLane Less(FloatLane a, FloatLane b) { return _mm_cmplt_ps(a, b); }
+        inline MaskLane Greater(FloatLane a, FloatLane b) { return _mm_cmpgt_ps(a, b); }
+        inline FloatLane Select(MaskLane mask, FloatLane a, FloatLane b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+#else
+        typedef float FloatLane;
+        typedef bool MaskLane;
+
+        inline FloatLane LoadLane(const float* p) { return *p; }
+        inline void StoreLane(float* p, FloatLane v) { *p = v; }
+        inline FloatLane SplatLane(float v) { return v; }
+        inline FloatLane Add(FloatLane a, FloatLane b) { return a + b; }
+        inline FloatLane Sub(FloatLane a, FloatLane b) { return a - b; }
+        inline FloatLane Mul(FloatLane a, FloatLane b) { return a * b; }
+        inline MaskLane Less(FloatLane a, FloatLane b) { return a < b; }
+        inline MaskLane Greater(FloatLane a, FloatLane b) { return a > b; }
+        inline FloatLane Select(MaskLane mask, FloatLane a, FloatLane b) { return mask ? a : b; }
+#endif
+
+        // Lanes past AliveCount run too, the streams are padded to a whole lane and nothing reads them until a spawn
+        // overwrites them. Particles dying this step are integrated once more and removed after.
+        void IntegrateParticles(ParticleStreams& particles, const Vec3& gravity, float particleLife, float fadeIn, float fadeOut, float dt)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const FloatLane dtLane       = SplatLane(dt);
+            const FloatLane gravityX     = SplatLane(gravity.x * dt);
+            const FloatLane gravityY     = SplatLane(gravity.y * dt);
+            const FloatLane gravityZ     = SplatLane(gravity.z * dt);
+            const FloatLane lifeLane     = SplatLane(particleLife);
+            const FloatLane fadeInStart  = SplatLane(particleLife - fadeIn);
+            const FloatLane fadeInScale  = SplatLane(fadeIn > 0.0f ? 1.0f / fadeIn : 0.0f);
+            const FloatLane fadeOutLane  = SplatLane(fadeOut);
+            const FloatLane fadeOutScale = SplatLane(fadeOut > 0.0f ? 1.0f / fadeOut : 0.0f);
+            const bool fading            = fadeIn > 0.0f || fadeOut > 0.0f;
+
+            for(uint32_t i = 0; i < particles.AliveCount; i += ParticleStreams::LaneCount)
+            {
+                const FloatLane life = Sub(LoadLane(particles.Life + i), dtLane);
+                StoreLane(particles.Life + i, life);
+
+                const FloatLane velocityX = Add(LoadLane(particles.VelocityX + i), gravityX);
+                const FloatLane velocityY = Add(LoadLane(particles.VelocityY + i), gravityY);
+                const FloatLane velocityZ = Add(LoadLane(particles.VelocityZ + i), gravityZ);
+                StoreLane(particles.VelocityX + i, velocityX);
+                StoreLane(particles.VelocityY + i, velocityY);
+                StoreLane(particles.VelocityZ + i, velocityZ);
+
+                StoreLane(particles.PositionX + i, Add(LoadLane(particles.PositionX + i), Mul(velocityX, dtLane)));
+                StoreLane(particles.PositionY + i, Add(LoadLane(particles.PositionY + i), Mul(velocityY, dtLane)));
+                StoreLane(particles.PositionZ + i, Add(LoadLane(particles.PositionZ + i), Mul(velocityZ, dtLane)));
+
+                // Fading in wins over fading out where the two overlap
+                if(fading)
+                {
+                    FloatLane alpha = LoadLane(particles.Alpha + i);
+                    if(fadeOut > 0.0f)
+                        alpha = Select(Less(life, fadeOutLane), Mul(life, fadeOutScale), alpha);
+                    if(fadeIn > 0.0f)
+                        alpha = Select(Greater(life, fadeInStart), Mul(Sub(lifeLane, life), fadeInScale), alpha);
+                    StoreLane(particles.Alpha + i, alpha);
+                }
+            }
+        }
+    }
+
+    static void TakeStreams(ParticleStreams& to, ParticleStreams& from)
+    {
+        to.AliveCount = from.AliveCount;
+        to.Capacity   = from.Capacity;
+        to.PositionX  = from.PositionX;
+        to.PositionY  = from.PositionY;
+        to.PositionZ  = from.PositionZ;
+        to.VelocityX  = from.VelocityX;
+        to.VelocityY  = from.VelocityY;
+        to.VelocityZ  = from.VelocityZ;
+        to.Alpha      = from.Alpha;
+        to.Life       = from.Life;
+        to.Size       = from.Size;
+        to.m_Arena    = from.m_Arena;
+
+        from.m_Arena = nullptr;
+        from.Release();
+    }
+
+    ParticleStreams::ParticleStreams(const ParticleStreams& other)
+    {
+        Init(other.Capacity);
+    }
+
+    ParticleStreams::ParticleStreams(ParticleStreams&& other) noexcept
+    {
+        TakeStreams(*this, other);
+    }
+
+    ParticleStreams& ParticleStreams::operator=(const ParticleStreams& other)
+    {
+        if(this != &other)
+            Init(other.Capacity);
+        return *this;
+    }
+
+    ParticleStreams& ParticleStreams::operator=(ParticleStreams&& other) noexcept
+    {
+        if(this != &other)
+        {
+            Release();
+            TakeStreams(*this, other);
+        }
+        return *this;
+    }
+
+    ParticleStreams::~ParticleStreams()
+    {
+        Release();
+    }
+
+    void ParticleStreams::Init(uint32_t capacity)
+    {
+        Release();
+
+        // Rounded up so the last lane of the integration loop stays inside every stream
+        const uint32_t padded = (capacity + LaneCount - 1) / LaneCount * LaneCount;
+        m_Arena               = ArenaAlloc(Maths::Max(padded, 1u) * sizeof(float) * 9 + 1024);
+        Capacity              = capacity;
+        AliveCount            = 0;
+
+        PositionX = PushArray(m_Arena, float, padded);
+        PositionY = PushArray(m_Arena, float, padded);
+        PositionZ = PushArray(m_Arena, float, padded);
+        VelocityX = PushArray(m_Arena, float, padded);
+        VelocityY = PushArray(m_Arena, float, padded);
+        VelocityZ = PushArray(m_Arena, float, padded);
+        Alpha     = PushArray(m_Arena, float, padded);
+        Life      = PushArray(m_Arena, float, padded);
+        Size      = PushArray(m_Arena, float, padded);
+    }
+
+    void ParticleStreams::Release()
+    {
+        if(m_Arena)
+            ArenaRelease(m_Arena);
+
+        m_Arena    = nullptr;
+        AliveCount = 0;
+        Capacity   = 0;
+        PositionX = PositionY = PositionZ = nullptr;
+        VelocityX = VelocityY = VelocityZ = nullptr;
+        Alpha = Life = Size = nullptr;
+    }
+
+    void ParticleStreams::Remove(uint32_t index)
+    {
+        const uint32_t last = --AliveCount;
+        PositionX[index]    = PositionX[last];
+        PositionY[index]    = PositionY[last];
+        PositionZ[index]    = PositionZ[last];
+        VelocityX[index]    = VelocityX[last];
+        VelocityY[index]    = VelocityY[last];
+        VelocityZ[index]    = VelocityZ[last];
+        Alpha[index]        = Alpha[last];
+        Life[index]         = Life[last];
+        Size[index]         = Size[last];
+    }
+
+    GPUParticleState::GPUParticleState(const GPUParticleState& other)
+    {
+    }
+
+    GPUParticleState::GPUParticleState(GPUParticleState&& other) noexcept
+    {
+        *this = Move(other);
+    }
+
+    GPUParticleState& GPUParticleState::operator=(const GPUParticleState& other)
+    {
+        if(this != &other)
+            Release();
+        return *this;
+    }
+
+    GPUParticleState& GPUParticleState::operator=(GPUParticleState&& other) noexcept
+    {
+        if(this == &other)
+            return *this;
+
+        Release();
+        Particles     = other.Particles;
+        DeadList      = other.DeadList;
+        AliveLists    = other.AliveLists;
+        Counters      = other.Counters;
+        SimulateSet   = Move(other.SimulateSet);
+        DrawSet       = Move(other.DrawSet);
+        TextureSet    = Move(other.TextureSet);
+        Capacity      = other.Capacity;
+        SortCapacity  = other.SortCapacity;
+        CurrentList   = other.CurrentList;
+        Simulated     = other.Simulated;
+        PendingSpawns = other.PendingSpawns;
+        PendingTime   = other.PendingTime;
+
+        other.Particles = other.DeadList = other.AliveLists = other.Counters = nullptr;
+        other.Release();
+        return *this;
+    }
+
+    GPUParticleState::~GPUParticleState()
+    {
+        Release();
+    }
+
+    void GPUParticleState::Release()
+    {
+        // Buffers still in use by frames in flight are destroyed once those frames finish
+        delete Particles;
+        delete DeadList;
+        delete AliveLists;
+        delete Counters;
+
+        Particles = DeadList = AliveLists = Counters = nullptr;
+        SimulateSet   = nullptr;
+        DrawSet       = nullptr;
+        TextureSet    = nullptr;
+        Capacity      = 0;
+        SortCapacity  = 0;
+        CurrentList   = 0;
+        PendingSpawns = 0;
+        PendingTime   = 0.0f;
+    }
+
     ParticleEmitter::ParticleEmitter()
     {
         m_ParticleCount = 1024;
+        m_RandomState   = Random32::Rand(1u, UINT32_MAX);
         Init();
     }
 
     ParticleEmitter::ParticleEmitter(uint32_t amount)
     {
         m_ParticleCount = amount;
+        m_RandomState   = Random32::Rand(1u, UINT32_MAX);
         Init();
     }
 
@@ -22,85 +271,77 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
 
-        if(!m_Arena || !m_Particles || m_ParticleCount > m_Arena->Size / sizeof(Particle))
+        // The renderer spawns and simulates these, it only needs to know how many particles to launch
+        if(m_GPUSimulation && m_GPUState.Simulated)
         {
-            m_ParticleCount = 1024;
-            Init();
+            if(m_Particles.m_Arena)
+                m_Particles.Release();
+
+            m_GPUState.PendingTime += dt;
+            m_NextParticleTime -= dt;
+            if(m_NextParticleTime <= 0.0f)
+            {
+                m_GPUState.PendingSpawns = Maths::Min(m_GPUState.PendingSpawns + m_NumLaunchParticles, m_ParticleCount);
+                m_NextParticleTime += m_ParticleRate;
+            }
+            return;
         }
+
+        if(m_Particles.Capacity != m_ParticleCount || !m_Particles.m_Arena)
+            Init();
+
         m_NextParticleTime -= dt;
 
         if(m_NextParticleTime <= 0.0f)
         {
             for(uint32_t i = 0; i < m_NumLaunchParticles; i++)
-            {
-                int unusedParticle = FirstUnusedParticle();
-                RespawnParticle(m_Particles[unusedParticle], emitterPosition);
-            }
+                SpawnParticle(emitterPosition);
 
             m_NextParticleTime += m_ParticleRate;
         }
 
-        // update all particles
-        for(uint32_t i = 0; i < m_ParticleCount; i++)
-        {
-            Particle& p = m_Particles[i];
-            p.Life -= dt;
-            if(p.Life > 0.0f)
-            {
-                p.Velocity += m_Gravity * dt;
-                p.Position += p.Velocity * dt;
+        IntegrateParticles(m_Particles, m_Gravity, m_ParticleLife, m_FadeIn, m_FadeOut, dt);
 
-                if(m_FadeIn > 0.0f && p.Life > (m_ParticleLife - m_FadeIn))
-                    p.Colour.w = (m_ParticleLife - p.Life) / m_FadeIn;
-                else if(m_FadeOut > 0.0f && p.Life < m_FadeOut)
-                    p.Colour.w = 1.0f - ((m_FadeOut - p.Life) / m_FadeOut);
-            }
+        // Walking back means whatever Remove moves into a slot has already been checked
+        for(uint32_t i = m_Particles.AliveCount; i-- > 0;)
+        {
+            if(m_Particles.Life[i] <= 0.0f)
+                m_Particles.Remove(i);
         }
     }
 
     void ParticleEmitter::Init()
     {
-        if(m_Arena)
-            ArenaRelease(m_Arena);
-
-        m_Arena     = ArenaAlloc((m_ParticleCount + 10) * sizeof(Particle));
-        m_Particles = PushArray(m_Arena, Particle, m_ParticleCount);
+        m_Particles.Init(m_ParticleCount);
     }
 
-    void ParticleEmitter::RespawnParticle(Particle& particle, Vec3 emitterPosition)
+    float ParticleEmitter::RandomRange(float range)
     {
-        LUMOS_PROFILE_FUNCTION_LOW();
+        if(range <= Maths::M_EPSILON)
+            return 0.0f;
 
-        particle.Position = Vec3(m_Spread.x > Maths::M_EPSILON ? Random32::Rand(-m_Spread.x, m_Spread.x) : 0.0f, m_Spread.y > Maths::M_EPSILON ? Random32::Rand(-m_Spread.y, m_Spread.y) : 0.0f, m_Spread.z > Maths::M_EPSILON ? Random32::Rand(-m_Spread.z, m_Spread.z) : 0.0f) + emitterPosition;
-        particle.Colour   = m_InitialColour;
-        particle.Life     = m_ParticleLife + Random32::Rand(-m_LifeSpread, m_LifeSpread);
-        particle.Velocity = m_InitialVelocity + Vec3(m_VelocitySpread.x > Maths::M_EPSILON ? Random32::Rand(-m_VelocitySpread.x, m_VelocitySpread.x) : 0.0f, m_VelocitySpread.y > Maths::M_EPSILON ? Random32::Rand(-m_VelocitySpread.y, m_VelocitySpread.y) : 0.0f, m_VelocitySpread.z > Maths::M_EPSILON ? Random32::Rand(-m_VelocitySpread.z, m_VelocitySpread.z) : 0.0f);
-        particle.Size     = m_ParticleSize;
+        m_RandomState ^= m_RandomState << 13;
+        m_RandomState ^= m_RandomState >> 17;
+        m_RandomState ^= m_RandomState << 5;
+        return ((float)(m_RandomState >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f) * range;
     }
 
-    uint32_t lastUsedParticle = 0;
-    uint32_t ParticleEmitter::FirstUnusedParticle()
+    void ParticleEmitter::SpawnParticle(const Vec3& emitterPosition)
     {
-        LUMOS_PROFILE_FUNCTION_LOW();
-        for(uint32_t i = lastUsedParticle; i < m_ParticleCount; ++i)
-        {
-            if(m_Particles[i].Life <= 0.0f)
-            {
-                lastUsedParticle = i;
-                return i;
-            }
-        }
-
-        for(uint32_t i = 0; i < lastUsedParticle; ++i)
-        {
-            if(m_Particles[i].Life <= 0.0f)
-            {
-                lastUsedParticle = i;
-                return i;
-            }
-        }
-        lastUsedParticle = 0;
-        return 0;
+        // A full emitter drops new particles until some die
+        if(m_Particles.AliveCount >= m_Particles.Capacity)
+            return;
+
+        const uint32_t i         = m_Particles.AliveCount++;
+        m_Particles.PositionX[i] = emitterPosition.x + RandomRange(m_Spread.x);
+        m_Particles.PositionY[i] = emitterPosition.y + RandomRange(m_Spread.y);
+        m_Particles.PositionZ[i] = emitterPosition.z + RandomRange(m_Spread.z);
+        m_Particles.VelocityX[i] = m_InitialVelocity.x + RandomRange(m_VelocitySpread.x);
+        m_Particles.VelocityY[i] = m_InitialVelocity.y + RandomRange(m_VelocitySpread.y);
+        m_Particles.VelocityZ[i] = m_InitialVelocity.z + RandomRange(m_VelocitySpread.z);
+        m_Particles.Alpha[i]     = m_InitialColour.w;
+        m_Particles.Life[i]      = m_ParticleLife + RandomRange(m_LifeSpread);
+        m_Particles.Size[i]      = m_ParticleSize;
     }
 
     void ParticleEmitter::SetTextureFromFile(const std::string& filePath)
@@ -7,21 +7,80 @@
 
 namespace Lumos
 {
-    struct Particle
+    struct Arena;
+
+    namespace Graphics
     {
-        Vec3 Position, Velocity;
-        Vec4 Colour;
-        float Life;
-        float Size;
-
-        Particle()
-            : Position(0.0f)
-            , Velocity(0.0f)
-            , Colour(1.0f)
-            , Life(0.0f)
-            , Size(0.1f)
-        {
-        }
+        class StorageBuffer;
+        class DescriptorSet;
+    }
+
+    // One array per particle component. The first AliveCount particles are alive, a particle that dies is replaced by
+    // the last alive one so the range stays dense and new particles go straight after it. Copies start empty.
+    struct LUMOS_EXPORT ParticleStreams
+    {
+#ifdef LUMOS_SSE
+        static constexpr uint32_t LaneCount = 4; // Particles integrated together in one SIMD register
+#else
+        static constexpr uint32_t LaneCount = 1;
+#endif
+
+        ParticleStreams() = default;
+        ParticleStreams(const ParticleStreams& other);
+        ParticleStreams(ParticleStreams&& other) noexcept;
+        ParticleStreams& operator=(const ParticleStreams& other);
+        ParticleStreams& operator=(ParticleStreams&& other) noexcept;
+        ~ParticleStreams();
+
+        void Init(uint32_t capacity);
+        void Release();
+        void Remove(uint32_t index);
+
+        uint32_t AliveCount = 0;
+        uint32_t Capacity   = 0;
+
+        float* PositionX = nullptr;
+        float* PositionY = nullptr;
+        float* PositionZ = nullptr;
+        float* VelocityX = nullptr;
+        float* VelocityY = nullptr;
+        float* VelocityZ = nullptr;
+        float* Alpha     = nullptr; // The rest of the colour is the emitter's initial colour
+        float* Life      = nullptr;
+        float* Size      = nullptr;
+
+        Arena* m_Arena = nullptr;
+    };
+
+    // Buffers of an emitter simulated by the scene renderer's compute passes, see SceneRenderer::GPUParticlePass.
+    // Created the first frame the emitter is drawn on the GPU and again when its capacity changes. Copies start empty.
+    struct LUMOS_EXPORT GPUParticleState
+    {
+        GPUParticleState() = default;
+        GPUParticleState(const GPUParticleState& other);
+        GPUParticleState(GPUParticleState&& other) noexcept;
+        GPUParticleState& operator=(const GPUParticleState& other);
+        GPUParticleState& operator=(GPUParticleState&& other) noexcept;
+        ~GPUParticleState();
+
+        void Release();
+
+        Graphics::StorageBuffer* Particles  = nullptr;
+        Graphics::StorageBuffer* DeadList   = nullptr;
+        Graphics::StorageBuffer* AliveLists = nullptr; // Two lists of SortCapacity entries, swapped each frame
+        Graphics::StorageBuffer* Counters   = nullptr; // Indirect draw arguments then the list counts
+        SharedPtr<Graphics::DescriptorSet> SimulateSet;
+        SharedPtr<Graphics::DescriptorSet> DrawSet;
+        SharedPtr<Graphics::DescriptorSet> TextureSet;
+
+        uint32_t Capacity     = 0;
+        uint32_t SortCapacity = 0;
+        uint32_t CurrentList  = 0;
+
+        // Written by the renderer each frame. Simulated emitters only count the particles to spawn on the CPU
+        bool Simulated         = false;
+        uint32_t PendingSpawns = 0;
+        float PendingTime      = 0.0f;
     };
 
     class ParticleEmitter
@@ -53,7 +112,8 @@ namespace Lumos
         void Update(float dt, Vec3 emitterPosition = Vec3(0.0f));
         void SetTextureFromFile(const std::string& path);
 
-        Particle* GetParticles() { return m_Particles; }
+        const ParticleStreams& GetParticles() const { return m_Particles; }
+        GPUParticleState& GetGPUState() { return m_GPUState; }
 
         // Getter methods
         const SharedPtr<Graphics::Texture>& GetTexture() const { return m_Texture; }
@@ -77,6 +137,9 @@ namespace Lumos
         float GetLifeSpread() const { return m_LifeSpread; }
         AlignedType GetAlignedType() const { return m_AlignedType; }
         bool GetDepthWrite() const { return m_DepthWrite; }
+        bool GetGPUSimulation() const { return m_GPUSimulation; }
+        bool GetDepthCollision() const { return m_DepthCollision; }
+        float GetRestitution() const { return m_Restitution; }
 
         // Setter methods
         void SetTexture(const SharedPtr<Graphics::Texture>& texture) { m_Texture = texture; }
@@ -100,6 +163,9 @@ namespace Lumos
         void SetLifeSpread(const float& spread) { m_LifeSpread = spread; }
         void SetAlignedType(const AlignedType& aligned) { m_AlignedType = aligned; }
         void SetDepthWrite(bool DepthWrite) { m_DepthWrite = DepthWrite; }
+        void SetGPUSimulation(bool gpuSimulation) { m_GPUSimulation = gpuSimulation; }
+        void SetDepthCollision(bool depthCollision) { m_DepthCollision = depthCollision; }
+        void SetRestitution(float restitution) { m_Restitution = restitution; }
 
         static const std::array<Vec2, 4>& GetDefaultUVs();
         std::array<Vec2, 4> GetAnimatedUVs(float currentLife, int numRows);
@@ -107,10 +173,12 @@ namespace Lumos
 
     private:
         void Init();
-        uint32_t FirstUnusedParticle();
-        void RespawnParticle(Particle& particle, Vec3 emitterPosition = Vec3(0.0f));
+        void SpawnParticle(const Vec3& emitterPosition);
+        float RandomRange(float range);
 
-        Particle* m_Particles = nullptr;
+        ParticleStreams m_Particles;
+        GPUParticleState m_GPUState;
+        uint32_t m_RandomState = 0x9E3779B9u; // xorshift, per emitter so emitters can update on different threads
 
         SharedPtr<Graphics::Texture> m_Texture;
         uint32_t m_ParticleCount       = 1024;
@@ -131,10 +199,11 @@ namespace Lumos
         float m_LifeSpread             = 0.1f;
         bool m_SortParticles           = false;
         bool m_DepthWrite              = false;
+        bool m_GPUSimulation           = false; // Falls back to the CPU when the renderer can't simulate on the GPU
+        bool m_DepthCollision          = false; // Bounce off the depth buffer, GPU simulation only
+        float m_Restitution            = 0.5f;
         BlendType m_BlendType          = BlendType::Additive;
         AlignedType m_AlignedType      = AlignedType::Aligned3D;
-
-        Arena* m_Arena = nullptr;
     };
 
 }
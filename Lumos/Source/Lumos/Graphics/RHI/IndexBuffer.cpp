@@ -10,7 +10,7 @@ namespace Lumos
 
         IndexBuffer* IndexBuffer::Create(uint16_t* data, uint32_t count, BufferUsage bufferUsage)
         {
-            ASSERT(CreateFunc, "No IndexBuffer Create Function");
+            ASSERT(Create16Func, "No IndexBuffer Create Function");
 
             return Create16Func(data, count, bufferUsage);
         }
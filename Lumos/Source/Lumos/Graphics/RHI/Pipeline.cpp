@@ -6,7 +6,14 @@
 #include "Renderer.h"
 
 #include "Utilities/CombineHash.h"
+#include "Utilities/Timer.h"
 #include "Graphics/RHI/GraphicsContext.h"
+#include "Core/Application.h"
+#include "Core/Mutex.h"
+#include "Core/Asset/AssetManager.h"
+#include "Core/OS/FileSystem.h"
+
+#include <unordered_set>
 
 #ifdef LUMOS_RENDER_API_VULKAN
 #include "Platform/Vulkan/VKTexture.h"
@@ -26,9 +33,110 @@ namespace Lumos
             float timeSinceLastAccessed;
         };
         static std::unordered_map<uint64_t, PipelineAsset> m_PipelineCache;
-        static const float m_CacheLifeTime = 1.0f;
+        static uint32_t m_MaxUnusedPipelines = 128;
+        static float m_MaxUnusedTime         = 30.0f;
+        static PipelineCacheStats m_CacheStats;
+
+        struct PipelineManifestHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t RecordSize;
+            uint32_t Count;
+        };
+
+        static const uint32_t PIPELINE_MANIFEST_MAGIC   = 0x4D50504C; // LPPM
+        static const uint32_t PIPELINE_MANIFEST_VERSION = 1;
+        static const char* PIPELINE_MANIFEST_PATH       = "//Assets/Cache/PipelineManifest.bin";
+
+        static TDArray<PipelineRecord> m_Manifest;
+        static std::unordered_set<uint64_t> m_ManifestHashes;
+        static bool m_ManifestDirty = false;
+
+        // Pipelines can be requested from worker threads, the manifest is guarded by this
+        static Mutex* GetManifestMutex()
+        {
+            static Mutex* mutex = []()
+            {
+                Mutex* m = new Mutex();
+                MutexInit(m);
+                return m;
+            }();
+            return mutex;
+        }
+
+        Pipeline* (*Pipeline::CreateFunc)(const PipelineDesc&)                                      = nullptr;
+        uint32_t (*Pipeline::WarmUpFunc)(const PipelineRecord*, const SharedPtr<Shader>*, uint32_t) = nullptr;
+
+        static void RecordPipeline(const PipelineDesc& pipelineDesc)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            auto& assetManager = Application::Get().GetAssetManager();
+            if(!pipelineDesc.shader || !assetManager)
+                return;
+
+            // Only shaders registered by name can be found again on the next run
+            String8 shaderName;
+            if(!assetManager->GetAssetRegistry()->GetName(pipelineDesc.shader->Handle, shaderName) || shaderName.size >= sizeof(PipelineRecord::ShaderName))
+                return;
+
+            PipelineRecord record;
+            MemoryCopy(record.ShaderName, shaderName.str, shaderName.size);
+            record.cullMode            = pipelineDesc.cullMode;
+            record.polygonMode         = pipelineDesc.polygonMode;
+            record.drawType            = pipelineDesc.drawType;
+            record.blendMode           = pipelineDesc.blendMode;
+            record.transparencyEnabled = pipelineDesc.transparencyEnabled;
+            record.depthBiasEnabled    = pipelineDesc.depthBiasEnabled;
+            record.swapchainTarget     = pipelineDesc.swapchainTarget;
+            record.DepthTest           = pipelineDesc.DepthTest;
+            record.DepthWrite          = pipelineDesc.DepthWrite;
+            record.samples             = pipelineDesc.samples;
+            record.lineWidth           = pipelineDesc.lineWidth;
+
+            for(auto type : pipelineDesc.shader->GetShaderTypes())
+                record.compute |= type == ShaderType::COMPUTE;
+
+            uint32_t colourCount = 0;
+            if(pipelineDesc.swapchainTarget)
+                record.colourFormats[colourCount++] = Renderer::GetMainSwapChain()->GetCurrentImage()->GetFormat();
+            else
+            {
+                for(auto texture : pipelineDesc.colourTargets)
+                {
+                    if(texture)
+                        record.colourFormats[colourCount++] = texture->GetFormat();
+                }
+            }
+
+            if(pipelineDesc.depthTarget)
+                record.depthFormat = pipelineDesc.depthTarget->GetFormat();
+            else if(pipelineDesc.depthArrayTarget)
+            {
+                record.depthFormat = pipelineDesc.depthArrayTarget->GetFormat();
+                record.depthType   = TextureType::DEPTHARRAY;
+            }
+
+            if(pipelineDesc.cubeMapTarget)
+                record.cubeMapFormat = pipelineDesc.cubeMapTarget->GetFormat();
+            if(pipelineDesc.resolveTexture)
+                record.resolveFormat = pipelineDesc.resolveTexture->GetFormat();
 
-        Pipeline* (*Pipeline::CreateFunc)(const PipelineDesc&) = nullptr;
+            uint64_t hash = 0;
+            HashCombine(hash, std::string(record.ShaderName), (uint32_t)record.cullMode, (uint32_t)record.polygonMode, (uint32_t)record.drawType, (uint32_t)record.blendMode);
+            HashCombine(hash, record.transparencyEnabled, record.depthBiasEnabled, record.swapchainTarget, record.DepthTest, record.DepthWrite, record.compute, record.samples, record.lineWidth);
+            for(uint32_t i = 0; i < colourCount; i++)
+                HashCombine(hash, (uint8_t)record.colourFormats[i]);
+            HashCombine(hash, (uint8_t)record.depthFormat, (uint8_t)record.depthType, (uint8_t)record.cubeMapFormat, (uint8_t)record.resolveFormat);
+            record.Hash = hash;
+
+            ScopedMutex lock(GetManifestMutex());
+            if(m_ManifestHashes.insert(hash).second)
+            {
+                m_Manifest.PushBack(record);
+                m_ManifestDirty = true;
+            }
+        }
 
         Pipeline* Pipeline::Create(const PipelineDesc& pipelineDesc)
         {
@@ -103,6 +211,7 @@ namespace Lumos
 
             SharedPtr<Pipeline> pipeline = SharedPtr<Pipeline>(Create(pipelineDesc));
             m_PipelineCache[hash]        = { pipeline, (float)Engine::GetTimeStep().GetElapsedSeconds() };
+            RecordPipeline(pipelineDesc);
             return pipeline;
         }
 
@@ -115,26 +224,185 @@ namespace Lumos
         {
             LUMOS_PROFILE_FUNCTION();
 
-            static std::size_t keysToDelete[256];
-            std::size_t keysToDeleteCount = 0;
+            struct UnusedPipeline
+            {
+                float LastAccessed;
+                uint64_t Key;
+            };
+
+            static TDArray<UnusedPipeline> unused;
+            static TDArray<uint64_t> keysToDelete;
+            unused.Clear();
+            keysToDelete.Clear();
+
+            const float currentTime = (float)Engine::GetTimeStep().GetElapsedSeconds();
 
+            // Only the cache holds a reference to these
             for(auto&& [key, value] : m_PipelineCache)
             {
-                if(value.pipeline && value.pipeline.GetCounter()->GetReferenceCount() == 1 && (Engine::GetTimeStep().GetElapsedSeconds() - value.timeSinceLastAccessed) > m_CacheLifeTime)
+                if(!value.pipeline || value.pipeline.GetCounter()->GetReferenceCount() != 1)
+                    continue;
+
+                if(m_MaxUnusedTime > 0.0f && (currentTime - value.timeSinceLastAccessed) > m_MaxUnusedTime)
+                    keysToDelete.PushBack(key);
+                else
+                    unused.PushBack({ value.timeSinceLastAccessed, key });
+            }
+
+            // Over budget, release the least recently used
+            uint32_t unusedCount = uint32_t(unused.Size());
+            if(m_MaxUnusedPipelines > 0 && unusedCount > m_MaxUnusedPipelines)
+            {
+                const uint32_t excess = unusedCount - m_MaxUnusedPipelines;
+                std::nth_element(unused.Data(), unused.Data() + excess, unused.Data() + unusedCount, [](const UnusedPipeline& a, const UnusedPipeline& b)
+                                 { return a.LastAccessed < b.LastAccessed; });
+
+                for(uint32_t i = 0; i < excess; i++)
+                    keysToDelete.PushBack(unused[i].Key);
+                unusedCount = m_MaxUnusedPipelines;
+            }
+
+            for(uint64_t key : keysToDelete)
+                m_PipelineCache.erase(key);
+
+            m_CacheStats.CachedPipelines = uint32_t(m_PipelineCache.size());
+            m_CacheStats.UnusedPipelines = unusedCount;
+            m_CacheStats.EvictedPipelines += uint32_t(keysToDelete.Size());
+        }
+
+        void Pipeline::SetCacheLimits(uint32_t maxUnusedPipelines, float maxUnusedTime)
+        {
+            m_MaxUnusedPipelines = maxUnusedPipelines;
+            m_MaxUnusedTime      = maxUnusedTime;
+        }
+
+        void Pipeline::GetCacheLimits(uint32_t& maxUnusedPipelines, float& maxUnusedTime)
+        {
+            maxUnusedPipelines = m_MaxUnusedPipelines;
+            maxUnusedTime      = m_MaxUnusedTime;
+        }
+
+        const PipelineCacheStats& Pipeline::GetCacheStats()
+        {
+            ScopedMutex lock(GetManifestMutex());
+            m_CacheStats.ManifestRecords = uint32_t(m_Manifest.Size());
+            return m_CacheStats;
+        }
+
+        void Pipeline::LoadManifest()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            ScopedMutex lock(GetManifestMutex());
+            m_Manifest.Clear();
+            m_ManifestHashes.clear();
+            m_ManifestDirty = false;
+
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            String8 physicalPath;
+            if(!FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8C((char*)PIPELINE_MANIFEST_PATH), &physicalPath) || !FileSystem::FileExists(physicalPath))
+            {
+                ScratchEnd(scratch);
+                return;
+            }
+
+            const int64_t fileSize = FileSystem::GetFileSize(physicalPath);
+            uint8_t* data          = fileSize >= (int64_t)sizeof(PipelineManifestHeader) ? FileSystem::ReadFile(scratch.arena, physicalPath) : nullptr;
+            if(data)
+            {
+                const PipelineManifestHeader* header = (const PipelineManifestHeader*)data;
+                const bool valid                     = header->Magic == PIPELINE_MANIFEST_MAGIC && header->Version == PIPELINE_MANIFEST_VERSION && header->RecordSize == sizeof(PipelineRecord) && fileSize >= (int64_t)(sizeof(PipelineManifestHeader) + uint64_t(header->Count) * sizeof(PipelineRecord));
+
+                if(valid)
                 {
-                    keysToDelete[keysToDeleteCount] = key;
-                    keysToDeleteCount++;
+                    const PipelineRecord* records = (const PipelineRecord*)(data + sizeof(PipelineManifestHeader));
+                    for(uint32_t i = 0; i < header->Count; i++)
+                    {
+                        if(m_ManifestHashes.insert(records[i].Hash).second)
+                            m_Manifest.PushBack(records[i]);
+                    }
                 }
+                else
+                    LWARN("Ignoring out of date pipeline manifest %s", (const char*)physicalPath.str);
+            }
 
-                if(keysToDeleteCount >= 256)
-                    break;
+            ScratchEnd(scratch);
+        }
+
+        void Pipeline::SaveManifest()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            ScopedMutex lock(GetManifestMutex());
+            if(!m_ManifestDirty)
+                return;
+
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            String8 assetFolder, cacheFolder, physicalPath;
+
+            // Resolving fills in the path even when the file or folder doesn't exist yet
+            if(FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8Lit("//Assets"), &assetFolder, true))
+            {
+                FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8Lit("//Assets/Cache"), &cacheFolder, true);
+                FileSystem::Get().ResolvePhysicalPath(scratch.arena, Str8C((char*)PIPELINE_MANIFEST_PATH), &physicalPath);
+
+                const uint64_t size            = sizeof(PipelineManifestHeader) + m_Manifest.Size() * sizeof(PipelineRecord);
+                uint8_t* data                  = PushArrayNoZero(scratch.arena, uint8_t, size);
+                PipelineManifestHeader* header = (PipelineManifestHeader*)data;
+                header->Magic                  = PIPELINE_MANIFEST_MAGIC;
+                header->Version                = PIPELINE_MANIFEST_VERSION;
+                header->RecordSize             = sizeof(PipelineRecord);
+                header->Count                  = uint32_t(m_Manifest.Size());
+                if(!m_Manifest.Empty())
+                    MemoryCopy(data + sizeof(PipelineManifestHeader), m_Manifest.Data(), m_Manifest.Size() * sizeof(PipelineRecord));
+
+                FileSystem::CreateFolderIfDoesntExist(cacheFolder);
+                if(FileSystem::WriteFile(physicalPath, data, uint32_t(size)))
+                    m_ManifestDirty = false;
+            }
+            ScratchEnd(scratch);
+        }
+
+        void Pipeline::WarmUp()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            LoadManifest();
+
+            auto& assetManager = Application::Get().GetAssetManager();
+            if(!WarmUpFunc || !assetManager)
+                return;
+
+            // Copied out so the lock isn't held while WarmUpFunc creates pipelines, which record themselves
+            TDArray<PipelineRecord> manifest;
+            {
+                ScopedMutex lock(GetManifestMutex());
+                manifest = m_Manifest;
             }
 
-            for(std::size_t i = 0; i < keysToDeleteCount; i++)
+            if(manifest.Empty())
+                return;
+
+            TDArray<PipelineRecord> records;
+            TDArray<SharedPtr<Shader>> shaders;
+            records.Reserve(manifest.Size());
+            shaders.Reserve(manifest.Size());
+
+            for(const PipelineRecord& record : manifest)
             {
-                m_PipelineCache[keysToDelete[i]].pipeline = nullptr;
-                m_PipelineCache.erase(keysToDelete[i]);
+                SharedPtr<Asset> asset = assetManager->GetAssetData(Str8C((char*)record.ShaderName));
+                if(!asset || asset->GetAssetType() != AssetType::Shader)
+                    continue;
+
+                SharedPtr<Shader> shader = asset.As<Shader>();
+                if(!shader->IsCompiled())
+                    continue;
+
+                records.PushBack(record);
+                shaders.PushBack(shader);
             }
+
+            Timer timer;
+            m_CacheStats.WarmedPipelines = WarmUpFunc(records.Data(), shaders.Data(), uint32_t(records.Size()));
+            m_CacheStats.WarmUpTime      = timer.GetElapsedMS();
+            LINFO("Warmed up %u of %u pipelines in %.2fms", m_CacheStats.WarmedPipelines, uint32_t(manifest.Size()), m_CacheStats.WarmUpTime);
         }
 
         uint32_t Pipeline::GetWidth()
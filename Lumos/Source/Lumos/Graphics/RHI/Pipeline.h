@@ -40,6 +40,45 @@ namespace Lumos
             const char* DebugName = nullptr;
         };
 
+        // Render target independent part of a PipelineDesc. Written to the pipeline manifest the first time a
+        // pipeline is created so a later run can compile it again before it is needed.
+        struct PipelineRecord
+        {
+            uint64_t Hash       = 0;
+            char ShaderName[64] = {};
+
+            CullMode cullMode       = CullMode::BACK;
+            PolygonMode polygonMode = PolygonMode::FILL;
+            DrawType drawType       = DrawType::TRIANGLE;
+            BlendMode blendMode     = BlendMode::None;
+
+            bool transparencyEnabled = false;
+            bool depthBiasEnabled    = false;
+            bool swapchainTarget     = false;
+            bool DepthTest           = true;
+            bool DepthWrite          = true;
+            bool compute             = false;
+            uint8_t samples          = 1;
+
+            // Attachment formats in the order the render pass declares them, NONE when unused
+            RHIFormat colourFormats[MAX_RENDER_TARGETS] = {};
+            RHIFormat depthFormat                       = RHIFormat::NONE;
+            TextureType depthType                       = TextureType::DEPTH;
+            RHIFormat cubeMapFormat                     = RHIFormat::NONE;
+            RHIFormat resolveFormat                     = RHIFormat::NONE;
+            float lineWidth                             = 1.0f;
+        };
+
+        struct PipelineCacheStats
+        {
+            uint32_t CachedPipelines  = 0;
+            uint32_t UnusedPipelines  = 0;
+            uint32_t EvictedPipelines = 0;
+            uint32_t ManifestRecords  = 0;
+            uint32_t WarmedPipelines  = 0;
+            float WarmUpTime          = 0.0f;
+        };
+
         class LUMOS_EXPORT Pipeline
         {
             friend class CommandBuffer;
@@ -52,11 +91,34 @@ namespace Lumos
             static void ClearCache();
             static void DeleteUnusedCache();
 
+            // Pipelines nothing else references are kept for reuse. Any unused longer than maxUnusedTime seconds are
+            // released, and past maxUnusedPipelines the least recently used go first. 0 disables either limit.
+            static void SetCacheLimits(uint32_t maxUnusedPipelines, float maxUnusedTime);
+            static void GetCacheLimits(uint32_t& maxUnusedPipelines, float& maxUnusedTime);
+            static const PipelineCacheStats& GetCacheStats();
+
+            // Manifest of pipelines created by this project, kept in //Assets/Cache
+            static void LoadManifest();
+            static void SaveManifest();
+
+            // Compiles every pipeline in the manifest on worker threads so the driver cache holds them before first use
+            static void WarmUp();
+
             virtual ~Pipeline() = default;
 
             virtual void ClearRenderTargets(CommandBuffer* commandBuffer) { }
             virtual Shader* GetShader() const = 0;
 
+            // Pipelines returning the same pass and framebuffer for a layer can share one render pass instance
+            virtual RenderPass* GetRenderPass() const { return nullptr; }
+            virtual Framebuffer* GetFramebuffer(uint32_t layer = 0) const { return nullptr; }
+
+            // Begins this pipeline's render pass on a primary command buffer so that it can only execute secondaries
+            virtual void BeginSecondaryPass(CommandBuffer* primaryCommandBuffer, uint32_t layer = 0) { }
+
+            // Starts recording a secondary that continues this pipeline's render pass, with the viewport set to its target
+            virtual void BeginSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer = 0) { }
+
             uint32_t GetWidth();
             uint32_t GetHeight();
 
@@ -65,6 +127,7 @@ namespace Lumos
             virtual void End(CommandBuffer* commandBuffer) { }
 
             static Pipeline* (*CreateFunc)(const PipelineDesc&);
+            static uint32_t (*WarmUpFunc)(const PipelineRecord*, const SharedPtr<Shader>*, uint32_t);
             PipelineDesc m_Description;
         };
     }
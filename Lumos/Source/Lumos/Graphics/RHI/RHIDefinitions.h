@@ -26,6 +26,7 @@ namespace Lumos
 
         static constexpr uint8_t MAX_RENDER_TARGETS = 8;
         static constexpr uint8_t SHADOWMAP_MAX      = 4;
+        static constexpr uint8_t MESH_LOD_MAX       = 4;
         static constexpr uint8_t MAX_MIPS           = 32;
 
         // Descriptor set limits
@@ -170,6 +171,13 @@ namespace Lumos
             UNKNOWN
         };
 
+        // How a vertex shader's inputs are fed from vertex buffers
+        enum class VertexInputLayout : uint8_t
+        {
+            Interleaved,   // Every input in binding 0, packed in declaration order, e.g. Graphics::Vertex
+            CompactStreams // Input N reads binding N on its own, e.g. Graphics::CompactVertexPosition at 0
+        };
+
         enum class TextureType : uint8_t
         {
             COLOUR = 0,
@@ -485,5 +493,24 @@ namespace Lumos
         {
             TDArray<Descriptor> descriptors;
         };
+
+        // One indexed draw read by Renderer::DrawMeshIndirect, laid out like VkDrawIndexedIndirectCommand
+        struct DrawIndexedArguments
+        {
+            uint32_t IndexCount;
+            uint32_t InstanceCount;
+            uint32_t FirstIndex;
+            int32_t VertexOffset;
+            uint32_t FirstInstance;
+        };
+
+        // One non-indexed draw read by Renderer::DrawIndirect, laid out like VkDrawIndirectCommand
+        struct DrawArguments
+        {
+            uint32_t VertexCount;
+            uint32_t InstanceCount;
+            uint32_t FirstVertex;
+            uint32_t FirstInstance;
+        };
     }
 }
@@ -17,6 +17,9 @@
 #include "CompiledSPV/Headers/ForwardPBRAnimvertspv.hpp"
 #include "CompiledSPV/Headers/ForwardPBRvertspv.hpp"
 #include "CompiledSPV/Headers/ForwardPBRfragspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRClusteredfragspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRAnimPalettevertspv.hpp"
+#include "CompiledSPV/Headers/ShadowAnimPalettevertspv.hpp"
 
 #include "CompiledSPV/Headers/Skyboxvertspv.hpp"
 #include "CompiledSPV/Headers/Skyboxfragspv.hpp"
@@ -30,8 +33,26 @@
 #include "CompiledSPV/Headers/Batch2Dvertspv.hpp"
 #include "CompiledSPV/Headers/Batch2Dfragspv.hpp"
 
+#include "CompiledSPV/Headers/ForwardPBRInstancedvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowInstancedvertspv.hpp"
+
 #include "CompiledSPV/Headers/Particlevertspv.hpp"
 #include "CompiledSPV/Headers/Particlefragspv.hpp"
+#include "CompiledSPV/Headers/ParticleGPUvertspv.hpp"
+#include "CompiledSPV/Headers/ParticleGPUfragspv.hpp"
+#include "CompiledSPV/Headers/ParticleSimulatecompspv.hpp"
+
+#include "CompiledSPV/Headers/ForwardPBRCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRCompactInstancedvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowCompactAlphavertspv.hpp"
+#include "CompiledSPV/Headers/ShadowCompactInstancedvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowCompactInstancedAlphavertspv.hpp"
+#include "CompiledSPV/Headers/DepthPrePassCompactvertspv.hpp"
+#include "CompiledSPV/Headers/DepthPrePassCompactfragspv.hpp"
+
+#include "CompiledSPV/Headers/GPUCullcompspv.hpp"
+#include "CompiledSPV/Headers/DepthPyramidcompspv.hpp"
 
 #include "CompiledSPV/Headers/ScreenPassvertspv.hpp"
 #include "CompiledSPV/Headers/ScreenPassfragspv.hpp"
@@ -69,6 +90,16 @@ namespace Lumos
 #define LoadShaderEmbedded(name, vertName, fragName) shaderLibrary->AddAsset(name, SharedPtr<Graphics::Shader>(Graphics::Shader::CreateFromEmbeddedArray(spirv_##vertName##vertspv.data(), spirv_##vertName##vertspv_size, spirv_##fragName##fragspv.data(), spirv_##fragName##fragspv_size)), true);
 #define LoadComputeShaderEmbedded(name, compName) shaderLibrary->AddAsset(name, SharedPtr<Graphics::Shader>(Graphics::Shader::CreateCompFromEmbeddedArray(spirv_##compName##compspv.data(), spirv_##compName##compspv_size)), true);
 #define LoadShaderFromFile(name, path) shaderLibrary->AddAsset(name, SharedPtr<Graphics::Shader>(Graphics::Shader::CreateFromFile((engineShaderPath + path).c_str())), true);
+#define LoadCompactShaderEmbedded(name, vertName, fragName) shaderLibrary->AddAsset(name, SharedPtr<Graphics::Shader>(CompactStreams(Graphics::Shader::CreateFromEmbeddedArray(spirv_##vertName##vertspv.data(), spirv_##vertName##vertspv_size, spirv_##fragName##fragspv.data(), spirv_##fragName##fragspv_size))), true);
+#define LoadCompactShaderFromFile(name, path) shaderLibrary->AddAsset(name, SharedPtr<Graphics::Shader>(CompactStreams(Graphics::Shader::CreateFromFile((engineShaderPath + path).c_str()))), true);
+
+        // Compact vertex shaders read each quantised stream from its own binding, see Graphics::CompactVertexData
+        static Shader* CompactStreams(Shader* shader)
+        {
+            if(shader)
+                shader->SetVertexInputLayout(VertexInputLayout::CompactStreams);
+            return shader;
+        }
 
         Renderer* (*Renderer::CreateFunc)() = nullptr;
 
@@ -134,6 +165,55 @@ namespace Lumos
                     LoadComputeShaderEmbedded(Str8Lit("BloomComp"), Bloom);
                     LoadComputeShaderEmbedded(Str8Lit("FXAAComp"), FXAACompute);
                 }
+
+                if(Renderer::GetCapabilities().SupportInstancing)
+                {
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRInstanced"), ForwardPBRInstanced, ForwardPBR);
+                    LoadShaderEmbedded(Str8Lit("ShadowInstanced"), ShadowInstanced, Shadow);
+                    LoadShaderEmbedded(Str8Lit("ShadowInstancedAlpha"), ShadowInstanced, ShadowAlpha);
+                }
+
+                if(Renderer::GetCapabilities().SupportStorageBuffers)
+                {
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRClustered"), ForwardPBR, ForwardPBRClustered);
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRAnimClustered"), ForwardPBRAnim, ForwardPBRClustered);
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRInstancedClustered"), ForwardPBRInstanced, ForwardPBRClustered);
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRAnimPalette"), ForwardPBRAnimPalette, ForwardPBR);
+                    LoadShaderEmbedded(Str8Lit("ForwardPBRAnimPaletteClustered"), ForwardPBRAnimPalette, ForwardPBRClustered);
+                    LoadShaderEmbedded(Str8Lit("ShadowAnimPalette"), ShadowAnimPalette, Shadow);
+                    LoadShaderEmbedded(Str8Lit("ShadowAnimPaletteAlpha"), ShadowAnimPalette, ShadowAlpha);
+                    LoadShaderEmbedded(Str8Lit("DepthPrePassAnimPalette"), ForwardPBRAnimPalette, DepthPrePass);
+                    LoadShaderEmbedded(Str8Lit("DepthPrePassAlphaAnimPalette"), ForwardPBRAnimPalette, DepthPrePassAlpha);
+                }
+
+                if(Renderer::GetCapabilities().SupportCompactVertices)
+                {
+                    LoadCompactShaderEmbedded(Str8Lit("ForwardPBRCompact"), ForwardPBRCompact, ForwardPBR);
+                    LoadCompactShaderEmbedded(Str8Lit("ForwardPBRCompactClustered"), ForwardPBRCompact, ForwardPBRClustered);
+                    LoadCompactShaderEmbedded(Str8Lit("ForwardPBRCompactInstanced"), ForwardPBRCompactInstanced, ForwardPBR);
+                    LoadCompactShaderEmbedded(Str8Lit("ForwardPBRCompactInstancedClustered"), ForwardPBRCompactInstanced, ForwardPBRClustered);
+                    LoadCompactShaderEmbedded(Str8Lit("ShadowCompact"), ShadowCompact, Shadow);
+                    LoadCompactShaderEmbedded(Str8Lit("ShadowCompactAlpha"), ShadowCompactAlpha, ShadowAlpha);
+                    LoadCompactShaderEmbedded(Str8Lit("ShadowCompactInstanced"), ShadowCompactInstanced, Shadow);
+                    LoadCompactShaderEmbedded(Str8Lit("ShadowCompactInstancedAlpha"), ShadowCompactInstancedAlpha, ShadowAlpha);
+                    LoadCompactShaderEmbedded(Str8Lit("DepthPrePassCompact"), DepthPrePassCompact, DepthPrePassCompact);
+                    LoadCompactShaderEmbedded(Str8Lit("DepthPrePassCompactNormal"), ForwardPBRCompact, DepthPrePass);
+                    LoadCompactShaderEmbedded(Str8Lit("DepthPrePassCompactAlpha"), ForwardPBRCompact, DepthPrePassAlpha);
+                }
+
+                if(Renderer::GetCapabilities().SupportGPUCulling)
+                {
+                    LoadComputeShaderEmbedded(Str8Lit("GPUCull"), GPUCull);
+                    LoadComputeShaderEmbedded(Str8Lit("DepthPyramid"), DepthPyramid);
+                    LoadShaderEmbedded(Str8Lit("DepthPrePassInstanced"), ForwardPBRInstanced, DepthPrePass);
+                    LoadCompactShaderEmbedded(Str8Lit("DepthPrePassCompactInstanced"), ForwardPBRCompactInstanced, DepthPrePass);
+                }
+
+                if(Renderer::GetCapabilities().SupportGPUParticles)
+                {
+                    LoadComputeShaderEmbedded(Str8Lit("ParticleSimulate"), ParticleSimulate);
+                    LoadShaderEmbedded(Str8Lit("ParticleGPU"), ParticleGPU, ParticleGPU);
+                }
             }
             else
             {
@@ -176,6 +256,106 @@ namespace Lumos
                     LoadShaderFromFile(Str8Lit("FXAAComp"), "Shaders/FXAACompute.shader");
                     LoadShaderFromFile(Str8Lit("BloomComp"), "Shaders/BloomComp.shader");
                 }
+
+                if(Renderer::GetCapabilities().SupportInstancing)
+                {
+                    LoadShaderFromFile(Str8Lit("ForwardPBRInstanced"), "Shaders/ForwardPBRInstanced.shader");
+                    LoadShaderFromFile(Str8Lit("ShadowInstanced"), "Shaders/ShadowInstanced.shader");
+                    LoadShaderFromFile(Str8Lit("ShadowInstancedAlpha"), "Shaders/ShadowInstancedAlpha.shader");
+                }
+
+                if(Renderer::GetCapabilities().SupportStorageBuffers)
+                {
+                    LoadShaderFromFile(Str8Lit("ForwardPBRClustered"), "Shaders/ForwardPBRClustered.shader");
+                    LoadShaderFromFile(Str8Lit("ForwardPBRAnimClustered"), "Shaders/ForwardPBRAnimClustered.shader");
+                    LoadShaderFromFile(Str8Lit("ForwardPBRInstancedClustered"), "Shaders/ForwardPBRInstancedClustered.shader");
+                    LoadShaderFromFile(Str8Lit("ForwardPBRAnimPalette"), "Shaders/ForwardPBRAnimPalette.shader");
+                    LoadShaderFromFile(Str8Lit("ForwardPBRAnimPaletteClustered"), "Shaders/ForwardPBRAnimPaletteClustered.shader");
+                    LoadShaderFromFile(Str8Lit("ShadowAnimPalette"), "Shaders/ShadowAnimPalette.shader");
+                    LoadShaderFromFile(Str8Lit("ShadowAnimPaletteAlpha"), "Shaders/ShadowAnimPaletteAlpha.shader");
+                    LoadShaderFromFile(Str8Lit("DepthPrePassAnimPalette"), "Shaders/DepthPrePassAnimPalette.shader");
+                    LoadShaderFromFile(Str8Lit("DepthPrePassAlphaAnimPalette"), "Shaders/DepthPrePassAlphaAnimPalette.shader");
+                }
+
+                if(Renderer::GetCapabilities().SupportCompactVertices)
+                {
+                    LoadCompactShaderFromFile(Str8Lit("ForwardPBRCompact"), "Shaders/ForwardPBRCompact.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ForwardPBRCompactClustered"), "Shaders/ForwardPBRCompactClustered.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ForwardPBRCompactInstanced"), "Shaders/ForwardPBRCompactInstanced.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ForwardPBRCompactInstancedClustered"), "Shaders/ForwardPBRCompactInstancedClustered.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ShadowCompact"), "Shaders/ShadowCompact.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ShadowCompactAlpha"), "Shaders/ShadowCompactAlpha.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ShadowCompactInstanced"), "Shaders/ShadowCompactInstanced.shader");
+                    LoadCompactShaderFromFile(Str8Lit("ShadowCompactInstancedAlpha"), "Shaders/ShadowCompactInstancedAlpha.shader");
+                    LoadCompactShaderFromFile(Str8Lit("DepthPrePassCompact"), "Shaders/DepthPrePassCompact.shader");
+                    LoadCompactShaderFromFile(Str8Lit("DepthPrePassCompactNormal"), "Shaders/DepthPrePassCompactNormal.shader");
+                    LoadCompactShaderFromFile(Str8Lit("DepthPrePassCompactAlpha"), "Shaders/DepthPrePassCompactAlpha.shader");
+                }
+
+                if(Renderer::GetCapabilities().SupportGPUCulling)
+                {
+                    LoadShaderFromFile(Str8Lit("GPUCull"), "Shaders/GPUCull.shader");
+                    LoadShaderFromFile(Str8Lit("DepthPyramid"), "Shaders/DepthPyramid.shader");
+                    LoadShaderFromFile(Str8Lit("DepthPrePassInstanced"), "Shaders/DepthPrePassInstanced.shader");
+                    LoadCompactShaderFromFile(Str8Lit("DepthPrePassCompactInstanced"), "Shaders/DepthPrePassCompactInstanced.shader");
+                }
+
+                if(Renderer::GetCapabilities().SupportGPUParticles)
+                {
+                    LoadShaderFromFile(Str8Lit("ParticleSimulate"), "Shaders/ParticleSimulate.shader");
+                    LoadShaderFromFile(Str8Lit("ParticleGPU"), "Shaders/ParticleGPU.shader");
+                }
+            }
+
+            // Compact meshes can only be drawn with these, so meshes keep the full vertex layout unless all of them loaded
+            if(Renderer::GetCapabilities().SupportCompactVertices)
+            {
+                static const char* compactShaders[] = { "ForwardPBRCompact", "ForwardPBRCompactClustered", "ForwardPBRCompactInstanced", "ForwardPBRCompactInstancedClustered",
+                                                        "ShadowCompact", "ShadowCompactAlpha", "ShadowCompactInstanced", "ShadowCompactInstancedAlpha",
+                                                        "DepthPrePassCompact", "DepthPrePassCompactNormal", "DepthPrePassCompactAlpha" };
+                for(const char* name : compactShaders)
+                {
+                    SharedPtr<Graphics::Shader> shader = shaderLibrary->GetAssetData(Str8C((char*)name)).As<Graphics::Shader>();
+                    if(!shader || !shader->IsCompiled())
+                    {
+                        LWARN("Compact vertex shader %s unavailable, meshes use the full vertex layout", name);
+                        Renderer::GetCapabilities().SupportCompactVertices = false;
+                        break;
+                    }
+                }
+            }
+
+            // The scene renderer falls back to CPU culling for every mesh without these
+            if(Renderer::GetCapabilities().SupportGPUCulling)
+            {
+                static const char* gpuCullShaders[] = { "GPUCull", "DepthPyramid", "DepthPrePassInstanced", "DepthPrePassCompactInstanced" };
+                const uint32_t shaderCount          = Renderer::GetCapabilities().SupportCompactVertices ? 4 : 3;
+                for(uint32_t i = 0; i < shaderCount; i++)
+                {
+                    SharedPtr<Graphics::Shader> shader = shaderLibrary->GetAssetData(Str8C((char*)gpuCullShaders[i])).As<Graphics::Shader>();
+                    if(!shader || !shader->IsCompiled())
+                    {
+                        LWARN("GPU culling shader %s unavailable, meshes are culled on the CPU", gpuCullShaders[i]);
+                        Renderer::GetCapabilities().SupportGPUCulling = false;
+                        break;
+                    }
+                }
+            }
+
+            // Emitters set to GPU simulation stay on the CPU without these
+            if(Renderer::GetCapabilities().SupportGPUParticles)
+            {
+                static const char* gpuParticleShaders[] = { "ParticleSimulate", "ParticleGPU" };
+                for(const char* name : gpuParticleShaders)
+                {
+                    SharedPtr<Graphics::Shader> shader = shaderLibrary->GetAssetData(Str8C((char*)name)).As<Graphics::Shader>();
+                    if(!shader || !shader->IsCompiled())
+                    {
+                        LWARN("GPU particle shader %s unavailable, particles are simulated on the CPU", name);
+                        Renderer::GetCapabilities().SupportGPUParticles = false;
+                        break;
+                    }
+                }
             }
         }
 
@@ -188,17 +368,47 @@ namespace Lumos
             return Application::Get().GetWindow()->GetSwapChain();
         }
 
-        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh)
+        static void BindMeshVertexBuffers(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh)
         {
-            if(mesh->GetAnimVertexBuffer())
+            if(mesh->IsCompact())
+            {
+                // Position only shaders just ignore the other streams
+                mesh->GetPositionBuffer()->Bind(commandBuffer, pipeline, 0);
+                mesh->GetAttributeBuffer()->Bind(commandBuffer, pipeline, 1);
+                if(mesh->GetColourBuffer())
+                    mesh->GetColourBuffer()->Bind(commandBuffer, pipeline, 2);
+            }
+            else if(mesh->GetAnimVertexBuffer())
                 mesh->GetAnimVertexBuffer()->Bind(commandBuffer, pipeline);
             else
                 mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
+        }
+
+        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t lod)
+        {
+            BindMeshVertexBuffers(commandBuffer, pipeline, mesh);
             mesh->GetIndexBuffer()->Bind(commandBuffer);
 
-            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetIndexBuffer()->GetCount());
+            const MeshLOD& range = mesh->GetLOD(lod);
+            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, range.IndexCount, range.IndexOffset);
             // mesh->GetVertexBuffer()->Unbind();
             // mesh->GetIndexBuffer()->Unbind();
         }
+
+        void Renderer::DrawMeshInstanced(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t instanceCount, uint32_t lod)
+        {
+            BindMeshVertexBuffers(commandBuffer, pipeline, mesh);
+            mesh->GetIndexBuffer()->Bind(commandBuffer);
+
+            const MeshLOD& range = mesh->GetLOD(lod);
+            Renderer::DrawIndexedInstanced(commandBuffer, DrawType::TRIANGLE, range.IndexCount, instanceCount, range.IndexOffset);
+        }
+
+        void Renderer::DrawMeshIndirect(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, StorageBuffer* argumentBuffer, uint32_t offset)
+        {
+            BindMeshVertexBuffers(commandBuffer, pipeline, mesh);
+            mesh->GetIndexBuffer()->Bind(commandBuffer);
+            s_Instance->DrawIndexedIndirect(commandBuffer, argumentBuffer, offset);
+        }
     }
 }
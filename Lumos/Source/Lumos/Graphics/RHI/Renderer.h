@@ -17,12 +17,19 @@ namespace Lumos
             std::string Renderer;
             std::string Version;
 
-            int MaxSamples                   = 1;
-            float MaxAnisotropy              = 0.0f;
-            int MaxTextureUnits              = 0;
-            int UniformBufferOffsetAlignment = 0;
-            bool WideLines                   = false;
-            bool SupportCompute              = false;
+            int MaxSamples                      = 1;
+            float MaxAnisotropy                 = 0.0f;
+            int MaxTextureUnits                 = 0;
+            int UniformBufferOffsetAlignment    = 0;
+            int MaxBoundDescriptorSets          = 4;
+            bool WideLines                      = false;
+            bool SupportCompute                 = false;
+            bool SupportInstancing              = false; // Instanced draws reading per instance data from a storage buffer
+            bool SupportStorageBuffers          = false; // Storage buffers readable from fragment shaders
+            bool SupportCompactVertices         = false; // Quantised vertex streams, cleared when their shaders fail to load
+            bool SupportGPUCulling              = false; // Compute culling into indirect draws, cleared when its shaders fail to load
+            bool SupportGPUParticles            = false; // Compute simulated particle emitters, cleared when their shaders fail to load
+            bool SupportSecondaryCommandBuffers = false; // Draws recorded on job threads and executed from the frame's command buffer
         };
 
         class LUMOS_EXPORT Renderer
@@ -47,16 +54,28 @@ namespace Lumos
             virtual void PresentInternal(Graphics::CommandBuffer* commandBuffer)                                                                                                                                      = 0;
             virtual void BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount) = 0;
 
-            virtual const char* GetTitleInternal() const                                                                                    = 0;
-            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const             = 0;
-            virtual void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const = 0;
+            virtual const char* GetTitleInternal() const                                                                                                         = 0;
+            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const                                  = 0;
+            virtual void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const                      = 0;
+            virtual void DrawIndexedInstancedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start) const = 0;
             virtual void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) { }
+            virtual void DrawIndexedIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset) { }
+            // Vertex and instance counts come from a DrawArguments record at offset bytes into argumentBuffer
+            virtual void DrawIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset) { }
+            // Makes compute shader writes visible to later dispatches, indirect argument reads and vertex shaders
+            virtual void ComputeBarrier(CommandBuffer* commandBuffer) { }
+            // Waits for earlier vertex shaders before compute shaders overwrite buffers they read
+            virtual void VertexToComputeBarrier(CommandBuffer* commandBuffer) { }
             virtual void DrawSplashScreen(Texture* texture) { }
             virtual uint32_t GetGPUCount() const { return 1; }
             virtual bool SupportsCompute() { return false; }
             virtual void SaveScreenshot(const std::string& path, Graphics::Texture* texture = nullptr, bool Blur = false, float BlurRadius = 2.0f) { };
             virtual RHIFormat GetDepthFormat() { return RHIFormat::D32_Float; };
 
+            // Secondary command buffer for the current frame, taken from a pool owned by the calling job system thread.
+            // Safe to call from worker threads. The buffer is only valid until this frame's slot comes round again.
+            virtual CommandBuffer* AllocateSecondaryCommandBuffer() { return nullptr; }
+
             inline static void Present()
             {
                 s_Instance->PresentInternal();
@@ -77,6 +96,10 @@ namespace Lumos
             {
                 s_Instance->DrawIndexedInternal(commandBuffer, type, count, start);
             }
+            inline static void DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start = 0)
+            {
+                s_Instance->DrawIndexedInstancedInternal(commandBuffer, type, count, instanceCount, start);
+            }
             inline static const char* GetTitle()
             {
                 return s_Instance->GetTitleInternal();
@@ -90,7 +113,10 @@ namespace Lumos
 
             static GraphicsContext* GetGraphicsContext();
             static SwapChain* GetMainSwapChain();
-            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh);
+            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t lod = 0);
+            static void DrawMeshInstanced(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t instanceCount, uint32_t lod = 0);
+            // Index range and instance count come from a DrawIndexedArguments record at offset bytes into argumentBuffer
+            static void DrawMeshIndirect(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, StorageBuffer* argumentBuffer, uint32_t offset);
 
         protected:
             static Renderer* (*CreateFunc)();
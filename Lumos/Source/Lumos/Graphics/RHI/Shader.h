@@ -32,9 +32,21 @@ namespace Lumos
             virtual TDArray<PushConstant>& GetPushConstants() = 0;
             virtual PushConstant* GetPushConstant(uint32_t index) { return nullptr; }
             virtual void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) = 0;
+
+            // Pushes data in place of push constant index's shared buffer, so threads recording with the same shader don't race
+            virtual void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data)
+            {
+                auto& pushConstants = GetPushConstants();
+                memcpy(pushConstants[index].data, data, pushConstants[index].size);
+                BindPushConstants(commandBuffer, pipeline);
+            }
             virtual DescriptorSetInfo GetDescriptorInfo(uint32_t index) { return DescriptorSetInfo(); }
             virtual uint64_t GetHash() const { return 0; };
 
+            // Set once after loading, before any pipeline uses the shader. Shaders are interleaved by default
+            virtual void SetVertexInputLayout(VertexInputLayout layout) { }
+            virtual VertexInputLayout GetVertexInputLayout() const { return VertexInputLayout::Interleaved; }
+
             ShaderDataType SPIRVTypeToLumosDataType(const spirv_cross::SPIRType type);
 
             SET_ASSET_TYPE(AssetType::Shader);
@@ -5,12 +5,12 @@ namespace Lumos
 {
     namespace Graphics
     {
-        StorageBuffer* (*StorageBuffer::CreateFunc)(uint32_t, const void*) = nullptr;
+        StorageBuffer* (*StorageBuffer::CreateFunc)(uint32_t, const void*, BufferUsage) = nullptr;
 
-        StorageBuffer* StorageBuffer::Create(uint32_t size, const void* data)
+        StorageBuffer* StorageBuffer::Create(uint32_t size, const void* data, BufferUsage usage)
         {
             ASSERT(CreateFunc, "No StorageBuffer Create Function");
-            return CreateFunc(size, data);
+            return CreateFunc(size, data, usage);
         }
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "RHIDefinitions.h"
 
 namespace Lumos
 {
@@ -10,7 +11,9 @@ namespace Lumos
         {
         public:
             virtual ~StorageBuffer() = default;
-            static StorageBuffer* Create(uint32_t size, const void* data = nullptr);
+            // STATIC buffers live in device local memory and are only written by the GPU after creation,
+            // DYNAMIC ones stay mapped for the CPU to write or read back
+            static StorageBuffer* Create(uint32_t size, const void* data = nullptr, BufferUsage usage = BufferUsage::DYNAMIC);
 
             virtual void SetData(uint32_t size, const void* data)        = 0;
             virtual void Resize(uint32_t size, const void* data)         = 0;
@@ -27,7 +30,7 @@ namespace Lumos
         protected:
             virtual void* GetPointerInternal() = 0;
 
-            static StorageBuffer* (*CreateFunc)(uint32_t, const void*);
+            static StorageBuffer* (*CreateFunc)(uint32_t, const void*, BufferUsage);
         };
     }
 }
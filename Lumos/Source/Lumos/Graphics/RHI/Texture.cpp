@@ -2,6 +2,7 @@
 #include "Texture.h"
 
 #include "Utilities/LoadImage.h"
+#include "Graphics/ModelLoader/MeshCache.h"
 
 namespace Lumos
 {
@@ -141,14 +142,22 @@ namespace Lumos
         {
             ASSERT(CreateFromSourceFunc, "No Texture2D Create Function");
 
-            return CreateFromSourceFunc(width, height, data, parameters, loadOptions);
+            Texture2D* texture = CreateFromSourceFunc(width, height, data, parameters, loadOptions);
+            if(MeshCacheCapture* capture = MeshCacheCapture::GetActive())
+                capture->AddTexture(texture, data, width, height, parameters, loadOptions);
+
+            return texture;
         }
 
         Texture2D* Texture2D::CreateFromFile(const std::string& name, const std::string& filepath, TextureDesc parameters, TextureLoadOptions loadOptions)
         {
             ASSERT(CreateFromFileFunc, "No Texture2D Create Function");
 
-            return CreateFromFileFunc(name, filepath, parameters, loadOptions);
+            Texture2D* texture = CreateFromFileFunc(name, filepath, parameters, loadOptions);
+            if(MeshCacheCapture* capture = MeshCacheCapture::GetActive())
+                capture->AddTexture(texture, name, filepath, parameters, loadOptions);
+
+            return texture;
         }
 
         TextureCube* TextureCube::Create(uint32_t size, void* data, bool hdr)
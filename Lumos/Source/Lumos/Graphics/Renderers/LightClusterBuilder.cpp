@@ -0,0 +1,208 @@
+#include "Precompiled.h"
+#include "LightClusterBuilder.h"
+#include "Graphics/Light.h"
+#include "Core/JobSystem.h"
+#include "Maths/MathsUtilities.h"
+
+#include <cmath>
+
+static const uint32_t LIGHT_BOUNDS_BATCH_SIZE = 64; // Lights per bounds job
+
+namespace Lumos::Graphics
+{
+    float LightClusterBuilder::GetLightRange(const Light& light)
+    {
+        return light.Type == float(LightType::PointLight) ? light.Radius : light.Radius * 100.0f;
+    }
+
+    void LightClusterBuilder::Build(const Light* lights, uint32_t lightCount, const Mat4& view, const Mat4& proj, float nearPlane, float farPlane)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        m_Lights     = lights;
+        m_LightCount = lightCount;
+        m_View       = view;
+        m_Proj       = proj;
+        m_NearPlane  = nearPlane;
+        m_FarPlane   = farPlane;
+
+        const float logDepthRange = std::log(farPlane / nearPlane);
+        m_Params.GridSize[0]      = GridSizeX;
+        m_Params.GridSize[1]      = GridSizeY;
+        m_Params.GridSize[2]      = GridSizeZ;
+        m_Params.GridSize[3]      = 0;
+        m_Params.SliceScale       = float(GridSizeZ) / logDepthRange;
+        m_Params.SliceBias        = -float(GridSizeZ) * std::log(nearPlane) / logDepthRange;
+
+        m_Bounds.Resize(lightCount);
+        m_Slices.Resize(GridSizeZ);
+
+        {
+            LUMOS_PROFILE_SCOPE("Light Cluster Bounds");
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, System::JobSystem::DispatchGroupCount(lightCount, LIGHT_BOUNDS_BATCH_SIZE), 1, [this](JobDispatchArgs args)
+                                        {
+                const uint32_t first = args.jobIndex * LIGHT_BOUNDS_BATCH_SIZE;
+                const uint32_t last  = Maths::Min(first + LIGHT_BOUNDS_BATCH_SIZE, m_LightCount);
+                for(uint32_t i = first; i < last; i++)
+                    ComputeBounds(i); });
+            System::JobSystem::Wait(ctx);
+        }
+
+        {
+            LUMOS_PROFILE_SCOPE("Light Cluster Slices");
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, GridSizeZ, 1, [this](JobDispatchArgs args)
+                                        { BuildSlice(args.jobIndex); });
+            System::JobSystem::Wait(ctx);
+        }
+
+        // Pack the slices into one list, offsets become absolute
+        uint32_t totalIndices = 0;
+        for(const SliceLists& lists : m_Slices)
+            totalIndices += (uint32_t)lists.Indices.Size();
+
+        m_Clusters.Resize(ClusterCount);
+        m_LightIndices.Resize(totalIndices);
+        m_MaxLightsPerCluster = 0;
+
+        uint32_t base = 0;
+        for(uint32_t slice = 0; slice < GridSizeZ; slice++)
+        {
+            const SliceLists& lists = m_Slices[slice];
+            Cluster* clusters       = m_Clusters.Data() + slice * SliceSize;
+
+            for(uint32_t i = 0; i < SliceSize; i++)
+            {
+                clusters[i].Offset = lists.Clusters[i].Offset + base;
+                clusters[i].Count  = lists.Clusters[i].Count;
+            }
+
+            if(!lists.Indices.Empty())
+                MemoryCopy(m_LightIndices.Data() + base, lists.Indices.Data(), lists.Indices.Size() * sizeof(uint32_t));
+
+            base += (uint32_t)lists.Indices.Size();
+            m_MaxLightsPerCluster = Maths::Max(m_MaxLightsPerCluster, lists.MaxCount);
+        }
+
+        m_Lights = nullptr;
+    }
+
+    uint32_t LightClusterBuilder::DepthToSlice(float depth) const
+    {
+        if(depth <= m_NearPlane)
+            return 0;
+
+        const float slice = std::log(depth) * m_Params.SliceScale + m_Params.SliceBias;
+        return Maths::Min((uint32_t)Maths::Max(slice, 0.0f), GridSizeZ - 1);
+    }
+
+    static uint8_t NDCToTile(float ndc, uint32_t gridSize)
+    {
+        const float tile = (ndc * 0.5f + 0.5f) * float(gridSize);
+        return (uint8_t)Maths::Clamp(tile, 0.0f, float(gridSize - 1));
+    }
+
+    void LightClusterBuilder::ComputeBounds(uint32_t lightIndex)
+    {
+        const Light& light  = m_Lights[lightIndex];
+        LightBounds& bounds = m_Bounds[lightIndex];
+        const float range   = GetLightRange(light);
+        const Vec4 centre   = m_View * Vec4(light.Position.x, light.Position.y, light.Position.z, 1.0f);
+
+        // View space looks down -z
+        const float minDepth = -centre.z - range;
+        const float maxDepth = -centre.z + range;
+
+        bounds.MinZ = 1;
+        bounds.MaxZ = 0;
+
+        if(maxDepth < m_NearPlane || minDepth > m_FarPlane)
+            return;
+
+        // A sphere crossing the near plane can cover any tile
+        if(minDepth <= m_NearPlane)
+        {
+            bounds.MinX = 0;
+            bounds.MaxX = GridSizeX - 1;
+            bounds.MinY = 0;
+            bounds.MaxY = GridSizeY - 1;
+            bounds.MinZ = (uint8_t)DepthToSlice(minDepth);
+            bounds.MaxZ = (uint8_t)DepthToSlice(maxDepth);
+            return;
+        }
+
+        // Project the corners of the view space box around the sphere, all of them are in front of the camera
+        float minX = FLT_MAX, minY = FLT_MAX;
+        float maxX = -FLT_MAX, maxY = -FLT_MAX;
+        for(uint32_t corner = 0; corner < 8; corner++)
+        {
+            const Vec4 point = Vec4(centre.x + ((corner & 1) ? range : -range),
+                                    centre.y + ((corner & 2) ? range : -range),
+                                    centre.z + ((corner & 4) ? range : -range), 1.0f);
+            const Vec4 clip  = m_Proj * point;
+            const float x    = clip.x / clip.w;
+            const float y    = clip.y / clip.w;
+            minX             = Maths::Min(minX, x);
+            maxX             = Maths::Max(maxX, x);
+            minY             = Maths::Min(minY, y);
+            maxY             = Maths::Max(maxY, y);
+        }
+
+        if(maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f)
+            return;
+
+        bounds.MinX = NDCToTile(minX, GridSizeX);
+        bounds.MaxX = NDCToTile(maxX, GridSizeX);
+        bounds.MinY = NDCToTile(minY, GridSizeY);
+        bounds.MaxY = NDCToTile(maxY, GridSizeY);
+        bounds.MinZ = (uint8_t)DepthToSlice(minDepth);
+        bounds.MaxZ = (uint8_t)DepthToSlice(maxDepth);
+    }
+
+    void LightClusterBuilder::BuildSlice(uint32_t slice)
+    {
+        SliceLists& lists = m_Slices[slice];
+        MemoryZero(lists.Clusters, sizeof(lists.Clusters));
+
+        // Count, then offsets, then fill so each cluster's lights are contiguous and in light order
+        for(uint32_t i = 0; i < m_LightCount; i++)
+        {
+            const LightBounds& bounds = m_Bounds[i];
+            if(slice < bounds.MinZ || slice > bounds.MaxZ)
+                continue;
+
+            for(uint32_t y = bounds.MinY; y <= bounds.MaxY; y++)
+                for(uint32_t x = bounds.MinX; x <= bounds.MaxX; x++)
+                    lists.Clusters[y * GridSizeX + x].Count++;
+        }
+
+        uint32_t total = 0;
+        lists.MaxCount = 0;
+        for(Cluster& cluster : lists.Clusters)
+        {
+            cluster.Offset = total;
+            total += cluster.Count;
+            lists.MaxCount = Maths::Max(lists.MaxCount, cluster.Count);
+            cluster.Count  = 0;
+        }
+
+        lists.Indices.Resize(total);
+
+        for(uint32_t i = 0; i < m_LightCount; i++)
+        {
+            const LightBounds& bounds = m_Bounds[i];
+            if(slice < bounds.MinZ || slice > bounds.MaxZ)
+                continue;
+
+            for(uint32_t y = bounds.MinY; y <= bounds.MaxY; y++)
+            {
+                for(uint32_t x = bounds.MinX; x <= bounds.MaxX; x++)
+                {
+                    Cluster& cluster                                = lists.Clusters[y * GridSizeX + x];
+                    lists.Indices[cluster.Offset + cluster.Count++] = i;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Maths/Matrix4.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        struct Light;
+
+        // Buckets point and spot lights into a view space froxel grid for clustered forward shading.
+        // Tiles split the screen evenly, depth slices are spaced exponentially between the near and far planes.
+        class LUMOS_EXPORT LightClusterBuilder
+        {
+        public:
+            static constexpr uint32_t GridSizeX    = 16;
+            static constexpr uint32_t GridSizeY    = 9;
+            static constexpr uint32_t GridSizeZ    = 24;
+            static constexpr uint32_t SliceSize    = GridSizeX * GridSizeY;
+            static constexpr uint32_t ClusterCount = SliceSize * GridSizeZ;
+
+            // Range into the light index list, matches uvec2 in the shader
+            struct Cluster
+            {
+                uint32_t Offset;
+                uint32_t Count;
+            };
+
+            // Matches u_ClusterData in ForwardPBR.glslh
+            struct ClusterParams
+            {
+                uint32_t GridSize[4];
+                float SliceScale;
+                float SliceBias;
+                float Padding[2];
+            };
+
+            // Assigns every light to the clusters its sphere of influence overlaps. Bounds are computed per light
+            // and the per slice lists built in parallel, then packed into one index list in slice order.
+            void Build(const Light* lights, uint32_t lightCount, const Mat4& view, const Mat4& proj, float nearPlane, float farPlane);
+
+            // Distance after which a light adds nothing. Point lights fade out at their radius, spot lights use the
+            // same bound the renderer frustum culls them with.
+            static float GetLightRange(const Light& light);
+
+            const TDArray<Cluster>& GetClusters() const { return m_Clusters; }
+            const TDArray<uint32_t>& GetLightIndices() const { return m_LightIndices; }
+            const ClusterParams& GetParams() const { return m_Params; }
+            uint32_t GetMaxLightsPerCluster() const { return m_MaxLightsPerCluster; }
+
+        private:
+            // Inclusive cluster ranges, MinZ > MaxZ when the light is outside the depth range
+            struct LightBounds
+            {
+                uint8_t MinX, MaxX;
+                uint8_t MinY, MaxY;
+                uint8_t MinZ, MaxZ;
+            };
+
+            struct SliceLists
+            {
+                Cluster Clusters[SliceSize];
+                TDArray<uint32_t> Indices;
+                uint32_t MaxCount = 0;
+            };
+
+            uint32_t DepthToSlice(float depth) const;
+            void ComputeBounds(uint32_t lightIndex);
+            void BuildSlice(uint32_t slice);
+
+            // Inputs of the current Build, read by the jobs
+            const Light* m_Lights = nullptr;
+            uint32_t m_LightCount = 0;
+            Mat4 m_View;
+            Mat4 m_Proj;
+            float m_NearPlane = 0.1f;
+            float m_FarPlane  = 1000.0f;
+
+            TDArray<LightBounds> m_Bounds;
+            TDArray<SliceLists> m_Slices;
+            TDArray<Cluster> m_Clusters;
+            TDArray<uint32_t> m_LightIndices;
+            ClusterParams m_Params         = {};
+            uint32_t m_MaxLightsPerCluster = 0;
+        };
+    }
+}
@@ -12,13 +12,83 @@ namespace Lumos
 
         struct LUMOS_EXPORT RenderCommand
         {
-            Mesh* mesh         = nullptr;
-            Material* material = nullptr;
-            Pipeline* pipeline = nullptr;
+            Mesh* mesh                  = nullptr;
+            Material* material          = nullptr;
+            Pipeline* pipeline          = nullptr;
+            Pipeline* instancedPipeline = nullptr; // Same state reading transforms from the instance buffer, null if the command can't be instanced
             Mat4 transform;
             Mat4 textureMatrix;
+            uint8_t lod                          = 0; // Index range of the mesh to draw, see Mesh::GetLOD
             bool animated                        = false;
+            uint32_t boneOffset                  = 0; // First joint in the skinning palette buffer
             DescriptorSet* AnimatedDescriptorSet = nullptr;
+            uint64_t sortKey                     = 0;
         };
+
+        // Highest bits of a sort key. Lower buckets are drawn first.
+        enum class RenderBucket : uint8_t
+        {
+            Opaque      = 0, // Depth tested, front to back then grouped by state
+            Transparent = 1, // Depth tested and blended, back to front
+            Overlay     = 2  // Not depth tested, back to front after everything else
+        };
+
+        namespace RenderKey
+        {
+            // Folds a pointer down to the requested number of bits so commands sharing state get the same key bits
+            inline uint64_t HashPointer(const void* ptr, uint32_t bits)
+            {
+                uint64_t value = (uint64_t)(uintptr_t)ptr;
+                value ^= value >> 33;
+                value *= 0xff51afd7ed558ccdULL;
+                value ^= value >> 33;
+                return value & ((1ULL << bits) - 1);
+            }
+
+            // Maps a view distance to [0, (1 << bits) - 1] over [0, farPlane]
+            inline uint64_t QuantiseDepth(float distance, float farPlane, uint32_t bits)
+            {
+                const uint64_t maxValue = (1ULL << bits) - 1;
+                float normalised        = farPlane > 0.0f ? distance / farPlane : 0.0f;
+                if(!(normalised > 0.0f))
+                    return 0;
+                if(normalised >= 1.0f)
+                    return maxValue;
+                return (uint64_t)(normalised * (float)maxValue);
+            }
+
+            // [bucket:2][pipeline:12][material:16][mesh:14][lod:2][depth:18]
+            // State changes are minimised first, depth only breaks ties so nearby opaque geometry still goes first
+            inline uint64_t EncodeOpaque(const Pipeline* pipeline, const Material* material, const Mesh* mesh, uint32_t lod, float distance, float farPlane)
+            {
+                return ((uint64_t)RenderBucket::Opaque << 62)
+                    | (HashPointer(pipeline, 12) << 50)
+                    | (HashPointer(material, 16) << 34)
+                    | (HashPointer(mesh, 14) << 20)
+                    | ((uint64_t)(lod & 3) << 18)
+                    | QuantiseDepth(distance, farPlane, 18);
+            }
+
+            // [bucket:2][inverted depth:24][pipeline:12][material:13][mesh:11][lod:2]
+            // Blending needs back to front, so depth dominates and state only breaks ties
+            inline uint64_t EncodeBlended(RenderBucket bucket, const Pipeline* pipeline, const Material* material, const Mesh* mesh, uint32_t lod, float distance, float farPlane)
+            {
+                const uint64_t invertedDepth = ((1ULL << 24) - 1) - QuantiseDepth(distance, farPlane, 24);
+                return ((uint64_t)bucket << 62)
+                    | (invertedDepth << 38)
+                    | (HashPointer(pipeline, 12) << 26)
+                    | (HashPointer(material, 13) << 13)
+                    | (HashPointer(mesh, 11) << 2)
+                    | (lod & 3);
+            }
+
+            // Float bits remapped so unsigned integer order matches float order, negatives included
+            inline uint32_t SortableFloat(float value)
+            {
+                uint32_t bits;
+                MemoryCopy(&bits, &value, sizeof(float));
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+        }
     }
 }
@@ -1,6 +1,7 @@
 #include "Precompiled.h"
 #include "SceneRenderer.h"
 #include "Scene/Entity.h"
+#include "Scene/SceneGraph.h"
 #include "Scene/Component/ModelComponent.h"
 #include "Graphics/Model.h"
 #include "Graphics/Animation/Skeleton.h"
@@ -17,6 +18,7 @@
 #include "Graphics/RHI/VertexBuffer.h"
 #include "Graphics/RHI/IndexBuffer.h"
 #include "Graphics/RHI/Texture.h"
+#include "Graphics/RHI/StorageBuffer.h"
 #include "Graphics/Font.h"
 #include "Graphics/MSDFData.h"
 #include "Graphics/ParticleManager.h"
@@ -24,6 +26,8 @@
 #include "Core/JobSystem.h"
 #include "Core/OS/Window.h"
 #include "Core/Algorithms/Sort.h"
+#include "Core/DataStructures/Set.h"
+#include "Utilities/Timer.h"
 #include "Maths/BoundingSphere.h"
 #include "Maths/BoundingBox.h"
 #include "Maths/Rect.h"
@@ -57,6 +61,9 @@ static const uint32_t MAX_LINE_BATCH_DRAW_CALLS = 100;
 static const uint32_t RENDERER_LINE_SIZE        = sizeof(Lumos::Graphics::LineVertexData) * 4;
 static const uint32_t RENDERER_LINE_BUFFER_SIZE = RENDERER_LINE_SIZE * MaxLineVertices;
 static const uint32_t MAX_LIGHTS                = 32;
+static const uint32_t MESH_CULL_BATCH_SIZE      = 128; // Entities per visibility job
+static const uint32_t MAX_PUSH_CONSTANT_SIZE    = 128; // Smallest limit Vulkan guarantees, mesh push constants are built on the stack
+static const uint32_t MAX_BONES                 = 100; // Matches Buffers.glslh, identity joints at the start of the palette
 
 namespace Lumos::Graphics
 {
@@ -233,6 +240,123 @@ namespace Lumos::Graphics
         m_ForwardData.m_DescriptorSet[3]->SetUniformBufferData(0, boneTransforms);
         m_ForwardData.m_DescriptorSet[3]->Update();
 
+        // Instanced forward and shadow shaders read transforms from set 3, binding 1. Only loaded when the API supports it.
+        m_ForwardData.m_InstancedShader     = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRInstanced")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderInstanced      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowInstanced")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderInstancedAlpha = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowInstancedAlpha")).As<Graphics::Shader>();
+        m_InstancingSupported               = m_ForwardData.m_InstancedShader && m_ForwardData.m_InstancedShader->IsCompiled()
+            && m_ShadowData.m_ShaderInstanced && m_ShadowData.m_ShaderInstanced->IsCompiled()
+            && m_ShadowData.m_ShaderInstancedAlpha && m_ShadowData.m_ShaderInstancedAlpha->IsCompiled();
+
+        if(m_InstancingSupported)
+        {
+            descriptorDesc.layoutIndex            = 3;
+            descriptorDesc.shader                 = m_ForwardData.m_InstancedShader.get();
+            m_ForwardData.m_InstanceDescriptorSet = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            descriptorDesc.shader                 = m_ShadowData.m_ShaderInstanced.get();
+            m_ShadowData.m_InstanceDescriptorSet  = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_InstanceBuffers.Resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount(), nullptr);
+        }
+
+        // Clustered forward shaders read point and spot lights from set 4, so the device must bind five sets. The instanced variant is only needed with instancing.
+        m_ForwardData.m_ClusteredShader          = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRClustered")).As<Graphics::Shader>();
+        m_ForwardData.m_ClusteredAnimShader      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRAnimClustered")).As<Graphics::Shader>();
+        m_ForwardData.m_ClusteredInstancedShader = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRInstancedClustered")).As<Graphics::Shader>();
+        m_ClusteredLightingSupported             = Renderer::GetCapabilities().MaxBoundDescriptorSets > 4
+            && m_ForwardData.m_ClusteredShader && m_ForwardData.m_ClusteredShader->IsCompiled()
+            && m_ForwardData.m_ClusteredAnimShader && m_ForwardData.m_ClusteredAnimShader->IsCompiled()
+            && (!m_InstancingSupported || (m_ForwardData.m_ClusteredInstancedShader && m_ForwardData.m_ClusteredInstancedShader->IsCompiled()));
+
+        if(m_ClusteredLightingSupported)
+        {
+            descriptorDesc.layoutIndex           = 4;
+            descriptorDesc.shader                = m_ForwardData.m_ClusteredShader.get();
+            m_ForwardData.m_ClusterDescriptorSet = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_LightClusterBuffers.Resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
+        }
+
+        // Skinned meshes read their joints from one storage buffer holding the palettes of every animated instance
+        m_ForwardData.m_AnimPaletteShader          = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRAnimPalette")).As<Graphics::Shader>();
+        m_ForwardData.m_ClusteredAnimPaletteShader = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRAnimPaletteClustered")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderAnimPalette           = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowAnimPalette")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderAnimPaletteAlpha      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowAnimPaletteAlpha")).As<Graphics::Shader>();
+        m_DepthPrePassAnimPaletteShader            = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassAnimPalette")).As<Graphics::Shader>();
+        m_DepthPrePassAlphaAnimPaletteShader       = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassAlphaAnimPalette")).As<Graphics::Shader>();
+        m_SkinningPaletteSupported                 = m_ForwardData.m_AnimPaletteShader && m_ForwardData.m_AnimPaletteShader->IsCompiled()
+            && m_ShadowData.m_ShaderAnimPalette && m_ShadowData.m_ShaderAnimPalette->IsCompiled()
+            && m_ShadowData.m_ShaderAnimPaletteAlpha && m_ShadowData.m_ShaderAnimPaletteAlpha->IsCompiled()
+            && m_DepthPrePassAnimPaletteShader && m_DepthPrePassAnimPaletteShader->IsCompiled()
+            && m_DepthPrePassAlphaAnimPaletteShader && m_DepthPrePassAlphaAnimPaletteShader->IsCompiled()
+            && (!m_ClusteredLightingSupported || (m_ForwardData.m_ClusteredAnimPaletteShader && m_ForwardData.m_ClusteredAnimPaletteShader->IsCompiled()));
+
+        if(m_SkinningPaletteSupported)
+        {
+            descriptorDesc.layoutIndex           = 3;
+            descriptorDesc.shader                = m_ForwardData.m_AnimPaletteShader.get();
+            m_ForwardData.m_PaletteDescriptorSet = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            descriptorDesc.shader                = m_ShadowData.m_ShaderAnimPalette.get();
+            m_ShadowData.m_PaletteDescriptorSet  = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_PaletteBuffers.Resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount(), nullptr);
+        }
+
+        // Compact meshes, only created when the renderer loaded all of these. They share the layouts of the full vertex shaders.
+        m_ForwardData.m_CompactShader                   = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRCompact")).As<Graphics::Shader>();
+        m_ForwardData.m_CompactClusteredShader          = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRCompactClustered")).As<Graphics::Shader>();
+        m_ForwardData.m_CompactInstancedShader          = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRCompactInstanced")).As<Graphics::Shader>();
+        m_ForwardData.m_CompactInstancedClusteredShader = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ForwardPBRCompactInstancedClustered")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderCompact                    = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowCompact")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderCompactAlpha               = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowCompactAlpha")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderCompactInstanced           = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowCompactInstanced")).As<Graphics::Shader>();
+        m_ShadowData.m_ShaderCompactInstancedAlpha      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ShadowCompactInstancedAlpha")).As<Graphics::Shader>();
+        m_DepthPrePassCompactShader                     = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassCompact")).As<Graphics::Shader>();
+        m_DepthPrePassCompactNormalShader               = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassCompactNormal")).As<Graphics::Shader>();
+        m_DepthPrePassCompactAlphaShader                = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassCompactAlpha")).As<Graphics::Shader>();
+
+        m_ParallelRecordingSupported = Renderer::GetCapabilities().SupportSecondaryCommandBuffers;
+
+        // GPU culling draws through the instanced shaders, the renderer only loads its shaders when the device can use them
+        if(m_InstancingSupported && Renderer::GetCapabilities().SupportGPUCulling)
+        {
+            m_GPUCullShader                      = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("GPUCull")).As<Graphics::Shader>();
+            m_DepthPyramidShader                 = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPyramid")).As<Graphics::Shader>();
+            m_DepthPrePassInstancedShader        = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassInstanced")).As<Graphics::Shader>();
+            m_DepthPrePassCompactInstancedShader = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("DepthPrePassCompactInstanced")).As<Graphics::Shader>();
+            m_GPUCullingSupported                = m_GPUCullShader && m_GPUCullShader->IsCompiled()
+                && m_DepthPyramidShader && m_DepthPyramidShader->IsCompiled()
+                && m_DepthPrePassInstancedShader && m_DepthPrePassInstancedShader->IsCompiled();
+        }
+
+        if(m_GPUCullingSupported)
+        {
+            descriptorDesc.layoutIndex  = 0;
+            descriptorDesc.shader       = m_GPUCullShader.get();
+            m_GPUCullDescriptorSet      = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            descriptorDesc.layoutIndex  = 3;
+            descriptorDesc.shader       = m_ForwardData.m_InstancedShader.get();
+            m_GPUCullForwardInstanceSet = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            descriptorDesc.shader       = m_ShadowData.m_ShaderInstanced.get();
+            m_GPUCullShadowInstanceSet  = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_GPUCullBuffers.Resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
+
+            // Farthest depth under each texel, level 0 matches the depth buffer
+            Graphics::TextureDesc pyramidDesc;
+            pyramidDesc.format          = RHIFormat::R32_Float;
+            pyramidDesc.minFilter       = TextureFilter::NEAREST;
+            pyramidDesc.magFilter       = TextureFilter::NEAREST;
+            pyramidDesc.wrap            = TextureWrap::CLAMP_TO_EDGE;
+            pyramidDesc.generateMipMaps = false;
+            pyramidDesc.flags           = TextureFlags::Texture_Storage | TextureFlags::Texture_CreateMips | TextureFlags::Texture_MipViews;
+            m_DepthPyramid              = Graphics::Texture2D::Create(pyramidDesc, width, height);
+        }
+
+        if(Renderer::GetCapabilities().SupportGPUParticles)
+        {
+            m_GPUParticleSimulateShader = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ParticleSimulate")).As<Graphics::Shader>();
+            m_GPUParticleShader         = Application::Get().GetAssetManager()->GetAssetData(Str8Lit("ParticleGPU")).As<Graphics::Shader>();
+            m_GPUParticlesSupported     = m_GPUParticleSimulateShader && m_GPUParticleSimulateShader->IsCompiled()
+                && m_GPUParticleShader && m_GPUParticleShader->IsCompiled();
+        }
+
         m_ForwardData.m_DefaultMaterial  = new Material(m_ForwardData.m_Shader);
         uint32_t blackCubeTextureData[6] = { 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000 };
         m_DefaultTextureCube             = Graphics::TextureCube::Create(1, blackCubeTextureData);
@@ -564,6 +688,28 @@ namespace Lumos::Graphics
     {
         Memory::AlignedFree(m_ForwardData.m_TransformData);
 
+        for(auto buffer : m_InstanceBuffers)
+            delete buffer;
+
+        for(auto buffer : m_PaletteBuffers)
+            delete buffer;
+
+        for(auto& buffers : m_LightClusterBuffers)
+        {
+            delete buffers.Lights;
+            delete buffers.Clusters;
+            delete buffers.Indices;
+        }
+
+        for(auto& buffers : m_GPUCullBuffers)
+        {
+            delete buffers.Instances;
+            delete buffers.Views;
+            delete buffers.Arguments;
+            delete buffers.Transforms;
+        }
+        delete m_DepthPyramid;
+
         delete m_ForwardData.m_DepthTexture;
         delete m_MainTexture;
         delete m_ResolveTexture;
@@ -681,6 +827,12 @@ namespace Lumos::Graphics
         m_BloomTexture1->Resize(width, height);
         m_BloomTexture2->Resize(width, height);
         m_NormalTexture->Resize(width, height);
+
+        if(m_DepthPyramid)
+        {
+            m_DepthPyramid->Resize(width, height);
+            m_DepthPyramidDescriptorSets.Clear();
+        }
     }
 
     void SceneRenderer::EnableDebugRenderer(bool enable)
@@ -706,6 +858,36 @@ namespace Lumos::Graphics
         m_Stats.NumRenderedObjects = 0;
         m_Stats.NumShadowObjects   = 0;
         m_Stats.UpdatesPerSecond   = 0;
+        m_Stats.CullTime           = 0.0f;
+        m_Stats.CommandMergeTime   = 0.0f;
+        m_Stats.NumCullBatches     = 0;
+        m_Stats.NumMeshesTested    = 0;
+
+        m_Stats.NumMeshCommands       = 0;
+        m_Stats.NumMeshDrawCalls      = 0;
+        m_Stats.NumInstancedDrawCalls = 0;
+
+        MemoryZeroArray(m_Stats.LODTriangles);
+        MemoryZeroArray(m_Stats.ShadowLODTriangles);
+        m_Stats.FullDetailTriangles       = 0;
+        m_Stats.ShadowFullDetailTriangles = 0;
+
+        m_Stats.ClusterBuildTime    = 0.0f;
+        m_Stats.NumClusteredLights  = 0;
+        m_Stats.MaxLightsPerCluster = 0;
+
+        m_Stats.NumGPUCullInstances = 0;
+        m_Stats.NumGPUCullUploads   = 0;
+        m_Stats.NumGPUIndirectDraws = 0;
+
+        m_Stats.RecordTime                 = 0.0f;
+        m_Stats.NumSecondaryCommandBuffers = 0;
+
+        m_Stats.NumSkinnedInstances = 0;
+        m_Stats.NumPaletteJoints    = 0;
+
+        m_Stats.NumGPUParticleEmitters = 0;
+        m_Stats.NumGPUParticles        = 0;
 
         m_Renderer2DData.m_BatchDrawCallIndex        = 0;
         m_TextRendererData.m_BatchDrawCallIndex      = 0;
@@ -840,14 +1022,24 @@ namespace Lumos::Graphics
         static Light lights[MAX_LIGHTS];
         uint32_t numLights = 0;
 
-        m_ForwardData.m_Frustum = m_Camera->GetFrustum(view);
+        m_ClusteredLightingActive = m_ClusteredLightingSupported && m_ClusteredLightingEnabled;
+        m_ClusteredLights.Clear();
 
-        auto emitterGroup = registry.group<ParticleEmitter>(entt::get<Maths::Transform>);
-        for(auto& emitterEntity : emitterGroup)
-        {
-            const auto& [emitter, trans] = emitterGroup.get<ParticleEmitter, Maths::Transform>(emitterEntity);
-            emitter.Update((float)Engine::GetTimeStep().GetSeconds(), trans.GetWorldPosition());
-        }
+        // Occlusion needs the prepass depth, the pyramid is built from a single sampled depth buffer
+        m_GPUCullingActive = m_GPUCullingSupported && m_GPUCullingEnabled && m_InstancingEnabled && m_ForwardData.m_DepthTest;
+        m_GPUCullPrePass   = m_GPUCullingActive && renderSettings.DepthPrePass;
+        m_GPUCullOcclusion = m_GPUCullPrePass && m_GPUOcclusionEnabled && m_MainTextureSamples == 1;
+        m_GPUCullCommands.Clear();
+        m_GPUCullCascadeCount = 0;
+
+        m_ParallelRecordingActive = m_ParallelRecordingSupported && m_ParallelRecordingEnabled && System::JobSystem::GetThreadCount() > 0;
+
+        m_GPUParticlesActive = m_GPUParticlesSupported && m_GPUParticlesEnabled;
+
+        m_SkinningPaletteActive = m_SkinningPaletteSupported && m_SkinningPaletteEnabled;
+        m_SkinningPalette.Clear();
+
+        m_ForwardData.m_Frustum = m_Camera->GetFrustum(view);
 
         m_ForwardData.m_CommandQueue.Clear();
 
@@ -886,10 +1078,10 @@ namespace Lumos::Graphics
 
                 for(auto& lightEntity : group)
                 {
-                    if(!Entity(lightEntity, scene).Active())
+                    if(!SceneGraph::IsActive(registry, lightEntity))
                         continue;
 
-                    if(numLights >= MAX_LIGHTS)
+                    if(!m_ClusteredLightingActive && numLights >= MAX_LIGHTS)
                         break;
 
                     const auto& [light, trans] = group.get<Graphics::Light, Maths::Transform>(lightEntity);
@@ -908,21 +1100,43 @@ namespace Lumos::Graphics
 
                         if(inside == Maths::Intersection::OUTSIDE)
                             continue;
+
+                        if(m_ClusteredLightingActive)
+                        {
+                            Light& clusteredLight = m_ClusteredLights.EmplaceBack(light);
+                            clusteredLight.Intensity *= m_Exposure;
+                            continue;
+                        }
                     }
 
+                    if(numLights >= MAX_LIGHTS)
+                        continue;
+
                     lights[numLights] = light;
                     lights[numLights].Intensity *= m_Exposure;
                     numLights++;
                 }
             }
 
-            if(renderSettings.ShadowsEnabled && Application::Get().GetQualitySettings().EnableShadows)
+            if(m_ClusteredLightingActive)
             {
-                for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
-                {
-                    m_ShadowData.m_CascadeCommandQueue[i].Clear();
-                }
+                LUMOS_PROFILE_SCOPE("Build Light Clusters");
+                Timer clusterTimer;
+                m_LightClusters.Build(m_ClusteredLights.Data(), (uint32_t)m_ClusteredLights.Size(), view, proj, Maths::Max(m_Camera->GetNear(), 0.01f), m_Camera->GetFar());
+                m_Stats.ClusterBuildTime    = clusterTimer.GetElapsedMS();
+                m_Stats.NumClusteredLights  = (uint32_t)m_ClusteredLights.Size();
+                m_Stats.MaxLightsPerCluster = m_LightClusters.GetMaxLightsPerCluster();
+
+                UploadLightClusters();
+            }
+
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                m_ShadowData.m_CascadeCommandQueue[i].Clear();
+            }
 
+            if(renderSettings.ShadowsEnabled && Application::Get().GetQualitySettings().EnableShadows)
+            {
                 if(directionaLight)
                 {
                     UpdateCascades(scene, directionaLight);
@@ -1000,212 +1214,1078 @@ namespace Lumos::Graphics
             m_ForwardData.m_DescriptorSet[3]->SetUniformBufferData(0, boneTransforms);
             m_ForwardData.m_DescriptorSet[3]->Update();
 
-            auto group = registry.group<ModelComponent>(entt::get<Maths::Transform>);
-
-            Graphics::PipelineDesc pipelineDesc = {};
-            pipelineDesc.shader                 = m_ForwardData.m_Shader;
-            pipelineDesc.polygonMode            = Graphics::PolygonMode::FILL;
-            pipelineDesc.blendMode              = BlendMode::SrcAlphaOneMinusSrcAlpha;
-            pipelineDesc.clearTargets           = false;
-            pipelineDesc.swapchainTarget        = false;
+            UpdateStreamingPriorities(scene);
+            CullAndBuildMeshCommands(scene, directionaLight && renderSettings.ShadowsEnabled && Application::Get().GetQualitySettings().EnableShadows);
+        }
 
-            Graphics::PipelineDesc shadowPipelineDesc;
-            shadowPipelineDesc.cullMode                = Graphics::CullMode::FRONT;
-            shadowPipelineDesc.depthArrayTarget        = reinterpret_cast<Texture*>(m_ShadowData.m_ShadowTex);
-            shadowPipelineDesc.depthBiasEnabled        = false;
-            shadowPipelineDesc.depthBiasConstantFactor = 0.0f;
-            shadowPipelineDesc.depthBiasSlopeFactor    = 0.0f;
-            shadowPipelineDesc.DebugName               = "Shadow";
-            shadowPipelineDesc.clearTargets            = false;
+        m_Renderer2DData.m_CommandQueue2D.Clear();
 
-            for(auto entity : group)
+        if(renderSettings.Renderer2DEnabled)
+        {
+            auto spriteGroup = registry.group<Graphics::Sprite>(entt::get<Maths::Transform>);
+            for(auto entity : spriteGroup)
             {
-                if(!Entity(entity, scene).Active())
+                const auto& [sprite, trans] = spriteGroup.get<Graphics::Sprite, Maths::Transform>(entity);
+
+                auto bb = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetScale()));
+                bb.Transform(trans.GetWorldMatrix());
+                auto inside = m_ForwardData.m_Frustum.IsInside(bb);
+
+                if(!inside)
                     continue;
 
-                const auto& [model, trans] = group.get<ModelComponent, Maths::Transform>(entity);
+                RenderCommand2D command;
+                command.renderable = &sprite;
+                command.transform  = trans.GetWorldMatrix();
+                command.sortKey    = (uint64_t)RenderKey::SortableFloat(command.transform.Translation().z) << 32;
+                m_Renderer2DData.m_CommandQueue2D.PushBack(command);
+            };
+
+            auto animSpriteGroup = registry.group<Graphics::AnimatedSprite>(entt::get<Maths::Transform>);
+            for(auto entity : animSpriteGroup)
+            {
+                const auto& [sprite, trans] = animSpriteGroup.get<Graphics::AnimatedSprite, Maths::Transform>(entity);
+
+                auto bb = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetScale()));
+                bb.Transform(trans.GetWorldMatrix());
+                auto inside = m_ForwardData.m_Frustum.IsInside(bb);
 
-                if(!model.ModelRef)
+                if(!inside)
                     continue;
 
-                const auto& meshes = model.ModelRef->GetMeshes();
+                RenderCommand2D command;
+                command.renderable = &sprite;
+                command.transform  = trans.GetWorldMatrix();
+                command.sortKey    = (uint64_t)RenderKey::SortableFloat(command.transform.Translation().z) << 32;
+                m_Renderer2DData.m_CommandQueue2D.PushBack(command);
+            };
+        }
+
+        {
+            LUMOS_PROFILE_SCOPE("Sort Render Commands");
+            SortCommandQueue(m_ForwardData.m_CommandQueue, m_CommandQueueScratch);
+            SortCommandQueue(m_Renderer2DData.m_CommandQueue2D, m_CommandQueue2DScratch);
+
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                SortCommandQueue(m_ShadowData.m_CascadeCommandQueue[i], m_CommandQueueScratch);
+        }
+
+        {
+            LUMOS_PROFILE_SCOPE("Build Mesh Draw Batches");
+            m_InstanceTransforms.Clear();
+
+            BuildMeshDrawBatches(m_ForwardData.m_CommandQueue, m_ForwardDrawBatches);
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                BuildMeshDrawBatches(m_ShadowData.m_CascadeCommandQueue[i], m_ShadowDrawBatches[i]);
+
+            UploadInstanceTransforms();
+            UploadSkinningPalette();
+            BuildGPUCullBatches();
+        }
+    }
+
+    void SceneRenderer::BuildMeshDrawBatches(const CommandQueue& queue, TDArray<MeshDrawBatch>& batches)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        batches.Clear();
+
+        const bool instancing = m_InstancingSupported && m_InstancingEnabled;
+        const uint32_t count  = (uint32_t)queue.Size();
+
+        // Queues are sorted by state, so identical mesh/material/pipeline commands are already adjacent.
+        // Collapsing a run keeps its order, which keeps blended runs back to front.
+        uint32_t first = 0;
+        while(first < count)
+        {
+            const RenderCommand& command = queue[first];
+            uint32_t last                = first + 1;
+
+            if(instancing && command.instancedPipeline)
+            {
+                while(last < count && queue[last].mesh == command.mesh && queue[last].lod == command.lod && queue[last].material == command.material && queue[last].pipeline == command.pipeline)
+                    last++;
+            }
+
+            MeshDrawBatch& batch = batches.EmplaceBack();
+            batch.FirstCommand   = first;
+            batch.InstanceCount  = last - first;
+            batch.InstanceOffset = 0;
+
+            if(batch.InstanceCount > 1)
+            {
+                batch.InstanceOffset = (uint32_t)m_InstanceTransforms.Size();
+                for(uint32_t i = first; i < last; i++)
+                    m_InstanceTransforms.PushBack(queue[i].transform);
+
+                m_Stats.NumInstancedDrawCalls++;
+            }
+
+            first = last;
+        }
+
+        m_Stats.NumMeshCommands += count;
+        m_Stats.NumMeshDrawCalls += (uint32_t)batches.Size();
+    }
+
+    // Creates or grows the buffer with some headroom. Empty data still leaves a valid buffer to bind, null data
+    // only sizes it for the GPU to fill.
+    static void UploadStorageBuffer(StorageBuffer*& buffer, uint32_t dataSize, const void* data)
+    {
+        const uint32_t size = Maths::Max(dataSize + dataSize / 2, 64u);
+
+        if(!buffer)
+            buffer = StorageBuffer::Create(size);
+        else if(buffer->GetSize() < dataSize)
+            buffer->Resize(size, nullptr);
+
+        if(dataSize > 0 && data)
+            buffer->SetData(dataSize, data);
+    }
+
+    void SceneRenderer::UploadInstanceTransforms()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_InstanceTransforms.Empty())
+            return;
+
+        // Each frame in flight has its own buffer so the GPU can still be reading the previous frames' transforms
+        StorageBuffer*& buffer = m_InstanceBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()];
+        UploadStorageBuffer(buffer, (uint32_t)(m_InstanceTransforms.Size() * sizeof(Mat4)), m_InstanceTransforms.Data());
+
+        m_ForwardData.m_InstanceDescriptorSet->SetStorageBuffer(1, buffer);
+        m_ForwardData.m_InstanceDescriptorSet->Update();
+        m_ShadowData.m_InstanceDescriptorSet->SetStorageBuffer(1, buffer);
+        m_ShadowData.m_InstanceDescriptorSet->Update();
+    }
+
+    uint32_t SceneRenderer::AddSkinningPalette(AnimationInstance* animation)
+    {
+        if(m_SkinningPalette.Empty())
+            m_SkinningPalette.Resize(MAX_BONES, Mat4(1.0f));
+
+        if(!animation || animation->Palette.Empty())
+            return 0;
+
+        // Every mesh of a model shares its instance's palette, which is only copied the first time it's seen this frame
+        if(animation->PaletteFrame != m_SkinningPaletteFrame)
+        {
+            const uint32_t offset    = (uint32_t)m_SkinningPalette.Size();
+            const uint32_t count     = (uint32_t)animation->Palette.Size();
+            animation->PaletteFrame  = m_SkinningPaletteFrame;
+            animation->PaletteOffset = offset;
+
+            m_SkinningPalette.Resize(offset + count);
+            for(uint32_t i = 0; i < count; i++)
+                m_SkinningPalette[offset + i] = animation->Palette[i];
+            m_Stats.NumSkinnedInstances++;
+        }
+
+        return animation->PaletteOffset;
+    }
+
+    void SceneRenderer::UploadSkinningPalette()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(!m_SkinningPaletteActive || m_SkinningPalette.Empty())
+            return;
+
+        StorageBuffer*& buffer = m_PaletteBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()];
+        UploadStorageBuffer(buffer, (uint32_t)(m_SkinningPalette.Size() * sizeof(Mat4)), m_SkinningPalette.Data());
+        m_Stats.NumPaletteJoints = (uint32_t)m_SkinningPalette.Size();
+
+        m_ForwardData.m_PaletteDescriptorSet->SetStorageBuffer(1, buffer);
+        m_ForwardData.m_PaletteDescriptorSet->Update();
+        m_ShadowData.m_PaletteDescriptorSet->SetStorageBuffer(1, buffer);
+        m_ShadowData.m_PaletteDescriptorSet->Update();
+    }
+
+    void SceneRenderer::UploadLightClusters()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        const auto& clusters         = m_LightClusters.GetClusters();
+        const auto& lightIndices     = m_LightClusters.GetLightIndices();
+        LightClusterBuffers& buffers = m_LightClusterBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()];
+
+        UploadStorageBuffer(buffers.Lights, (uint32_t)(m_ClusteredLights.Size() * sizeof(Light)), m_ClusteredLights.Data());
+        UploadStorageBuffer(buffers.Clusters, (uint32_t)(clusters.Size() * sizeof(LightClusterBuilder::Cluster)), clusters.Data());
+        UploadStorageBuffer(buffers.Indices, (uint32_t)(lightIndices.Size() * sizeof(uint32_t)), lightIndices.Data());
+
+        LightClusterBuilder::ClusterParams params = m_LightClusters.GetParams();
+        m_ForwardData.m_ClusterDescriptorSet->SetUniformBufferData(0, &params);
+        m_ForwardData.m_ClusterDescriptorSet->SetStorageBuffer(1, buffers.Lights);
+        m_ForwardData.m_ClusterDescriptorSet->SetStorageBuffer(2, buffers.Clusters);
+        m_ForwardData.m_ClusterDescriptorSet->SetStorageBuffer(3, buffers.Indices);
+        m_ForwardData.m_ClusterDescriptorSet->Update();
+    }
+
+    template <typename T>
+    void SceneRenderer::SortCommandQueue(TDArray<T>& queue, TDArray<T>& scratchQueue)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const uint32_t count = (uint32_t)queue.Size();
+        if(count < 2)
+            return;
+
+        m_SortEntries.Resize(count);
+        m_SortEntriesScratch.Resize(count);
+        for(uint32_t i = 0; i < count; i++)
+        {
+            m_SortEntries[i].Key   = queue[i].sortKey;
+            m_SortEntries[i].Index = i;
+        }
+
+        // Sorting the small pairs and gathering once avoids moving whole commands on every radix pass
+        Algorithms::RadixSort(m_SortEntries.Data(), m_SortEntries.Data() + count, m_SortEntriesScratch.Data(),
+                              [](const SortEntry& entry)
+                              { return entry.Key; });
+
+        scratchQueue.Clear();
+        scratchQueue.Reserve(count);
+        for(uint32_t i = 0; i < count; i++)
+            scratchQueue.PushBack(queue[m_SortEntries[i].Index]);
+
+        Swap(queue, scratchQueue);
+    }
+
+    // Bits describing which forward/shadow pipeline a mesh needs. Resolved to pipelines once per frame in the merge.
+    enum MeshPipelineVariant : uint8_t
+    {
+        MeshPipelineVariant_Animated    = BIT(0),
+        MeshPipelineVariant_AlphaBlend  = BIT(1),
+        MeshPipelineVariant_Compact     = BIT(2),
+        MeshPipelineVariant_TwoSided    = BIT(3),
+        MeshPipelineVariant_DepthTest   = BIT(4),
+        MeshPipelineVariant_NoShadow    = BIT(5),
+        MeshPipelineVariant_GPUCulled   = BIT(6), // Static, opaque and depth tested, drawn from the GPU cull pass
+        MeshPipelineVariant_ForwardMask = MeshPipelineVariant_Animated | MeshPipelineVariant_AlphaBlend | MeshPipelineVariant_Compact | MeshPipelineVariant_TwoSided | MeshPipelineVariant_DepthTest,
+        MeshPipelineVariant_ShadowMask  = MeshPipelineVariant_Animated | MeshPipelineVariant_AlphaBlend | MeshPipelineVariant_Compact
+    };
+
+    // Compact shaders that sample textures take the mesh's UV scale and bias after their other push constants
+    static void SetTexCoordScaleBias(uint8_t* pushData, Pipeline* pipeline, uint32_t offset, const Mesh* mesh)
+    {
+        const uint32_t size = pipeline->GetShader()->GetPushConstants()[0].size;
+        ASSERT(size <= MAX_PUSH_CONSTANT_SIZE, "Push constants larger than the recording buffer");
+        if(mesh->IsCompact() && size >= offset + sizeof(Vec4))
+            memcpy(pushData + offset, &mesh->GetTexCoordScaleBias(), sizeof(Vec4));
+    }
+
+    static_assert(MESH_LOD_MAX <= 4, "Sort keys have two bits for the LOD");
+
+    // Coarsest LOD whose error covers at most errorPixels, given how many pixels a unit of model space error covers.
+    // LODs coarser than the current one have to fit under the hysteresis band below the threshold to be picked.
+    static uint32_t SelectMeshLOD(const Mesh* mesh, float pixelsPerUnit, uint32_t current, float errorPixels, float hysteresis)
+    {
+        for(uint32_t lod = mesh->GetLODCount() - 1; lod > 0; lod--)
+        {
+            const float limit = lod > current ? errorPixels * (1.0f - hysteresis) : errorPixels;
+            if(mesh->GetLOD(lod).Error * pixelsPerUnit <= limit)
+                return lod;
+        }
+        return 0;
+    }
+
+    void SceneRenderer::UpdateStreamingPriorities(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        AssetStreamer& streamer = Application::Get().GetAssetManager()->GetStreamer();
+        if(!streamer.HasWork())
+            return;
+
+        const Vec3 cameraPosition = m_CameraTransform->GetWorldPosition();
+        auto group                = scene->GetRegistry().group<ModelComponent>(entt::get<Maths::Transform>);
+        for(auto entity : group)
+        {
+            const auto& [model, trans] = group.get<ModelComponent, Maths::Transform>(entity);
+            if(model.ModelRef && model.ModelRef->IsFlagSet(AssetFlag::UnLoaded))
+                streamer.SetPriority(model.ModelRef->Handle, (trans.GetWorldPosition() - cameraPosition).LengthSquared());
+        }
+    }
 
-                for(auto mesh : meshes)
+    void SceneRenderer::CullAndBuildMeshCommands(Scene* scene, bool cullShadowCascades)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto& registry = scene->GetRegistry();
+        auto group     = registry.group<ModelComponent>(entt::get<Maths::Transform>);
+
+        // Frustum 0 is the camera, frustums 1..n are the shadow cascades
+        Maths::Frustum frustums[SHADOWMAP_MAX + 1];
+        frustums[0]                 = m_ForwardData.m_Frustum;
+        const uint32_t cascadeCount = cullShadowCascades ? m_ShadowData.m_ShadowMapNum : 0;
+        for(uint32_t i = 0; i < cascadeCount; i++)
+            frustums[i + 1] = m_ShadowData.m_CascadeFrustums[i];
+        const uint32_t frustumCount = cascadeCount + 1;
+        m_GPUCullCascadeCount       = m_GPUCullingActive ? cascadeCount : 0;
+
+        const uint32_t entityCount = (uint32_t)group.size();
+        const uint32_t batchCount  = System::JobSystem::DispatchGroupCount(entityCount, MESH_CULL_BATCH_SIZE);
+        if(m_MeshCullBatches.Size() < batchCount)
+            m_MeshCullBatches.Resize(batchCount);
+
+        const auto& inactiveEntities = registry.storage<InactiveComponent>();
+
+        // Grouped so the job below stays within Function's capture size. PixelsPerUnit is what a unit of world space
+        // error covers a unit in front of the camera, orthographic views don't divide by distance.
+        const QualitySettings& qualitySettings = Application::Get().GetQualitySettings();
+        const bool meshLODs                    = qualitySettings.EnableMeshLODs;
+        struct
+        {
+            bool Enabled;
+            float PixelsPerUnit;
+            float ErrorPixels;
+            float Hysteresis;
+            float Near;
+            Vec3 ViewPosition;
+            bool Orthographic;
+        } lodView;
+        lodView.Enabled       = meshLODs;
+        lodView.PixelsPerUnit = 0.5f * (float)m_MainTexture->GetHeight() * Maths::Abs(m_Camera->GetProjectionMatrix().Get(1, 1));
+        lodView.ErrorPixels   = qualitySettings.LODErrorPixels;
+        lodView.Hysteresis    = Maths::Clamp(qualitySettings.LODHysteresis, 0.0f, 0.9f);
+        lodView.Near          = m_Camera->GetNear();
+        lodView.ViewPosition  = m_CameraTransform->GetWorldPosition();
+        lodView.Orthographic  = m_Camera->IsOrthographic();
+
+        Timer cullTimer;
+        {
+            LUMOS_PROFILE_SCOPE("Cull Meshes");
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, batchCount, 1, [&](JobDispatchArgs args)
+                                        {
+                LUMOS_PROFILE_SCOPE("Cull Mesh Batch");
+                MeshCullBatch& batch = m_MeshCullBatches[args.jobIndex];
+                batch.CentreX.Clear();
+                batch.CentreY.Clear();
+                batch.CentreZ.Clear();
+                batch.ExtentX.Clear();
+                batch.ExtentY.Clear();
+                batch.ExtentZ.Clear();
+                batch.Meshes.Clear();
+                batch.Transforms.Clear();
+                batch.Animations.Clear();
+                batch.LODStates.Clear();
+                batch.Variants.Clear();
+                batch.GPUCulledMeshes.Clear();
+                batch.GPUCulledTransforms.Clear();
+                batch.GPUCulledLODStates.Clear();
+                batch.GPUCulledVariants.Clear();
+                batch.Commands.Clear();
+                batch.CommandMasks.Clear();
+                batch.CommandAnimations.Clear();
+                batch.CommandVariants.Clear();
+                batch.CommandSources.Clear();
+
+                const uint32_t first = args.jobIndex * MESH_CULL_BATCH_SIZE;
+                const uint32_t last  = Maths::Min(first + MESH_CULL_BATCH_SIZE, entityCount);
+
+                auto pushMesh = [&batch](Mesh* mesh, const Mat4& worldTransform, AnimationInstance* animation, uint8_t* lodState, uint8_t variant)
                 {
-                    auto& worldTransform = trans.GetWorldMatrix();
-                    auto bbCopy          = mesh->GetBoundingBox().Transformed(worldTransform);
+                    const Maths::BoundingBox& localBox = mesh->GetBoundingBox();
+                    const Vec3 localCentre             = localBox.Center();
+                    const Vec3 localExtent             = localBox.Size() * 0.5f;
 
-                    if(directionaLight)
+                    float centre[3], extent[3];
+                    for(uint32_t row = 0; row < 3; row++)
                     {
-                        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                        centre[row] = worldTransform.Get(row, 3);
+                        extent[row] = 0.0f;
+                        for(uint32_t col = 0; col < 3; col++)
                         {
-                            auto inside = m_ShadowData.m_CascadeFrustums[i].IsInside(bbCopy);
+                            centre[row] += worldTransform.Get(row, col) * localCentre[col];
+                            extent[row] += Maths::Abs(worldTransform.Get(row, col)) * localExtent[col];
+                        }
+                    }
 
-                            if(!inside)
-                                continue;
+                    batch.CentreX.PushBack(centre[0]);
+                    batch.CentreY.PushBack(centre[1]);
+                    batch.CentreZ.PushBack(centre[2]);
+                    batch.ExtentX.PushBack(extent[0]);
+                    batch.ExtentY.PushBack(extent[1]);
+                    batch.ExtentZ.PushBack(extent[2]);
+                    batch.Meshes.PushBack(mesh);
+                    batch.Transforms.PushBack(&worldTransform);
+                    batch.Animations.PushBack(animation);
+                    batch.LODStates.PushBack(lodState);
+                    batch.Variants.PushBack(variant);
+                };
+
+                // Gather world space boxes into packed centre/extent streams
+                for(uint32_t entityIndex = first; entityIndex < last; entityIndex++)
+                {
+                    entt::entity entity = group[entityIndex];
+                    if(inactiveEntities.contains(entity))
+                        continue;
 
-                            RenderCommand command;
-                            command.mesh      = mesh.get();
-                            command.transform = worldTransform;
-                            command.material  = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
+                    auto [model, trans] = group.get<ModelComponent, Maths::Transform>(entity);
+                    if(!model.ModelRef)
+                        continue;
 
-                            if(command.material->GetFlag(Material::RenderFlags::NOSHADOW))
-                                continue;
+                    const Mat4& worldTransform = trans.GetWorldMatrix();
 
-                            Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-                            bool alphaBlend    = material->GetFlag(Material::RenderFlags::ALPHABLEND);
+                    const auto& meshes = model.ModelRef->GetMeshes();
+                    if(model.MeshLODs.Size() != meshes.Size())
+                        model.MeshLODs.Resize(meshes.Size(), 0);
+                    uint8_t* lodState = model.MeshLODs.Data();
 
-                            shadowPipelineDesc.transparencyEnabled = alphaBlend;
-                            shadowPipelineDesc.shader              = alphaBlend ? m_ShadowData.m_ShaderAlpha : m_ShadowData.m_Shader;
+                    for(const auto& mesh : meshes)
+                    {
+                        const Material* material = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
 
-                            // Bind here in case not bound in the loop below as meshes will be inside
-                            // cascade frustum and not the cameras
-                            command.material->Bind();
+                        uint8_t variant = 0;
+                        if(mesh->GetAnimVertexBuffer())
+                            variant |= MeshPipelineVariant_Animated;
+                        if(mesh->IsCompact())
+                            variant |= MeshPipelineVariant_Compact;
+                        if(material->GetFlag(Material::RenderFlags::ALPHABLEND))
+                            variant |= MeshPipelineVariant_AlphaBlend;
+                        if(material->GetFlag(Material::RenderFlags::TWOSIDED))
+                            variant |= MeshPipelineVariant_TwoSided;
+                        if(m_ForwardData.m_DepthTest && material->GetFlag(Material::RenderFlags::DEPTHTEST))
+                            variant |= MeshPipelineVariant_DepthTest;
+                        if(material->GetFlag(Material::RenderFlags::NOSHADOW))
+                            variant |= MeshPipelineVariant_NoShadow;
+
+                        if(m_GPUCullingActive && (variant & (MeshPipelineVariant_Animated | MeshPipelineVariant_AlphaBlend | MeshPipelineVariant_DepthTest)) == MeshPipelineVariant_DepthTest)
+                        {
+                            batch.GPUCulledMeshes.PushBack(mesh.get());
+                            batch.GPUCulledTransforms.PushBack(&worldTransform);
+                            batch.GPUCulledLODStates.PushBack(lodState++);
+                            batch.GPUCulledVariants.PushBack(variant | MeshPipelineVariant_GPUCulled);
+                            continue;
+                        }
 
-                            if(mesh->GetAnimVertexBuffer())
-                            {
-                                shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAnimAlpha : m_ShadowData.m_ShaderAnim;
+                        pushMesh(mesh.get(), worldTransform, model.Animation.get(), lodState++, variant);
+                    }
+                }
 
-                                command.animated              = true;
-                                command.AnimatedDescriptorSet = model.ModelRef->GetAnimationController() ? model.ModelRef->GetAnimationController()->GetDescriptorSet() : m_ForwardData.m_DescriptorSet[3];
-                            }
-                            command.pipeline = Graphics::Pipeline::Get(shadowPipelineDesc);
+                // The compute pass tests GPU culled meshes for every view, they only need their bounds here
+                const uint32_t testedCount = (uint32_t)batch.Meshes.Size();
+                for(uint32_t i = 0; i < batch.GPUCulledMeshes.Size(); i++)
+                    pushMesh(batch.GPUCulledMeshes[i], *batch.GPUCulledTransforms[i], nullptr, batch.GPUCulledLODStates[i], batch.GPUCulledVariants[i]);
+
+                const uint32_t meshCount = (uint32_t)batch.Meshes.Size();
+                batch.VisibilityMasks.Resize(meshCount);
+                for(uint32_t i = testedCount; i < meshCount; i++)
+                    batch.VisibilityMasks[i] = (1u << frustumCount) - 1;
+
+                Maths::PackedBoundingBoxes boxes;
+                boxes.CentreX = batch.CentreX.Data();
+                boxes.CentreY = batch.CentreY.Data();
+                boxes.CentreZ = batch.CentreZ.Data();
+                boxes.ExtentX = batch.ExtentX.Data();
+                boxes.ExtentY = batch.ExtentY.Data();
+                boxes.ExtentZ = batch.ExtentZ.Data();
+                boxes.Count   = testedCount;
+                Maths::Frustum::CullPacked(frustums, frustumCount, boxes, batch.VisibilityMasks.Data());
+
+                // Build commands for anything visible in the camera or a cascade
+                for(uint32_t i = 0; i < meshCount; i++)
+                {
+                    const uint8_t variant = batch.Variants[i];
+                    uint32_t mask         = batch.VisibilityMasks[i];
+                    if(variant & MeshPipelineVariant_NoShadow)
+                        mask &= 1u;
+                    if(mask == 0)
+                        continue;
+
+                    Mesh* mesh         = batch.Meshes[i];
+                    Material* material = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
+
+                    RenderCommand& command = batch.Commands.EmplaceBack();
+                    command.mesh           = mesh;
+                    command.material       = material;
+                    command.transform      = *batch.Transforms[i];
+                    command.animated       = (variant & MeshPipelineVariant_Animated) != 0;
+
+                    // Error scales with the largest axis of the transform and falls off with distance to the bounds
+                    uint32_t lod = 0;
+                    if(lodView.Enabled && mesh->GetLODCount() > 1)
+                    {
+                        const Mat4& world = *batch.Transforms[i];
+                        float scale       = 0.0f;
+                        for(uint32_t col = 0; col < 3; col++)
+                            scale = Maths::Max(scale, Vec3(world.Get(0, col), world.Get(1, col), world.Get(2, col)).LengthSquared());
 
-                            m_ShadowData.m_CascadeCommandQueue[i].PushBack(command);
+                        float pixelsPerUnit = lodView.PixelsPerUnit * Maths::Sqrt(scale);
+                        if(!lodView.Orthographic)
+                        {
+                            const Vec3 centre(batch.CentreX[i], batch.CentreY[i], batch.CentreZ[i]);
+                            const float radius = Vec3(batch.ExtentX[i], batch.ExtentY[i], batch.ExtentZ[i]).Length();
+                            pixelsPerUnit /= Maths::Max(Maths::Distance(lodView.ViewPosition, centre) - radius, lodView.Near);
                         }
+
+                        lod = SelectMeshLOD(mesh, pixelsPerUnit, *batch.LODStates[i], lodView.ErrorPixels, lodView.Hysteresis);
                     }
+                    *batch.LODStates[i] = (uint8_t)lod;
+                    command.lod         = (uint8_t)lod;
+
+                    // Compact positions are quantised to the mesh bounds, every pass and the instance buffer take them back through this
+                    if(variant & MeshPipelineVariant_Compact)
+                        command.transform = command.transform * mesh->GetPositionDequantise();
+
+                    batch.CommandMasks.PushBack(mask);
+                    batch.CommandAnimations.PushBack(batch.Animations[i]);
+                    batch.CommandVariants.PushBack(variant);
+                    batch.CommandSources.PushBack(i);
+                } });
+            System::JobSystem::Wait(ctx);
+        }
+        m_Stats.CullTime       = cullTimer.GetElapsedMS();
+        m_Stats.NumCullBatches = batchCount;
 
-                    {
-                        auto inside = m_ForwardData.m_Frustum.IsInside(bbCopy);
+        Timer mergeTimer;
+        {
+            LUMOS_PROFILE_SCOPE("Merge Mesh Commands");
 
-                        if(!inside)
-                            continue;
+            Graphics::PipelineDesc pipelineDesc = {};
+            pipelineDesc.polygonMode            = Graphics::PolygonMode::FILL;
+            pipelineDesc.blendMode              = BlendMode::SrcAlphaOneMinusSrcAlpha;
+            pipelineDesc.clearTargets           = false;
+            pipelineDesc.swapchainTarget        = false;
+            pipelineDesc.colourTargets[0]       = m_MainTexture;
+            pipelineDesc.samples                = m_MainTextureSamples;
+            if(m_MainTextureSamples > 1)
+                pipelineDesc.resolveTexture = m_ResolveTexture;
 
-                        RenderCommand command;
-                        command.mesh      = mesh;
-                        command.transform = worldTransform;
-                        command.material  = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
+            Graphics::PipelineDesc shadowPipelineDesc;
+            shadowPipelineDesc.cullMode                = Graphics::CullMode::FRONT;
+            shadowPipelineDesc.depthArrayTarget        = reinterpret_cast<Texture*>(m_ShadowData.m_ShadowTex);
+            shadowPipelineDesc.depthBiasEnabled        = false;
+            shadowPipelineDesc.depthBiasConstantFactor = 0.0f;
+            shadowPipelineDesc.depthBiasSlopeFactor    = 0.0f;
+            shadowPipelineDesc.DebugName               = "Shadow";
+            shadowPipelineDesc.clearTargets            = false;
+
+            // Pipeline::Get and Material::Bind touch shared caches and GPU objects so they stay on this thread,
+            // but only once per unique variant / material instead of once per mesh
+            Pipeline* forwardPipelines[MeshPipelineVariant_ForwardMask + 1] = {};
+            Pipeline* shadowPipelines[MeshPipelineVariant_ShadowMask + 1] = {};
+            Pipeline* forwardInstancedPipelines[MeshPipelineVariant_ForwardMask + 1] = {};
+            Pipeline* shadowInstancedPipelines[MeshPipelineVariant_ShadowMask + 1] = {};
+            const bool instancing = m_InstancingSupported && m_InstancingEnabled;
+
+            const bool clustered                            = m_ClusteredLightingActive;
+            const SharedPtr<Shader>& forwardShader          = clustered ? m_ForwardData.m_ClusteredShader : m_ForwardData.m_Shader;
+            const SharedPtr<Shader>& forwardAnimShader      = m_SkinningPaletteActive ? (clustered ? m_ForwardData.m_ClusteredAnimPaletteShader : m_ForwardData.m_AnimPaletteShader)
+                                                                                      : (clustered ? m_ForwardData.m_ClusteredAnimShader : m_ForwardData.m_AnimShader);
+            const SharedPtr<Shader>& shadowAnimShader       = m_SkinningPaletteActive ? m_ShadowData.m_ShaderAnimPalette : m_ShadowData.m_ShaderAnim;
+            const SharedPtr<Shader>& shadowAnimAlphaShader  = m_SkinningPaletteActive ? m_ShadowData.m_ShaderAnimPaletteAlpha : m_ShadowData.m_ShaderAnimAlpha;
+            const SharedPtr<Shader>& forwardInstancedShader = clustered ? m_ForwardData.m_ClusteredInstancedShader : m_ForwardData.m_InstancedShader;
+            const SharedPtr<Shader>& compactShader          = clustered ? m_ForwardData.m_CompactClusteredShader : m_ForwardData.m_CompactShader;
+            const SharedPtr<Shader>& compactInstancedShader = clustered ? m_ForwardData.m_CompactInstancedClusteredShader : m_ForwardData.m_CompactInstancedShader;
+
+            HashSet(Material*) boundMaterials = { 0 };
+            boundMaterials.arena              = Application::Get().GetFrameArena();
+
+            const Vec3 cameraPosition    = m_CameraTransform->GetWorldPosition();
+            const float cameraFar        = m_Camera->GetFar();
+            const uint32_t shadowLODBias = meshLODs ? qualitySettings.ShadowLODBias : 0;
+
+            // Unique across renderers so an instance drawn by two of them gets a palette in each one's buffer
+            static uint64_t s_SkinningPaletteFrame = 0;
+            m_SkinningPaletteFrame                 = ++s_SkinningPaletteFrame;
+
+            for(uint32_t batchIndex = 0; batchIndex < batchCount; batchIndex++)
+            {
+                MeshCullBatch& batch = m_MeshCullBatches[batchIndex];
+                m_Stats.NumMeshesTested += (uint32_t)batch.Meshes.Size();
+
+                for(uint32_t i = 0; i < batch.Commands.Size(); i++)
+                {
+                    RenderCommand& command = batch.Commands[i];
+                    const uint32_t mask    = batch.CommandMasks[i];
+                    const uint8_t variant  = batch.CommandVariants[i];
 
-                        // Update material buffers
+                    if(HashSetAdd(&boundMaterials, command.material))
                         command.material->Bind();
 
-                        pipelineDesc.colourTargets[0]    = m_MainTexture;
-                        pipelineDesc.cullMode            = command.material->GetFlag(Material::RenderFlags::TWOSIDED) ? Graphics::CullMode::NONE : Graphics::CullMode::BACK;
-                        pipelineDesc.transparencyEnabled = command.material->GetFlag(Material::RenderFlags::ALPHABLEND);
-                        pipelineDesc.samples             = m_MainTextureSamples;
-                        pipelineDesc.polygonMode         = PolygonMode::FILL;
-                        if(m_MainTextureSamples > 1)
-                            pipelineDesc.resolveTexture = m_ResolveTexture;
-                        if(m_ForwardData.m_DepthTest && command.material->GetFlag(Material::RenderFlags::DEPTHTEST))
+                    if(command.animated)
+                    {
+                        AnimationInstance* animation = batch.CommandAnimations[i];
+
+                        // How big the skeleton was drawn picks its update rate in the next Scene::UpdateAnimations
+                        if(animation)
                         {
-                            pipelineDesc.depthTarget = m_ForwardData.m_DepthTexture;
+                            if(mask & 1u)
+                            {
+                                const uint32_t source = batch.CommandSources[i];
+                                const Vec3 centre(batch.CentreX[source], batch.CentreY[source], batch.CentreZ[source]);
+                                const float radius = Vec3(batch.ExtentX[source], batch.ExtentY[source], batch.ExtentZ[source]).Length();
+                                float screenSize   = 2.0f * radius * lodView.PixelsPerUnit;
+                                if(!lodView.Orthographic)
+                                    screenSize /= Maths::Max(Maths::Distance(lodView.ViewPosition, centre), lodView.Near);
+                                animation->ScreenSize = Maths::Max(animation->ScreenSize, screenSize);
+                            }
+                            else
+                                animation->ShadowVisible = true;
                         }
 
-                        if(mesh->GetAnimVertexBuffer())
+                        if(m_SkinningPaletteActive)
                         {
-                            pipelineDesc.shader           = m_ForwardData.m_AnimShader;
-                            command.animated              = true;
-                            command.AnimatedDescriptorSet = model.ModelRef->GetAnimationController() ? model.ModelRef->GetAnimationController()->GetDescriptorSet() : m_ForwardData.m_DescriptorSet[3];
+                            command.boneOffset            = AddSkinningPalette(animation);
+                            command.AnimatedDescriptorSet = m_ForwardData.m_PaletteDescriptorSet.get();
                         }
                         else
-                            pipelineDesc.shader = m_ForwardData.m_Shader;
-#ifndef LUMOS_PRODUCTION
-                        static const char* debugName0 = "Forward PBR Transparent DepthTested";
-                        static const char* debugName1 = "Forward PBR DepthTested";
-                        static const char* debugName2 = "Forward PBR Transparent";
-                        static const char* debugName3 = "Forward PBR";
+                            command.AnimatedDescriptorSet = animation ? animation->GetDescriptorSet() : m_ForwardData.m_DescriptorSet[3].get();
+                    }
 
-                        if(pipelineDesc.depthTarget && pipelineDesc.transparencyEnabled)
-                        {
-                            pipelineDesc.DebugName = debugName0;
-                        }
-                        else if(pipelineDesc.depthTarget)
+                    // Filled in by the forward and shadow sections below instead of going into their queues
+                    GPUCullCommand* gpuCommand = nullptr;
+                    if(variant & MeshPipelineVariant_GPUCulled)
+                    {
+                        const uint32_t source      = batch.CommandSources[i];
+                        gpuCommand                 = &m_GPUCullCommands.EmplaceBack();
+                        gpuCommand->mesh           = command.mesh;
+                        gpuCommand->material       = command.material;
+                        gpuCommand->shadowPipeline = nullptr;
+                        gpuCommand->transform      = command.transform;
+                        gpuCommand->centre         = Vec4(batch.CentreX[source], batch.CentreY[source], batch.CentreZ[source], 0.0f);
+                        gpuCommand->extent         = Vec4(batch.ExtentX[source], batch.ExtentY[source], batch.ExtentZ[source], 0.0f);
+                        gpuCommand->lod            = command.lod;
+                        gpuCommand->shadowLOD      = command.lod;
+                    }
+
+                    if(mask >> 1)
+                    {
+                        // GPU culled meshes are only ever drawn instanced so they skip the per mesh pipeline
+                        const uint8_t shadowVariant = variant & MeshPipelineVariant_ShadowMask;
+                        if(gpuCommand ? !shadowInstancedPipelines[shadowVariant] : !shadowPipelines[shadowVariant])
                         {
-                            pipelineDesc.DebugName = debugName1;
+                            const bool alphaBlend                  = shadowVariant & MeshPipelineVariant_AlphaBlend;
+                            shadowPipelineDesc.transparencyEnabled = alphaBlend;
+                            const bool compact                     = shadowVariant & MeshPipelineVariant_Compact;
+                            if(!gpuCommand)
+                            {
+                                if(shadowVariant & MeshPipelineVariant_Animated)
+                                    shadowPipelineDesc.shader = alphaBlend ? shadowAnimAlphaShader : shadowAnimShader;
+                                else if(compact)
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderCompactAlpha : m_ShadowData.m_ShaderCompact;
+                                else
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAlpha : m_ShadowData.m_Shader;
+
+                                shadowPipelines[shadowVariant] = Graphics::Pipeline::Get(shadowPipelineDesc);
+                            }
+
+                            if(instancing && !(shadowVariant & MeshPipelineVariant_Animated) && !shadowInstancedPipelines[shadowVariant])
+                            {
+                                if(compact)
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderCompactInstancedAlpha : m_ShadowData.m_ShaderCompactInstanced;
+                                else
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderInstancedAlpha : m_ShadowData.m_ShaderInstanced;
+                                shadowInstancedPipelines[shadowVariant] = Graphics::Pipeline::Get(shadowPipelineDesc);
+                            }
                         }
-                        else if(pipelineDesc.transparencyEnabled)
+
+                        const uint8_t shadowLOD = (uint8_t)Maths::Min(command.lod + shadowLODBias, command.mesh->GetLODCount() - 1);
+                        if(gpuCommand)
                         {
-                            pipelineDesc.DebugName = debugName2;
+                            gpuCommand->shadowPipeline = shadowInstancedPipelines[shadowVariant];
+                            gpuCommand->shadowLOD      = shadowLOD;
                         }
                         else
                         {
-                            pipelineDesc.DebugName = debugName3;
+                            RenderCommand shadowCommand     = command;
+                            shadowCommand.pipeline          = shadowPipelines[shadowVariant];
+                            shadowCommand.instancedPipeline = shadowInstancedPipelines[shadowVariant];
+                            if(command.animated && m_SkinningPaletteActive)
+                                shadowCommand.AnimatedDescriptorSet = m_ShadowData.m_PaletteDescriptorSet.get();
+                            shadowCommand.lod     = shadowLOD;
+                            shadowCommand.sortKey = RenderKey::EncodeOpaque(shadowCommand.pipeline, shadowCommand.material, shadowCommand.mesh, shadowCommand.lod, 0.0f, cameraFar);
+
+                            const uint32_t shadowTriangles = command.mesh->GetLOD(shadowCommand.lod).IndexCount / 3;
+                            const uint32_t fullTriangles   = command.mesh->GetLOD(0).IndexCount / 3;
+                            for(uint32_t cascade = 0; cascade < m_ShadowData.m_ShadowMapNum; cascade++)
+                            {
+                                if(mask & (1u << (cascade + 1)))
+                                {
+                                    m_ShadowData.m_CascadeCommandQueue[cascade].PushBack(shadowCommand);
+                                    m_Stats.ShadowLODTriangles[shadowCommand.lod] += shadowTriangles;
+                                    m_Stats.ShadowFullDetailTriangles += fullTriangles;
+                                }
+                            }
                         }
+                    }
+
+                    if(mask & 1u)
+                    {
+                        const uint8_t forwardVariant = variant & MeshPipelineVariant_ForwardMask;
+                        if(gpuCommand ? !forwardInstancedPipelines[forwardVariant] : !forwardPipelines[forwardVariant])
+                        {
+                            pipelineDesc.cullMode            = (forwardVariant & MeshPipelineVariant_TwoSided) ? Graphics::CullMode::NONE : Graphics::CullMode::BACK;
+                            pipelineDesc.transparencyEnabled = (forwardVariant & MeshPipelineVariant_AlphaBlend) != 0;
+                            pipelineDesc.depthTarget         = (forwardVariant & MeshPipelineVariant_DepthTest) ? m_ForwardData.m_DepthTexture : nullptr;
+                            if(forwardVariant & MeshPipelineVariant_Animated)
+                                pipelineDesc.shader = forwardAnimShader;
+                            else
+                                pipelineDesc.shader = (forwardVariant & MeshPipelineVariant_Compact) ? compactShader : forwardShader;
+#ifndef LUMOS_PRODUCTION
+                            static const char* debugName0 = "Forward PBR Transparent DepthTested";
+                            static const char* debugName1 = "Forward PBR DepthTested";
+                            static const char* debugName2 = "Forward PBR Transparent";
+                            static const char* debugName3 = "Forward PBR";
+
+                            if(pipelineDesc.depthTarget && pipelineDesc.transparencyEnabled)
+                                pipelineDesc.DebugName = debugName0;
+                            else if(pipelineDesc.depthTarget)
+                                pipelineDesc.DebugName = debugName1;
+                            else if(pipelineDesc.transparencyEnabled)
+                                pipelineDesc.DebugName = debugName2;
+                            else
+                                pipelineDesc.DebugName = debugName3;
 #endif
+                            if(!gpuCommand)
+                                forwardPipelines[forwardVariant] = Graphics::Pipeline::Get(pipelineDesc);
+
+                            if(instancing && !(forwardVariant & MeshPipelineVariant_Animated) && !forwardInstancedPipelines[forwardVariant])
+                            {
+                                pipelineDesc.shader                       = (forwardVariant & MeshPipelineVariant_Compact) ? compactInstancedShader : forwardInstancedShader;
+                                forwardInstancedPipelines[forwardVariant] = Graphics::Pipeline::Get(pipelineDesc);
+                            }
+                        }
+
+                        command.pipeline          = forwardPipelines[forwardVariant];
+                        command.instancedPipeline = forwardInstancedPipelines[forwardVariant];
+
+                        // Distance is left out of the key so every view's batches follow the same state order
+                        if(gpuCommand)
+                        {
+                            gpuCommand->forwardPipeline = command.instancedPipeline;
+                            gpuCommand->sortKey         = RenderKey::EncodeOpaque(command.instancedPipeline, command.material, command.mesh, command.lod, 0.0f, cameraFar);
+                            continue;
+                        }
+
+                        const float distance = Maths::Distance(cameraPosition, command.transform.Translation());
+                        if(!(forwardVariant & MeshPipelineVariant_DepthTest))
+                            command.sortKey = RenderKey::EncodeBlended(RenderBucket::Overlay, command.pipeline, command.material, command.mesh, command.lod, distance, cameraFar);
+                        else if(forwardVariant & MeshPipelineVariant_AlphaBlend)
+                            command.sortKey = RenderKey::EncodeBlended(RenderBucket::Transparent, command.pipeline, command.material, command.mesh, command.lod, distance, cameraFar);
+                        else
+                            command.sortKey = RenderKey::EncodeOpaque(command.pipeline, command.material, command.mesh, command.lod, distance, cameraFar);
+
+                        m_Stats.LODTriangles[command.lod] += command.mesh->GetLOD(command.lod).IndexCount / 3;
+                        m_Stats.FullDetailTriangles += command.mesh->GetLOD(0).IndexCount / 3;
 
-                        command.pipeline = Graphics::Pipeline::Get(pipelineDesc);
                         m_ForwardData.m_CommandQueue.PushBack(command);
                     }
                 }
             }
         }
 
-        m_Renderer2DData.m_CommandQueue2D.Clear();
+        m_Stats.CommandMergeTime = mergeTimer.GetElapsedMS();
+    }
 
-        if(renderSettings.Renderer2DEnabled)
+    void SceneRenderer::BuildGPUCullBatches()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        m_GPUCullForwardBatches.Clear();
+        m_GPUCullShadowBatches.Clear();
+        m_GPUCullViews.Clear();
+        m_GPUCullArguments.Clear();
+
+        if(!m_GPUCullingActive || m_GPUCullCommands.Empty())
+            m_GPUCullInstances.Clear();
+
+        if(!m_GPUCullingActive)
+            return;
+
+        GPUCullBuffers& buffers = m_GPUCullBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()];
+        ReadGPUCullStats(buffers);
+        buffers.ViewCount = 0;
+
+        if(m_GPUCullCommands.Empty())
+            return;
+
+        m_GPUCullFrame++;
+
+        // Sorted by state, so batches are runs of equal mesh, LOD, material and pipeline. Shadow batches only need
+        // the shadow state to match, which the same order mostly keeps together too.
+        SortCommandQueue(m_GPUCullCommands, m_GPUCullCommandsScratch);
+
+        // Instances from last frame are kept to compare against, so a static scene's instances are never rewritten
+        const uint32_t count         = (uint32_t)m_GPUCullCommands.Size();
+        const uint32_t previousCount = Maths::Min((uint32_t)m_GPUCullInstances.Size(), count);
+        m_GPUCullInstances.Resize(count);
+        m_GPUCullInstanceFrames.Resize(count);
+        for(uint32_t i = 0; i < count; i++)
         {
-            auto spriteGroup = registry.group<Graphics::Sprite>(entt::get<Maths::Transform>);
-            for(auto entity : spriteGroup)
+            const GPUCullCommand& command = m_GPUCullCommands[i];
+            GPUCullInstance instance;
+
+            const GPUCullCommand* forwardFirst = m_GPUCullForwardBatches.Empty() ? nullptr : &m_GPUCullCommands[m_GPUCullForwardBatches.Back().FirstCommand];
+            if(!forwardFirst || forwardFirst->mesh != command.mesh || forwardFirst->lod != command.lod || forwardFirst->material != command.material || forwardFirst->forwardPipeline != command.forwardPipeline)
+                m_GPUCullForwardBatches.PushBack({ i, 0 });
+            m_GPUCullForwardBatches.Back().Capacity++;
+
+            instance.ShadowBatch = UINT32_MAX;
+            if(command.shadowPipeline)
             {
-                const auto& [sprite, trans] = spriteGroup.get<Graphics::Sprite, Maths::Transform>(entity);
+                const GPUCullCommand* shadowFirst = m_GPUCullShadowBatches.Empty() ? nullptr : &m_GPUCullCommands[m_GPUCullShadowBatches.Back().FirstCommand];
+                if(!shadowFirst || shadowFirst->mesh != command.mesh || shadowFirst->shadowLOD != command.shadowLOD || shadowFirst->material != command.material || shadowFirst->shadowPipeline != command.shadowPipeline)
+                    m_GPUCullShadowBatches.PushBack({ i, 0 });
+                m_GPUCullShadowBatches.Back().Capacity++;
+                instance.ShadowBatch = (uint32_t)m_GPUCullShadowBatches.Size() - 1;
+            }
 
-                auto bb = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetScale()));
-                bb.Transform(trans.GetWorldMatrix());
-                auto inside = m_ForwardData.m_Frustum.IsInside(bb);
+            instance.Transform    = command.transform;
+            instance.Centre       = command.centre;
+            instance.Extent       = command.extent;
+            instance.ForwardBatch = (uint32_t)m_GPUCullForwardBatches.Size() - 1;
+            instance.Padding[0]   = 0;
+            instance.Padding[1]   = 0;
 
-                if(!inside)
+            if(i >= previousCount || memcmp(&m_GPUCullInstances[i], &instance, sizeof(GPUCullInstance)) != 0)
+            {
+                m_GPUCullInstances[i]      = instance;
+                m_GPUCullInstanceFrames[i] = m_GPUCullFrame;
+            }
+        }
+
+        // Every view gets one argument record per batch, and each batch a slice of the output transforms big enough
+        // for all of its instances
+        const Mat4 cameraProjView = m_Camera->GetProjectionMatrix() * m_CameraTransform->GetWorldMatrix().Inverse();
+        const uint32_t viewCount  = GPUCullView_Cascade0 + m_GPUCullCascadeCount;
+        uint32_t outputCount      = 0;
+        for(uint32_t viewIndex = 0; viewIndex < viewCount; viewIndex++)
+        {
+            const bool shadowView         = viewIndex >= GPUCullView_Cascade0;
+            const uint32_t cascade        = shadowView ? viewIndex - GPUCullView_Cascade0 : 0;
+            const Maths::Frustum& frustum = shadowView ? m_ShadowData.m_CascadeFrustums[cascade] : m_ForwardData.m_Frustum;
+
+            GPUCullView& view = m_GPUCullViews.EmplaceBack();
+            for(int plane = 0; plane < 6; plane++)
+                view.Planes[plane] = Vec4(frustum.GetPlane(plane).Normal(), frustum.GetPlane(plane).Distance());
+            view.ViewProj       = shadowView ? m_ShadowData.m_ShadowProjView[cascade] : cameraProjView;
+            view.ArgsOffset     = (uint32_t)m_GPUCullArguments.Size();
+            view.UseShadowBatch = shadowView ? 1 : 0;
+            view.OcclusionTest  = (viewIndex == GPUCullView_Forward && m_GPUCullOcclusion) ? 1 : 0;
+            view.Padding        = 0;
+
+            buffers.ViewArgsOffset[viewIndex] = view.ArgsOffset;
+            if(!IsGPUCullViewUsed(viewIndex))
+                continue;
+
+            for(const GPUCullBatch& batch : shadowView ? m_GPUCullShadowBatches : m_GPUCullForwardBatches)
+            {
+                const GPUCullCommand& command = m_GPUCullCommands[batch.FirstCommand];
+                const MeshLOD& range          = command.mesh->GetLOD(shadowView ? command.shadowLOD : command.lod);
+
+                DrawIndexedArguments& arguments = m_GPUCullArguments.EmplaceBack();
+                arguments.IndexCount            = range.IndexCount;
+                arguments.InstanceCount         = 0;
+                arguments.FirstIndex            = range.IndexOffset;
+                arguments.VertexOffset          = 0;
+                arguments.FirstInstance         = outputCount;
+                outputCount += batch.Capacity;
+            }
+        }
+        buffers.ViewArgsOffset[viewCount] = (uint32_t)m_GPUCullArguments.Size();
+        buffers.ViewCount                 = viewCount;
+
+        m_Stats.NumGPUCullInstances = count;
+
+        // A new or grown buffer takes everything, otherwise runs of instances changed since it was last written
+        const uint32_t instancesSize = count * (uint32_t)sizeof(GPUCullInstance);
+        if(!buffers.Instances || buffers.Instances->GetSize() < instancesSize)
+        {
+            UploadStorageBuffer(buffers.Instances, instancesSize, m_GPUCullInstances.Data());
+            m_Stats.NumGPUCullUploads = count;
+        }
+        else
+        {
+            GPUCullInstance* resident = nullptr;
+            for(uint32_t i = 0; i < count;)
+            {
+                if(m_GPUCullInstanceFrames[i] <= buffers.InstancesFrame)
+                {
+                    i++;
                     continue;
+                }
+
+                uint32_t end = i + 1;
+                while(end < count && m_GPUCullInstanceFrames[end] > buffers.InstancesFrame)
+                    end++;
+
+                if(!resident)
+                    resident = buffers.Instances->GetPointer<GPUCullInstance>();
+                memcpy((void*)(resident + i), m_GPUCullInstances.Data() + i, (end - i) * sizeof(GPUCullInstance)); // Mapped buffer memory, not live objects
+                m_Stats.NumGPUCullUploads += end - i;
+                i = end;
+            }
+
+            if(resident)
+                buffers.Instances->Unmap();
+        }
+        buffers.InstancesFrame = m_GPUCullFrame;
+
+        UploadStorageBuffer(buffers.Views, (uint32_t)(m_GPUCullViews.Size() * sizeof(GPUCullView)), m_GPUCullViews.Data());
+        UploadStorageBuffer(buffers.Arguments, (uint32_t)(m_GPUCullArguments.Size() * sizeof(DrawIndexedArguments)), m_GPUCullArguments.Data());
+        UploadStorageBuffer(buffers.Transforms, outputCount * (uint32_t)sizeof(Mat4), nullptr);
+
+        m_GPUCullDescriptorSet->SetStorageBuffer(0, buffers.Instances);
+        m_GPUCullDescriptorSet->SetStorageBuffer(1, buffers.Views);
+        m_GPUCullDescriptorSet->SetStorageBuffer(2, buffers.Arguments);
+        m_GPUCullDescriptorSet->SetStorageBuffer(3, buffers.Transforms);
+        m_GPUCullDescriptorSet->SetTexture(4, m_DepthPyramid);
+        m_GPUCullDescriptorSet->Update();
+
+        m_GPUCullForwardInstanceSet->SetStorageBuffer(1, buffers.Transforms);
+        m_GPUCullForwardInstanceSet->Update();
+        m_GPUCullShadowInstanceSet->SetStorageBuffer(1, buffers.Transforms);
+        m_GPUCullShadowInstanceSet->Update();
+    }
+
+    void SceneRenderer::ReadGPUCullStats(GPUCullBuffers& buffers)
+    {
+        if(buffers.ViewCount == 0 || !buffers.Arguments)
+            return;
+
+        // The GPU has finished with this frame in flight's buffers, so these are its counts from a few frames ago
+        m_Stats.NumGPUVisibleInstances   = 0;
+        m_Stats.NumGPUShadowInstances    = 0;
+        m_Stats.NumGPUEmptyIndirectDraws = 0;
+
+        const DrawIndexedArguments* arguments = buffers.Arguments->GetPointer<DrawIndexedArguments>();
+        for(uint32_t view = GPUCullView_Forward; view < buffers.ViewCount; view++)
+        {
+            for(uint32_t i = buffers.ViewArgsOffset[view]; i < buffers.ViewArgsOffset[view + 1]; i++)
+            {
+                if(view == GPUCullView_Forward)
+                    m_Stats.NumGPUVisibleInstances += arguments[i].InstanceCount;
+                else
+                    m_Stats.NumGPUShadowInstances += arguments[i].InstanceCount;
+
+                if(arguments[i].InstanceCount == 0)
+                    m_Stats.NumGPUEmptyIndirectDraws++;
+            }
+        }
+        buffers.Arguments->Unmap();
+    }
+
+    void SceneRenderer::GPUCullPass(bool afterDepthPyramid)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        LUMOS_PROFILE_GPU("GPU Cull Pass");
+
+        if(m_GPUCullInstances.Empty())
+            return;
+
+        auto commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
+        commandBuffer->UnBindPipeline();
+        commandBuffer->EndCurrentRenderPass();
+
+        m_GPUCullDescriptorSet->TransitionImages(commandBuffer);
+
+        Graphics::PipelineDesc pipelineDesc {};
+        pipelineDesc.shader    = m_GPUCullShader;
+        pipelineDesc.DebugName = "GPU Cull";
+
+        auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
+        commandBuffer->BindPipeline(pipeline);
+
+        DescriptorSet* set = m_GPUCullDescriptorSet.get();
+        Renderer::BindDescriptorSets(pipeline.get(), commandBuffer, 0, &set, 1);
+
+        struct GPUCullPushConstants
+        {
+            uint32_t InstanceCount;
+            uint32_t ViewIndex;
+            uint32_t PyramidLevels;
+            uint32_t Padding;
+            Vec2 PyramidSize;
+        } pushConstants;
+
+        pushConstants.InstanceCount = (uint32_t)m_GPUCullInstances.Size();
+        pushConstants.PyramidLevels = m_DepthPyramid->GetMipMapLevels();
+        pushConstants.Padding       = 0;
+        pushConstants.PyramidSize   = Vec2((float)m_DepthPyramid->GetWidth(), (float)m_DepthPyramid->GetHeight());
+
+        const uint32_t groupCount = (pushConstants.InstanceCount + 63) / 64;
+        for(uint32_t view = 0; view < (uint32_t)m_GPUCullViews.Size(); view++)
+        {
+            // The camera view waits for the depth pyramid when it tests occlusion
+            const bool waitsForPyramid = view == GPUCullView_Forward && m_GPUCullOcclusion;
+            if(!IsGPUCullViewUsed(view) || waitsForPyramid != afterDepthPyramid)
+                continue;
+
+            pushConstants.ViewIndex = view;
+            memcpy(m_GPUCullShader->GetPushConstants()[0].data, &pushConstants, sizeof(GPUCullPushConstants));
+            m_GPUCullShader->BindPushConstants(commandBuffer, pipeline.get());
+            Renderer::GetRenderer()->Dispatch(commandBuffer, groupCount, 1, 1);
+        }
+
+        commandBuffer->UnBindPipeline();
+        Renderer::GetRenderer()->ComputeBarrier(commandBuffer);
+    }
+
+    void SceneRenderer::DepthPyramidPass()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        LUMOS_PROFILE_GPU("Depth Pyramid Pass");
+
+        auto commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
+        commandBuffer->UnBindPipeline();
+        commandBuffer->EndCurrentRenderPass();
+
+        const uint32_t levels = m_DepthPyramid->GetMipMapLevels();
+        if(m_DepthPyramidDescriptorSets.Size() != levels)
+        {
+            m_DepthPyramidDescriptorSets.Clear();
+
+            Graphics::DescriptorDesc descriptorDesc {};
+            descriptorDesc.layoutIndex = 0;
+            descriptorDesc.shader      = m_DepthPyramidShader.get();
+            for(uint32_t level = 0; level < levels; level++)
+                m_DepthPyramidDescriptorSets.PushBack(SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc)));
+        }
+
+        Graphics::PipelineDesc pipelineDesc {};
+        pipelineDesc.shader    = m_DepthPyramidShader;
+        pipelineDesc.DebugName = "Depth Pyramid";
 
-                RenderCommand2D command;
-                command.renderable = &sprite;
-                command.transform  = trans.GetWorldMatrix();
-                m_Renderer2DData.m_CommandQueue2D.PushBack(command);
-            };
+        auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
 
-            auto animSpriteGroup = registry.group<Graphics::AnimatedSprite>(entt::get<Maths::Transform>);
-            for(auto entity : animSpriteGroup)
-            {
-                const auto& [sprite, trans] = animSpriteGroup.get<Graphics::AnimatedSprite, Maths::Transform>(entity);
+        struct DepthPyramidPushConstants
+        {
+            int32_t PreviousSize[2];
+            int32_t LevelSize[2];
+            uint32_t FromDepth;
+        } pushConstants;
+
+        int32_t previousWidth  = (int32_t)m_DepthPyramid->GetWidth();
+        int32_t previousHeight = (int32_t)m_DepthPyramid->GetHeight();
+        for(uint32_t level = 0; level < levels; level++)
+        {
+            const int32_t width  = level == 0 ? previousWidth : Maths::Max(previousWidth / 2, 1);
+            const int32_t height = level == 0 ? previousHeight : Maths::Max(previousHeight / 2, 1);
 
-                auto bb = Maths::BoundingBox(Maths::Rect(sprite.GetPosition(), sprite.GetScale()));
-                bb.Transform(trans.GetWorldMatrix());
-                auto inside = m_ForwardData.m_Frustum.IsInside(bb);
+            // Level 0 reads the depth buffer, the previous level binding just needs something valid
+            DescriptorSet* set = m_DepthPyramidDescriptorSets[level].get();
+            set->SetTexture(0, m_DepthPyramid, level);
+            set->SetTexture(1, m_DepthPyramid, level == 0 ? 0 : level - 1);
+            set->SetTexture(2, m_ForwardData.m_DepthTexture);
+            set->TransitionImages(commandBuffer);
+            set->Update();
 
-                if(!inside)
-                    continue;
+            commandBuffer->BindPipeline(pipeline);
+            Renderer::BindDescriptorSets(pipeline.get(), commandBuffer, 0, &set, 1);
 
-                RenderCommand2D command;
-                command.renderable = &sprite;
-                command.transform  = trans.GetWorldMatrix();
-                m_Renderer2DData.m_CommandQueue2D.PushBack(command);
-            };
+            pushConstants.PreviousSize[0] = previousWidth;
+            pushConstants.PreviousSize[1] = previousHeight;
+            pushConstants.LevelSize[0]    = width;
+            pushConstants.LevelSize[1]    = height;
+            pushConstants.FromDepth       = level == 0 ? 1 : 0;
+            memcpy(m_DepthPyramidShader->GetPushConstants()[0].data, &pushConstants, sizeof(DepthPyramidPushConstants));
+            m_DepthPyramidShader->BindPushConstants(commandBuffer, pipeline.get());
 
-            {
-                LUMOS_PROFILE_SCOPE("Sort Meshes by distance from camera");
-                auto camTransform = m_CameraTransform;
-                if(!m_ForwardData.m_CommandQueue.Empty())
-                    Algorithms::BubbleSort(m_ForwardData.m_CommandQueue.begin(), m_ForwardData.m_CommandQueue.end(),
-                                           [camTransform](RenderCommand& a, RenderCommand& b)
-                                           {
-                                               if(a.material->GetFlag(Material::RenderFlags::DEPTHTEST) && !b.material->GetFlag(Material::RenderFlags::DEPTHTEST))
-                                                   return true;
-                                               if(!a.material->GetFlag(Material::RenderFlags::DEPTHTEST) && b.material->GetFlag(Material::RenderFlags::DEPTHTEST))
-                                                   return false;
-
-                                               return Maths::Distance(camTransform->GetWorldPosition(), a.transform.Translation()) < Maths::Distance(camTransform->GetWorldPosition(), b.transform.Translation());
-                                           });
-            }
+            Renderer::GetRenderer()->Dispatch(commandBuffer, (width + 7) / 8, (height + 7) / 8, 1);
+            Renderer::GetRenderer()->ComputeBarrier(commandBuffer);
 
-            {
-                LUMOS_PROFILE_SCOPE("Sort sprites by z value");
-                if(!m_Renderer2DData.m_CommandQueue2D.Empty())
-                    Algorithms::BubbleSort(m_Renderer2DData.m_CommandQueue2D.begin(), m_Renderer2DData.m_CommandQueue2D.end(),
-                                           [](RenderCommand2D& a, RenderCommand2D& b)
-                                           {
-                                               return a.transform.Translation()[2] < b.transform.Translation()[2];
-                                           });
-            }
+            previousWidth  = width;
+            previousHeight = height;
         }
+
+        commandBuffer->UnBindPipeline();
     }
 
     void SceneRenderer::SetRenderTarget(Graphics::Texture* texture, bool onlyIfTargetsScreen, bool rebuildFramebuffer)
@@ -1253,9 +2333,18 @@ namespace Lumos::Graphics
 
         GenerateBRDFLUTPass();
 
+        if(m_GPUCullingActive)
+            GPUCullPass(false);
+
         if(sceneRenderSettings.DepthPrePass)
             DepthPrePass();
 
+        if(m_GPUCullOcclusion && !m_GPUCullInstances.Empty())
+        {
+            DepthPyramidPass();
+            GPUCullPass(true);
+        }
+
         // if(m_MainTextureSamples > 1)
         // {
         //     sceneRenderSettings.SSAOEnabled = false;
@@ -1281,8 +2370,13 @@ namespace Lumos::Graphics
         if(sceneRenderSettings.Renderer2DEnabled)
             Render2DPass();
 
-        if (sceneRenderSettings.Renderer3DEnabled)
+        if(sceneRenderSettings.Renderer3DEnabled)
+        {
+            if(m_GPUParticlesActive)
+                GPUParticlePass();
+
             ParticlePass();
+        }
 
         if(m_DebugRenderEnabled && sceneRenderSettings.DebugRenderEnabled)
             DebugPass();
@@ -1431,6 +2525,55 @@ namespace Lumos::Graphics
         ImGui::PopItemWidth();
         ImGui::NextColumn();
 
+        if(m_InstancingSupported)
+            ImGuiUtilities::Property("Instancing", m_InstancingEnabled);
+        ImGuiUtilities::Property("Mesh Commands", m_Stats.NumMeshCommands, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Mesh Draw Calls", m_Stats.NumMeshDrawCalls, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Instanced Draw Calls", m_Stats.NumInstancedDrawCalls, ImGuiUtilities::PropertyFlag::ReadOnly);
+
+        if(m_SkinningPaletteSupported)
+        {
+            ImGuiUtilities::Property("Skinning Palette Buffer", m_SkinningPaletteEnabled);
+            ImGuiUtilities::Property("Skinned Instances", m_Stats.NumSkinnedInstances, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("Palette Joints", m_Stats.NumPaletteJoints, ImGuiUtilities::PropertyFlag::ReadOnly);
+        }
+
+        if(m_ClusteredLightingSupported)
+        {
+            ImGuiUtilities::Property("Clustered Lighting", m_ClusteredLightingEnabled);
+            ImGuiUtilities::Property("Clustered Lights", m_Stats.NumClusteredLights, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("Max Lights Per Cluster", m_Stats.MaxLightsPerCluster, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("Cluster Build (ms)", m_Stats.ClusterBuildTime, 0.0f, 0.0f, 0.0f, ImGuiUtilities::PropertyFlag::ReadOnly);
+        }
+
+        if(m_GPUCullingSupported)
+        {
+            ImGuiUtilities::Property("GPU Culling", m_GPUCullingEnabled);
+            ImGuiUtilities::Property("GPU Occlusion Culling", m_GPUOcclusionEnabled);
+            ImGuiUtilities::Property("GPU Culled Meshes", m_Stats.NumGPUCullInstances, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("GPU Cull Uploads", m_Stats.NumGPUCullUploads, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("GPU Visible Meshes", m_Stats.NumGPUVisibleInstances, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("GPU Shadow Casters", m_Stats.NumGPUShadowInstances, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("Indirect Draws", m_Stats.NumGPUIndirectDraws, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("Empty Indirect Draws", m_Stats.NumGPUEmptyIndirectDraws, ImGuiUtilities::PropertyFlag::ReadOnly);
+        }
+
+        if(m_ParallelRecordingSupported)
+        {
+            ImGuiUtilities::Property("Parallel Recording", m_ParallelRecordingEnabled);
+            ImGuiUtilities::Property("Draws Per Secondary", m_SecondaryChunkSize, 16, 4096);
+            ImGuiUtilities::Property("Secondary Command Buffers", m_Stats.NumSecondaryCommandBuffers, ImGuiUtilities::PropertyFlag::ReadOnly);
+        }
+        ImGuiUtilities::Property("Draw Recording (ms)", m_Stats.RecordTime, 0.0f, 0.0f, 0.0f, ImGuiUtilities::PropertyFlag::ReadOnly);
+
+        if(m_GPUParticlesSupported)
+        {
+            ImGuiUtilities::Property("GPU Particles", m_GPUParticlesEnabled);
+            ImGuiUtilities::Property("Particle Collision Distance", m_GPUParticleCollisionDistance, 0.0f, 10.0f, 0.01f);
+            ImGuiUtilities::Property("GPU Particle Emitters", m_Stats.NumGPUParticleEmitters, ImGuiUtilities::PropertyFlag::ReadOnly);
+            ImGuiUtilities::Property("GPU Particles Alive", m_Stats.NumGPUParticles, ImGuiUtilities::PropertyFlag::ReadOnly);
+        }
+
         ImGui::Columns(1);
         ImGui::TextUnformatted("2D renderer");
         ImGui::Columns(2);
@@ -1629,7 +2772,7 @@ namespace Lumos::Graphics
         LUMOS_PROFILE_FUNCTION();
         LUMOS_PROFILE_GPU("Shadow Pass");
 
-        bool empty = true;
+        bool empty = m_GPUCullCascadeCount == 0 || m_GPUCullShadowBatches.Empty();
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
             if(!m_ShadowData.m_CascadeCommandQueue[i].Empty())
@@ -1639,6 +2782,7 @@ namespace Lumos::Graphics
         if(empty)
             return;
 
+        Timer recordTimer;
         auto commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
         commandBuffer->UnBindPipeline();
         commandBuffer->EndCurrentRenderPass();
@@ -1649,8 +2793,7 @@ namespace Lumos::Graphics
         m_ShadowData.m_DescriptorSet[1]->SetUniformBufferData(1, m_ShadowData.m_ShadowProjView);
         m_ShadowData.m_DescriptorSet[1]->Update();
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
+        Arena* frameArena = Application::Get().GetFrameArena();
 
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
@@ -1658,15 +2801,58 @@ namespace Lumos::Graphics
 
             m_ShadowData.m_Layer = i;
 
-            for(auto& command : m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer])
+            // CPU batches, then GPU culled casters
+            const TDArray<MeshDrawBatch>& batches = m_ShadowDrawBatches[i];
+            const CommandQueue& commandQueue      = m_ShadowData.m_CascadeCommandQueue[i];
+            const uint32_t gpuBatchCount          = i < m_GPUCullCascadeCount ? m_GPUCullShadowBatches.Size() : 0;
+            const uint32_t itemCount              = batches.Size() + gpuBatchCount;
+            if(itemCount == 0)
+                continue;
+
+            Pipeline** pipelines = PushArrayNoZero(frameArena, Pipeline*, itemCount);
+            for(uint32_t batchIndex = 0; batchIndex < batches.Size(); batchIndex++)
+            {
+                const MeshDrawBatch& batch   = batches[batchIndex];
+                const RenderCommand& command = commandQueue[batch.FirstCommand];
+                pipelines[batchIndex]        = batch.InstanceCount > 1 ? command.instancedPipeline : command.pipeline;
+                m_Stats.NumShadowObjects += batch.InstanceCount;
+            }
+
+            for(uint32_t batchIndex = 0; batchIndex < gpuBatchCount; batchIndex++)
+                pipelines[batches.Size() + batchIndex] = m_GPUCullCommands[m_GPUCullShadowBatches[batchIndex].FirstCommand].shadowPipeline;
+
+            m_Stats.NumGPUIndirectDraws += gpuBatchCount;
+            RecordPassItems(pipelines, itemCount, i, &SceneRenderer::RecordShadowItems);
+
+            commandBuffer->UnBindPipeline();
+            commandBuffer->EndCurrentRenderPass();
+        }
+
+        m_Stats.RecordTime += recordTimer.GetElapsedMS();
+    }
+
+    void SceneRenderer::RecordShadowItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const TDArray<MeshDrawBatch>& batches = m_ShadowDrawBatches[layer];
+        const CommandQueue& commandQueue      = m_ShadowData.m_CascadeCommandQueue[layer];
+
+        DescriptorSet* currentDescriptors[4] = {};
+        alignas(16) uint8_t pushData[MAX_PUSH_CONSTANT_SIZE];
+
+        for(uint32_t item = firstItem; item < firstItem + itemCount; item++)
+        {
+            if(item < batches.Size())
             {
+                const MeshDrawBatch& batch   = batches[item];
+                const RenderCommand& command = commandQueue[batch.FirstCommand];
+                const bool instanced         = batch.InstanceCount > 1;
+
                 Material* material    = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
                 currentDescriptors[1] = material->GetDescriptorSet();
                 bool alphaBlend       = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
-                uint32_t layer      = static_cast<uint32_t>(m_ShadowData.m_Layer);
-                auto& pushConstants = command.pipeline->GetShader()->GetPushConstants();
-                memcpy(pushConstants[0].data + sizeof(Mat4), &layer, sizeof(uint32_t));
+                auto pipeline         = instanced ? command.instancedPipeline : command.pipeline;
                 currentDescriptors[0] = alphaBlend ? m_ShadowData.m_DescriptorSet[1].get() : m_ShadowData.m_DescriptorSet[0].get();
                 currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2];
 
@@ -1675,20 +2861,57 @@ namespace Lumos::Graphics
                     currentDescriptors[3] = command.AnimatedDescriptorSet;
                 }
 
-                auto pipeline = command.pipeline;
-                commandBuffer->BindPipeline(pipeline, m_ShadowData.m_Layer);
+                commandBuffer->BindPipeline(pipeline, layer);
 
-                Mesh* mesh     = command.mesh;
-                auto transform = m_ShadowData.m_ShadowProjView[m_ShadowData.m_Layer] * command.transform;
-                memcpy(pushConstants[0].data, &transform, sizeof(Mat4));
-
-                command.pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline);
-                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
-                Renderer::DrawMesh(commandBuffer, pipeline, mesh);
-                m_Stats.NumShadowObjects++;
+                Mesh* mesh = command.mesh;
+                if(instanced)
+                {
+                    // Cascade matrices come from the shadow uniform buffer, the push constants only index into it
+                    currentDescriptors[3] = m_ShadowData.m_InstanceDescriptorSet.get();
+                    memcpy(pushData, &layer, sizeof(uint32_t));
+                    memcpy(pushData + sizeof(uint32_t), &batch.InstanceOffset, sizeof(uint32_t));
+                    SetTexCoordScaleBias(pushData, pipeline, sizeof(Vec4), mesh);
+
+                    pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+                    Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, 4);
+                    Renderer::DrawMeshInstanced(commandBuffer, pipeline, mesh, batch.InstanceCount, command.lod);
+                }
+                else
+                {
+                    auto transform = m_ShadowData.m_ShadowProjView[layer] * command.transform;
+                    memcpy(pushData, &transform, sizeof(Mat4));
+                    memcpy(pushData + sizeof(Mat4), &layer, sizeof(uint32_t));
+                    if(command.animated)
+                        memcpy(pushData + sizeof(Mat4) + sizeof(uint32_t), &command.boneOffset, sizeof(uint32_t));
+                    SetTexCoordScaleBias(pushData, pipeline, sizeof(Mat4) + sizeof(Vec4), mesh);
+
+                    pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+                    Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
+                    Renderer::DrawMesh(commandBuffer, pipeline, mesh, command.lod);
+                }
+                continue;
             }
-            commandBuffer->UnBindPipeline();
-            commandBuffer->EndCurrentRenderPass();
+
+            // GPU culled casters, opaque so the alpha descriptor set isn't needed
+            const uint32_t batchIndex     = item - batches.Size();
+            StorageBuffer* arguments      = m_GPUCullBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()].Arguments;
+            const uint32_t firstArgument  = m_GPUCullViews[GPUCullView_Cascade0 + layer].ArgsOffset;
+            const uint32_t layerOffset[2] = { layer, 0 };
+            currentDescriptors[0]         = m_ShadowData.m_DescriptorSet[0].get();
+            currentDescriptors[2]         = m_ForwardData.m_DescriptorSet[2];
+            currentDescriptors[3]         = m_GPUCullShadowInstanceSet.get();
+
+            const GPUCullCommand& command = m_GPUCullCommands[m_GPUCullShadowBatches[batchIndex].FirstCommand];
+            Pipeline* pipeline            = command.shadowPipeline;
+            commandBuffer->BindPipeline(pipeline, layer);
+            currentDescriptors[1] = command.material->GetDescriptorSet();
+
+            memcpy(pushData, layerOffset, sizeof(layerOffset));
+            SetTexCoordScaleBias(pushData, pipeline, sizeof(Vec4), command.mesh);
+
+            pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, 4);
+            Renderer::DrawMeshIndirect(commandBuffer, pipeline, command.mesh, arguments, (firstArgument + batchIndex) * sizeof(DrawIndexedArguments));
         }
     }
 
@@ -1697,7 +2920,12 @@ namespace Lumos::Graphics
         LUMOS_PROFILE_FUNCTION();
         LUMOS_PROFILE_GPU("Depth Pre Pass");
 
-        Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
+        // SSAO and the normals debug view are the only readers of the prepass normals. Without them the pass is
+        // depth only and compact meshes read just their position stream.
+        const auto& renderSettings = m_CurrentScene->GetSettings().RenderSettings;
+        const bool writeNormals    = (renderSettings.SSAOEnabled && !m_DisablePostProcess && Application::Get().GetQualitySettings().EnableSSAO) || renderSettings.DebugMode == 3;
+
+        Timer recordTimer;
         Graphics::PipelineDesc pipelineDesc {};
         pipelineDesc.polygonMode      = Graphics::PolygonMode::FILL;
         pipelineDesc.blendMode        = BlendMode::SrcAlphaOneMinusSrcAlpha;
@@ -1705,43 +2933,110 @@ namespace Lumos::Graphics
         pipelineDesc.swapchainTarget  = false;
         pipelineDesc.cullMode         = Graphics::CullMode::BACK;
         pipelineDesc.depthTarget      = m_ForwardData.m_DepthTexture;
-        pipelineDesc.colourTargets[0] = m_NormalTexture;
+        pipelineDesc.colourTargets[0] = writeNormals ? m_NormalTexture : nullptr;
         pipelineDesc.DebugName        = "Depth Prepass";
         pipelineDesc.samples          = m_MainTextureSamples;
 
-        DescriptorSet* sets[4];
-        sets[0] = m_ForwardData.m_DescriptorSet[0].get();
-        sets[2] = m_ForwardData.m_DescriptorSet[2].get();
+        // Pipelines are looked up here as the cache isn't safe to use from the recording threads
+        const uint32_t gpuBatchCount = (m_GPUCullPrePass && !m_GPUCullForwardBatches.Empty()) ? m_GPUCullForwardBatches.Size() : 0;
+        const uint32_t maxItemCount  = m_ForwardData.m_CommandQueue.Size() + gpuBatchCount;
+        if(maxItemCount == 0)
+            return;
+
+        Arena* frameArena     = Application::Get().GetFrameArena();
+        m_PrePassCommands     = PushArrayNoZero(frameArena, const RenderCommand*, maxItemCount);
+        m_PrePassPipelines    = PushArrayNoZero(frameArena, Pipeline*, maxItemCount);
+        m_PrePassCommandCount = 0;
 
         for(auto& command : m_ForwardData.m_CommandQueue)
         {
             Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            sets[1]            = material->GetDescriptorSet();
             if(!material->GetFlag(Material::RenderFlags::DEPTHTEST)) // || command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
                 continue;
 
             bool alphaBlend = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
-            if(command.animated)
-            {
-                sets[3] = command.AnimatedDescriptorSet;
-            }
-
+            Mesh* mesh                       = command.mesh;
             pipelineDesc.transparencyEnabled = alphaBlend;
-            pipelineDesc.shader              = command.animated ? (alphaBlend ? m_DepthPrePassAlphaAnimShader : m_DepthPrePassAnimShader) : (alphaBlend ? m_DepthPrePassAlphaShader : m_DepthPrePassShader);
+            if(command.animated && m_SkinningPaletteActive)
+                pipelineDesc.shader = alphaBlend ? m_DepthPrePassAlphaAnimPaletteShader : m_DepthPrePassAnimPaletteShader;
+            else if(command.animated)
+                pipelineDesc.shader = alphaBlend ? m_DepthPrePassAlphaAnimShader : m_DepthPrePassAnimShader;
+            else if(mesh->IsCompact())
+                pipelineDesc.shader = alphaBlend ? m_DepthPrePassCompactAlphaShader : (writeNormals ? m_DepthPrePassCompactNormalShader : m_DepthPrePassCompactShader);
+            else
+                pipelineDesc.shader = alphaBlend ? m_DepthPrePassAlphaShader : m_DepthPrePassShader;
+
+            m_PrePassCommands[m_PrePassCommandCount]  = &command;
+            m_PrePassPipelines[m_PrePassCommandCount] = Graphics::Pipeline::Get(pipelineDesc).get();
+            m_PrePassCommandCount++;
+        }
+
+        // GPU culled meshes are all opaque, drawn from the prepass view's arguments with transforms starting at each
+        // record's FirstInstance
+        pipelineDesc.transparencyEnabled = false;
+        for(uint32_t i = 0; i < gpuBatchCount; i++)
+        {
+            const GPUCullCommand& command                 = m_GPUCullCommands[m_GPUCullForwardBatches[i].FirstCommand];
+            pipelineDesc.shader                           = command.mesh->IsCompact() ? m_DepthPrePassCompactInstancedShader : m_DepthPrePassInstancedShader;
+            m_PrePassPipelines[m_PrePassCommandCount + i] = Graphics::Pipeline::Get(pipelineDesc).get();
+        }
+
+        m_Stats.NumGPUIndirectDraws += gpuBatchCount;
+        RecordPassItems(m_PrePassPipelines, m_PrePassCommandCount + gpuBatchCount, 0, &SceneRenderer::RecordPrePassItems);
+        m_Stats.RecordTime += recordTimer.GetElapsedMS();
+    }
+
+    void SceneRenderer::RecordPrePassItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        DescriptorSet* sets[4] = {};
+        sets[0]                = m_ForwardData.m_DescriptorSet[0].get();
+        sets[2]                = m_ForwardData.m_DescriptorSet[2].get();
+        alignas(16) uint8_t pushData[MAX_PUSH_CONSTANT_SIZE];
 
-            auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
+        for(uint32_t item = firstItem; item < firstItem + itemCount; item++)
+        {
+            Pipeline* pipeline = m_PrePassPipelines[item];
             commandBuffer->BindPipeline(pipeline);
 
-            Mesh* mesh           = command.mesh;
-            auto& worldTransform = command.transform;
+            if(item < m_PrePassCommandCount)
+            {
+                const RenderCommand& command = *m_PrePassCommands[item];
+                Material* material           = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                sets[1]                      = material->GetDescriptorSet();
+
+                if(command.animated)
+                {
+                    sets[3] = command.AnimatedDescriptorSet;
+                }
 
-            auto& pushConstants = m_DepthPrePassShader->GetPushConstants()[0];
-            pushConstants.SetData((void*)&worldTransform);
+                // Compact alpha and normal variants also take the UV scale and bias, skinned ones their palette offset
+                memcpy(pushData, &command.transform, sizeof(Mat4));
+                if(command.animated)
+                    memcpy(pushData + sizeof(Mat4), &command.boneOffset, sizeof(uint32_t));
+                SetTexCoordScaleBias(pushData, pipeline, sizeof(Mat4), command.mesh);
+
+                pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, sets, command.animated ? 4 : 3);
+                Renderer::DrawMesh(commandBuffer, pipeline, command.mesh, command.lod);
+                continue;
+            }
 
-            m_DepthPrePassShader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, sets, command.animated ? 4 : 3);
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
+            const uint32_t batchIndex     = item - m_PrePassCommandCount;
+            StorageBuffer* arguments      = m_GPUCullBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()].Arguments;
+            const uint32_t firstArgument  = m_GPUCullViews[GPUCullView_PrePass].ArgsOffset;
+            const uint32_t instanceOffset = 0;
+            const GPUCullCommand& command = m_GPUCullCommands[m_GPUCullForwardBatches[batchIndex].FirstCommand];
+            sets[1]                       = command.material->GetDescriptorSet();
+            sets[3]                       = m_GPUCullForwardInstanceSet.get();
+
+            memcpy(pushData, &instanceOffset, sizeof(uint32_t));
+            SetTexCoordScaleBias(pushData, pipeline, sizeof(Vec4), command.mesh);
+
+            pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, sets, 4);
+            Renderer::DrawMeshIndirect(commandBuffer, pipeline, command.mesh, arguments, (firstArgument + batchIndex) * sizeof(DrawIndexedArguments));
         }
     }
 
@@ -1901,39 +3196,166 @@ namespace Lumos::Graphics
         LUMOS_PROFILE_FUNCTION();
         LUMOS_PROFILE_GPU("Forward Pass");
 
-        if(m_ForwardData.m_CommandQueue.Empty())
+        if(m_ForwardData.m_CommandQueue.Empty() && m_GPUCullForwardBatches.Empty())
             return;
 
+        Timer recordTimer;
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
         m_ForwardData.m_DescriptorSet[2]->TransitionImages(commandBuffer);
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
+        // GPU culled meshes are opaque so they go first, same as the opaque bucket of the sorted queue
+        const uint32_t gpuBatchCount = m_GPUCullForwardBatches.Size();
+        const uint32_t itemCount     = gpuBatchCount + m_ForwardDrawBatches.Size();
+        Pipeline** pipelines         = PushArrayNoZero(Application::Get().GetFrameArena(), Pipeline*, itemCount);
 
-        for(auto& command : m_ForwardData.m_CommandQueue)
+        for(uint32_t i = 0; i < gpuBatchCount; i++)
+            pipelines[i] = m_GPUCullCommands[m_GPUCullForwardBatches[i].FirstCommand].forwardPipeline;
+
+        for(uint32_t i = 0; i < m_ForwardDrawBatches.Size(); i++)
         {
-            m_Stats.NumRenderedObjects++;
+            const MeshDrawBatch& batch   = m_ForwardDrawBatches[i];
+            const RenderCommand& command = m_ForwardData.m_CommandQueue[batch.FirstCommand];
+            pipelines[gpuBatchCount + i] = batch.InstanceCount > 1 ? command.instancedPipeline : command.pipeline;
+            m_Stats.NumRenderedObjects += batch.InstanceCount;
+        }
+
+        m_Stats.NumGPUIndirectDraws += gpuBatchCount;
+        RecordPassItems(pipelines, itemCount, 0, &SceneRenderer::RecordForwardItems);
+        m_Stats.RecordTime += recordTimer.GetElapsedMS();
+    }
+
+    void SceneRenderer::RecordForwardItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        // Clustered pipelines also read set 4, so set 3 is bound for every mesh
+        const bool clustered                 = m_ClusteredLightingActive;
+        DescriptorSet* currentDescriptors[5] = {};
+        currentDescriptors[0]                = m_ForwardData.m_DescriptorSet[0].get();
+        currentDescriptors[2]                = m_ForwardData.m_DescriptorSet[2].get();
+        currentDescriptors[4]                = clustered ? m_ForwardData.m_ClusterDescriptorSet.get() : nullptr;
+        alignas(16) uint8_t pushData[MAX_PUSH_CONSTANT_SIZE];
+
+        const uint32_t gpuBatchCount = m_GPUCullForwardBatches.Size();
+        for(uint32_t item = firstItem; item < firstItem + itemCount; item++)
+        {
+            if(item < gpuBatchCount)
+            {
+                StorageBuffer* arguments      = m_GPUCullBuffers[Renderer::GetMainSwapChain()->GetCurrentBufferIndex()].Arguments;
+                const uint32_t firstArgument  = m_GPUCullViews[GPUCullView_Forward].ArgsOffset;
+                const uint32_t instanceOffset = 0;
+                currentDescriptors[3]         = m_GPUCullForwardInstanceSet.get();
+
+                const GPUCullCommand& command = m_GPUCullCommands[m_GPUCullForwardBatches[item].FirstCommand];
+                Pipeline* pipeline            = command.forwardPipeline;
+                commandBuffer->BindPipeline(pipeline);
+                currentDescriptors[1] = command.material->GetDescriptorSet();
+
+                memcpy(pushData, &instanceOffset, sizeof(uint32_t));
+                SetTexCoordScaleBias(pushData, pipeline, sizeof(Vec4), command.mesh);
+
+                pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, clustered ? 5 : 4);
+                Renderer::DrawMeshIndirect(commandBuffer, pipeline, command.mesh, arguments, (firstArgument + item) * sizeof(DrawIndexedArguments));
+                continue;
+            }
+
+            const MeshDrawBatch& batch   = m_ForwardDrawBatches[item - gpuBatchCount];
+            const RenderCommand& command = m_ForwardData.m_CommandQueue[batch.FirstCommand];
+            const bool instanced         = batch.InstanceCount > 1;
 
             Mesh* mesh           = command.mesh;
             auto& worldTransform = command.transform;
             Material* material   = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            auto pipeline        = command.pipeline;
+            auto pipeline        = instanced ? command.instancedPipeline : command.pipeline;
             commandBuffer->BindPipeline(pipeline);
 
-            currentDescriptors[0] = m_ForwardData.m_DescriptorSet[0].get();
             currentDescriptors[1] = material->GetDescriptorSet();
-            currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2].get();
 
+            if(instanced)
+            {
+                currentDescriptors[3] = m_ForwardData.m_InstanceDescriptorSet.get();
+
+                memcpy(pushData, &batch.InstanceOffset, sizeof(uint32_t));
+                SetTexCoordScaleBias(pushData, pipeline, sizeof(Vec4), mesh);
+
+                pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, clustered ? 5 : 4);
+                Renderer::DrawMeshInstanced(commandBuffer, pipeline, mesh, batch.InstanceCount, command.lod);
+                continue;
+            }
+
+            currentDescriptors[3] = (command.animated && command.AnimatedDescriptorSet) ? command.AnimatedDescriptorSet : m_ForwardData.m_DescriptorSet[3].get();
+
+            memcpy(pushData, &worldTransform, sizeof(Mat4));
             if(command.animated)
-                currentDescriptors[3] = command.AnimatedDescriptorSet ? command.AnimatedDescriptorSet : m_ForwardData.m_DescriptorSet[3].get();
+                memcpy(pushData + sizeof(Mat4), &command.boneOffset, sizeof(uint32_t));
+            SetTexCoordScaleBias(pushData, pipeline, sizeof(Mat4), mesh);
+
+            pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline, 0, pushData);
+            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, clustered ? 5 : (command.animated ? 4 : 3));
+            Renderer::DrawMesh(commandBuffer, pipeline, mesh, command.lod);
+        }
+    }
+
+    void SceneRenderer::RecordPassItems(Pipeline* const* pipelines, uint32_t itemCount, uint32_t layer, RecordItemsFunc record)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
+        const uint32_t chunkSize     = (uint32_t)Maths::Max(m_SecondaryChunkSize, 1);
+
+        if(!m_ParallelRecordingActive || itemCount <= chunkSize)
+        {
+            (this->*record)(commandBuffer, layer, 0, itemCount);
+            return;
+        }
+
+        // A chunk never spans two render passes. The primary begins each pass and the chunks after it continue it.
+        ArenaTemp scratch = ScratchBegin(0, 0);
+        TDArray<SecondaryChunk> chunks(scratch.arena);
+        chunks.Reserve(itemCount / chunkSize + 1);
+
+        for(uint32_t item = 0; item < itemCount; item++)
+        {
+            const Pipeline* previous = item > 0 ? pipelines[item - 1] : nullptr;
+            const bool beginsPass    = !previous || previous->GetRenderPass() != pipelines[item]->GetRenderPass() || previous->GetFramebuffer(layer) != pipelines[item]->GetFramebuffer(layer);
+
+            if(beginsPass || chunks.Back().ItemCount == chunkSize)
+                chunks.PushBack({ item, 0, pipelines[item], nullptr, beginsPass });
 
-            auto& pushConstants = m_ForwardData.m_Shader->GetPushConstants()[0];
-            pushConstants.SetData((void*)&worldTransform);
+            chunks.Back().ItemCount++;
+        }
 
-            m_ForwardData.m_Shader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
+        struct RecordJob
+        {
+            SceneRenderer* Owner;
+            SecondaryChunk* Chunks;
+            RecordItemsFunc Record;
+            uint32_t Layer;
+        };
+        RecordJob job = { this, chunks.Data(), record, layer };
+
+        System::JobSystem::Context ctx;
+        System::JobSystem::Dispatch(ctx, chunks.Size(), 1, [&job](JobDispatchArgs args)
+                                    {
+                SecondaryChunk& chunk = job.Chunks[args.jobIndex];
+                chunk.Secondary       = Renderer::GetRenderer()->AllocateSecondaryCommandBuffer();
+                chunk.FirstPipeline->BeginSecondary(chunk.Secondary, job.Layer);
+                (job.Owner->*job.Record)(chunk.Secondary, job.Layer, chunk.FirstItem, chunk.ItemCount);
+                chunk.Secondary->EndRecording(); });
+        System::JobSystem::Wait(ctx);
+
+        for(const SecondaryChunk& chunk : chunks)
+        {
+            if(chunk.BeginsPass)
+                chunk.FirstPipeline->BeginSecondaryPass(commandBuffer, layer);
+            chunk.Secondary->ExecuteSecondary(commandBuffer);
         }
+
+        // Later passes record inline, so they must not continue a pass begun for secondaries
+        commandBuffer->UnBindPipeline();
+        m_Stats.NumSecondaryCommandBuffers += chunks.Size();
+        ScratchEnd(scratch);
     }
 
     void SceneRenderer::SkyboxPass()
@@ -3487,6 +4909,11 @@ namespace Lumos::Graphics
             const auto& [textComp, trans] = textGroup.get<TextComponent, Maths::Transform>(entity);
 
             auto font = textComp.FontHandle ? textComp.FontHandle : Font::GetDefaultFont();
+
+            // Draw with the default font while a streamed one is loading
+            if(font && !font->GetFontAtlas())
+                font = Font::GetDefaultFont();
+
             if(!font || !font->GetFontAtlas())
                 continue;
 
@@ -4982,14 +6409,307 @@ namespace Lumos::Graphics
         return result;
     }
 
-    bool compareParticles(const Particle& a, const Particle& b, const Vec3& cameraPosition)
+    // Layouts match ParticleSimulate.comp and ParticleGPU.vert
+    struct GPUParticle
+    {
+        Vec4 PositionLife;
+        Vec4 VelocityAlpha;
+    };
+
+    struct GPUParticleCounters
+    {
+        DrawArguments Draw;
+        uint32_t AliveCount[2];
+        int32_t DeadCount;
+        uint32_t Padding;
+    };
+
+    struct GPUParticleEmitterData
+    {
+        Mat4 ViewProj;
+        Mat4 InvViewProj;
+        Vec4 Position;
+        Vec4 Spread;
+        Vec4 Velocity;
+        Vec4 VelocitySpread;
+        Vec4 Gravity;
+        Vec4 CameraPosition;
+        Vec4 Fade;
+        Vec4 DepthSize;
+    };
+
+    struct GPUParticleDrawData
+    {
+        Mat4 ProjView;
+        Vec4 Right;
+        Vec4 Up;
+        Vec4 Colour;
+        uint32_t Options[4];
+    };
+
+    enum GPUParticleStage : uint32_t
+    {
+        GPUParticleStage_Emit     = 0,
+        GPUParticleStage_Simulate = 1,
+        GPUParticleStage_SortPad  = 2,
+        GPUParticleStage_Sort     = 3,
+        GPUParticleStage_Finish   = 4
+    };
+
+    struct GPUParticlePushConstants
+    {
+        uint32_t Stage;
+        uint32_t Current;
+        uint32_t SpawnCount;
+        uint32_t SortCapacity;
+        uint32_t SortBlock;
+        uint32_t SortStep;
+        uint32_t Seed;
+        uint32_t Padding;
+    };
+
+    static void DispatchGPUParticleStage(CommandBuffer* commandBuffer, Pipeline* pipeline, Shader* shader, GPUParticlePushConstants& pushConstants, uint32_t stage, uint32_t threadCount)
+    {
+        pushConstants.Stage = stage;
+        memcpy(shader->GetPushConstants()[0].data, &pushConstants, sizeof(GPUParticlePushConstants));
+        shader->BindPushConstants(commandBuffer, pipeline);
+        Renderer::GetRenderer()->Dispatch(commandBuffer, (threadCount + 63) / 64, 1, 1);
+        Renderer::GetRenderer()->ComputeBarrier(commandBuffer);
+    }
+
+    void SceneRenderer::InitGPUParticleState(GPUParticleState& state, uint32_t capacity)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        state.Release();
+        if(capacity == 0)
+            return;
+
+        // The bitonic sort works on whole powers of two, the alive lists are padded to one
+        uint32_t sortCapacity = 1;
+        while(sortCapacity < capacity)
+            sortCapacity <<= 1;
+
+        ArenaTemp scratch  = ScratchBegin(nullptr, 0);
+        uint32_t* deadList = PushArrayNoZero(scratch.arena, uint32_t, capacity);
+        for(uint32_t i = 0; i < capacity; i++)
+            deadList[i] = i;
+
+        GPUParticleCounters counters = {};
+        counters.DeadCount           = (int32_t)capacity;
+
+        // Only the counters are read back on the CPU, everything else stays in device local memory
+        state.Particles    = StorageBuffer::Create(capacity * (uint32_t)sizeof(GPUParticle), nullptr, BufferUsage::STATIC);
+        state.DeadList     = StorageBuffer::Create(capacity * (uint32_t)sizeof(uint32_t), deadList, BufferUsage::STATIC);
+        state.AliveLists   = StorageBuffer::Create(sortCapacity * 2 * (uint32_t)sizeof(uint32_t) * 2, nullptr, BufferUsage::STATIC);
+        state.Counters     = StorageBuffer::Create((uint32_t)sizeof(GPUParticleCounters), &counters);
+        state.Capacity     = capacity;
+        state.SortCapacity = sortCapacity;
+        state.CurrentList  = 0;
+        ScratchEnd(scratch);
+
+        Graphics::DescriptorDesc descriptorDesc {};
+        descriptorDesc.layoutIndex = 0;
+        descriptorDesc.shader      = m_GPUParticleSimulateShader.get();
+        state.SimulateSet          = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        descriptorDesc.shader      = m_GPUParticleShader.get();
+        state.DrawSet              = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        descriptorDesc.layoutIndex = 1;
+        state.TextureSet           = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+
+        state.SimulateSet->SetStorageBuffer(0, state.Particles);
+        state.SimulateSet->SetStorageBuffer(1, state.DeadList);
+        state.SimulateSet->SetStorageBuffer(2, state.AliveLists);
+        state.SimulateSet->SetStorageBuffer(3, state.Counters);
+        state.DrawSet->SetStorageBuffer(1, state.Particles);
+        state.DrawSet->SetStorageBuffer(2, state.AliveLists);
+    }
+
+    void SceneRenderer::GPUParticlePass()
     {
-        // Calculate squared distance from camera to particle
-        float distanceSqA = Maths::Length2(a.Position - cameraPosition);
-        float distanceSqB = Maths::Length2(b.Position - cameraPosition);
+        LUMOS_PROFILE_FUNCTION();
+        LUMOS_PROFILE_GPU("GPU Particle Pass");
+
+        if(!m_Camera || !m_CameraTransform)
+            return;
 
-        // Sort in descending order based on squared distance
-        return distanceSqA > distanceSqB;
+        auto emitterGroup = m_CurrentScene->GetRegistry().group<ParticleEmitter>(entt::get<Maths::Transform>);
+        if(emitterGroup.empty())
+            return;
+
+        Arena* frameArena          = Application::Get().GetFrameArena();
+        ParticleEmitter** emitters = PushArrayNoZero(frameArena, ParticleEmitter*, emitterGroup.size());
+        Vec3* positions            = PushArrayNoZero(frameArena, Vec3, emitterGroup.size());
+        uint32_t emitterCount      = 0;
+
+        for(auto& emitterEntity : emitterGroup)
+        {
+            const auto& [emitter, trans] = emitterGroup.get<ParticleEmitter, Maths::Transform>(emitterEntity);
+            if(!emitter.GetGPUSimulation())
+                continue;
+
+            GPUParticleState& state = emitter.GetGPUState();
+            state.Simulated         = true;
+            if(state.Capacity != emitter.GetParticleCount())
+                InitGPUParticleState(state, emitter.GetParticleCount());
+
+            if(state.Capacity == 0)
+                continue;
+
+            emitters[emitterCount]  = &emitter;
+            positions[emitterCount] = trans.GetWorldPosition();
+            emitterCount++;
+        }
+
+        if(emitterCount == 0)
+            return;
+
+        auto commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
+        commandBuffer->UnBindPipeline();
+        commandBuffer->EndCurrentRenderPass();
+
+        // Earlier frames' draws read the buffers simulated into below
+        Renderer::GetRenderer()->VertexToComputeBarrier(commandBuffer);
+
+        const Mat4 projView    = m_Camera->GetProjectionMatrix() * Mat4::Inverse(m_CameraTransform->GetWorldMatrix());
+        const Mat4 invProjView = Mat4::Inverse(projView);
+        const Vec3 cameraPos   = m_CameraTransform->GetWorldPosition();
+
+        // Collision reads the depth the forward pass just wrote, sampling it needs a single sample depth buffer
+        const bool canCollide = m_ForwardData.m_DepthTest && m_MainTextureSamples == 1;
+        Texture* depthTexture = canCollide ? reinterpret_cast<Texture*>(m_ForwardData.m_DepthTexture) : Material::GetDefaultTexture().get();
+        const float depthWidth  = (float)depthTexture->GetWidth();
+        const float depthHeight = (float)depthTexture->GetHeight();
+
+        Graphics::PipelineDesc computeDesc {};
+        computeDesc.shader    = m_GPUParticleSimulateShader;
+        computeDesc.DebugName = "GPU Particle Simulate";
+        auto computePipeline  = Graphics::Pipeline::Get(computeDesc);
+
+        GPUParticlePushConstants pushConstants = {};
+        for(uint32_t i = 0; i < emitterCount; i++)
+        {
+            ParticleEmitter& emitter = *emitters[i];
+            GPUParticleState& state  = emitter.GetGPUState();
+
+            // Host visible, so this is what an earlier frame left in it
+            const GPUParticleCounters* counters = state.Counters->GetPointer<GPUParticleCounters>();
+            m_Stats.NumGPUParticles += counters->Draw.InstanceCount;
+            state.Counters->Unmap();
+
+            GPUParticleEmitterData emitterData;
+            emitterData.ViewProj       = projView;
+            emitterData.InvViewProj    = invProjView;
+            emitterData.Position       = Vec4(positions[i], state.PendingTime);
+            emitterData.Spread         = Vec4(emitter.GetSpread(), emitter.GetLifeSpread());
+            emitterData.Velocity       = Vec4(emitter.GetInitialVelocity(), emitter.GetParticleLife());
+            emitterData.VelocitySpread = Vec4(emitter.GetVelocitySpread(), emitter.GetInitialColour().w);
+            emitterData.Gravity        = Vec4(emitter.GetGravity(), emitter.GetRestitution());
+            emitterData.CameraPosition = Vec4(cameraPos, m_GPUParticleCollisionDistance);
+            emitterData.Fade           = Vec4(emitter.GetFadeIn(), emitter.GetFadeOut(), (canCollide && emitter.GetDepthCollision()) ? 1.0f : 0.0f, emitter.GetSortParticles() ? 1.0f : 0.0f);
+            emitterData.DepthSize      = Vec4(depthWidth, depthHeight, 1.0f / depthWidth, 1.0f / depthHeight);
+
+            DescriptorSet* set = state.SimulateSet.get();
+            set->SetUniformBufferData(4, &emitterData);
+            set->SetTexture(5, depthTexture);
+            set->TransitionImages(commandBuffer);
+            set->Update();
+
+            commandBuffer->BindPipeline(computePipeline);
+            Renderer::BindDescriptorSets(computePipeline.get(), commandBuffer, 0, &set, 1);
+
+            pushConstants.Current      = state.CurrentList;
+            pushConstants.SpawnCount   = state.PendingSpawns;
+            pushConstants.SortCapacity = state.SortCapacity;
+            pushConstants.Seed         = Random32::Rand(0u, UINT32_MAX);
+
+            Pipeline* pipeline = computePipeline.get();
+            Shader* shader     = m_GPUParticleSimulateShader.get();
+            if(state.PendingSpawns > 0)
+                DispatchGPUParticleStage(commandBuffer, pipeline, shader, pushConstants, GPUParticleStage_Emit, state.PendingSpawns);
+
+            // The alive count is only known on the GPU, so every slot gets a thread and the extra ones return
+            DispatchGPUParticleStage(commandBuffer, pipeline, shader, pushConstants, GPUParticleStage_Simulate, state.Capacity);
+
+            if(emitter.GetSortParticles())
+            {
+                DispatchGPUParticleStage(commandBuffer, pipeline, shader, pushConstants, GPUParticleStage_SortPad, state.SortCapacity);
+                for(uint32_t block = 2; block <= state.SortCapacity; block <<= 1)
+                {
+                    for(uint32_t step = block >> 1; step > 0; step >>= 1)
+                    {
+                        pushConstants.SortBlock = block;
+                        pushConstants.SortStep  = step;
+                        DispatchGPUParticleStage(commandBuffer, pipeline, shader, pushConstants, GPUParticleStage_Sort, state.SortCapacity);
+                    }
+                }
+            }
+
+            DispatchGPUParticleStage(commandBuffer, pipeline, shader, pushConstants, GPUParticleStage_Finish, 1);
+
+            state.CurrentList   = 1 - state.CurrentList;
+            state.PendingSpawns = 0;
+            state.PendingTime   = 0.0f;
+            m_Stats.NumGPUParticleEmitters++;
+        }
+
+        commandBuffer->UnBindPipeline();
+
+        Graphics::PipelineDesc pipelineDesc;
+        pipelineDesc.shader                  = m_GPUParticleShader;
+        pipelineDesc.polygonMode             = Graphics::PolygonMode::FILL;
+        pipelineDesc.cullMode                = Graphics::CullMode::BACK;
+        pipelineDesc.transparencyEnabled     = true;
+        pipelineDesc.clearTargets            = false;
+        pipelineDesc.depthTarget             = reinterpret_cast<Texture*>(m_ForwardData.m_DepthTexture);
+        pipelineDesc.colourTargets[0]        = m_MainTexture;
+        pipelineDesc.depthBiasEnabled        = true;
+        pipelineDesc.depthBiasConstantFactor = -1.25f;
+        pipelineDesc.depthBiasSlopeFactor    = -1.75f;
+        pipelineDesc.DebugName               = "GPU Particle";
+        pipelineDesc.samples                 = m_MainTextureSamples;
+        if(m_MainTextureSamples > 1)
+            pipelineDesc.resolveTexture = m_ResolveTexture;
+
+        const Vec3 cameraRight = m_CameraTransform->GetRightDirection().Normalised();
+        const Vec3 cameraUp    = m_CameraTransform->GetUpDirection().Normalised();
+
+        for(uint32_t i = 0; i < emitterCount; i++)
+        {
+            ParticleEmitter& emitter = *emitters[i];
+            GPUParticleState& state  = emitter.GetGPUState();
+
+            pipelineDesc.blendMode  = emitter.GetBlendType() == ParticleEmitter::BlendType::Additive ? BlendMode::SrcAlphaOne : BlendMode::SrcAlphaOneMinusSrcAlpha;
+            pipelineDesc.DepthTest  = emitter.GetDepthWrite();
+            pipelineDesc.DepthWrite = emitter.GetDepthWrite();
+            auto pipeline           = Graphics::Pipeline::Get(pipelineDesc);
+
+            // The list Finish just wrote, CurrentList has already moved on to it
+            const bool cameraAligned = emitter.GetAlignedType() == ParticleEmitter::Aligned3D;
+            GPUParticleDrawData drawData;
+            drawData.ProjView   = projView;
+            drawData.Right      = Vec4(cameraAligned ? cameraRight : Vec3(1.0f, 0.0f, 0.0f), emitter.GetParticleSize());
+            drawData.Up         = Vec4(cameraAligned ? cameraUp : Vec3(0.0f, 1.0f, 0.0f), emitter.GetParticleLife());
+            drawData.Colour     = emitter.GetInitialColour();
+            drawData.Options[0] = state.CurrentList * state.SortCapacity;
+            drawData.Options[1] = emitter.GetIsAnimated() ? emitter.GetAnimatedTextureRows() : 0;
+            drawData.Options[2] = 0;
+            drawData.Options[3] = 0;
+
+            state.DrawSet->SetUniformBufferData(0, &drawData);
+            state.DrawSet->Update();
+
+            Texture* texture = emitter.GetTexture() ? emitter.GetTexture().get() : Material::GetDefaultTexture().get();
+            state.TextureSet->SetTexture(0, texture);
+            state.TextureSet->Update();
+
+            commandBuffer->BindPipeline(pipeline);
+
+            DescriptorSet* sets[2] = { state.DrawSet.get(), state.TextureSet.get() };
+            Renderer::BindDescriptorSets(pipeline.get(), commandBuffer, 0, sets, 2);
+            Renderer::GetRenderer()->DrawIndirect(commandBuffer, state.Counters, 0);
+        }
+
+        commandBuffer->UnBindPipeline();
     }
 
     void SceneRenderer::ParticlePass()
@@ -5031,8 +6751,20 @@ namespace Lumos::Graphics
         for(auto& emitterEntity : emitterGroup)
         {
             const auto& [emitter, trans] = emitterGroup.get<ParticleEmitter, Maths::Transform>(emitterEntity);
-            Particle* particles          = emitter.GetParticles();
-            uint32_t particleCount       = emitter.GetParticleCount();
+
+            // Drawn by GPUParticlePass, emitters that just left GPU simulation give back their buffers
+            if(emitter.GetGPUSimulation() && m_GPUParticlesActive)
+                continue;
+
+            GPUParticleState& gpuState = emitter.GetGPUState();
+            if(gpuState.Simulated)
+            {
+                gpuState.Simulated = false;
+                gpuState.Release();
+            }
+
+            const ParticleStreams& particles = emitter.GetParticles();
+            uint32_t particleCount           = particles.AliveCount;
 
             if(!particleCount)
                 continue;
@@ -5051,17 +6783,33 @@ namespace Lumos::Graphics
             pipelineDesc.depthBiasSlopeFactor    = -1.75f;
             m_ParticleData.m_Pipeline            = Graphics::Pipeline::Get(pipelineDesc);
 
-            if(emitter.GetSortParticles())
+            // Back to front by squared distance. Positive float bits sort like the floats, so they're flipped for the
+            // furthest to come first
+            const bool sorted = emitter.GetSortParticles();
+            if(sorted)
             {
-                std::sort(&particles[0], &particles[particleCount - 1], [&](const Particle& a, const Particle& b)
-                          { return compareParticles(a, b, m_CameraTransform->GetWorldPosition()); });
+                m_SortEntries.Resize(particleCount);
+                m_SortEntriesScratch.Resize(particleCount);
+                for(uint32_t i = 0; i < particleCount; i++)
+                {
+                    const float distance = Maths::Length2(Vec3(particles.PositionX[i], particles.PositionY[i], particles.PositionZ[i]) - cameraPos);
+                    uint32_t bits;
+                    MemoryCopy(&bits, &distance, sizeof(bits));
+                    m_SortEntries[i].Key   = ~bits;
+                    m_SortEntries[i].Index = i;
+                }
+
+                Algorithms::RadixSort(m_SortEntries.Data(), m_SortEntries.Data() + particleCount, m_SortEntriesScratch.Data(),
+                                      [](const SortEntry& entry)
+                                      { return (uint32_t)entry.Key; });
             }
 
-            for(uint32_t i = 0; i < particleCount; i++)
+            for(uint32_t n = 0; n < particleCount; n++)
             {
-                auto& particle = particles[i];
-                if(particle.Life <= 0.0f)
-                    continue;
+                const uint32_t i = sorted ? m_SortEntries[n].Index : n;
+
+                const Vec3 position = Vec3(particles.PositionX[i], particles.PositionY[i], particles.PositionZ[i]);
+                const float size    = particles.Size[i];
 
                 m_Stats.NumRenderedObjects++;
 
@@ -5077,39 +6825,39 @@ namespace Lumos::Graphics
                 auto alignType = emitter.GetAlignedType();
                 if(alignType == ParticleEmitter::Aligned2D)
                 {
-                    Vec3 rightOffset = Vec3(1.0f, 0.0f, 0.0f) * particle.Size * 0.5f;
-                    Vec3 upOffset    = Vec3(0.0f, 1.0f, 0.0f) * particle.Size * 0.5f;
+                    Vec3 rightOffset = Vec3(1.0f, 0.0f, 0.0f) * size * 0.5f;
+                    Vec3 upOffset    = Vec3(0.0f, 1.0f, 0.0f) * size * 0.5f;
 
-                    v1 = particle.Position - rightOffset - upOffset;
-                    v2 = particle.Position + rightOffset - upOffset;
-                    v3 = particle.Position + rightOffset + upOffset;
-                    v4 = particle.Position - rightOffset + upOffset;
+                    v1 = position - rightOffset - upOffset;
+                    v2 = position + rightOffset - upOffset;
+                    v3 = position + rightOffset + upOffset;
+                    v4 = position - rightOffset + upOffset;
                 }
                 else if(alignType == ParticleEmitter::Aligned3D)
                 {
                     Vec3 cameraRight = m_CameraTransform->GetRightDirection().Normalised();
                     Vec3 cameraUp    = m_CameraTransform->GetUpDirection().Normalised();
 
-                    Vec3 rightOffset = cameraRight * particle.Size * 0.5f;
-                    Vec3 upOffset    = cameraUp * particle.Size * 0.5f;
+                    Vec3 rightOffset = cameraRight * size * 0.5f;
+                    Vec3 upOffset    = cameraUp * size * 0.5f;
 
-                    v1 = particle.Position - rightOffset - upOffset;
-                    v2 = particle.Position + rightOffset - upOffset;
-                    v3 = particle.Position + rightOffset + upOffset;
-                    v4 = particle.Position - rightOffset + upOffset;
+                    v1 = position - rightOffset - upOffset;
+                    v2 = position + rightOffset - upOffset;
+                    v3 = position + rightOffset + upOffset;
+                    v4 = position - rightOffset + upOffset;
                 }
                 else
                 {
-                    Vec3 rightOffset = Vec3(particle.Size * 0.5f, 0.0f, 0.0f);
-                    Vec3 upOffset    = Vec3(0.0f, particle.Size * 0.5f, 0.0f);
+                    Vec3 rightOffset = Vec3(size * 0.5f, 0.0f, 0.0f);
+                    Vec3 upOffset    = Vec3(0.0f, size * 0.5f, 0.0f);
 
-                    v1 = particle.Position - rightOffset - upOffset;
-                    v2 = particle.Position + rightOffset - upOffset;
-                    v3 = particle.Position + rightOffset + upOffset;
-                    v4 = particle.Position - rightOffset + upOffset;
+                    v1 = position - rightOffset - upOffset;
+                    v2 = position + rightOffset - upOffset;
+                    v3 = position + rightOffset + upOffset;
+                    v4 = position - rightOffset + upOffset;
                 }
 
-                const Vec4 colour = particle.Colour;
+                const Vec4 colour = Vec4(emitter.GetInitialColour().x, emitter.GetInitialColour().y, emitter.GetInitialColour().z, particles.Alpha[i]);
                 bool animated     = emitter.GetIsAnimated();
                 std::array<Vec2, 4> uv;
                 std::array<Vec4, 4> blendedUVs;
@@ -5118,7 +6866,7 @@ namespace Lumos::Graphics
 
                 if(animated)
                 {
-                    blendedUVs = emitter.GetBlendedAnimatedUVs(1.0f - (particle.Life / emitter.GetParticleLife()), emitter.GetAnimatedTextureRows(), blendAmount);
+                    blendedUVs = emitter.GetBlendedAnimatedUVs(1.0f - (particles.Life[i] / emitter.GetParticleLife()), emitter.GetAnimatedTextureRows(), blendAmount);
                 }
                 else
                 {
@@ -1,6 +1,8 @@
 #pragma once
 #include "Graphics/Renderers/IRenderer.h"
+#include "Graphics/Renderers/LightClusterBuilder.h"
 #include "Graphics/Renderable2D.h"
+#include "Graphics/Light.h"
 
 #define MAX_BOUND_TEXTURES 16
 
@@ -12,6 +14,7 @@ namespace Lumos
     class Event;
     struct SceneRenderSettings;
     struct UI_Widget;
+    struct GPUParticleState;
 
     namespace Maths
     {
@@ -29,6 +32,7 @@ namespace Lumos
         class SkyboxRenderer;
         class CommandBuffer;
         class Model;
+        struct AnimationInstance;
         struct Light;
         class VertexBuffer;
         class IndexBuffer;
@@ -64,6 +68,50 @@ namespace Lumos
             uint32_t NumRenderedObjects = 0;
             uint32_t NumShadowObjects   = 0;
             uint32_t NumDrawCalls       = 0;
+
+            // Mesh visibility stage timings in milliseconds
+            float CullTime           = 0.0f; // Parallel AABB transform, frustum tests and per batch command build
+            float CommandMergeTime   = 0.0f; // Serial merge of batch command lists, pipeline lookup and material binds
+            uint32_t NumCullBatches  = 0;
+            uint32_t NumMeshesTested = 0;
+
+            // Forward and shadow mesh draws before and after collapsing runs of the same mesh, material and pipeline
+            uint32_t NumMeshCommands       = 0;
+            uint32_t NumMeshDrawCalls      = 0;
+            uint32_t NumInstancedDrawCalls = 0;
+
+            // Triangles submitted at each mesh LOD, and what LOD 0 everywhere would have cost
+            uint32_t LODTriangles[MESH_LOD_MAX]       = {};
+            uint32_t ShadowLODTriangles[MESH_LOD_MAX] = {};
+            uint32_t FullDetailTriangles              = 0;
+            uint32_t ShadowFullDetailTriangles        = 0;
+
+            // Clustered lighting, build time in milliseconds
+            float ClusterBuildTime       = 0.0f;
+            uint32_t NumClusteredLights  = 0;
+            uint32_t MaxLightsPerCluster = 0;
+
+            // GPU culled meshes and their indirect draws this frame. Visible counts are read back from the last frame
+            // that used this frame's buffers, so they lag by the number of frames in flight.
+            uint32_t NumGPUCullInstances      = 0;
+            uint32_t NumGPUCullUploads        = 0; // Instances rewritten in this frame's resident buffer
+            uint32_t NumGPUIndirectDraws      = 0;
+            uint32_t NumGPUVisibleInstances   = 0;
+            uint32_t NumGPUShadowInstances    = 0;
+            uint32_t NumGPUEmptyIndirectDraws = 0;
+
+            // Forward, shadow and prepass command recording in milliseconds, including the wait for job threads
+            float RecordTime                    = 0.0f;
+            uint32_t NumSecondaryCommandBuffers = 0;
+
+            // Skinned instances drawn from the shared palette buffer and the joints uploaded for them
+            uint32_t NumSkinnedInstances = 0;
+            uint32_t NumPaletteJoints    = 0;
+
+            // GPU simulated emitters this frame. Alive particles are read back from buffers the GPU may still be
+            // writing, so the count can be a frame or two old.
+            uint32_t NumGPUParticleEmitters = 0;
+            uint32_t NumGPUParticles        = 0;
         };
 
         class SceneRenderer
@@ -106,6 +154,7 @@ namespace Lumos
             void ParticleBeginBatch();
             void ParticlePass();
             void ParticleFlush();
+            void GPUParticlePass();
             void DebugPass();
             void DebugLineFlush(Graphics::Pipeline* pipeline);
             void DebugPointFlush(Graphics::Pipeline* pipeline);
@@ -140,6 +189,7 @@ namespace Lumos
             {
                 Renderable2D* renderable = nullptr;
                 Mat4 transform;
+                uint64_t sortKey = 0;
             };
 
             typedef TDArray<RenderCommand2D> CommandQueue2D;
@@ -187,6 +237,19 @@ namespace Lumos
                 SharedPtr<Shader> m_ShaderAnim      = nullptr;
                 SharedPtr<Shader> m_ShaderAnimAlpha = nullptr;
 
+                SharedPtr<Shader> m_ShaderAnimPalette      = nullptr;
+                SharedPtr<Shader> m_ShaderAnimPaletteAlpha = nullptr;
+                SharedPtr<Graphics::DescriptorSet> m_PaletteDescriptorSet;
+
+                SharedPtr<Shader> m_ShaderInstanced      = nullptr;
+                SharedPtr<Shader> m_ShaderInstancedAlpha = nullptr;
+                SharedPtr<Graphics::DescriptorSet> m_InstanceDescriptorSet;
+
+                SharedPtr<Shader> m_ShaderCompact               = nullptr;
+                SharedPtr<Shader> m_ShaderCompactAlpha          = nullptr;
+                SharedPtr<Shader> m_ShaderCompactInstanced      = nullptr;
+                SharedPtr<Shader> m_ShaderCompactInstancedAlpha = nullptr;
+
                 Maths::Frustum m_CascadeFrustums[SHADOWMAP_MAX];
             };
 
@@ -211,6 +274,23 @@ namespace Lumos
                 Texture* m_RenderTexture       = nullptr;
                 TextureDepth* m_DepthTexture   = nullptr;
 
+                SharedPtr<Shader> m_InstancedShader = nullptr;
+                SharedPtr<Graphics::DescriptorSet> m_InstanceDescriptorSet;
+
+                SharedPtr<Shader> m_ClusteredShader          = nullptr;
+                SharedPtr<Shader> m_ClusteredAnimShader      = nullptr;
+                SharedPtr<Shader> m_ClusteredInstancedShader = nullptr;
+                SharedPtr<Graphics::DescriptorSet> m_ClusterDescriptorSet;
+
+                SharedPtr<Shader> m_AnimPaletteShader          = nullptr;
+                SharedPtr<Shader> m_ClusteredAnimPaletteShader = nullptr;
+                SharedPtr<Graphics::DescriptorSet> m_PaletteDescriptorSet;
+
+                SharedPtr<Shader> m_CompactShader                   = nullptr;
+                SharedPtr<Shader> m_CompactClusteredShader          = nullptr;
+                SharedPtr<Shader> m_CompactInstancedShader          = nullptr;
+                SharedPtr<Shader> m_CompactInstancedClusteredShader = nullptr;
+
                 Maths::Frustum m_Frustum;
 
                 uint32_t m_RenderMode      = 0;
@@ -286,6 +366,249 @@ namespace Lumos
             void SetDisablePostProcess(bool disabled) { m_DisablePostProcess = disabled; }
 
         private:
+            // Per job output of the mesh visibility stage. Kept between frames so the arrays stay allocated.
+            struct MeshCullBatch
+            {
+                TDArray<float> CentreX, CentreY, CentreZ;
+                TDArray<float> ExtentX, ExtentY, ExtentZ;
+                TDArray<uint32_t> VisibilityMasks;
+                TDArray<Mesh*> Meshes;
+                TDArray<const Mat4*> Transforms;
+                TDArray<AnimationInstance*> Animations;
+                TDArray<uint8_t*> LODStates; // Into the entity's ModelComponent::MeshLODs
+                TDArray<uint8_t> Variants;   // MeshPipelineVariant bits
+
+                // GPU culled meshes skip the CPU frustum test, they are appended to the arrays above after it
+                TDArray<Mesh*> GPUCulledMeshes;
+                TDArray<const Mat4*> GPUCulledTransforms;
+                TDArray<uint8_t*> GPUCulledLODStates;
+                TDArray<uint8_t> GPUCulledVariants;
+
+                // Commands for meshes visible in at least one frustum, pipeline resolved during the merge
+                TDArray<RenderCommand> Commands;
+                TDArray<uint32_t> CommandMasks;
+                TDArray<AnimationInstance*> CommandAnimations;
+                TDArray<uint8_t> CommandVariants;
+                TDArray<uint32_t> CommandSources; // Mesh index in the arrays above, for the GPU culled bounds
+            };
+
+            void CullAndBuildMeshCommands(Scene* scene, bool cullShadowCascades);
+
+            // Models still streaming in load nearest the camera first
+            void UpdateStreamingPriorities(Scene* scene);
+
+            TDArray<MeshCullBatch> m_MeshCullBatches;
+
+            // A run of sorted commands sharing mesh, material and pipeline. Runs of one command are drawn with the
+            // transform pushed as before, longer runs are one instanced draw reading transforms from InstanceOffset.
+            struct MeshDrawBatch
+            {
+                uint32_t FirstCommand;
+                uint32_t InstanceCount;
+                uint32_t InstanceOffset;
+            };
+
+            void BuildMeshDrawBatches(const CommandQueue& queue, TDArray<MeshDrawBatch>& batches);
+            void UploadInstanceTransforms();
+
+            TDArray<MeshDrawBatch> m_ForwardDrawBatches;
+            TDArray<MeshDrawBatch> m_ShadowDrawBatches[SHADOWMAP_MAX];
+            TDArray<Mat4> m_InstanceTransforms;        // Transforms of every instanced run this frame, forward and shadow
+            TDArray<StorageBuffer*> m_InstanceBuffers; // Per frame in flight, grown when a frame needs more
+            bool m_InstancingSupported = false;
+            bool m_InstancingEnabled   = true;
+
+            // Skinning palettes of every animated instance drawn this frame, read from set 3 by the palette shaders at
+            // each command's boneOffset. The first MAX_BONES entries are identity for models not animated yet.
+            uint32_t AddSkinningPalette(AnimationInstance* animation);
+            void UploadSkinningPalette();
+
+            TDArray<Mat4> m_SkinningPalette;
+            TDArray<StorageBuffer*> m_PaletteBuffers; // Per frame in flight
+            uint64_t m_SkinningPaletteFrame = 0;
+            bool m_SkinningPaletteSupported = false;
+            bool m_SkinningPaletteEnabled   = true;
+            bool m_SkinningPaletteActive    = false;
+
+            // Point and spot lights are bucketed into froxels and read from set 4 by the clustered forward shaders.
+            // Directional lights stay in the scene uniform buffer.
+            struct LightClusterBuffers
+            {
+                StorageBuffer* Lights   = nullptr;
+                StorageBuffer* Clusters = nullptr;
+                StorageBuffer* Indices  = nullptr;
+            };
+
+            void UploadLightClusters();
+
+            LightClusterBuilder m_LightClusters;
+            TDArray<Light> m_ClusteredLights;
+            TDArray<LightClusterBuffers> m_LightClusterBuffers; // Per frame in flight
+            bool m_ClusteredLightingSupported = false;
+            bool m_ClusteredLightingEnabled   = true;
+            bool m_ClusteredLightingActive    = false; // Supported, enabled and used by this frame's pipelines
+
+            // Static depth tested meshes can be left to a compute pass that tests them against every view's frustum,
+            // and the camera against a depth pyramid built from the prepass. Each batch of the same mesh, LOD, material
+            // and pipeline is one indirect draw per view whose instance count and transforms are written by the GPU.
+            struct GPUCullCommand
+            {
+                Mesh* mesh;
+                Material* material;
+                Pipeline* forwardPipeline; // Instanced
+                Pipeline* shadowPipeline;  // Instanced, null when the mesh casts no shadow
+                Mat4 transform;
+                Vec4 centre;
+                Vec4 extent;
+                uint8_t lod;
+                uint8_t shadowLOD;
+                uint64_t sortKey;
+            };
+
+            // Layouts match GPUCull.comp
+            struct GPUCullInstance
+            {
+                Mat4 Transform;
+                Vec4 Centre;
+                Vec4 Extent;
+                uint32_t ForwardBatch;
+                uint32_t ShadowBatch;
+                uint32_t Padding[2];
+            };
+
+            struct GPUCullView
+            {
+                Vec4 Planes[6];
+                Mat4 ViewProj;
+                uint32_t ArgsOffset;
+                uint32_t UseShadowBatch;
+                uint32_t OcclusionTest;
+                uint32_t Padding;
+            };
+
+            // Adjacent sorted commands drawn together, Capacity is the most instances the view can output
+            struct GPUCullBatch
+            {
+                uint32_t FirstCommand;
+                uint32_t Capacity;
+            };
+
+            enum GPUCullViewIndex : uint32_t
+            {
+                GPUCullView_PrePass  = 0,
+                GPUCullView_Forward  = 1,
+                GPUCullView_Cascade0 = 2,
+                GPUCullView_Max      = GPUCullView_Cascade0 + SHADOWMAP_MAX
+            };
+
+            struct GPUCullBuffers
+            {
+                StorageBuffer* Instances  = nullptr;
+                StorageBuffer* Views      = nullptr;
+                StorageBuffer* Arguments  = nullptr;
+                StorageBuffer* Transforms = nullptr;
+
+                // Instances stay resident, only entries changed after this frame of m_GPUCullFrame are rewritten
+                uint64_t InstancesFrame = 0;
+
+                // Argument ranges last written, to read the visible counts back once the GPU is done with them
+                uint32_t ViewArgsOffset[GPUCullView_Max + 1] = {};
+                uint32_t ViewCount                           = 0;
+            };
+
+            void BuildGPUCullBatches();
+            void ReadGPUCullStats(GPUCullBuffers& buffers);
+            void GPUCullPass(bool afterDepthPyramid);
+            void DepthPyramidPass();
+            bool IsGPUCullViewUsed(uint32_t view) const { return view != GPUCullView_PrePass || m_GPUCullPrePass; }
+
+            TDArray<GPUCullCommand> m_GPUCullCommands;
+            TDArray<GPUCullCommand> m_GPUCullCommandsScratch;
+            TDArray<GPUCullBatch> m_GPUCullForwardBatches;
+            TDArray<GPUCullBatch> m_GPUCullShadowBatches;
+            TDArray<GPUCullInstance> m_GPUCullInstances;
+            TDArray<uint64_t> m_GPUCullInstanceFrames; // m_GPUCullFrame each instance last changed
+            uint64_t m_GPUCullFrame = 0;
+            TDArray<GPUCullView> m_GPUCullViews;
+            TDArray<DrawIndexedArguments> m_GPUCullArguments;
+            TDArray<GPUCullBuffers> m_GPUCullBuffers; // Per frame in flight
+            uint32_t m_GPUCullCascadeCount = 0;
+
+            SharedPtr<Graphics::Shader> m_GPUCullShader;
+            SharedPtr<Graphics::Shader> m_DepthPyramidShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassInstancedShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassCompactInstancedShader;
+            SharedPtr<Graphics::DescriptorSet> m_GPUCullDescriptorSet;
+            SharedPtr<Graphics::DescriptorSet> m_GPUCullForwardInstanceSet;
+            SharedPtr<Graphics::DescriptorSet> m_GPUCullShadowInstanceSet;
+            TDArray<SharedPtr<Graphics::DescriptorSet>> m_DepthPyramidDescriptorSets; // One per level
+            Texture2D* m_DepthPyramid = nullptr;
+
+            bool m_GPUCullingSupported = false;
+            bool m_GPUCullingEnabled   = true;
+            bool m_GPUCullingActive    = false; // Supported, enabled and instancing is on this frame
+            bool m_GPUOcclusionEnabled = true;
+            bool m_GPUCullPrePass      = false; // This frame draws the prepass, so view 0 is culled
+            bool m_GPUCullOcclusion    = false; // The forward view waits for the depth pyramid
+
+            // Emitters set to GPU simulation keep their particles in storage buffers. Compute passes spawn into them,
+            // simulate, compact the survivors and optionally sort them, then each emitter is one indirect draw whose
+            // instance count the GPU wrote. Nothing is uploaded per particle.
+            void InitGPUParticleState(GPUParticleState& state, uint32_t capacity);
+
+            SharedPtr<Graphics::Shader> m_GPUParticleSimulateShader;
+            SharedPtr<Graphics::Shader> m_GPUParticleShader;
+            bool m_GPUParticlesSupported         = false;
+            bool m_GPUParticlesEnabled           = true;
+            bool m_GPUParticlesActive            = false; // Supported and enabled this frame
+            float m_GPUParticleCollisionDistance = 0.5f;  // How far behind the depth buffer still counts as a collision
+
+            // Forward, shadow and prepass draws are split into chunks recorded into secondary command buffers on job
+            // threads, then executed in order from the frame's command buffer. Recording only reads pipelines and
+            // descriptor sets, so each pass resolves its pipelines and updates its descriptor sets on the main thread first.
+            struct SecondaryChunk
+            {
+                uint32_t FirstItem;
+                uint32_t ItemCount;
+                Pipeline* FirstPipeline; // Its render pass and framebuffer are the ones the chunk continues
+                CommandBuffer* Secondary;
+                bool BeginsPass;
+            };
+
+            using RecordItemsFunc = void (SceneRenderer::*)(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount);
+
+            // Records itemCount draws, directly into the frame's command buffer when parallel recording is off or
+            // there are too few to split. pipelines holds the pipeline each item binds.
+            void RecordPassItems(Pipeline* const* pipelines, uint32_t itemCount, uint32_t layer, RecordItemsFunc record);
+            void RecordForwardItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount);
+            void RecordShadowItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount);
+            void RecordPrePassItems(CommandBuffer* commandBuffer, uint32_t layer, uint32_t firstItem, uint32_t itemCount);
+
+            // This frame's prepass draws, frame arena allocated. CPU commands come first, then GPU culled batches.
+            const RenderCommand** m_PrePassCommands = nullptr;
+            Pipeline** m_PrePassPipelines           = nullptr;
+            uint32_t m_PrePassCommandCount          = 0;
+
+            bool m_ParallelRecordingSupported = false;
+            bool m_ParallelRecordingEnabled   = true;
+            bool m_ParallelRecordingActive    = false; // Supported, enabled and there are job threads to record on
+            int m_SecondaryChunkSize          = 128;   // Draws per secondary command buffer
+
+            // (key, index) pairs radix sorted each frame, then used to gather the queue into its scratch copy
+            struct SortEntry
+            {
+                uint64_t Key;
+                uint32_t Index;
+            };
+
+            template <typename T>
+            void SortCommandQueue(TDArray<T>& queue, TDArray<T>& scratchQueue);
+
+            TDArray<SortEntry> m_SortEntries;
+            TDArray<SortEntry> m_SortEntriesScratch;
+            CommandQueue m_CommandQueueScratch;
+            CommandQueue2D m_CommandQueue2DScratch;
+
             void InitDebugRenderData();
             bool m_DebugRenderDataInitialised = false;
 
@@ -370,6 +693,11 @@ namespace Lumos
             SharedPtr<Graphics::Shader> m_DepthPrePassAlphaShader;
             SharedPtr<Graphics::Shader> m_DepthPrePassAnimShader;
             SharedPtr<Graphics::Shader> m_DepthPrePassAlphaAnimShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassAnimPaletteShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassAlphaAnimPaletteShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassCompactShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassCompactNormalShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassCompactAlphaShader;
             Texture2D* m_SSAOTexture  = nullptr;
             Texture2D* m_SSAOTexture1 = nullptr;
 
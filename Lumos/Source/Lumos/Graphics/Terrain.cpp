@@ -93,6 +93,7 @@ namespace Lumos
         m_VertexBuffer->SetData(sizeof(Graphics::Vertex) * numVertices, (void*)verts);
 
         m_IndexBuffer = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(indices, indicesCount)); // / sizeof(uint32_t));
+        m_LODs[0]     = { 0, indicesCount, 0.0f };
 
         delete[] normals;
         delete[] tangents;
@@ -4,6 +4,7 @@
 #include "Maths/BoundingSphere.h"
 #include "Maths/Rect.h"
 #include "Maths/Ray.h"
+#include "Maths/MathsUtilities.h"
 
 #ifdef LUMOS_SSE
 #include "Maths/SSEUtilities.h"
@@ -281,6 +282,109 @@ namespace Lumos
             }
         }
 
+        void Frustum::CullPacked(const Frustum* frustums, uint32_t frustumCount, const PackedBoundingBoxes& boxes, uint32_t* outMasks)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            ASSERT(frustumCount <= 32, "Visibility masks only hold 32 frustums");
+
+            uint32_t boxIndex = 0;
+
+#ifdef LUMOS_SSE
+            // Planes are splatted once per call so the inner loop is pure multiply/add on 4 boxes
+            struct PlaneSplat
+            {
+                __m128 NormalX, NormalY, NormalZ, Distance;
+                __m128 AbsNormalX, AbsNormalY, AbsNormalZ;
+            };
+
+            PlaneSplat planes[32 * 6];
+            for(uint32_t f = 0; f < frustumCount; f++)
+            {
+                for(uint32_t p = 0; p < 6; p++)
+                {
+                    const Plane& plane = frustums[f].m_Planes[p];
+                    const Vec3 normal  = plane.Normal();
+                    PlaneSplat& splat  = planes[f * 6 + p];
+                    splat.NormalX      = _mm_set1_ps(normal.x);
+                    splat.NormalY      = _mm_set1_ps(normal.y);
+                    splat.NormalZ      = _mm_set1_ps(normal.z);
+                    splat.Distance     = _mm_set1_ps(plane.Distance());
+                    splat.AbsNormalX   = _mm_set1_ps(Maths::Abs(normal.x));
+                    splat.AbsNormalY   = _mm_set1_ps(Maths::Abs(normal.y));
+                    splat.AbsNormalZ   = _mm_set1_ps(Maths::Abs(normal.z));
+                }
+            }
+
+            const __m128 zero = _mm_setzero_ps();
+
+            for(; boxIndex + 4 <= boxes.Count; boxIndex += 4)
+            {
+                __m128 centreX = _mm_loadu_ps(boxes.CentreX + boxIndex);
+                __m128 centreY = _mm_loadu_ps(boxes.CentreY + boxIndex);
+                __m128 centreZ = _mm_loadu_ps(boxes.CentreZ + boxIndex);
+                __m128 extentX = _mm_loadu_ps(boxes.ExtentX + boxIndex);
+                __m128 extentY = _mm_loadu_ps(boxes.ExtentY + boxIndex);
+                __m128 extentZ = _mm_loadu_ps(boxes.ExtentZ + boxIndex);
+
+                uint32_t laneMasks[4] = { 0, 0, 0, 0 };
+
+                for(uint32_t f = 0; f < frustumCount; f++)
+                {
+                    __m128 inside = _mm_cmpeq_ps(zero, zero);
+
+                    for(uint32_t p = 0; p < 6; p++)
+                    {
+                        const PlaneSplat& splat = planes[f * 6 + p];
+
+                        // Signed distance of the box centre plus the projected radius of the box onto the plane normal
+                        __m128 distance = _mm_add_ps(_mm_mul_ps(splat.NormalX, centreX), _mm_mul_ps(splat.NormalY, centreY));
+                        distance        = _mm_add_ps(distance, _mm_mul_ps(splat.NormalZ, centreZ));
+                        distance        = _mm_add_ps(distance, splat.Distance);
+
+                        __m128 radius = _mm_add_ps(_mm_mul_ps(splat.AbsNormalX, extentX), _mm_mul_ps(splat.AbsNormalY, extentY));
+                        radius        = _mm_add_ps(radius, _mm_mul_ps(splat.AbsNormalZ, extentZ));
+
+                        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+                    }
+
+                    int bits = _mm_movemask_ps(inside);
+                    for(uint32_t lane = 0; lane < 4; lane++)
+                    {
+                        if(bits & (1 << lane))
+                            laneMasks[lane] |= 1u << f;
+                    }
+                }
+
+                outMasks[boxIndex + 0] = laneMasks[0];
+                outMasks[boxIndex + 1] = laneMasks[1];
+                outMasks[boxIndex + 2] = laneMasks[2];
+                outMasks[boxIndex + 3] = laneMasks[3];
+            }
+#endif
+
+            for(; boxIndex < boxes.Count; boxIndex++)
+            {
+                uint32_t mask = 0;
+                for(uint32_t f = 0; f < frustumCount; f++)
+                {
+                    bool inside = true;
+                    for(uint32_t p = 0; p < 6 && inside; p++)
+                    {
+                        const Plane& plane = frustums[f].m_Planes[p];
+                        const Vec3 normal  = plane.Normal();
+
+                        float distance = normal.x * boxes.CentreX[boxIndex] + normal.y * boxes.CentreY[boxIndex] + normal.z * boxes.CentreZ[boxIndex] + plane.Distance();
+                        float radius   = Maths::Abs(normal.x) * boxes.ExtentX[boxIndex] + Maths::Abs(normal.y) * boxes.ExtentY[boxIndex] + Maths::Abs(normal.z) * boxes.ExtentZ[boxIndex];
+                        inside         = distance + radius >= 0.0f;
+                    }
+
+                    if(inside)
+                        mask |= 1u << f;
+                }
+                outMasks[boxIndex] = mask;
+            }
+        }
+
 #ifdef LUMOS_SSE
         // SIMD-optimized frustum culling tests
         // Tests all 6 planes simultaneously using SSE
@@ -21,6 +21,19 @@ namespace Lumos
             PLANE_FAR,
         };
 
+        // Structure of arrays view over world space boxes stored as centre and half extents.
+        // Lets many boxes be tested against several frustums at once.
+        struct PackedBoundingBoxes
+        {
+            const float* CentreX = nullptr;
+            const float* CentreY = nullptr;
+            const float* CentreZ = nullptr;
+            const float* ExtentX = nullptr;
+            const float* ExtentY = nullptr;
+            const float* ExtentZ = nullptr;
+            uint32_t Count       = 0;
+        };
+
         class Frustum
         {
         public:
@@ -48,6 +61,10 @@ namespace Lumos
             bool IsInsideFast(const BoundingBox& box) const;
 #endif
 
+            // Tests every packed box against each frustum. Bit i of outMasks[box] is set when the box
+            // intersects frustums[i]. Four boxes are tested per iteration when SSE is available.
+            static void CullPacked(const Frustum* frustums, uint32_t frustumCount, const PackedBoundingBoxes& boxes, uint32_t* outMasks);
+
             const Plane& GetPlane(FrustumPlane plane) const;
             const Plane& GetPlane(int index) const { return m_Planes[index]; }
             Vec3* GetVerticies();
@@ -37,27 +37,32 @@ namespace Lumos
         {
             LUMOS_PROFILE_FUNCTION_LOW();
             m_WorldMatrix = mat * Mat4::Translation(m_LocalPosition) * Maths::ToMat4(m_LocalOrientation) * Mat4::Scale(m_LocalScale);
+            m_Dirty       = false;
         }
 
         void Transform::SetLocalTransform(const Mat4& localMat)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
             localMat.Decompose(m_LocalPosition, m_LocalOrientation, m_LocalScale);
+            m_Dirty = true;
         }
 
         void Transform::SetLocalPosition(const Vec3& localPos)
         {
             m_LocalPosition = localPos;
+            m_Dirty         = true;
         }
 
         void Transform::SetLocalScale(const Vec3& newScale)
         {
             m_LocalScale = newScale;
+            m_Dirty      = true;
         }
 
         void Transform::SetLocalOrientation(const Quat& quat)
         {
             m_LocalOrientation = quat;
+            m_Dirty            = true;
         }
 
         const Mat4& Transform::GetWorldMatrix()
@@ -45,6 +45,10 @@ namespace Lumos
             const Vec3& GetLocalScale() const;
             const Quat& GetLocalOrientation() const;
 
+            // True when the local transform has changed since the world matrix was last rebuilt
+            bool IsDirty() const { return m_Dirty; }
+            void SetDirty() { m_Dirty = true; }
+
             Vec3 GetUpDirection()
             {
                 Vec3 up = Vec3(0.0f, 1.0f, 0.0f);
@@ -72,6 +76,8 @@ namespace Lumos
             Vec3 m_LocalPosition;
             Vec3 m_LocalScale;
             Quat m_LocalOrientation;
+
+            bool m_Dirty = true;
         };
     }
 }
@@ -0,0 +1,418 @@
+#include "Precompiled.h"
+#include "DynamicAABBTree.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    static Maths::BoundingBox Combine(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+    {
+        Maths::BoundingBox result;
+        result.m_Min = Vec3(Maths::Min(a.m_Min.x, b.m_Min.x), Maths::Min(a.m_Min.y, b.m_Min.y), Maths::Min(a.m_Min.z, b.m_Min.z));
+        result.m_Max = Vec3(Maths::Max(a.m_Max.x, b.m_Max.x), Maths::Max(a.m_Max.y, b.m_Max.y), Maths::Max(a.m_Max.z, b.m_Max.z));
+        return result;
+    }
+
+    static float SurfaceArea(const Maths::BoundingBox& box)
+    {
+        const Vec3 size = box.m_Max - box.m_Min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    static bool Contains(const Maths::BoundingBox& outer, const Maths::BoundingBox& inner)
+    {
+        return outer.m_Min.x <= inner.m_Min.x && outer.m_Min.y <= inner.m_Min.y && outer.m_Min.z <= inner.m_Min.z
+            && inner.m_Max.x <= outer.m_Max.x && inner.m_Max.y <= outer.m_Max.y && inner.m_Max.z <= outer.m_Max.z;
+    }
+
+    static Maths::BoundingBox Fatten(const Maths::BoundingBox& aabb, const Vec3& displacement)
+    {
+        const Vec3 margin(DynamicAABBTree::AABBMargin);
+        Maths::BoundingBox fat;
+        fat.m_Min = aabb.m_Min - margin;
+        fat.m_Max = aabb.m_Max + margin;
+
+        // Extend ahead of the body so it can keep moving for a few steps before it needs reinserting
+        const Vec3 d = displacement * DynamicAABBTree::AABBMultiplier;
+        if(d.x < 0.0f)
+            fat.m_Min.x += d.x;
+        else
+            fat.m_Max.x += d.x;
+        if(d.y < 0.0f)
+            fat.m_Min.y += d.y;
+        else
+            fat.m_Max.y += d.y;
+        if(d.z < 0.0f)
+            fat.m_Min.z += d.z;
+        else
+            fat.m_Max.z += d.z;
+
+        return fat;
+    }
+
+    DynamicAABBTree::DynamicAABBTree()
+    {
+    }
+
+    DynamicAABBTree::~DynamicAABBTree()
+    {
+    }
+
+    void DynamicAABBTree::Clear()
+    {
+        m_Nodes.Clear();
+        m_Root       = NullNode;
+        m_FreeList   = NullNode;
+        m_ProxyCount = 0;
+    }
+
+    int32_t DynamicAABBTree::AllocateNode()
+    {
+        int32_t nodeId;
+        if(m_FreeList != NullNode)
+        {
+            nodeId     = m_FreeList;
+            m_FreeList = m_Nodes[nodeId].Parent;
+        }
+        else
+        {
+            nodeId = (int32_t)m_Nodes.Size();
+            m_Nodes.EmplaceBack();
+        }
+
+        Node& node    = m_Nodes[nodeId];
+        node.Parent   = NullNode;
+        node.Child1   = NullNode;
+        node.Child2   = NullNode;
+        node.Height   = 0;
+        node.UserData = 0;
+        return nodeId;
+    }
+
+    void DynamicAABBTree::FreeNode(int32_t nodeId)
+    {
+        Node& node  = m_Nodes[nodeId];
+        node.Parent = m_FreeList;
+        node.Height = -1;
+        m_FreeList  = nodeId;
+    }
+
+    int32_t DynamicAABBTree::CreateProxy(const Maths::BoundingBox& aabb, uint32_t userData)
+    {
+        const int32_t proxyId = AllocateNode();
+
+        Node& node    = m_Nodes[proxyId];
+        node.Box      = Fatten(aabb, Vec3(0.0f));
+        node.UserData = userData;
+
+        InsertLeaf(proxyId);
+        m_ProxyCount++;
+
+        return proxyId;
+    }
+
+    void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+    {
+        ASSERT(m_Nodes[proxyId].IsLeaf());
+
+        RemoveLeaf(proxyId);
+        FreeNode(proxyId);
+        m_ProxyCount--;
+    }
+
+    bool DynamicAABBTree::MoveProxy(int32_t proxyId, const Maths::BoundingBox& aabb, const Vec3& displacement)
+    {
+        ASSERT(m_Nodes[proxyId].IsLeaf());
+
+        const Maths::BoundingBox& fat = m_Nodes[proxyId].Box;
+        if(Contains(fat, aabb))
+        {
+            // Still inside, unless the fat bounds were grown for a fast move and are now far too large
+            const Vec3 hugeMargin(AABBMargin * AABBMultiplier);
+            Maths::BoundingBox huge;
+            huge.m_Min = aabb.m_Min - hugeMargin;
+            huge.m_Max = aabb.m_Max + hugeMargin;
+            if(Contains(huge, fat))
+                return false;
+        }
+
+        RemoveLeaf(proxyId);
+        m_Nodes[proxyId].Box = Fatten(aabb, displacement);
+        InsertLeaf(proxyId);
+
+        return true;
+    }
+
+    void DynamicAABBTree::InsertLeaf(int32_t leaf)
+    {
+        if(m_Root == NullNode)
+        {
+            m_Root               = leaf;
+            m_Nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // Find the best sibling by walking down the cheaper side, using surface area as the cost
+        const Maths::BoundingBox leafBox = m_Nodes[leaf].Box;
+        int32_t index                    = m_Root;
+        while(!m_Nodes[index].IsLeaf())
+        {
+            const Node& node     = m_Nodes[index];
+            const int32_t child1 = node.Child1;
+            const int32_t child2 = node.Child2;
+
+            const float area         = SurfaceArea(node.Box);
+            const float combinedArea = SurfaceArea(Combine(node.Box, leafBox));
+
+            // Cost of creating a new parent for this node and the new leaf
+            const float cost = 2.0f * combinedArea;
+
+            // Minimum cost of pushing the leaf further down the tree
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](int32_t child)
+            {
+                const Node& childNode = m_Nodes[child];
+                const float newArea   = SurfaceArea(Combine(leafBox, childNode.Box));
+                if(childNode.IsLeaf())
+                    return newArea + inheritanceCost;
+                return (newArea - SurfaceArea(childNode.Box)) + inheritanceCost;
+            };
+
+            const float cost1 = descendCost(child1);
+            const float cost2 = descendCost(child2);
+
+            if(cost < cost1 && cost < cost2)
+                break;
+
+            index = cost1 < cost2 ? child1 : child2;
+        }
+
+        const int32_t sibling   = index;
+        const int32_t newParent = AllocateNode();
+        const int32_t oldParent = m_Nodes[sibling].Parent;
+
+        Node& parentNode  = m_Nodes[newParent];
+        parentNode.Parent = oldParent;
+        parentNode.Box    = Combine(leafBox, m_Nodes[sibling].Box);
+        parentNode.Height = m_Nodes[sibling].Height + 1;
+        parentNode.Child1 = sibling;
+        parentNode.Child2 = leaf;
+
+        if(oldParent != NullNode)
+        {
+            if(m_Nodes[oldParent].Child1 == sibling)
+                m_Nodes[oldParent].Child1 = newParent;
+            else
+                m_Nodes[oldParent].Child2 = newParent;
+        }
+        else
+        {
+            m_Root = newParent;
+        }
+
+        m_Nodes[sibling].Parent = newParent;
+        m_Nodes[leaf].Parent    = newParent;
+
+        // Refit and rebalance back up to the root
+        index = newParent;
+        while(index != NullNode)
+        {
+            index = Balance(index);
+
+            Node& node  = m_Nodes[index];
+            node.Height = 1 + Maths::Max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+            node.Box    = Combine(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+
+            index = node.Parent;
+        }
+    }
+
+    void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+    {
+        if(leaf == m_Root)
+        {
+            m_Root = NullNode;
+            return;
+        }
+
+        const int32_t parent      = m_Nodes[leaf].Parent;
+        const int32_t grandParent = m_Nodes[parent].Parent;
+        const int32_t sibling     = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+        if(grandParent == NullNode)
+        {
+            m_Root                  = sibling;
+            m_Nodes[sibling].Parent = NullNode;
+            FreeNode(parent);
+            return;
+        }
+
+        // Replace the parent with the sibling and refit the ancestors
+        if(m_Nodes[grandParent].Child1 == parent)
+            m_Nodes[grandParent].Child1 = sibling;
+        else
+            m_Nodes[grandParent].Child2 = sibling;
+
+        m_Nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        int32_t index = grandParent;
+        while(index != NullNode)
+        {
+            index = Balance(index);
+
+            Node& node  = m_Nodes[index];
+            node.Box    = Combine(m_Nodes[node.Child1].Box, m_Nodes[node.Child2].Box);
+            node.Height = 1 + Maths::Max(m_Nodes[node.Child1].Height, m_Nodes[node.Child2].Height);
+
+            index = node.Parent;
+        }
+    }
+
+    // Rotates the taller grandchild up if the subtree at iA is out of balance. Returns the new subtree root.
+    int32_t DynamicAABBTree::Balance(int32_t iA)
+    {
+        Node& A = m_Nodes[iA];
+        if(A.IsLeaf() || A.Height < 2)
+            return iA;
+
+        const int32_t iB = A.Child1;
+        const int32_t iC = A.Child2;
+        Node& B          = m_Nodes[iB];
+        Node& C          = m_Nodes[iC];
+
+        const int32_t balance = C.Height - B.Height;
+
+        // Rotate C up
+        if(balance > 1)
+        {
+            const int32_t iF = C.Child1;
+            const int32_t iG = C.Child2;
+            Node& F          = m_Nodes[iF];
+            Node& G          = m_Nodes[iG];
+
+            C.Child1 = iA;
+            C.Parent = A.Parent;
+            A.Parent = iC;
+
+            if(C.Parent != NullNode)
+            {
+                if(m_Nodes[C.Parent].Child1 == iA)
+                    m_Nodes[C.Parent].Child1 = iC;
+                else
+                    m_Nodes[C.Parent].Child2 = iC;
+            }
+            else
+            {
+                m_Root = iC;
+            }
+
+            if(F.Height > G.Height)
+            {
+                C.Child2 = iF;
+                A.Child2 = iG;
+                G.Parent = iA;
+                A.Box    = Combine(B.Box, G.Box);
+                C.Box    = Combine(A.Box, F.Box);
+                A.Height = 1 + Maths::Max(B.Height, G.Height);
+                C.Height = 1 + Maths::Max(A.Height, F.Height);
+            }
+            else
+            {
+                C.Child2 = iG;
+                A.Child2 = iF;
+                F.Parent = iA;
+                A.Box    = Combine(B.Box, F.Box);
+                C.Box    = Combine(A.Box, G.Box);
+                A.Height = 1 + Maths::Max(B.Height, F.Height);
+                C.Height = 1 + Maths::Max(A.Height, G.Height);
+            }
+
+            return iC;
+        }
+
+        // Rotate B up
+        if(balance < -1)
+        {
+            const int32_t iD = B.Child1;
+            const int32_t iE = B.Child2;
+            Node& D          = m_Nodes[iD];
+            Node& E          = m_Nodes[iE];
+
+            B.Child1 = iA;
+            B.Parent = A.Parent;
+            A.Parent = iB;
+
+            if(B.Parent != NullNode)
+            {
+                if(m_Nodes[B.Parent].Child1 == iA)
+                    m_Nodes[B.Parent].Child1 = iB;
+                else
+                    m_Nodes[B.Parent].Child2 = iB;
+            }
+            else
+            {
+                m_Root = iB;
+            }
+
+            if(D.Height > E.Height)
+            {
+                B.Child2 = iD;
+                A.Child1 = iE;
+                E.Parent = iA;
+                A.Box    = Combine(C.Box, E.Box);
+                B.Box    = Combine(A.Box, D.Box);
+                A.Height = 1 + Maths::Max(C.Height, E.Height);
+                B.Height = 1 + Maths::Max(A.Height, D.Height);
+            }
+            else
+            {
+                B.Child2 = iE;
+                A.Child1 = iD;
+                D.Parent = iA;
+                A.Box    = Combine(C.Box, D.Box);
+                B.Box    = Combine(A.Box, E.Box);
+                A.Height = 1 + Maths::Max(C.Height, D.Height);
+                B.Height = 1 + Maths::Max(A.Height, E.Height);
+            }
+
+            return iB;
+        }
+
+        return iA;
+    }
+
+    bool DynamicAABBTree::RayHitsBox(const Vec3& origin, const Vec3& direction, const Maths::BoundingBox& box, float radius, float maxDistance)
+    {
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+
+        for(int axis = 0; axis < 3; axis++)
+        {
+            const float o     = origin[axis];
+            const float d     = direction[axis];
+            const float lower = box.m_Min[axis] - radius;
+            const float upper = box.m_Max[axis] + radius;
+
+            if(Maths::Abs(d) < Maths::M_EPSILON)
+            {
+                if(o < lower || o > upper)
+                    return false;
+                continue;
+            }
+
+            const float invD = 1.0f / d;
+            float t1         = (lower - o) * invD;
+            float t2         = (upper - o) * invD;
+            if(t1 > t2)
+                Swap(t1, t2);
+
+            tMin = Maths::Max(tMin, t1);
+            tMax = Maths::Min(tMax, t2);
+            if(tMin > tMax)
+                return false;
+        }
+
+        return true;
+    }
+}
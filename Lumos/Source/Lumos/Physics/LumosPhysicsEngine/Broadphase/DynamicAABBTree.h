@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Maths/BoundingBox.h"
+#include "Maths/Vector3.h"
+#include "Core/DataStructures/TDArray.h"
+
+namespace Lumos
+{
+    // Bounding volume hierarchy over fattened AABBs, in the style of the Box2D / Bullet dynamic tree.
+    // A proxy is only reinserted once its tight bounds leave its fat bounds, and every insert or remove
+    // rebalances the path back to the root with AVL style rotations.
+    class LUMOS_EXPORT DynamicAABBTree
+    {
+    public:
+        static constexpr int32_t NullNode = -1;
+
+        // Fixed margin added around every proxy and how far ahead along its displacement the fat bounds reach
+        static constexpr float AABBMargin     = 0.1f;
+        static constexpr float AABBMultiplier = 4.0f;
+
+        DynamicAABBTree();
+        ~DynamicAABBTree();
+
+        int32_t CreateProxy(const Maths::BoundingBox& aabb, uint32_t userData);
+        void DestroyProxy(int32_t proxyId);
+
+        // Returns true if the proxy had to be reinserted
+        bool MoveProxy(int32_t proxyId, const Maths::BoundingBox& aabb, const Vec3& displacement);
+
+        void Clear();
+
+        uint32_t GetUserData(int32_t proxyId) const { return m_Nodes[proxyId].UserData; }
+        const Maths::BoundingBox& GetFatAABB(int32_t proxyId) const { return m_Nodes[proxyId].Box; }
+
+        int32_t GetHeight() const { return m_Root == NullNode ? 0 : m_Nodes[m_Root].Height; }
+        uint32_t GetProxyCount() const { return m_ProxyCount; }
+
+        // callback(proxyId) is called for every proxy whose fat bounds overlap aabb. Return false to stop the query.
+        template <typename Callback>
+        void Query(const Maths::BoundingBox& aabb, Callback callback) const;
+
+        // Visits proxies whose fat bounds, grown by radius, are hit by the ray within maxDistance. direction must be normalised.
+        // callback(proxyId, maxDistance) returns the distance to continue with. Returning a closer hit clips the ray, 0 stops.
+        template <typename Callback>
+        void Raycast(const Vec3& origin, const Vec3& direction, float maxDistance, float radius, Callback callback) const;
+
+        // callback(const Maths::BoundingBox& box, bool isLeaf)
+        template <typename Callback>
+        void ForEachNode(Callback callback) const;
+
+    private:
+        struct Node
+        {
+            Maths::BoundingBox Box;
+            int32_t Parent; // Next free node while on the free list
+            int32_t Child1;
+            int32_t Child2;
+            int32_t Height; // 0 for leaves, -1 while free
+            uint32_t UserData;
+
+            bool IsLeaf() const { return Child1 == NullNode; }
+        };
+
+        static constexpr uint32_t MaxStackSize = 256;
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t nodeId);
+
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        int32_t Balance(int32_t nodeId);
+
+        static bool Overlaps(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+        {
+            return !(a.m_Max.x < b.m_Min.x || a.m_Min.x > b.m_Max.x || a.m_Max.y < b.m_Min.y || a.m_Min.y > b.m_Max.y || a.m_Max.z < b.m_Min.z || a.m_Min.z > b.m_Max.z);
+        }
+
+        static bool RayHitsBox(const Vec3& origin, const Vec3& direction, const Maths::BoundingBox& box, float radius, float maxDistance);
+
+        TDArray<Node> m_Nodes;
+        int32_t m_Root        = NullNode;
+        int32_t m_FreeList    = NullNode;
+        uint32_t m_ProxyCount = 0;
+    };
+
+    template <typename Callback>
+    void DynamicAABBTree::Query(const Maths::BoundingBox& aabb, Callback callback) const
+    {
+        if(m_Root == NullNode)
+            return;
+
+        int32_t stack[MaxStackSize];
+        uint32_t stackSize = 0;
+        stack[stackSize++] = m_Root;
+
+        while(stackSize > 0)
+        {
+            const int32_t nodeId = stack[--stackSize];
+            const Node& node     = m_Nodes[nodeId];
+
+            if(!Overlaps(node.Box, aabb))
+                continue;
+
+            if(node.IsLeaf())
+            {
+                if(!callback(nodeId))
+                    return;
+            }
+            else
+            {
+                ASSERT(stackSize + 2 <= MaxStackSize);
+                stack[stackSize++] = node.Child1;
+                stack[stackSize++] = node.Child2;
+            }
+        }
+    }
+
+    template <typename Callback>
+    void DynamicAABBTree::Raycast(const Vec3& origin, const Vec3& direction, float maxDistance, float radius, Callback callback) const
+    {
+        if(m_Root == NullNode)
+            return;
+
+        int32_t stack[MaxStackSize];
+        uint32_t stackSize = 0;
+        stack[stackSize++] = m_Root;
+
+        while(stackSize > 0)
+        {
+            const int32_t nodeId = stack[--stackSize];
+            const Node& node     = m_Nodes[nodeId];
+
+            if(!RayHitsBox(origin, direction, node.Box, radius, maxDistance))
+                continue;
+
+            if(node.IsLeaf())
+            {
+                const float distance = callback(nodeId, maxDistance);
+                if(distance <= 0.0f)
+                    return;
+
+                maxDistance = distance;
+            }
+            else
+            {
+                ASSERT(stackSize + 2 <= MaxStackSize);
+                stack[stackSize++] = node.Child1;
+                stack[stackSize++] = node.Child2;
+            }
+        }
+    }
+
+    template <typename Callback>
+    void DynamicAABBTree::ForEachNode(Callback callback) const
+    {
+        if(m_Root == NullNode)
+            return;
+
+        int32_t stack[MaxStackSize];
+        uint32_t stackSize = 0;
+        stack[stackSize++] = m_Root;
+
+        while(stackSize > 0)
+        {
+            const Node& node = m_Nodes[stack[--stackSize]];
+            callback(node.Box, node.IsLeaf());
+
+            if(!node.IsLeaf())
+            {
+                stack[stackSize++] = node.Child1;
+                stack[stackSize++] = node.Child2;
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include "Precompiled.h"
+#include "DynamicTreeBroadphase.h"
+#include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
+#include "Graphics/Renderers/DebugRenderer.h"
+
+namespace Lumos
+{
+    DynamicTreeBroadphase::DynamicTreeBroadphase()
+        : Broadphase()
+    {
+    }
+
+    DynamicTreeBroadphase::~DynamicTreeBroadphase()
+    {
+    }
+
+    void DynamicTreeBroadphase::UpdateProxies(RigidBody3D* rootObject, uint32_t totalRigidBodyCount)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        // Body storage moved or shrank, the existing proxies no longer map to the same bodies
+        if(rootObject != m_RootObject || totalRigidBodyCount < m_ProxyIds.Size())
+        {
+            m_Tree.Clear();
+            m_ProxyIds.Clear();
+            m_RootObject = rootObject;
+        }
+
+        while(m_ProxyIds.Size() < totalRigidBodyCount)
+            m_ProxyIds.PushBack(DynamicAABBTree::NullNode);
+
+        const float dt = LumosPhysicsEngine::GetDeltaTime();
+
+        for(uint32_t i = 0; i < totalRigidBodyCount; i++)
+        {
+            RigidBody3D& body = rootObject[i];
+            int32_t& proxyId  = m_ProxyIds[i];
+
+            if(!body.GetIsValid() || !body.GetCollisionShape())
+            {
+                if(proxyId != DynamicAABBTree::NullNode)
+                {
+                    m_Tree.DestroyProxy(proxyId);
+                    proxyId = DynamicAABBTree::NullNode;
+                }
+                continue;
+            }
+
+            // Refresh the cached world transform and bounds here so queries can read them from other threads afterwards
+            body.GetWorldSpaceTransform();
+            const Maths::BoundingBox& aabb = body.GetWorldSpaceAABB();
+
+            if(proxyId == DynamicAABBTree::NullNode)
+                proxyId = m_Tree.CreateProxy(aabb, i);
+            else
+                m_Tree.MoveProxy(proxyId, aabb, body.GetLinearVelocity() * dt);
+        }
+    }
+
+    void DynamicTreeBroadphase::FindPotentialCollisionPairs(RigidBody3D* rootObject,
+                                                            TDArray<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        UpdateProxies(rootObject, totalRigidBodyCount);
+
+        // Static bodies never query, they are found by the dynamic bodies overlapping them.
+        // Dynamic pairs are found from both sides, so only the lower index keeps them.
+        for(uint32_t i = 0; i < totalRigidBodyCount; i++)
+        {
+            if(m_ProxyIds[i] == DynamicAABBTree::NullNode)
+                continue;
+
+            RigidBody3D& obj1 = rootObject[i];
+            if(obj1.GetIsStatic())
+                continue;
+
+            const Maths::BoundingBox& aabb = obj1.GetWorldSpaceAABB();
+
+            m_Tree.Query(aabb, [&](int32_t proxyId)
+                         {
+                             const uint32_t otherIndex = m_Tree.GetUserData(proxyId);
+                             if(otherIndex == i)
+                                 return true;
+
+                             RigidBody3D& obj2 = rootObject[otherIndex];
+                             if(!obj2.GetIsStatic() && otherIndex < i)
+                                 return true;
+
+                             // Skip pairs of two non-static objects that are both at rest
+                             // (Don't skip static-dynamic pairs even if dynamic object is at rest,
+                             // because another dynamic object could push the at-rest object into the static one)
+                             if(obj1.GetIsAtRest() && obj2.GetIsAtRest() && !obj2.GetIsStatic())
+                                 return true;
+
+                             // Skip pairs filtered out by collision layers
+                             if(!obj1.CanCollideWith(&obj2))
+                                 return true;
+
+                             // The tree holds fat bounds, check the tight ones before handing the pair on
+                             if(!aabb.IsInsideFast(obj2.GetWorldSpaceAABB()))
+                                 return true;
+
+                             CollisionPair pair;
+                             if(&obj1 < &obj2)
+                             {
+                                 pair.pObjectA = &obj1;
+                                 pair.pObjectB = &obj2;
+                             }
+                             else
+                             {
+                                 pair.pObjectA = &obj2;
+                                 pair.pObjectB = &obj1;
+                             }
+
+                             collisionPairs.EmplaceBack(pair);
+                             return true; });
+        }
+    }
+
+    void DynamicTreeBroadphase::DebugDraw()
+    {
+        m_Tree.ForEachNode([](const Maths::BoundingBox& box, bool isLeaf)
+                           { DebugRenderer::DebugDraw(box, isLeaf ? Vec4(0.2f, 0.8f, 0.4f, 1.0f) : Vec4(0.8f, 0.2f, 0.4f, 1.0f), false, true, 0.1f); });
+    }
+}
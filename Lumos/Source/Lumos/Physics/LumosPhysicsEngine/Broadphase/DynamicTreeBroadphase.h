@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Broadphase.h"
+#include "DynamicAABBTree.h"
+
+namespace Lumos
+{
+    // Broadphase backed by a persistent DynamicAABBTree. Bodies keep their proxy between steps and are only
+    // reinserted when they leave their fat bounds. The same tree answers scene queries in LumosPhysicsEngine.
+    class LUMOS_EXPORT DynamicTreeBroadphase : public Broadphase
+    {
+    public:
+        DynamicTreeBroadphase();
+        virtual ~DynamicTreeBroadphase();
+
+        void FindPotentialCollisionPairs(RigidBody3D* rootObject, TDArray<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount) override;
+        void DebugDraw() override;
+
+        // Creates, moves and destroys proxies so the tree matches the current bodies. Proxy user data is the body index.
+        void UpdateProxies(RigidBody3D* rootObject, uint32_t totalRigidBodyCount);
+
+        const DynamicAABBTree& GetTree() const { return m_Tree; }
+
+    private:
+        DynamicAABBTree m_Tree;
+        TDArray<int32_t> m_ProxyIds;
+        RigidBody3D* m_RootObject = nullptr;
+    };
+}
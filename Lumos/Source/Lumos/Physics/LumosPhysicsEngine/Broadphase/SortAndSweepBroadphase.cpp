@@ -0,0 +1,254 @@
+#include "Precompiled.h"
+#include "SortAndSweepBroadphase.h"
+#include "Graphics/Renderers/DebugRenderer.h"
+#include "Core/Algorithms/Sort.h"
+#include "Maths/BoundingBox.h"
+
+#include <float.h>
+
+namespace Lumos
+{
+    static bool EndpointLess(const float valueA, const uint32_t dataA, const float valueB, const uint32_t dataB)
+    {
+        // Min endpoints sort before max endpoints at the same value so touching boxes still overlap
+        return valueA < valueB || (valueA == valueB && (dataA & 1) < (dataB & 1));
+    }
+
+    SortAndSweepBroadphase::SortAndSweepBroadphase()
+        : Broadphase()
+    {
+    }
+
+    SortAndSweepBroadphase::~SortAndSweepBroadphase()
+    {
+    }
+
+    void SortAndSweepBroadphase::FindPotentialCollisionPairs(RigidBody3D* rootObject,
+                                                             TDArray<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        // Body storage moved or shrank, the existing endpoints no longer map to the same bodies
+        if(rootObject != m_RootObject || totalRigidBodyCount < m_BodyCount)
+        {
+            m_RootObject = rootObject;
+            m_BodyCount  = 0;
+            m_Proxies.Clear();
+            m_Endpoints.Clear();
+        }
+
+        // New bodies are appended, the sort below moves them into place
+        if(totalRigidBodyCount > m_BodyCount)
+        {
+            m_Proxies.Resize(totalRigidBodyCount);
+            m_Endpoints.Reserve(totalRigidBodyCount * 2);
+            for(uint32_t i = m_BodyCount; i < totalRigidBodyCount; i++)
+            {
+                m_Endpoints.PushBack({ FLT_MAX, i << 1 });
+                m_Endpoints.PushBack({ FLT_MAX, (i << 1) | 1 });
+            }
+            m_BodyCount = totalRigidBodyCount;
+        }
+
+        if(m_BodyCount == 0)
+            return;
+
+        UpdateProxies(rootObject, totalRigidBodyCount);
+
+        // Only the sweep axis is kept sorted. When it changes the list is in the old axis' order, the
+        // insertion sort runs out of budget and falls back to a full sort for that one step
+        {
+            LUMOS_PROFILE_SCOPE("Sort Endpoints");
+            for(Endpoint& endpoint : m_Endpoints)
+            {
+                const Proxy& proxy = m_Proxies[endpoint.Data >> 1];
+                endpoint.Value     = (endpoint.Data & 1) ? proxy.Max[m_SweepAxis] : proxy.Min[m_SweepAxis];
+            }
+
+            SortEndpoints(m_Endpoints);
+        }
+
+        {
+            LUMOS_PROFILE_SCOPE("Sweep");
+            const uint32_t axisB = (m_SweepAxis + 1) % 3;
+            const uint32_t axisC = (m_SweepAxis + 2) % 3;
+
+            m_Active.Clear();
+            for(const Endpoint& endpoint : m_Endpoints)
+            {
+                const uint32_t index = endpoint.Data >> 1;
+                Proxy& proxy         = m_Proxies[index];
+                if(!proxy.Valid)
+                    continue;
+
+                if(endpoint.Data & 1)
+                {
+                    // Leaving the interval, swap remove from the active list
+                    const ActiveEntry& last          = m_Active.Back();
+                    m_Proxies[last.Index].ActiveSlot = proxy.ActiveSlot;
+                    m_Active[proxy.ActiveSlot]       = last;
+                    m_Active.PopBack();
+                    continue;
+                }
+
+                RigidBody3D& obj1 = rootObject[index];
+
+                // Everything in the active list already overlaps this body on the sweep axis
+                const float minB = proxy.Min[axisB];
+                const float maxB = proxy.Max[axisB];
+                const float minC = proxy.Min[axisC];
+                const float maxC = proxy.Max[axisC];
+
+                for(const ActiveEntry& other : m_Active)
+                {
+                    // Non short circuit, most entries are rejected and a single branch predicts far better than four
+                    if((other.MaxB < minB) | (other.MinB > maxB) | (other.MaxC < minC) | (other.MinC > maxC))
+                        continue;
+
+                    RigidBody3D& obj2 = rootObject[other.Index];
+
+                    // Skip pairs of two static objects
+                    if(obj1.GetIsStatic() && obj2.GetIsStatic())
+                        continue;
+
+                    // Skip pairs of two non-static objects that are both at rest
+                    // (Don't skip static-dynamic pairs even if dynamic object is at rest,
+                    // because another dynamic object could push the at-rest object into the static one)
+                    if(obj1.GetIsAtRest() && obj2.GetIsAtRest() && !obj1.GetIsStatic() && !obj2.GetIsStatic())
+                        continue;
+
+                    // Skip pairs filtered out by collision layers
+                    if(!obj1.CanCollideWith(&obj2))
+                        continue;
+
+                    // Each pair is only found once, when the second body enters the sweep, so no duplicate check is needed
+                    CollisionPair pair;
+                    if(&obj1 < &obj2)
+                    {
+                        pair.pObjectA = &obj1;
+                        pair.pObjectB = &obj2;
+                    }
+                    else
+                    {
+                        pair.pObjectA = &obj2;
+                        pair.pObjectB = &obj1;
+                    }
+
+                    collisionPairs.EmplaceBack(pair);
+                }
+
+                proxy.ActiveSlot = (uint32_t)m_Active.Size();
+                m_Active.PushBack({ index, minB, maxB, minC, maxC });
+            }
+        }
+    }
+
+    void SortAndSweepBroadphase::UpdateProxies(RigidBody3D* rootObject, uint32_t totalRigidBodyCount)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        float sum[3]   = { 0.0f, 0.0f, 0.0f };
+        float sumSq[3] = { 0.0f, 0.0f, 0.0f };
+        uint32_t valid = 0;
+
+        for(uint32_t i = 0; i < totalRigidBodyCount; i++)
+        {
+            RigidBody3D& body = rootObject[i];
+            Proxy& proxy      = m_Proxies[i];
+
+            proxy.Valid = body.GetIsValid() && body.GetCollisionShape();
+            if(!proxy.Valid)
+            {
+                // Parked at the end of every axis so they stay out of the way of the sweep
+                for(uint32_t axis = 0; axis < 3; axis++)
+                {
+                    proxy.Min[axis] = FLT_MAX;
+                    proxy.Max[axis] = FLT_MAX;
+                }
+                continue;
+            }
+
+            const Maths::BoundingBox& aabb = body.GetWorldSpaceAABB();
+            proxy.Min[0]                   = aabb.m_Min.x;
+            proxy.Min[1]                   = aabb.m_Min.y;
+            proxy.Min[2]                   = aabb.m_Min.z;
+            proxy.Max[0]                   = aabb.m_Max.x;
+            proxy.Max[1]                   = aabb.m_Max.y;
+            proxy.Max[2]                   = aabb.m_Max.z;
+
+            for(uint32_t axis = 0; axis < 3; axis++)
+            {
+                const float centre = (proxy.Min[axis] + proxy.Max[axis]) * 0.5f;
+                sum[axis] += centre;
+                sumSq[axis] += centre * centre;
+            }
+            valid++;
+        }
+
+        if(valid == 0)
+            return;
+
+        // Sweep along the axis the bodies are most spread out on, it leaves the fewest overlaps to test.
+        // Changing axis costs a full sort, so another axis has to be clearly better before switching
+        float variance[3];
+        for(uint32_t axis = 0; axis < 3; axis++)
+        {
+            const float mean = sum[axis] / (float)valid;
+            variance[axis]   = sumSq[axis] / (float)valid - mean * mean;
+        }
+
+        uint32_t bestAxis = m_SweepAxis;
+        for(uint32_t axis = 0; axis < 3; axis++)
+        {
+            if(variance[axis] > variance[bestAxis])
+                bestAxis = axis;
+        }
+
+        if(variance[bestAxis] > variance[m_SweepAxis] * 1.25f)
+            m_SweepAxis = bestAxis;
+    }
+
+    void SortAndSweepBroadphase::SortEndpoints(TDArray<Endpoint>& endpoints)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        Endpoint* data     = endpoints.Data();
+        const size_t count = endpoints.Size();
+
+        // Insertion sort is close to linear on last step's order. If bodies were added or teleported and
+        // it ends up doing far more work than that, finish with a full sort instead.
+        size_t budget = count * 8 + 64;
+        for(size_t i = 1; i < count; i++)
+        {
+            const Endpoint value = data[i];
+            size_t hole          = i;
+            while(hole > 0 && EndpointLess(value.Value, value.Data, data[hole - 1].Value, data[hole - 1].Data))
+            {
+                data[hole] = data[hole - 1];
+                --hole;
+
+                if(--budget == 0)
+                {
+                    data[hole] = value;
+                    Algorithms::IntroSort(data, data + count, [](const Endpoint& a, const Endpoint& b)
+                                          { return EndpointLess(a.Value, a.Data, b.Value, b.Data); });
+                    return;
+                }
+            }
+            data[hole] = value;
+        }
+    }
+
+    void SortAndSweepBroadphase::DebugDraw()
+    {
+        for(uint32_t i = 0; i < m_BodyCount; i++)
+        {
+            const Proxy& proxy = m_Proxies[i];
+            if(!proxy.Valid)
+                continue;
+
+            Maths::BoundingBox box(Vec3(proxy.Min[0], proxy.Min[1], proxy.Min[2]), Vec3(proxy.Max[0], proxy.Max[1], proxy.Max[2]));
+            DebugRenderer::DebugDraw(box, Vec4(0.2f, 0.8f, 0.4f, 1.0f), false, true, 0.1f);
+        }
+    }
+}
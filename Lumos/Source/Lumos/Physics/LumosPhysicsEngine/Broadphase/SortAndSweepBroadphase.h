@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Broadphase.h"
+
+namespace Lumos
+{
+    // Incremental sort and sweep. The endpoint list for the sweep axis persists between steps and is
+    // re-sorted with insertion sort, which is close to linear as bodies only move a little per step.
+    // The sweep runs along the axis with the largest spread and the other two axes are tested directly.
+    class LUMOS_EXPORT SortAndSweepBroadphase : public Broadphase
+    {
+    public:
+        SortAndSweepBroadphase();
+        virtual ~SortAndSweepBroadphase();
+
+        void FindPotentialCollisionPairs(RigidBody3D* rootObject, TDArray<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount) override;
+        void DebugDraw() override;
+
+        uint32_t GetSweepAxis() const { return m_SweepAxis; }
+
+    private:
+        struct Endpoint
+        {
+            float Value;
+            uint32_t Data; // Body index << 1, low bit set for a max endpoint
+        };
+
+        struct Proxy
+        {
+            float Min[3];
+            float Max[3];
+            uint32_t ActiveSlot;
+            bool Valid;
+        };
+
+        // Bounds on the two non sweep axes are copied in so the overlap test scans memory linearly
+        struct ActiveEntry
+        {
+            uint32_t Index;
+            float MinB, MaxB;
+            float MinC, MaxC;
+        };
+
+        void UpdateProxies(RigidBody3D* rootObject, uint32_t totalRigidBodyCount);
+        void SortEndpoints(TDArray<Endpoint>& endpoints);
+
+        RigidBody3D* m_RootObject = nullptr;
+        uint32_t m_BodyCount      = 0;
+        uint32_t m_SweepAxis      = 0;
+
+        TDArray<Proxy> m_Proxies;
+        TDArray<Endpoint> m_Endpoints; // Along m_SweepAxis
+        TDArray<ActiveEntry> m_Active;
+    };
+}
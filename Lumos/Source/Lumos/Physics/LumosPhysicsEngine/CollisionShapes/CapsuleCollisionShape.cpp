@@ -42,16 +42,14 @@ namespace Lumos
         return inertia;
     }
 
-    TDArray<Vec3>& CapsuleCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void CapsuleCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const
     {
         /* There is infinite edges so handle seperately */
-        return m_Axes;
     }
 
-    TDArray<CollisionEdge>& CapsuleCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void CapsuleCollisionShape::GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const
     {
         /* There is infinite edges on a sphere so handle seperately */
-        return m_Edges;
     }
 
     void CapsuleCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
@@ -90,6 +88,82 @@ namespace Lumos
         refPolygon.Normal = axis;
     }
 
+    bool CapsuleCollisionShape::Raycast(const RigidBody3D* currentObject, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const Mat4 transform = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+
+        // Segment between the two cap centres, inflated by the sweep radius
+        const Vec3 top       = Vec3(transform * Vec4(0.0f, m_Height * 0.5f, 0.0f, 1.0f));
+        const Vec3 bottom    = Vec3(transform * Vec4(0.0f, -m_Height * 0.5f, 0.0f, 1.0f));
+        const Vec3 axis      = bottom - top;
+        const float axisSq   = Maths::Dot(axis, axis);
+        const float capsuleR = m_Radius + radius;
+
+        auto closestOnAxis = [&](const Vec3& point)
+        {
+            if(axisSq < Maths::M_EPSILON)
+                return top;
+            const float s = Maths::Clamp(Maths::Dot(point - top, axis) / axisSq, 0.0f, 1.0f);
+            return top + axis * s;
+        };
+
+        const Vec3 startOffset = origin - closestOnAxis(origin);
+        if(Maths::Dot(startOffset, startOffset) <= capsuleR * capsuleR)
+        {
+            *out_distance = 0.0f;
+            *out_normal   = -direction;
+            return true;
+        }
+
+        float best = maxDistance;
+        bool hit   = false;
+
+        // Infinite cylinder around the axis, only counted between the caps
+        if(axisSq > Maths::M_EPSILON)
+        {
+            const Vec3 oa     = origin - top;
+            const float dDotA = Maths::Dot(direction, axis);
+            const float oDotA = Maths::Dot(oa, axis);
+            const float a     = axisSq - dDotA * dDotA;
+            const float b     = axisSq * Maths::Dot(oa, direction) - oDotA * dDotA;
+            const float c     = axisSq * Maths::Dot(oa, oa) - oDotA * oDotA - capsuleR * capsuleR * axisSq;
+            const float h     = b * b - a * c;
+
+            if(a > Maths::M_EPSILON && h >= 0.0f)
+            {
+                const float t = (-b - Maths::Sqrt(h)) / a;
+                const float y = oDotA + t * dDotA;
+                if(t >= 0.0f && t <= best && y > 0.0f && y < axisSq)
+                {
+                    best = t;
+                    hit  = true;
+                }
+            }
+        }
+
+        // End caps
+        float t;
+        if(RaycastSphere(origin, direction, top, capsuleR, best, &t))
+        {
+            best = t;
+            hit  = true;
+        }
+        if(RaycastSphere(origin, direction, bottom, capsuleR, best, &t))
+        {
+            best = t;
+            hit  = true;
+        }
+
+        if(!hit)
+            return false;
+
+        const Vec3 point = origin + direction * best;
+        *out_distance    = best;
+        *out_normal      = (point - closestOnAxis(point)).Normalised();
+        return true;
+    }
+
     void CapsuleCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
     {
         LUMOS_PROFILE_FUNCTION();
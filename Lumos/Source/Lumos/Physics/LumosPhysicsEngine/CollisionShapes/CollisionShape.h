@@ -64,12 +64,13 @@ namespace Lumos
         //<----- USED BY COLLISION DETECTION ----->
         // Get all possible collision axes
         //	- This is a list of all the face normals ignoring any duplicates and parallel vectors.
-        virtual TDArray<Vec3>& GetCollisionAxes(const RigidBody3D* currentObject) = 0;
+        //  - Results are appended to out_axes so shapes hold no per call state and can be queried from several threads.
+        virtual void GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const = 0;
 
         // Get all shape Edges
         //	- Returns a list of all edges AB that form the convex hull of the collision shape. These are
         //    used to check edge/edge collisions aswell as finding the closest point to a sphere. */
-        virtual TDArray<CollisionEdge>& GetEdges(const RigidBody3D* currentObject) = 0;
+        virtual void GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const = 0;
 
         // Get the min/max vertices along a given axis
         virtual void GetMinMaxVertexOnAxis(
@@ -88,6 +89,19 @@ namespace Lumos
                                                  ReferencePolygon& refPolygon) const
             = 0;
 
+        //<----- USED BY SCENE QUERIES ----->
+        // Sweeps a sphere of the given radius (0 for a ray) from origin along a normalised direction
+        //	- Returns the distance travelled and the surface normal at the first hit within maxDistance.
+        //    Starting inside the shape reports a hit at distance 0 with the normal facing back along the direction.
+        virtual bool Raycast(const RigidBody3D* currentObject,
+                             const Vec3& origin,
+                             const Vec3& direction,
+                             float maxDistance,
+                             float radius,
+                             float* out_distance,
+                             Vec3* out_normal) const
+            = 0;
+
         void SetLocalTransform(const Mat4& transform)
         {
             m_LocalTransform = transform;
@@ -111,9 +125,32 @@ namespace Lumos
         }
 
     protected:
+        // Ray against a sphere. Starting inside it hits at distance 0
+        static bool RaycastSphere(const Vec3& origin, const Vec3& direction, const Vec3& centre, float radius, float maxDistance, float* out_distance)
+        {
+            const Vec3 m  = origin - centre;
+            const float b = Vec3::Dot(m, direction);
+            const float c = Vec3::Dot(m, m) - radius * radius;
+
+            // Outside and pointing away
+            if(c > 0.0f && b > 0.0f)
+                return false;
+
+            const float discriminant = b * b - c;
+            if(discriminant < 0.0f)
+                return false;
+
+            float t = -b - sqrtf(discriminant);
+            if(t < 0.0f)
+                t = 0.0f;
+            if(t > maxDistance)
+                return false;
+
+            *out_distance = t;
+            return true;
+        }
+
         CollisionShapeType m_Type;
         Mat4 m_LocalTransform;
-        TDArray<CollisionEdge> m_Edges;
-        TDArray<Vec3> m_Axes;
     };
 }
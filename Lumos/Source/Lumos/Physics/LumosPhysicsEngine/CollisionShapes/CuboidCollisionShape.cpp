@@ -14,8 +14,6 @@ namespace Lumos
         m_CubeHull             = CreateSharedPtr<BoundingBoxHull>();
         m_CubeHull->Set(-m_CuboidHalfDimensions, m_CuboidHalfDimensions);
         m_CubeHull->UpdateHull();
-        m_Axes.Resize(3);
-        m_Edges.Resize(m_CubeHull->GetNumEdges());
     }
 
     CuboidCollisionShape::CuboidCollisionShape(const Vec3& halfdims)
@@ -27,9 +25,6 @@ namespace Lumos
         m_CubeHull = CreateSharedPtr<BoundingBoxHull>();
         m_CubeHull->Set(-m_CuboidHalfDimensions, m_CuboidHalfDimensions);
         m_CubeHull->UpdateHull();
-
-        m_Axes.Resize(3);
-        m_Edges.Resize(m_CubeHull->GetNumEdges());
     }
 
     CuboidCollisionShape::~CuboidCollisionShape()
@@ -49,36 +44,32 @@ namespace Lumos
         return inertia;
     }
 
-    TDArray<Vec3>& CuboidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void CuboidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
-            m_Axes.Resize(3);
-
             Mat3 objOrientation = Mat3(currentObject->GetOrientation());     //.RotationMatrix();
-            m_Axes[0]           = (objOrientation * Vec3(1.0f, 0.0f, 0.0f)); // X - Axis
-            m_Axes[1]           = (objOrientation * Vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
-            m_Axes[2]           = (objOrientation * Vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
+            out_axes.PushBack(objOrientation * Vec3(1.0f, 0.0f, 0.0f)); // X - Axis
+            out_axes.PushBack(objOrientation * Vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
+            out_axes.PushBack(objOrientation * Vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
         }
-
-        return m_Axes;
     }
 
-    TDArray<CollisionEdge>& CuboidCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void CuboidCollisionShape::GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
             Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+            out_edges.Reserve(out_edges.Size() + m_CubeHull->GetNumEdges());
             for(unsigned int i = 0; i < m_CubeHull->GetNumEdges(); ++i)
             {
                 const HullEdge& edge = m_CubeHull->GetEdge(i);
                 Vec3 A               = transform * Vec4(m_CubeHull->GetVertex(edge.vStart).pos, 1.0f);
                 Vec3 B               = transform * Vec4(m_CubeHull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
+                out_edges.PushBack({ A, B });
             }
         }
-        return m_Edges;
     }
 
     void CuboidCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
@@ -175,6 +166,13 @@ namespace Lumos
         }
     }
 
+    bool CuboidCollisionShape::Raycast(const RigidBody3D* currentObject, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const Mat4 transform = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+        return m_CubeHull->Raycast(transform, origin, direction, maxDistance, radius, out_distance, out_normal);
+    }
+
     void CuboidCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
     {
         Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
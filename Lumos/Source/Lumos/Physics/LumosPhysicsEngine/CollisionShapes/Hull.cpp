@@ -2,6 +2,7 @@
 #include "Hull.h"
 #include "Graphics/Renderers/DebugRenderer.h"
 #include "Maths/Vector4.h"
+#include "Maths/Matrix3.h"
 #include "Maths/MathsUtilities.h"
 #include "Core/Algorithms/Find.h"
 
@@ -196,6 +197,70 @@ namespace Lumos
         }
     }
 
+    bool Hull::Raycast(const Mat4& transform, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_Vertices.Empty() || m_Faces.Empty())
+            return false;
+
+        // Non uniform scale needs the inverse transpose to keep normals perpendicular to their faces
+        const Mat3 normalMatrix = Mat3::Transpose(Mat3::Inverse(Mat3(transform)));
+
+        Vec3 centre(0.0f);
+        for(const HullVertex& vertex : m_Vertices)
+            centre += vertex.pos;
+        centre = Vec3(transform * Vec4(centre / (float)m_Vertices.Size(), 1.0f));
+
+        float tEnter     = 0.0f;
+        float tExit      = maxDistance;
+        Vec3 enterNormal = -direction;
+
+        for(const HullFace& face : m_Faces)
+        {
+            if(face.vert_ids.Empty())
+                continue;
+
+            const Vec3 point = Vec3(transform * Vec4(m_Vertices[face.vert_ids[0]].pos, 1.0f));
+            Vec3 normal      = (normalMatrix * face.normal).Normalised();
+
+            // Face winding is not consistent between hulls, make sure the normal points away from the centre
+            if(Maths::Dot(normal, centre - point) > 0.0f)
+                normal = -normal;
+
+            const float distance = Maths::Dot(normal, origin - point) - radius;
+            const float denom    = Maths::Dot(normal, direction);
+
+            if(Maths::Abs(denom) < Maths::M_EPSILON)
+            {
+                // Parallel to the plane and outside it
+                if(distance > 0.0f)
+                    return false;
+                continue;
+            }
+
+            const float t = -distance / denom;
+            if(denom < 0.0f)
+            {
+                if(t > tEnter)
+                {
+                    tEnter      = t;
+                    enterNormal = normal;
+                }
+            }
+            else if(t < tExit)
+            {
+                tExit = t;
+            }
+
+            if(tEnter > tExit)
+                return false;
+        }
+
+        *out_distance = tEnter;
+        *out_normal   = enterNormal;
+        return true;
+    }
+
     const int BoundingBoxHull::FAR_FACE[]    = { 0, 1, 2, 3 };
     const int BoundingBoxHull::NEAR_FACE[]   = { 7, 6, 5, 4 };
     const int BoundingBoxHull::TOP_FACE[]    = { 5, 6, 2, 1 };
@@ -61,6 +61,10 @@ namespace Lumos
 
         void DebugDraw(const Mat4& transform);
 
+        // Sweeps a sphere (radius 0 for a ray) against the hull placed by transform, by clipping the ray against every face plane.
+        // Planes are pushed out by radius, so hits near edges and corners are slightly conservative when radius > 0.
+        bool Raycast(const Mat4& transform, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const;
+
     protected:
         int ConstructNewEdge(int parent_face_idx, int vert_start, int vert_end); // Called by AddFace
 
@@ -12,13 +12,11 @@ namespace Lumos
     {
         m_HalfDimensions = Vec3(1.0f);
         m_Type           = CollisionShapeType::CollisionHull;
-        m_Axes.Resize(3);
 
         auto test = Lumos::SharedPtr<Lumos::Graphics::Mesh>(Lumos::Graphics::CreatePrimative(Lumos::Graphics::PrimitiveType::Cube));
         BuildFromMesh(test.get());
 
         m_LocalTransform = Mat4::Scale(m_HalfDimensions);
-        m_Edges.Resize(m_Hull->GetNumEdges());
     }
 
     HullCollisionShape::~HullCollisionShape()
@@ -59,8 +57,6 @@ namespace Lumos
         //     int vertexIdx[] = { (int)indices[i], (int)indices[i + 1], (int)indices[i + 2] };
         //     m_Hull->AddFace(normal, 3, vertexIdx);
         // }
-
-        // m_Edges.Resize(m_Hull->GetNumEdges());
     }
 
     // Mat3 HullCollisionShape::GetLocalInertiaTensor(float mass)
@@ -89,34 +85,32 @@ namespace Lumos
         return inertia;
     }
 
-    TDArray<Vec3>& HullCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void HullCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
             Mat3 objOrientation = Mat3(currentObject->GetOrientation());
-            m_Axes[0]           = (objOrientation * Vec3(1.0f, 0.0f, 0.0f)); // X - Axis
-            m_Axes[1]           = (objOrientation * Vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
-            m_Axes[2]           = (objOrientation * Vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
+            out_axes.PushBack(objOrientation * Vec3(1.0f, 0.0f, 0.0f)); // X - Axis
+            out_axes.PushBack(objOrientation * Vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
+            out_axes.PushBack(objOrientation * Vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
         }
-
-        return m_Axes;
     }
 
-    TDArray<CollisionEdge>& HullCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void HullCollisionShape::GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
             Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+            out_edges.Reserve(out_edges.Size() + m_Hull->GetNumEdges());
             for(unsigned int i = 0; i < m_Hull->GetNumEdges(); ++i)
             {
                 const HullEdge& edge = m_Hull->GetEdge(i);
                 Vec3 A               = transform * Vec4(m_Hull->GetVertex(edge.vStart).pos, 1.0f);
                 Vec3 B               = transform * Vec4(m_Hull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
+                out_edges.PushBack({ A, B });
             }
         }
-        return m_Edges;
     }
 
     void HullCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
@@ -226,6 +220,16 @@ namespace Lumos
         }
     }
 
+    bool HullCollisionShape::Raycast(const RigidBody3D* currentObject, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(!m_Hull)
+            return false;
+
+        const Mat4 transform = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+        return m_Hull->Raycast(transform, origin, direction, maxDistance, radius, out_distance, out_normal);
+    }
+
     void HullCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
     {
         if(!m_Hull)
@@ -17,9 +17,6 @@ namespace Lumos
         {
             ConstructPyramidHull();
         }
-
-        m_Axes.Resize(5);
-        m_Edges.Resize(m_PyramidHull->GetNumEdges());
     }
 
     PyramidCollisionShape::PyramidCollisionShape(const Vec3& halfdims)
@@ -48,9 +45,6 @@ namespace Lumos
         {
             ConstructPyramidHull();
         }
-
-        m_Axes.Resize(5);
-        m_Edges.Resize(m_PyramidHull->GetNumEdges());
     }
 
     PyramidCollisionShape::~PyramidCollisionShape()
@@ -68,38 +62,34 @@ namespace Lumos
         return inertia;
     }
 
-    TDArray<CollisionEdge>& PyramidCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void PyramidCollisionShape::GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
             Mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+            out_edges.Reserve(out_edges.Size() + m_PyramidHull->GetNumEdges());
             for(unsigned int i = 0; i < m_PyramidHull->GetNumEdges(); ++i)
             {
                 const HullEdge& edge = m_PyramidHull->GetEdge(i);
                 Vec3 A               = transform * Vec4(m_PyramidHull->GetVertex(edge.vStart).pos, 1.0f);
                 Vec3 B               = transform * Vec4(m_PyramidHull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
+                out_edges.PushBack({ A, B });
             }
         }
-        return m_Edges;
     }
 
-    TDArray<Vec3>& PyramidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void PyramidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         {
-            m_Axes.Clear();
-            m_Axes.Resize(5);
             const Mat3 objOrientation = Mat3(currentObject->GetOrientation());
-            m_Axes[0]                 = (objOrientation * m_Normals[0]);
-            m_Axes[1]                 = (objOrientation * m_Normals[1]);
-            m_Axes[2]                 = (objOrientation * m_Normals[2]);
-            m_Axes[3]                 = (objOrientation * m_Normals[3]);
-            m_Axes[4]                 = (objOrientation * m_Normals[4]);
+            out_axes.PushBack(objOrientation * m_Normals[0]);
+            out_axes.PushBack(objOrientation * m_Normals[1]);
+            out_axes.PushBack(objOrientation * m_Normals[2]);
+            out_axes.PushBack(objOrientation * m_Normals[3]);
+            out_axes.PushBack(objOrientation * m_Normals[4]);
         }
-
-        return m_Axes;
     }
 
     void PyramidCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
@@ -195,6 +185,13 @@ namespace Lumos
         }
     }
 
+    bool PyramidCollisionShape::Raycast(const RigidBody3D* currentObject, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const Mat4 transform = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+        return m_PyramidHull->Raycast(transform, origin, direction, maxDistance, radius, out_distance, out_normal);
+    }
+
     void PyramidCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
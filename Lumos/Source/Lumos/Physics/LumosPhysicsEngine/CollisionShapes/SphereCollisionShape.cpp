@@ -38,17 +38,14 @@ namespace Lumos
         return inertia;
     }
 
-    TDArray<Vec3>& SphereCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void SphereCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, TDArray<Vec3>& out_axes) const
     {
         /* There is infinite edges so handle seperately */
-        m_Axes.Clear();
-        return m_Axes;
     }
 
-    TDArray<CollisionEdge>& SphereCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void SphereCollisionShape::GetEdges(const RigidBody3D* currentObject, TDArray<CollisionEdge>& out_edges) const
     {
         /* There is infinite edges on a sphere so handle seperately */
-        return m_Edges;
     }
 
     void SphereCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const Vec3& axis, Vec3* out_min, Vec3* out_max) const
@@ -76,6 +73,22 @@ namespace Lumos
         refPolygon.Normal = axis;
     }
 
+    bool SphereCollisionShape::Raycast(const RigidBody3D* currentObject, const Vec3& origin, const Vec3& direction, float maxDistance, float radius, float* out_distance, Vec3* out_normal) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const Mat4 transform = currentObject ? currentObject->GetWorldSpaceTransform() * m_LocalTransform : m_LocalTransform;
+        const Vec3 centre    = transform.GetPositionVector();
+
+        float distance;
+        if(!RaycastSphere(origin, direction, centre, m_Radius + radius, maxDistance, &distance))
+            return false;
+
+        const Vec3 offset = origin + direction * distance - centre;
+        *out_distance     = distance;
+        *out_normal       = distance > 0.0f ? offset.Normalised() : -direction;
+        return true;
+    }
+
     void SphereCollisionShape::DebugDraw(const RigidBody3D* currentObject) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
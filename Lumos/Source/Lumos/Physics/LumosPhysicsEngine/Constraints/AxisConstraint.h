@@ -24,6 +24,7 @@ namespace Lumos
 
         virtual void ApplyImpulse() override;
         virtual void DebugDraw() const override;
+        virtual RigidBody3D* GetBodyA() const override { return m_pObj1; }
         Axes GetAxes() { return m_Axes; }
 
     protected:
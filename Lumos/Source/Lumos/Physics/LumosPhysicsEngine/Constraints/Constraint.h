@@ -2,6 +2,7 @@
 
 namespace Lumos
 {
+    class RigidBody3D;
 
     class LUMOS_EXPORT Constraint
     {
@@ -21,5 +22,9 @@ namespace Lumos
         virtual void DebugDraw() const
         {
         }
+
+        // Bodies the constraint acts on, used to join them into one sleep island. Either may be null.
+        virtual RigidBody3D* GetBodyA() const { return nullptr; }
+        virtual RigidBody3D* GetBodyB() const { return nullptr; }
     };
 }
@@ -12,6 +12,8 @@ namespace Lumos
 
         virtual void ApplyImpulse() override;
         virtual void DebugDraw() const override;
+        virtual RigidBody3D* GetBodyA() const override { return m_pObj1; }
+        virtual RigidBody3D* GetBodyB() const override { return m_pObj2; }
 
     protected:
         RigidBody3D* m_pObj1;
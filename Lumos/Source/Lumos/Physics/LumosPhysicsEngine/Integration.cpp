@@ -6,11 +6,12 @@ namespace Lumos
 
     void Integration::RK2(State& state, float t, float dt)
     {
-        const Derivative a = Evaluate(state, t, 0.0f, Derivative());
-        const Derivative b = Evaluate(state, t, dt * 0.5f, a);
+        const Derivative a = Evaluate(state, 0.0f, t, Derivative());
+        const Derivative b = Evaluate(state, dt * 0.5f, t + dt * 0.5f, a);
 
-        const Vec3 dxdt = (a.velocity + b.velocity) * 0.5f;
-        const Vec3 dvdt = (a.acceleration + b.acceleration) * 0.5f;
+        // Midpoint method, the derivative at the half step carries the whole step
+        const Vec3 dxdt = b.velocity;
+        const Vec3 dvdt = b.acceleration;
 
         state.position += dxdt * dt;
         state.velocity += dvdt * dt;
@@ -18,10 +19,10 @@ namespace Lumos
 
     void Integration::RK4(State& state, float t, float dt)
     {
-        const Derivative a = Evaluate(state, t, 0.0f, Derivative());
-        const Derivative b = Evaluate(state, t, dt * 0.5f, a);
-        const Derivative c = Evaluate(state, t, dt * 0.5f, b);
-        const Derivative d = Evaluate(state, t, dt, c);
+        const Derivative a = Evaluate(state, 0.0f, t, Derivative());
+        const Derivative b = Evaluate(state, dt * 0.5f, t + dt * 0.5f, a);
+        const Derivative c = Evaluate(state, dt * 0.5f, t + dt * 0.5f, b);
+        const Derivative d = Evaluate(state, dt, t + dt, c);
 
         const Vec3 dxdt = (a.velocity + (b.velocity + c.velocity) * 2.0f + d.velocity) * 1.0f / 6.0f;
         const Vec3 dvdt = (a.acceleration + (b.acceleration + c.acceleration) * 2.0f + d.acceleration) * 1.0f / 6.0f;
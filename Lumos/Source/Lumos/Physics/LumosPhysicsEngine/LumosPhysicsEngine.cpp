@@ -4,18 +4,22 @@
 #include "Narrowphase/CollisionDetection.h"
 #include "Broadphase/BruteForceBroadphase.h"
 #include "Broadphase/OctreeBroadphase.h"
-#include "Integration.h"
+#include "Broadphase/SortAndSweepBroadphase.h"
+#include "Broadphase/DynamicTreeBroadphase.h"
+#include "RigidBodyStreams.h"
 #include "Constraints/Constraint.h"
 #include "Utilities/TimeStep.h"
 #include "Core/OS/Window.h"
 #include "Core/JobSystem.h"
 #include "Core/Application.h"
+#include "Core/Algorithms/Sort.h"
 #include "Scene/Component/RigidBody3DComponent.h"
 #include "Scene/Scene.h"
 #include "Scene/Entity.h"
 #include "Graphics/Renderers/DebugRenderer.h"
 #include "Maths/MathsUtilities.h"
 #include "Maths/Transform.h"
+#include "Maths/Ray.h"
 #include "ImGui/ImGuiUtilities.h"
 #include "Utilities/Colour.h"
 
@@ -27,6 +31,11 @@ namespace Lumos
 
     float LumosPhysicsEngine::s_UpdateTimestep = 1.0f / 60.0f;
 
+    static bool IsSimulated(const RigidBody3D* body)
+    {
+        return body && !body->GetIsStatic() && body->IsAwake();
+    }
+
     LumosPhysicsEngine::LumosPhysicsEngine(const LumosPhysicsEngineConfig& config)
         : m_IsPaused(true)
         , m_UpdateAccum(0.0f)
@@ -42,13 +51,23 @@ namespace Lumos
         m_BroadphaseCollisionPairs.Reserve(1000);
 
         m_FrameArena        = ArenaAlloc(Megabytes(4));
-        m_Arena             = ArenaAlloc(m_MaxRigidBodyCount * sizeof(RigidBody3D) * 2 + sizeof(Mutex));
+        m_Arena             = ArenaAlloc(m_MaxRigidBodyCount * sizeof(RigidBody3D) * 2);
         m_RigidBodies       = PushArray(m_Arena, RigidBody3D, m_MaxRigidBodyCount);
         m_RigidBodyFreeList = TDArray<RigidBody3D*>(m_Arena);
         m_RigidBodyFreeList.Reserve(m_MaxRigidBodyCount);
-
-        m_ManifoldLock = PushArray(m_Arena, Mutex, 1);
-        MutexInit(m_ManifoldLock);
+        m_BodyIslands = PushArrayNoZero(m_Arena, u32, m_MaxRigidBodyCount);
+        m_BodyStreams.Init(m_Arena, m_MaxRigidBodyCount);
+
+        m_ManifoldArenaSize         = 1000 * (sizeof(Manifold) + sizeof(CollisionData) + sizeof(bool) + sizeof(ManifoldKey));
+        m_ManifoldArena             = ArenaAlloc(m_ManifoldArenaSize);
+        m_PreviousManifoldArenaSize = m_ManifoldArenaSize;
+        m_PreviousManifoldArena     = ArenaAlloc(m_PreviousManifoldArenaSize);
+        m_Manifolds                 = nullptr;
+        m_ManifoldKeys              = nullptr;
+        m_PreviousManifolds         = nullptr;
+        m_PreviousManifoldKeys      = nullptr;
+
+        m_QueryTree = CreateSharedPtr<DynamicTreeBroadphase>();
     }
 
     void LumosPhysicsEngine::SetDefaults()
@@ -65,10 +84,10 @@ namespace Lumos
 
     LumosPhysicsEngine::~LumosPhysicsEngine()
     {
-        MutexDestroy(m_ManifoldLock);
-
         ArenaRelease(m_Arena);
         ArenaRelease(m_FrameArena);
+        ArenaRelease(m_ManifoldArena);
+        ArenaRelease(m_PreviousManifoldArena);
 
         CollisionDetection::Release();
     }
@@ -76,6 +95,10 @@ namespace Lumos
     void LumosPhysicsEngine::OnUpdate(const TimeStep& timeStep, Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
+
+        // Bodies can be moved from outside the simulation, so the query tree is resynced at least once per frame
+        m_QueryTreeDirty = true;
+
         if(!m_IsPaused)
         {
             auto& registry    = scene->GetRegistry();
@@ -158,10 +181,6 @@ namespace Lumos
 
     void LumosPhysicsEngine::UpdatePhysics()
     {
-        m_ManifoldCount = 0;
-        m_MaxManifolds  = 1000;
-        m_Manifolds     = PushArrayNoZero(m_FrameArena, Manifold, m_MaxManifolds);
-
         // Check for collisions
         BroadPhaseCollisions();
         NarrowPhaseCollisions();
@@ -169,15 +188,11 @@ namespace Lumos
         // Solve collision constraints
         SolveConstraints();
         // Update movement
-        for(uint32_t i = 0; i < m_PositionIterations; i++)
-            UpdateRigidBodies();
+        UpdateRigidBodies();
 
-        for(u32 i = 0; i < m_RigidBodyCount; i++)
-        {
-            RigidBody3D& current = m_RigidBodies[i];
-            if(current.m_IsValid)
-                current.RestTest();
-        }
+        UpdateIslands();
+
+        m_QueryTreeDirty = true;
     }
 
     void LumosPhysicsEngine::UpdateRigidBodies()
@@ -190,19 +205,22 @@ namespace Lumos
 
         for(u32 i = 0; i < m_RigidBodyCount; i++)
         {
-            RigidBody3D& current = m_RigidBodies[i];
-            if(!current.m_IsValid)
+            const uint8_t flags = m_BodyStreams.Flag[i];
+            if(!(flags & RigidBodyStreams::Valid))
                 continue;
 
-            if(current.m_AtRest)
+            if(flags & RigidBodyStreams::AtRest)
                 m_Stats.RestCount++;
-            if(current.m_Static)
+            if(flags & RigidBodyStreams::Static)
                 m_Stats.StaticCount++;
 
             m_Stats.RigidBodyCount++;
-
-            UpdateRigidBody(&current);
         }
+
+        // Every position iteration runs inside the kernel, one integrator chosen for the whole stream.
+        // Lanes past m_RigidBodyCount are never valid, so the count can be rounded up to whole lane groups.
+        const u32 laneCount = (m_RigidBodyCount + RigidBodyStreams::LaneCount - 1) / RigidBodyStreams::LaneCount * RigidBodyStreams::LaneCount;
+        m_BodyStreams.Integrate(m_IntegrationType, m_Gravity, m_DampingFactor, s_UpdateTimestep / m_PositionIterations, m_PositionIterations, laneCount);
     }
 
     RigidBody3D* LumosPhysicsEngine::CreateBody(const RigidBody3DProperties& properties)
@@ -210,9 +228,11 @@ namespace Lumos
         if(!m_RigidBodyFreeList.Empty())
         {
             RigidBody3D* body = m_RigidBodyFreeList.Back();
-            *body             = RigidBody3D(properties);
-            body->m_IsValid   = true;
+            *body             = RigidBody3D(&m_BodyStreams, (u32)(body - m_RigidBodies), properties);
             m_RigidBodyFreeList.PopBack();
+            m_QueryTreeDirty = true;
+
+            m_BodyIslands[body - m_RigidBodies] = (u32)(body - m_RigidBodies);
 
             return body;
         }
@@ -221,9 +241,10 @@ namespace Lumos
             if(m_RigidBodyCount < m_MaxRigidBodyCount)
             {
                 RigidBody3D* body = &m_RigidBodies[m_RigidBodyCount];
-                *body             = RigidBody3D(properties);
-                body->m_IsValid   = true;
+                *body             = RigidBody3D(&m_BodyStreams, m_RigidBodyCount, properties);
+                m_BodyIslands[m_RigidBodyCount] = m_RigidBodyCount;
                 m_RigidBodyCount++;
+                m_QueryTreeDirty = true;
 
                 return body;
             }
@@ -237,10 +258,30 @@ namespace Lumos
 
     void LumosPhysicsEngine::DestroyBody(RigidBody3D* body)
     {
-        if(body && body->m_IsValid)
+        if(body && body->GetIsValid())
         {
-            body->m_IsValid = false;
+            m_BodyStreams.SetFlag((u32)(body - m_RigidBodies), RigidBodyStreams::Valid, false);
             m_RigidBodyFreeList.PushBack(body);
+            m_QueryTreeDirty = true;
+
+            // This step's manifolds become the warm start cache of the next one. Whichever body reuses the slot must not
+            // be warm started from this body's contacts, so they are dropped and the rest are kept.
+            uint32_t keptCount = 0;
+            for(uint32_t index = 0; index < m_ManifoldCount; index++)
+            {
+                if(m_Manifolds[index].NodeA() == body || m_Manifolds[index].NodeB() == body)
+                    continue;
+
+                if(keptCount != index)
+                    m_Manifolds[keptCount] = m_Manifolds[index];
+                keptCount++;
+            }
+
+            if(keptCount != m_ManifoldCount)
+            {
+                m_ManifoldCount = keptCount;
+                SortManifoldKeys();
+            }
         }
     }
 
@@ -269,151 +310,6 @@ namespace Lumos
         };
     }
 
-    Quat QuatMulVec3(const Quat& quat, const Vec3& b)
-    {
-        Quat ans;
-
-        ans.w = -(quat.x * b.x) - (quat.y * b.y) - (quat.z * b.z);
-
-        ans.x = (quat.w * b.x) + (b.y * quat.z) - (b.z * quat.y);
-        ans.y = (quat.w * b.y) + (b.z * quat.x) - (b.x * quat.z);
-        ans.z = (quat.w * b.z) + (b.x * quat.y) - (b.y * quat.x);
-
-        return ans;
-    }
-
-    void LumosPhysicsEngine::UpdateRigidBody(RigidBody3D* obj) const
-    {
-        LUMOS_PROFILE_FUNCTION_LOW();
-
-        // Use local variable instead of modifying static timestep
-        const float dt = s_UpdateTimestep / m_PositionIterations;
-
-        if(!obj->GetIsStatic() && obj->IsAwake())
-        {
-            const float damping = m_DampingFactor;
-
-            // Apply gravity
-            if(obj->m_InvMass > 0.0f)
-                obj->m_LinearVelocity += m_Gravity * dt;
-
-            switch(m_IntegrationType)
-            {
-            case IntegrationType::EXPLICIT_EULER:
-            {
-                // Update position
-                obj->m_Position += obj->m_LinearVelocity * dt;
-
-                // Update linear velocity (v = u + at)
-                obj->m_LinearVelocity += obj->m_Force * obj->m_InvMass * dt;
-
-                // Linear velocity damping
-                obj->m_LinearVelocity = obj->m_LinearVelocity * damping;
-
-                // Update orientation
-                obj->m_Orientation += obj->m_Orientation * Quat(obj->m_AngularVelocity * dt);
-                // obj->m_Orientation = obj->m_Orientation + ((obj->m_AngularVelocity * dt * 0.5f) * obj->m_Orientation);
-                obj->m_Orientation.Normalise();
-
-                // Update angular velocity
-                obj->m_AngularVelocity += obj->m_InvInertia * obj->m_Torque * dt;
-
-                // Angular velocity damping
-                obj->m_AngularVelocity = obj->m_AngularVelocity * damping * obj->m_AngularFactor;
-
-                break;
-            }
-
-            case IntegrationType::SEMI_IMPLICIT_EULER:
-            {
-                // Update linear velocity (v = u + at)
-                obj->m_LinearVelocity += obj->m_Force * obj->m_InvMass * dt;
-
-                // Linear velocity damping
-                obj->m_LinearVelocity = obj->m_LinearVelocity * damping;
-
-                // Update position
-                obj->m_Position += obj->m_LinearVelocity * dt;
-
-                // Update angular velocity
-                obj->m_AngularVelocity += obj->m_InvInertia * obj->m_Torque * dt;
-
-                // Angular velocity damping
-                obj->m_AngularVelocity = obj->m_AngularVelocity * damping * obj->m_AngularFactor;
-
-                auto angularVelocity = obj->m_AngularVelocity * dt;
-
-                // Update orientation
-                obj->m_Orientation += QuatMulVec3(obj->m_Orientation, angularVelocity);
-                obj->m_Orientation.Normalise();
-
-                break;
-            }
-
-            case IntegrationType::RUNGE_KUTTA_2:
-            {
-                // RK2 integration for linear motion
-                Integration::State state = { obj->m_Position, obj->m_LinearVelocity, obj->m_Force * obj->m_InvMass };
-                Integration::RK2(state, 0.0f, dt);
-
-                obj->m_Position       = state.position;
-                obj->m_LinearVelocity = state.velocity;
-
-                // Linear velocity damping
-                obj->m_LinearVelocity = obj->m_LinearVelocity * damping;
-
-                // Update angular velocity
-                obj->m_AngularVelocity += obj->m_InvInertia * obj->m_Torque * dt;
-
-                // Angular velocity damping
-                obj->m_AngularVelocity = obj->m_AngularVelocity * damping * obj->m_AngularFactor;
-
-                auto angularVelocity = obj->m_AngularVelocity * dt * 0.5f;
-
-                // Update orientation
-                obj->m_Orientation += QuatMulVec3(obj->m_Orientation, angularVelocity);
-                obj->m_Orientation.Normalise();
-
-                break;
-            }
-
-            case IntegrationType::RUNGE_KUTTA_4:
-            {
-                // RK4 integration for linear motion
-                Integration::State state = { obj->m_Position, obj->m_LinearVelocity, obj->m_Force * obj->m_InvMass };
-                Integration::RK4(state, 0.0f, dt);
-                obj->m_Position       = state.position;
-                obj->m_LinearVelocity = state.velocity;
-
-                // Linear velocity damping
-                obj->m_LinearVelocity = obj->m_LinearVelocity * damping;
-
-                // Update angular velocity
-                obj->m_AngularVelocity += obj->m_InvInertia * obj->m_Torque * dt;
-
-                // Angular velocity damping
-                obj->m_AngularVelocity = obj->m_AngularVelocity * damping * obj->m_AngularFactor;
-
-                // Update orientation
-                // Check order of quat multiplication
-                auto angularVelocity = obj->m_AngularVelocity * dt * 0.5f;
-
-                obj->m_Orientation += QuatMulVec3(obj->m_Orientation, angularVelocity);
-                obj->m_Orientation.Normalise();
-
-                break;
-            }
-            }
-
-            // Mark cached world transform and AABB as invalid
-            obj->m_WSTransformInvalidated = true;
-            obj->m_WSAabbInvalidated      = true;
-        }
-
-        ASSERT(obj->m_Orientation.IsValid());
-        ASSERT(obj->m_Position.IsValid());
-    }
-
     Quat AngularVelcityToQuaternion(const Vec3& angularVelocity)
     {
         Quat q;
@@ -455,83 +351,223 @@ namespace Lumos
 #endif
     }
 
+    bool LumosPhysicsEngine::TestCollisionPair(const CollisionPair& pair, Manifold& manifold, CollisionData& colData, bool& manifoldBuilt) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        manifoldBuilt = false;
+
+        // Sleeping bodies keep resting on each other and on static geometry without being tested
+        if(!IsSimulated(pair.pObjectA) && !IsSimulated(pair.pObjectB))
+            return false;
+
+        CollisionShape* shapeA = pair.pObjectA->GetCollisionShape().get();
+        CollisionShape* shapeB = pair.pObjectB->GetCollisionShape().get();
+
+        if(!shapeA || !shapeB)
+            return false;
+
+        // Detects if the objects are colliding - Seperating Axis Theorem
+        if(!CollisionDetection::Get().CheckCollision(pair.pObjectA, pair.pObjectB, shapeA, shapeB, &colData))
+            return false;
+
+        // Build full collision manifold that will also handle the collision
+        // response between the two objects in the solver stage
+        manifold.Initiate(pair.pObjectA, pair.pObjectB, m_BaumgarteScalar, m_BaumgarteSlop);
+
+        // Construct contact points that form the perimeter of the collision manifold
+        manifoldBuilt = CollisionDetection::Get().BuildCollisionManifold(pair.pObjectA, pair.pObjectB, shapeA, shapeB, colData, &manifold);
+
+        if(manifoldBuilt && m_WarmStarting)
+            ContinueManifold(manifold);
+
+        return true;
+    }
+
+    void LumosPhysicsEngine::ContinueManifold(Manifold& manifold) const
+    {
+        const uint64_t pair = ((uint64_t)(manifold.NodeA() - m_RigidBodies) << 32) | (uint64_t)(manifold.NodeB() - m_RigidBodies);
+
+        // Lower bound over last step's keys, which are only read while the pairs are tested
+        uint32_t first = 0;
+        uint32_t count = m_PreviousManifoldCount;
+        while(count > 0)
+        {
+            const uint32_t step = count / 2;
+            if(m_PreviousManifoldKeys[first + step].Pair < pair)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
+
+        if(first < m_PreviousManifoldCount && m_PreviousManifoldKeys[first].Pair == pair)
+            manifold.ContinueFrom(m_PreviousManifolds[m_PreviousManifoldKeys[first].Index]);
+    }
+
     void LumosPhysicsEngine::NarrowPhaseCollisions()
     {
         LUMOS_PROFILE_FUNCTION();
+
+        // Last step's manifolds stay where they are for warm starting, this step reuses the arena of the step before
+        Swap(m_ManifoldArena, m_PreviousManifoldArena);
+        Swap(m_ManifoldArenaSize, m_PreviousManifoldArenaSize);
+        m_PreviousManifolds     = m_Manifolds;
+        m_PreviousManifoldKeys  = m_ManifoldKeys;
+        m_PreviousManifoldCount = m_ManifoldCount;
+        m_ManifoldCount         = 0;
+
+        m_Stats.WarmStartedContactCount = 0;
+
         if(m_BroadphaseCollisionPairs.Empty())
             return;
 
-        m_Stats.NarrowPhaseCount = (uint32_t)m_BroadphaseCollisionPairs.Size();
+        const uint32_t pairCount   = (uint32_t)m_BroadphaseCollisionPairs.Size();
+        const uint32_t pairsPerJob = 32;
+        const uint32_t groupCount  = System::JobSystem::DispatchGroupCount(pairCount, pairsPerJob);
+
+        m_Stats.NarrowPhaseCount = pairCount;
         m_Stats.CollisionCount   = 0;
-        CollisionData colData;
 
+        // A pair produces at most one manifold, so every pair gets a slot and the narrowphase can never run out of space
+        {
+            LUMOS_PROFILE_SCOPE("Allocate Manifolds");
+            const uint64_t requiredSize = (uint64_t)pairCount * (sizeof(Manifold) + sizeof(CollisionData) + sizeof(bool) + sizeof(ManifoldKey)) + groupCount * sizeof(uint32_t) + 4 * alignof(std::max_align_t);
+            if(requiredSize > m_ManifoldArenaSize)
+            {
+                m_ManifoldArenaSize = Maths::Max(requiredSize, m_ManifoldArenaSize * 2);
+                ArenaRelease(m_ManifoldArena);
+                m_ManifoldArena = ArenaAlloc(m_ManifoldArenaSize);
+            }
+            ArenaClear(m_ManifoldArena);
+        }
+
+        m_MaxManifolds               = pairCount;
+        m_Manifolds                  = PushArrayNoZero(m_ManifoldArena, Manifold, pairCount);
+        CollisionData* collisionData = PushArrayNoZero(m_ManifoldArena, CollisionData, pairCount);
+        bool* manifoldBuilt          = PushArrayNoZero(m_ManifoldArena, bool, pairCount);
+        uint32_t* groupHitCounts     = PushArray(m_ManifoldArena, uint32_t, groupCount);
+
+        // Broadphase debug draw
+        if(m_DebugDrawFlags & PhysicsDebugFlags::BROADPHASE_PAIRS)
+        {
+            for(auto& cp : m_BroadphaseCollisionPairs)
+            {
+                Vec4 colour = Colour::RandomColour();
+                DebugRenderer::DrawThickLine(cp.pObjectA->GetPosition(), cp.pObjectB->GetPosition(), 0.02f, false, colour);
+                DebugRenderer::DrawPoint(cp.pObjectA->GetPosition(), 0.05f, false, colour);
+                DebugRenderer::DrawPoint(cp.pObjectB->GetPosition(), 0.05f, false, colour);
+            }
+        }
+
+        // World transforms are cached lazily on first use, so fill the caches before the pairs are tested on several threads
+        CollisionDetection::Get();
         for(auto& cp : m_BroadphaseCollisionPairs)
         {
-            auto shapeA = cp.pObjectA->GetCollisionShape();
-            auto shapeB = cp.pObjectB->GetCollisionShape();
+            cp.pObjectA->GetWorldSpaceTransform();
+            cp.pObjectB->GetWorldSpaceTransform();
+        }
 
-            if(shapeA && shapeB)
+        // Each job group owns the manifold slots of its own range of pairs and packs its hits at the start of that range.
+        // A group runs its pairs in order on one thread, so the result does not depend on how groups were scheduled.
+        {
+            LUMOS_PROFILE_SCOPE("Test Collision Pairs");
+            const CollisionPair* pairs = m_BroadphaseCollisionPairs.Data();
+            auto testPair              = [this, pairs, collisionData, manifoldBuilt, groupHitCounts](JobDispatchArgs args)
             {
+                const uint32_t groupIndex = args.jobIndex / pairsPerJob;
+                const uint32_t slot       = groupIndex * pairsPerJob + groupHitCounts[groupIndex];
+                if(TestCollisionPair(pairs[args.jobIndex], m_Manifolds[slot], collisionData[slot], manifoldBuilt[slot]))
+                    groupHitCounts[groupIndex]++;
+            };
 
-                // Broadphase debug draw
-                if(m_DebugDrawFlags & PhysicsDebugFlags::BROADPHASE_PAIRS)
+            if(groupCount == 1)
+            {
+                JobDispatchArgs args = {};
+                for(uint32_t i = 0; i < pairCount; i++)
                 {
-                    Vec4 colour = Colour::RandomColour();
-                    DebugRenderer::DrawThickLine(cp.pObjectA->GetPosition(), cp.pObjectB->GetPosition(), 0.02f, false, colour);
-                    DebugRenderer::DrawPoint(cp.pObjectA->GetPosition(), 0.05f, false, colour);
-                    DebugRenderer::DrawPoint(cp.pObjectB->GetPosition(), 0.05f, false, colour);
+                    args.jobIndex = i;
+                    testPair(args);
                 }
+            }
+            else
+            {
+                System::JobSystem::Context ctx;
+                System::JobSystem::Dispatch(ctx, pairCount, pairsPerJob, testPair);
+                System::JobSystem::Wait(ctx);
+            }
+        }
 
-                // Detects if the objects are colliding - Seperating Axis Theorem
-                if(CollisionDetection::Get().CheckCollision(cp.pObjectA, cp.pObjectB, shapeA.get(), shapeB.get(), &colData))
+        // Callbacks and debug drawing run here on the calling thread, in pair order, while the accepted manifolds are compacted
+        {
+            LUMOS_PROFILE_SCOPE("Collision Callbacks");
+            for(uint32_t groupIndex = 0; groupIndex < groupCount; groupIndex++)
+            {
+                const uint32_t groupStart = groupIndex * pairsPerJob;
+                for(uint32_t slot = groupStart; slot < groupStart + groupHitCounts[groupIndex]; slot++)
                 {
+                    RigidBody3D* objectA = m_Manifolds[slot].NodeA();
+                    RigidBody3D* objectB = m_Manifolds[slot].NodeB();
+
                     // Check to see if any of the objects have collision callbacks that dont
                     // want the objects to physically collide
-                    const bool okA = cp.pObjectA->FireOnCollisionEvent(cp.pObjectA, cp.pObjectB);
-                    const bool okB = cp.pObjectB->FireOnCollisionEvent(cp.pObjectB, cp.pObjectA);
+                    const bool okA = objectA->FireOnCollisionEvent(objectA, objectB);
+                    const bool okB = objectB->FireOnCollisionEvent(objectB, objectA);
+
+                    if(!okA || !okB || !manifoldBuilt[slot])
+                        continue;
 
-                    if(okA && okB)
+                    if(slot != m_ManifoldCount)
+                        m_Manifolds[m_ManifoldCount] = m_Manifolds[slot];
+                    Manifold& manifold = m_Manifolds[m_ManifoldCount++];
+
+                    if(m_DebugDrawFlags & PhysicsDebugFlags::COLLISIONNORMALS)
                     {
-                        // Check if we have space for another manifold
-                        if(m_ManifoldCount >= m_MaxManifolds)
-                        {
-                            LWARN("Exceeded max manifold count (%u), skipping collision", m_MaxManifolds);
-                            continue;
-                        }
-
-                        // Build full collision manifold that will also handle the collision
-                        // response between the two objects in the solver stage
-                        ScopedMutex lock(m_ManifoldLock);
-                        Manifold& manifold = m_Manifolds[m_ManifoldCount++];
-                        manifold.Initiate(cp.pObjectA, cp.pObjectB, m_BaumgarteScalar, m_BaumgarteSlop);
-                        // Construct contact points that form the perimeter of the collision manifold
-                        if(CollisionDetection::Get().BuildCollisionManifold(cp.pObjectA, cp.pObjectB, shapeA.get(), shapeB.get(), colData, &manifold))
-                        {
-                            if(m_DebugDrawFlags & PhysicsDebugFlags::COLLISIONNORMALS)
-                            {
-                                DebugRenderer::DrawPoint(colData.pointOnPlane, 0.1f, false, Vec4(0.5f, 0.5f, 1.0f, 1.0f), 3.0f);
-                                DebugRenderer::DrawThickLine(colData.pointOnPlane, colData.pointOnPlane - colData.normal * colData.penetration, 0.05f, false, Vec4(0.0f, 0.0f, 1.0f, 1.0f), 3.0f);
-                            }
-
-                            // Fire callback
-                            cp.pObjectA->FireOnCollisionManifoldCallback(cp.pObjectA, cp.pObjectB, &manifold);
-                            cp.pObjectB->FireOnCollisionManifoldCallback(cp.pObjectB, cp.pObjectA, &manifold);
-                            m_Stats.CollisionCount++;
-                        }
-                        else
-                        {
-                            m_ManifoldCount--;
-                        }
+                        const CollisionData& colData = collisionData[slot];
+                        DebugRenderer::DrawPoint(colData.pointOnPlane, 0.1f, false, Vec4(0.5f, 0.5f, 1.0f, 1.0f), 3.0f);
+                        DebugRenderer::DrawThickLine(colData.pointOnPlane, colData.pointOnPlane - colData.normal * colData.penetration, 0.05f, false, Vec4(0.0f, 0.0f, 1.0f, 1.0f), 3.0f);
                     }
+
+                    // Fire callback
+                    objectA->FireOnCollisionManifoldCallback(objectA, objectB, &manifold);
+                    objectB->FireOnCollisionManifoldCallback(objectB, objectA, &manifold);
+                    m_Stats.CollisionCount++;
+                    m_Stats.WarmStartedContactCount += manifold.GetWarmStartedCount();
                 }
             }
         }
+
+        m_ManifoldKeys = PushArrayNoZero(m_ManifoldArena, ManifoldKey, m_ManifoldCount);
+        SortManifoldKeys();
+    }
+
+    void LumosPhysicsEngine::SortManifoldKeys()
+    {
+        for(uint32_t index = 0; index < m_ManifoldCount; index++)
+        {
+            m_ManifoldKeys[index].Pair  = ((uint64_t)(m_Manifolds[index].NodeA() - m_RigidBodies) << 32) | (uint64_t)(m_Manifolds[index].NodeB() - m_RigidBodies);
+            m_ManifoldKeys[index].Index = index;
+        }
+
+        Algorithms::IntroSort(m_ManifoldKeys, m_ManifoldKeys + m_ManifoldCount, [](const ManifoldKey& a, const ManifoldKey& b)
+                              { return a.Pair < b.Pair; });
     }
 
     void LumosPhysicsEngine::SolveConstraints()
     {
         LUMOS_PROFILE_FUNCTION();
 
+        // Constraints between bodies that are all asleep or static are left out of the solve, as their contacts were
+        Constraint** activeConstraints = PushArrayNoZero(m_FrameArena, Constraint*, m_ConstraintCount);
+        uint32_t activeConstraintCount = 0;
+        for(uint32_t index = 0; index < m_ConstraintCount; index++)
+        {
+            Constraint* constraint = m_Constraints[index].get();
+            if(IsSimulated(constraint->GetBodyA()) || IsSimulated(constraint->GetBodyB()))
+                activeConstraints[activeConstraintCount++] = constraint;
+        }
+
         {
             LUMOS_PROFILE_SCOPE("Solve Manifolds");
             for(uint32_t index = 0; index < m_ManifoldCount; index++)
@@ -539,8 +575,14 @@ namespace Lumos
         }
         {
             LUMOS_PROFILE_SCOPE("Solve Constraints");
-            for(uint32_t index = 0; index < m_ConstraintCount; index++)
-                m_Constraints[index]->PreSolverStep(s_UpdateTimestep);
+            for(uint32_t index = 0; index < activeConstraintCount; index++)
+                activeConstraints[index]->PreSolverStep(s_UpdateTimestep);
+        }
+        if(m_WarmStarting)
+        {
+            LUMOS_PROFILE_SCOPE("Warm Start");
+            for(uint32_t index = 0; index < m_ManifoldCount; index++)
+                m_Manifolds[index].WarmStart();
         }
         {
             LUMOS_PROFILE_SCOPE("Apply Impulses");
@@ -550,10 +592,108 @@ namespace Lumos
                 for(uint32_t index = 0; index < m_ManifoldCount; index++)
                     m_Manifolds[index].ApplyImpulse();
 
-                for(uint32_t index = 0; index < m_ConstraintCount; index++)
-                    m_Constraints[index]->ApplyImpulse();
+                for(uint32_t index = 0; index < activeConstraintCount; index++)
+                    activeConstraints[index]->ApplyImpulse();
+            }
+        }
+    }
+
+    void LumosPhysicsEngine::UpdateIslands()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+
+        u32* parents         = PushArrayNoZero(scratch.arena, u32, m_RigidBodyCount);
+        bool* islandCanSleep = PushArrayNoZero(scratch.arena, bool, m_RigidBodyCount);
+
+        for(u32 i = 0; i < m_RigidBodyCount; i++)
+        {
+            parents[i]        = i;
+            islandCanSleep[i] = true;
+        }
+
+        auto findRoot = [parents](u32 index)
+        {
+            while(parents[index] != index)
+            {
+                parents[index] = parents[parents[index]];
+                index          = parents[index];
+            }
+            return index;
+        };
+
+        // Static bodies never join islands together, otherwise everything resting on the ground would be one island.
+        // The lower index always becomes the root so the islands do not depend on the order bodies are joined in.
+        auto join = [this, parents, &findRoot](const RigidBody3D* a, const RigidBody3D* b)
+        {
+            if(!a || !b || a->GetIsStatic() || b->GetIsStatic())
+                return;
+
+            const u32 rootA = findRoot((u32)(a - m_RigidBodies));
+            const u32 rootB = findRoot((u32)(b - m_RigidBodies));
+            if(rootA < rootB)
+                parents[rootB] = rootA;
+            else if(rootB < rootA)
+                parents[rootA] = rootB;
+        };
+
+        for(uint32_t index = 0; index < m_ManifoldCount; index++)
+            join(m_Manifolds[index].NodeA(), m_Manifolds[index].NodeB());
+
+        for(uint32_t index = 0; index < m_ConstraintCount; index++)
+            join(m_Constraints[index]->GetBodyA(), m_Constraints[index]->GetBodyB());
+
+        // Sleeping bodies are no longer tested against each other, so they stay in the island they fell asleep in.
+        // A body woken up this step pulls the rest of that island along with it.
+        for(u32 i = 0; i < m_RigidBodyCount; i++)
+        {
+            RigidBody3D& current = m_RigidBodies[i];
+            if(!current.GetIsValid() || current.GetIsStatic())
+                continue;
+
+            const RigidBody3D& island = m_RigidBodies[m_BodyIslands[i]];
+            if(island.GetIsValid() && (!current.IsAwake() || !island.IsAwake()))
+                join(&current, &island);
+        }
+
+        for(u32 i = 0; i < m_RigidBodyCount; i++)
+        {
+            RigidBody3D& current = m_RigidBodies[i];
+            if(!current.GetIsValid() || current.GetIsStatic())
+                continue;
+
+            current.RestTest();
+            if(!current.CanSleep())
+                islandCanSleep[findRoot(i)] = false;
+        }
+
+        m_Stats.SleepingIslandCount = 0;
+        for(u32 i = 0; i < m_RigidBodyCount; i++)
+        {
+            RigidBody3D& current = m_RigidBodies[i];
+            if(!current.GetIsValid() || current.GetIsStatic())
+                continue;
+
+            const u32 root   = findRoot(i);
+            m_BodyIslands[i] = root;
+
+            if(islandCanSleep[root])
+            {
+                if(current.IsAwake())
+                {
+                    m_BodyStreams.SetLinearVelocity(i, Vec3(0.0f));
+                    m_BodyStreams.SetAngularVelocity(i, Vec3(0.0f));
+                    current.SetIsAtRest(true);
+                }
+
+                if(root == i)
+                    m_Stats.SleepingIslandCount++;
             }
+            else if(!current.IsAwake())
+                current.WakeUp();
         }
+
+        ScratchEnd(scratch);
     }
 
     void LumosPhysicsEngine::ClearConstraints()
@@ -588,6 +728,8 @@ namespace Lumos
             return "Sort and Sweap";
         case BroadphaseType::OCTREE:
             return "Octree";
+        case BroadphaseType::DYNAMIC_TREE:
+            return "Dynamic AABB Tree";
         default:
             return "";
         }
@@ -601,12 +743,18 @@ namespace Lumos
         switch(type)
         {
         case BroadphaseType::SORT_AND_SWEAP:
+            m_BroadphaseDetection = Lumos::CreateSharedPtr<SortAndSweepBroadphase>();
+            break;
         case BroadphaseType::BRUTE_FORCE:
             m_BroadphaseDetection = Lumos::CreateSharedPtr<BruteForceBroadphase>();
             break;
         case BroadphaseType::OCTREE:
             m_BroadphaseDetection = Lumos::CreateSharedPtr<OctreeBroadphase>(5, 8);
             break;
+        case BroadphaseType::DYNAMIC_TREE:
+            // Shares the query tree so it is only kept up to date once per step
+            m_BroadphaseDetection = m_QueryTree;
+            break;
         default:
             m_BroadphaseDetection = Lumos::CreateSharedPtr<BruteForceBroadphase>();
             break;
@@ -615,6 +763,125 @@ namespace Lumos
         m_BroadphaseType = type;
     }
 
+    void LumosPhysicsEngine::UpdateQueryTree()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(!m_QueryTreeDirty)
+            return;
+
+        m_QueryTree->UpdateProxies(m_RigidBodies, m_RigidBodyCount);
+        m_QueryTreeDirty = false;
+    }
+
+    bool LumosPhysicsEngine::CastQuery(const Maths::Ray& ray, float radius, float maxDistance, RaycastHit3D& hit, u16 collisionMask) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        hit.Body = nullptr;
+
+        const float length = Maths::Length(ray.Direction);
+        if(length < Maths::M_EPSILON || maxDistance < 0.0f)
+            return false;
+
+        const Vec3 origin           = ray.Origin;
+        const Vec3 direction        = ray.Direction / length;
+        const DynamicAABBTree& tree = m_QueryTree->GetTree();
+
+        tree.Raycast(origin, direction, maxDistance, radius, [&](int32_t proxyId, float currentMax)
+                     {
+                         RigidBody3D* body = &m_RigidBodies[tree.GetUserData(proxyId)];
+                         if((collisionMask & (1 << body->GetCollisionLayer())) == 0)
+                             return currentMax;
+
+                         float distance;
+                         Vec3 normal;
+                         if(!body->GetCollisionShape()->Raycast(body, origin, direction, currentMax, radius, &distance, &normal))
+                             return currentMax;
+
+                         hit.Body     = body;
+                         hit.Distance = distance;
+                         hit.Normal   = normal;
+                         hit.Point    = origin + direction * distance - normal * radius;
+                         return distance; });
+
+        return hit.Body != nullptr;
+    }
+
+    bool LumosPhysicsEngine::Raycast(const Maths::Ray& ray, float maxDistance, RaycastHit3D& hit, u16 collisionMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UpdateQueryTree();
+        return CastQuery(ray, 0.0f, maxDistance, hit, collisionMask);
+    }
+
+    bool LumosPhysicsEngine::SphereCast(const Maths::Ray& ray, float radius, float maxDistance, RaycastHit3D& hit, u16 collisionMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UpdateQueryTree();
+        return CastQuery(ray, radius, maxDistance, hit, collisionMask);
+    }
+
+    uint32_t LumosPhysicsEngine::OverlapAABB(const Maths::BoundingBox& box, TDArray<RigidBody3D*>& results, u16 collisionMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UpdateQueryTree();
+
+        const uint32_t startCount   = (uint32_t)results.Size();
+        const DynamicAABBTree& tree = m_QueryTree->GetTree();
+        tree.Query(box, [&](int32_t proxyId)
+                   {
+                       RigidBody3D* body = &m_RigidBodies[tree.GetUserData(proxyId)];
+                       if((collisionMask & (1 << body->GetCollisionLayer())) != 0 && box.IsInsideFast(body->GetWorldSpaceAABB()))
+                           results.PushBack(body);
+                       return true; });
+
+        return (uint32_t)results.Size() - startCount;
+    }
+
+    uint32_t LumosPhysicsEngine::OverlapSphere(const Vec3& centre, float radius, TDArray<RigidBody3D*>& results, u16 collisionMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UpdateQueryTree();
+
+        const uint32_t startCount   = (uint32_t)results.Size();
+        const DynamicAABBTree& tree = m_QueryTree->GetTree();
+        const Maths::BoundingBox box(centre - Vec3(radius), centre + Vec3(radius));
+
+        tree.Query(box, [&](int32_t proxyId)
+                   {
+                       RigidBody3D* body = &m_RigidBodies[tree.GetUserData(proxyId)];
+                       if((collisionMask & (1 << body->GetCollisionLayer())) == 0)
+                           return true;
+
+                       // A zero length sphere cast only hits if the sphere already overlaps the shape
+                       float distance;
+                       Vec3 normal;
+                       if(body->GetCollisionShape()->Raycast(body, centre, Vec3(0.0f, 1.0f, 0.0f), 0.0f, radius, &distance, &normal))
+                           results.PushBack(body);
+                       return true; });
+
+        return (uint32_t)results.Size() - startCount;
+    }
+
+    void LumosPhysicsEngine::RaycastBatch(const Maths::Ray* rays, uint32_t rayCount, float maxDistance, RaycastHit3D* hits, u16 collisionMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        UpdateQueryTree();
+
+        // The tree and cached body transforms are only read from here on, so rays can run on any thread
+        const uint32_t raysPerJob = 64;
+        if(rayCount <= raysPerJob)
+        {
+            for(uint32_t i = 0; i < rayCount; i++)
+                CastQuery(rays[i], 0.0f, maxDistance, hits[i], collisionMask);
+            return;
+        }
+
+        System::JobSystem::Context ctx;
+        System::JobSystem::Dispatch(ctx, rayCount, raysPerJob, [this, rays, hits, maxDistance, collisionMask](JobDispatchArgs args)
+                                    { CastQuery(rays[args.jobIndex], 0.0f, maxDistance, hits[args.jobIndex], collisionMask); });
+        System::JobSystem::Wait(ctx);
+    }
+
     void LumosPhysicsEngine::OnImGui()
     {
         LUMOS_PROFILE_FUNCTION();
@@ -640,6 +907,15 @@ namespace Lumos
         ImGuiUtilities::Property("Collision Count", m_Stats.CollisionCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("NarrowPhase Count", m_Stats.NarrowPhaseCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("Constraint Count", m_Stats.ConstraintCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Warm Started Contacts", m_Stats.WarmStartedContactCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Sleeping Islands", m_Stats.SleepingIslandCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Warm Starting", m_WarmStarting);
+        ImGuiUtilities::Property("Velocity Iterations", m_VelocityIterations);
+
+        uint32_t queryProxyCount = m_QueryTree->GetTree().GetProxyCount();
+        int32_t queryTreeHeight  = m_QueryTree->GetTree().GetHeight();
+        ImGuiUtilities::Property("Query Tree Proxies", queryProxyCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Query Tree Height", queryTreeHeight, ImGuiUtilities::PropertyFlag::ReadOnly);
 
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Paused");
@@ -727,7 +1003,7 @@ namespace Lumos
         for(u32 i = 0; i < m_RigidBodyCount; i++)
         {
             RigidBody3D& current = m_RigidBodies[i];
-            if(current.m_IsValid)
+            if(current.GetIsValid())
             {
                 current.DebugDraw(m_DebugDrawFlags);
                 if(current.GetCollisionShape() && (m_DebugDrawFlags & PhysicsDebugFlags::COLLISIONVOLUMES))
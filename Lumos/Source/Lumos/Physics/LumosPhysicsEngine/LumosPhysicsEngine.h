@@ -3,6 +3,7 @@
 #include "Utilities/TSingleton.h"
 #include "Narrowphase/Manifold.h"
 #include "Broadphase/Broadphase.h"
+#include "RigidBodyStreams.h"
 #include "Scene/ISystem.h"
 #include "Core/OS/Allocators/PoolAllocator.h"
 #include "Core/Mutex.h"
@@ -24,6 +25,7 @@ namespace Lumos
         BRUTE_FORCE    = 0,
         SORT_AND_SWEAP = 1,
         OCTREE         = 2,
+        DYNAMIC_TREE   = 3,
     };
 
     enum PhysicsDebugFlags : uint32_t
@@ -43,6 +45,13 @@ namespace Lumos
     class Constraint;
     class TimeStep;
     class Scene;
+    class DynamicTreeBroadphase;
+    struct CollisionData;
+
+    namespace Maths
+    {
+        class Ray;
+    }
 
     struct PhysicsStats3D
     {
@@ -52,6 +61,16 @@ namespace Lumos
         uint32_t StaticCount;
         uint32_t ConstraintCount;
         uint32_t NarrowPhaseCount;
+        uint32_t WarmStartedContactCount;
+        uint32_t SleepingIslandCount;
+    };
+
+    struct RaycastHit3D
+    {
+        RigidBody3D* Body = nullptr;
+        Vec3 Point;
+        Vec3 Normal;
+        float Distance = 0.0f;
     };
 
     struct LumosPhysicsEngineConfig
@@ -126,6 +145,16 @@ namespace Lumos
 
         const PhysicsStats3D& GetStats() const { return m_Stats; }
 
+        // Scene queries, answered by a dynamic AABB tree over every body whichever broadphase is in use.
+        // collisionMask selects bodies by collision layer, the same way RigidBody3D::CanCollideWith does.
+        bool Raycast(const Maths::Ray& ray, float maxDistance, RaycastHit3D& hit, u16 collisionMask = 0xFFFF);
+        bool SphereCast(const Maths::Ray& ray, float radius, float maxDistance, RaycastHit3D& hit, u16 collisionMask = 0xFFFF);
+        uint32_t OverlapAABB(const Maths::BoundingBox& box, TDArray<RigidBody3D*>& results, u16 collisionMask = 0xFFFF);
+        uint32_t OverlapSphere(const Vec3& centre, float radius, TDArray<RigidBody3D*>& results, u16 collisionMask = 0xFFFF);
+
+        // hits[i] receives the closest hit for rays[i], with a null Body on a miss. Large batches are split across the job system.
+        void RaycastBatch(const Maths::Ray* rays, uint32_t rayCount, float maxDistance, RaycastHit3D* hits, u16 collisionMask = 0xFFFF);
+
     protected:
         // The actual time-independant update function
         void UpdatePhysics();
@@ -135,15 +164,35 @@ namespace Lumos
 
         // Handles narrowphase collision detection
         void NarrowPhaseCollisions();
+        bool TestCollisionPair(const CollisionPair& pair, Manifold& manifold, CollisionData& colData, bool& manifoldBuilt) const;
 
-        // Updates all Rigid Body position, orientation, velocity etc (default method uses symplectic euler integration)
+        // Updates all Rigid Body position, orientation, velocity etc (default method uses symplectic euler integration).
+        // Runs every position iteration over m_BodyStreams, which own the state of all bodies in m_RigidBodies.
         void UpdateRigidBodies();
-        void UpdateRigidBody(RigidBody3D* obj) const;
 
         // Solves all engine constraints (constraints and manifolds)
         void SolveConstraints();
 
+        // Groups dynamic bodies joined by contacts or constraints into islands that fall asleep and wake up together
+        void UpdateIslands();
+
+        // Rebuilds m_ManifoldKeys from m_Manifolds, sorted by body pair
+        void SortManifoldKeys();
+
+        // Finds last step's manifold for the same pair and carries its accumulated impulses over
+        void ContinueManifold(Manifold& manifold) const;
+
+        // Brings the query tree up to date if bodies may have moved since it was last built
+        void UpdateQueryTree();
+        bool CastQuery(const Maths::Ray& ray, float radius, float maxDistance, RaycastHit3D& hit, u16 collisionMask) const;
+
     protected:
+        struct ManifoldKey
+        {
+            uint64_t Pair; // Index of body A in the upper 32 bits, body B in the lower
+            uint32_t Index;
+        };
+
         bool m_IsPaused;
         float m_UpdateAccum;
         Vec3 m_Gravity;
@@ -151,13 +200,20 @@ namespace Lumos
         uint32_t m_MaxUpdatesPerFrame = 5;
         uint32_t m_PositionIterations = 2;
         uint32_t m_VelocityIterations = 10;
+        bool m_WarmStarting           = true;
 
         float m_BaumgarteScalar = 0.2f;   // Amount of force to add to the System to solve error
         float m_BaumgarteSlop   = 0.001f; // Amount of allowed penetration, ensures a complete manifold each frame
 
         TDArray<CollisionPair> m_BroadphaseCollisionPairs;
         SharedPtr<Constraint>* m_Constraints; // Misc constraints between pairs of objects
-        Manifold* m_Manifolds;                // Contact constraints between pairs of objects
+        Manifold* m_Manifolds;                // Contact constraints between pairs of objects, one slot per broadphase pair
+        ManifoldKey* m_ManifoldKeys;          // Sorted by Pair once the narrowphase has finished
+
+        // Last step's manifolds, kept alive in the other manifold arena so new contacts can be warm started from them
+        Manifold* m_PreviousManifolds;
+        ManifoldKey* m_PreviousManifoldKeys;
+        u32 m_PreviousManifoldCount = 0;
 
         u32 m_ManifoldCount   = 0;
         u32 m_MaxManifolds    = 0;
@@ -165,11 +221,12 @@ namespace Lumos
         u32 m_RigidBodyCount  = 0;
 
         SharedPtr<Broadphase> m_BroadphaseDetection;
+        SharedPtr<DynamicTreeBroadphase> m_QueryTree;
+        bool m_QueryTreeDirty = true;
         BroadphaseType m_BroadphaseType;
         IntegrationType m_IntegrationType;
 
         uint32_t m_DebugDrawFlags = 0;
-        Mutex* m_ManifoldLock;
 
         RigidBody3D* m_RigidBodies;
         TDArray<RigidBody3D*> m_RigidBodyFreeList;
@@ -177,6 +234,12 @@ namespace Lumos
 
         Arena* m_Arena;
         Arena* m_FrameArena;
+        Arena* m_ManifoldArena;         // Cleared each step, grown when the pair count outgrows it
+        uint64_t m_ManifoldArenaSize = 0;
+        Arena* m_PreviousManifoldArena;
+        uint64_t m_PreviousManifoldArenaSize = 0;
+        u32* m_BodyIslands; // Island each body was last put in, the index of one of its bodies
+        RigidBodyStreams m_BodyStreams;
 
         PhysicsStats3D m_Stats;
 
@@ -122,25 +122,33 @@ namespace Lumos
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        TDArray<Vec3>& shapeCollisionAxes           = complexShape->GetCollisionAxes(complexObj);
-        TDArray<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
-
-        Vec3 p   = GetClosestPointOnEdges(sphereObj->GetPosition(), complex_shape_edges);
-        Vec3 p_t = sphereObj->GetPosition() - p;
-        p_t.Normalise();
-
         const int MAX_COLLISION_AXES = 100;
         Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
         uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shapeCollisionAxes)
+        Vec3 p_t;
+
         {
-            if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+            // Shapes write their world space axes and edges into per thread scratch memory so pairs can be tested in parallel
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            TDArray<Vec3> shapeCollisionAxes(scratch.arena);
+            TDArray<CollisionEdge> complex_shape_edges(scratch.arena);
+            complexShape->GetCollisionAxes(complexObj, shapeCollisionAxes);
+            complexShape->GetEdges(complexObj, complex_shape_edges);
+
+            Vec3 p = GetClosestPointOnEdges(sphereObj->GetPosition(), complex_shape_edges);
+            p_t    = sphereObj->GetPosition() - p;
+            p_t.Normalise();
+
+            for(const Vec3& axis : shapeCollisionAxes)
             {
-                LWARN("Collision axes limit reached in CheckPolyhedronSphereCollision");
-                break;
+                if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+                {
+                    LWARN("Collision axes limit reached in CheckPolyhedronSphereCollision");
+                    break;
+                }
+                possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
             }
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+            ScratchEnd(scratch);
         }
 
         AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount, MAX_COLLISION_AXES);
@@ -169,36 +177,39 @@ namespace Lumos
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        TDArray<Vec3>& shape1CollisionAxes         = shape1->GetCollisionAxes(obj1);
-        TDArray<Vec3>& shape2PossibleCollisionAxes = shape2->GetCollisionAxes(obj2);
-
         const int MAX_COLLISION_AXES = 100;
         Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
         uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shape1CollisionAxes)
+
         {
-            if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            TDArray<Vec3> shape1CollisionAxes(scratch.arena);
+            TDArray<Vec3> shape2PossibleCollisionAxes(scratch.arena);
+            shape1->GetCollisionAxes(obj1, shape1CollisionAxes);
+            shape2->GetCollisionAxes(obj2, shape2PossibleCollisionAxes);
+
+            for(const Vec3& axis : shape1CollisionAxes)
             {
-                LWARN("Collision axes limit reached in CheckPolyhedronCollision (shape1)");
-                break;
+                if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+                {
+                    LWARN("Collision axes limit reached in CheckPolyhedronCollision (shape1)");
+                    break;
+                }
+                possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
             }
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
 
-        for(const Vec3& axis : shape2PossibleCollisionAxes)
-        {
-            if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+            for(const Vec3& axis : shape2PossibleCollisionAxes)
             {
-                LWARN("Collision axes limit reached in CheckPolyhedronCollision (shape2)");
-                break;
+                if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+                {
+                    LWARN("Collision axes limit reached in CheckPolyhedronCollision (shape2)");
+                    break;
+                }
+                possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
             }
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+            ScratchEnd(scratch);
         }
 
-        TDArray<CollisionEdge>& shape1_edges = shape1->GetEdges(obj1);
-        TDArray<CollisionEdge>& shape2_edges = shape2->GetEdges(obj2);
-
         for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
         {
             const Vec3& axis = possibleCollisionAxes[i];
@@ -677,25 +688,33 @@ namespace Lumos
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        TDArray<Vec3>& shapeCollisionAxes           = complexShape->GetCollisionAxes(complexObj);
-        TDArray<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
-
-        Vec3 p   = GetClosestPointOnEdges(capsuleObj->GetPosition(), complex_shape_edges);
-        Vec3 p_t = capsuleObj->GetPosition() - p;
-        p_t.Normalise();
-
         const int MAX_COLLISION_AXES = 100;
         Vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
         uint32_t possibleCollisionAxesCount = 0;
-        for(const Vec3& axis : shapeCollisionAxes)
+        Vec3 p_t;
+
         {
-            if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+            // Shapes write their world space axes and edges into per thread scratch memory so pairs can be tested in parallel
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            TDArray<Vec3> shapeCollisionAxes(scratch.arena);
+            TDArray<CollisionEdge> complex_shape_edges(scratch.arena);
+            complexShape->GetCollisionAxes(complexObj, shapeCollisionAxes);
+            complexShape->GetEdges(complexObj, complex_shape_edges);
+
+            Vec3 p = GetClosestPointOnEdges(capsuleObj->GetPosition(), complex_shape_edges);
+            p_t    = capsuleObj->GetPosition() - p;
+            p_t.Normalise();
+
+            for(const Vec3& axis : shapeCollisionAxes)
             {
-                LWARN("Collision axes limit reached in CheckPolyhedronCapsuleCheckCollision");
-                break;
+                if(possibleCollisionAxesCount >= MAX_COLLISION_AXES)
+                {
+                    LWARN("Collision axes limit reached in CheckPolyhedronCapsuleCheckCollision");
+                    break;
+                }
+                possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
             }
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+            ScratchEnd(scratch);
         }
 
         AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount, MAX_COLLISION_AXES);
@@ -12,6 +12,27 @@ namespace Lumos
 
 #define persistentThresholdSq 0.025f
 
+    // Picks the world axis least aligned with the normal, so the basis only drifts slightly as the normal does
+    // and friction impulses carried over from the last step still point roughly the same way
+    static void ComputeTangentBasis(const Vec3& normal, Vec3& tangent1, Vec3& tangent2)
+    {
+        if(Maths::Abs(normal.x) >= 0.57735f)
+            tangent1 = Vec3(normal.y, -normal.x, 0.0f);
+        else
+            tangent1 = Vec3(0.0f, normal.z, -normal.y);
+
+        tangent1 = tangent1.Normalised();
+        tangent2 = Maths::Cross(normal, tangent1);
+    }
+
+    static float InverseEffectiveMass(const RigidBody3D* nodeA, const RigidBody3D* nodeB, const Vec3& r1, const Vec3& r2, const Vec3& axis)
+    {
+        const float mass = (nodeA->GetInverseMass() + nodeB->GetInverseMass())
+            + Maths::Dot(axis, Maths::Cross(nodeA->GetInverseInertia() * Maths::Cross(r1, axis), r1) + Maths::Cross(nodeB->GetInverseInertia() * Maths::Cross(r2, axis), r2));
+
+        return mass > Maths::M_EPSILON ? 1.0f / mass : 0.0f;
+    }
+
     Manifold::Manifold()
         : m_pNodeA(nullptr)
         , m_pNodeB(nullptr)
@@ -24,7 +45,8 @@ namespace Lumos
 
     void Manifold::Initiate(RigidBody3D* nodeA, RigidBody3D* nodeB, float BaumgarteScalar, float BaumgarteSlop)
     {
-        m_ContactCount = 0;
+        m_ContactCount     = 0;
+        m_WarmStartedCount = 0;
 
         m_pNodeA = nodeA;
         m_pNodeB = nodeB;
@@ -60,15 +82,6 @@ namespace Lumos
 
         // Collision Resoluton
         {
-            const float constraintMass = (m_pNodeA->GetInverseMass()
-                                          + m_pNodeB->GetInverseMass())
-                + Maths::Dot(normal,
-                             Maths::Cross(m_pNodeA->GetInverseInertia()
-                                              * Maths::Cross(r1, normal),
-                                          r1)
-                                 + Maths::Cross(m_pNodeB->GetInverseInertia()
-                                                    * Maths::Cross(r2, normal),
-                                                r2));
             // Baumgarte Offset ( Adds energy to the System to counter
             // slight solving errors that accumulate over time
             // called as �constraint drift �)
@@ -76,62 +89,56 @@ namespace Lumos
             float penetrationSlop      = Maths::Min(c.collisionPenetration + m_BaumgarteSlop, 0.0f);
             float b                    = -(m_BaumgarteScalar / LumosPhysicsEngine::GetDeltaTime()) * penetrationSlop;
             float b_real               = Maths::Max(b, c.elatisity_term + b * 0.2f);
-            float jn                   = -(Maths::Dot(dv, normal) + b_real) / constraintMass;
+            float jn                   = -(Maths::Dot(dv, normal) + b_real) * c.normalMass;
             float oldSumImpulseContact = c.sumImpulseContact;
 
-            jn                  = Maths::Min(jn, 0.0f);
+            // Only the accumulated impulse is clamped, so iterations can take back part of a warm started impulse
             c.sumImpulseContact = Maths::Min(c.sumImpulseContact + jn, 0.0f);
             jn                  = c.sumImpulseContact - oldSumImpulseContact;
 
-            m_pNodeA->SetLinearVelocity(m_pNodeA->GetLinearVelocity()
-                                        + normal * (jn * m_pNodeA->GetInverseMass()));
-            m_pNodeB->SetLinearVelocity(m_pNodeB->GetLinearVelocity()
-                                        - normal * (jn * m_pNodeB->GetInverseMass()));
-
-            m_pNodeA->SetAngularVelocity(m_pNodeA->GetAngularVelocity()
-                                         + m_pNodeA->GetInverseInertia()
-                                             * Maths::Cross(r1, normal * jn));
-            m_pNodeB->SetAngularVelocity(m_pNodeB->GetAngularVelocity()
-                                         - m_pNodeB->GetInverseInertia()
-                                             * Maths::Cross(r2, normal * jn));
+            ApplyContactImpulse(r1, r2, normal * jn);
         }
         // Friction
         {
-            Vec3 tangent      = dv - normal * Maths::Dot(dv, normal);
-            float tangent_len = Maths::Length(tangent);
+            const float frictionCoef = Maths::Sqrt(m_pNodeA->GetFriction() * m_pNodeB->GetFriction());
+
+            // Clamp friction to never apply more force than the main collision
+            // resolution force
+            const float maxJt = frictionCoef * c.sumImpulseContact;
 
-            if(tangent_len > Maths::M_EPSILON)
+            for(uint32_t i = 0; i < 2; i++)
             {
-                tangent = tangent * (1.0f / tangent_len);
-
-                float frictionalMass = (m_pNodeA->GetInverseMass() + m_pNodeB->GetInverseMass())
-                    + Maths::Dot(tangent, Maths::Cross(m_pNodeA->GetInverseInertia() * Maths::Cross(r1, tangent), r1) + Maths::Cross(m_pNodeB->GetInverseInertia() * Maths::Cross(r2, tangent), r2));
-                float frictionCoef = Maths::Sqrt(m_pNodeA->GetFriction() * m_pNodeB->GetFriction());
-                float jt           = -1.0f * frictionCoef * Maths::Dot(dv, tangent) / frictionalMass;
-
-                // Clamp friction to never apply more force than the main collision
-                // resolution force
-
-                float oldImpulseTangent = c.sumImpulseFriction;
-                float maxJt             = frictionCoef * c.sumImpulseContact;
-                c.sumImpulseFriction    = Maths::Min(Maths::Max(oldImpulseTangent + jt, maxJt), -maxJt);
-                jt                      = c.sumImpulseFriction - oldImpulseTangent;
-
-                m_pNodeA->SetLinearVelocity(m_pNodeA->GetLinearVelocity()
-                                            + tangent * (jt * m_pNodeA->GetInverseMass()));
-                m_pNodeB->SetLinearVelocity(m_pNodeB->GetLinearVelocity()
-                                            - tangent * (jt * m_pNodeB->GetInverseMass()));
-
-                m_pNodeA->SetAngularVelocity(m_pNodeA->GetAngularVelocity()
-                                             + m_pNodeA->GetInverseInertia()
-                                                 * Maths::Cross(r1, tangent * jt));
-                m_pNodeB->SetAngularVelocity(m_pNodeB->GetAngularVelocity()
-                                             - m_pNodeB->GetInverseInertia()
-                                                 * Maths::Cross(r2, tangent * jt));
+                const Vec3& tangent = c.frictionTangents[i];
+
+                v0 = m_pNodeA->GetLinearVelocity() + Maths::Cross(m_pNodeA->GetAngularVelocity(), r1);
+                v1 = m_pNodeB->GetLinearVelocity() + Maths::Cross(m_pNodeB->GetAngularVelocity(), r2);
+                dv = v0 - v1;
+
+                float jt                = -1.0f * frictionCoef * Maths::Dot(dv, tangent) * c.frictionMass[i];
+                float oldImpulseTangent = c.sumImpulseFriction[i];
+                c.sumImpulseFriction[i] = Maths::Min(Maths::Max(oldImpulseTangent + jt, maxJt), -maxJt);
+                jt                      = c.sumImpulseFriction[i] - oldImpulseTangent;
+
+                ApplyContactImpulse(r1, r2, tangent * jt);
             }
         }
     }
 
+    void Manifold::ApplyContactImpulse(const Vec3& r1, const Vec3& r2, const Vec3& impulse) const
+    {
+        m_pNodeA->SetLinearVelocity(m_pNodeA->GetLinearVelocity()
+                                    + impulse * m_pNodeA->GetInverseMass());
+        m_pNodeB->SetLinearVelocity(m_pNodeB->GetLinearVelocity()
+                                    - impulse * m_pNodeB->GetInverseMass());
+
+        m_pNodeA->SetAngularVelocity(m_pNodeA->GetAngularVelocity()
+                                     + m_pNodeA->GetInverseInertia()
+                                         * Maths::Cross(r1, impulse));
+        m_pNodeB->SetAngularVelocity(m_pNodeB->GetAngularVelocity()
+                                     - m_pNodeB->GetInverseInertia()
+                                         * Maths::Cross(r2, impulse));
+    }
+
     void Manifold::PreSolverStep(float dt)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
@@ -142,13 +149,64 @@ namespace Lumos
         }
     }
 
+    void Manifold::ContinueFrom(const Manifold& previous)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(previous.m_pNodeA != m_pNodeA || previous.m_pNodeB != m_pNodeB)
+            return;
+
+        for(uint32_t i = 0; i < m_ContactCount; i++)
+        {
+            ContactPoint& contact = m_vContacts[i];
+
+            float closestDistSq           = persistentThresholdSq;
+            const ContactPoint* matchedTo = nullptr;
+            for(uint32_t j = 0; j < previous.m_ContactCount; j++)
+            {
+                const ContactPoint& old = previous.m_vContacts[j];
+                const Vec3 ab           = old.localPosA - contact.localPosA;
+                const float distSq      = Maths::Dot(ab, ab);
+
+                if(distSq < closestDistSq && Maths::Dot(old.collisionNormal, contact.collisionNormal) > 0.9f)
+                {
+                    closestDistSq = distSq;
+                    matchedTo     = &old;
+                }
+            }
+
+            if(matchedTo)
+            {
+                contact.sumImpulseContact     = matchedTo->sumImpulseContact;
+                contact.sumImpulseFriction[0] = matchedTo->sumImpulseFriction[0];
+                contact.sumImpulseFriction[1] = matchedTo->sumImpulseFriction[1];
+                m_WarmStartedCount++;
+            }
+        }
+    }
+
+    void Manifold::WarmStart()
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_WarmStartedCount == 0 || m_pNodeA->GetInverseMass() + m_pNodeB->GetInverseMass() < Maths::M_EPSILON)
+            return;
+
+        for(uint32_t i = 0; i < m_ContactCount; i++)
+        {
+            const ContactPoint& c = m_vContacts[i];
+            const Vec3 impulse    = c.collisionNormal * c.sumImpulseContact + c.frictionTangents[0] * c.sumImpulseFriction[0] + c.frictionTangents[1] * c.sumImpulseFriction[1];
+            ApplyContactImpulse(c.relPosA, c.relPosB, impulse);
+        }
+    }
+
     void Manifold::UpdateConstraint(ContactPoint& contact)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
 
-        // Reset total impulse forces computed this physics timestep
-        contact.sumImpulseContact  = 0.0f;
-        contact.sumImpulseFriction = 0.0f;
+        // Accumulated impulses are left as they are, either zero for a new contact or carried over by ContinueFrom
+        ComputeTangentBasis(contact.collisionNormal, contact.frictionTangents[0], contact.frictionTangents[1]);
+        contact.normalMass      = InverseEffectiveMass(m_pNodeA, m_pNodeB, contact.relPosA, contact.relPosB, contact.collisionNormal);
+        contact.frictionMass[0] = InverseEffectiveMass(m_pNodeA, m_pNodeB, contact.relPosA, contact.relPosB, contact.frictionTangents[0]);
+        contact.frictionMass[1] = InverseEffectiveMass(m_pNodeA, m_pNodeB, contact.relPosA, contact.relPosB, contact.frictionTangents[1]);
 
         // Compute Elasticity Term - must be computed prior to solving
         // ANY constraints otherwise the objects velocities may have
@@ -197,9 +255,8 @@ namespace Lumos
         contact.relPosB              = r2;
         contact.collisionNormal      = _normal;
         contact.collisionPenetration = _penetration;
+        contact.localPosA            = Maths::Transpose(Mat3(m_pNodeA->GetOrientation())) * r1;
         contact.elatisity_term       = 1.0f;
-        contact.sumImpulseContact    = 0.0f;
-        contact.sumImpulseFriction   = 0.0f;
 
         // Check to see if we already contain a contact point almost in that location
         const float min_allowed_dist_sq = 0.2f * 0.2f;
@@ -228,8 +285,24 @@ namespace Lumos
 
         if(should_add)
         {
-            m_vContacts[m_ContactCount] = contact;
-            m_ContactCount++;
+            // Clipping two faces can give more points than the manifold holds, keep the deepest ones
+            if(m_ContactCount == MAX_CONTACT_POINTS)
+            {
+                uint32_t shallowest = 0;
+                for(uint32_t i = 1; i < m_ContactCount; i++)
+                {
+                    if(m_vContacts[i].collisionPenetration > m_vContacts[shallowest].collisionPenetration)
+                        shallowest = i;
+                }
+
+                if(m_vContacts[shallowest].collisionPenetration > contact.collisionPenetration)
+                    m_vContacts[shallowest] = contact;
+            }
+            else
+            {
+                m_vContacts[m_ContactCount] = contact;
+                m_ContactCount++;
+            }
         }
     }
 
@@ -11,14 +11,20 @@ namespace Lumos
         */
     struct LUMOS_EXPORT ContactPoint
     {
-        float sumImpulseContact    = 0.0f;
-        float sumImpulseFriction   = 0.0f;
-        float elatisity_term       = 0.0f;
-        float collisionPenetration = 0.0f;
+        float sumImpulseContact     = 0.0f;
+        float sumImpulseFriction[2] = { 0.0f, 0.0f }; // Along each of frictionTangents
+        float elatisity_term        = 0.0f;
+        float collisionPenetration  = 0.0f;
+
+        // Inverse effective masses, fixed for the whole velocity solve so they are computed once in PreSolverStep
+        float normalMass      = 0.0f;
+        float frictionMass[2] = { 0.0f, 0.0f };
 
         Vec3 collisionNormal;
-        Vec3 relPosA; // Position relative to objectA
-        Vec3 relPosB; // Position relative to objectB
+        Vec3 frictionTangents[2];
+        Vec3 relPosA;   // Position relative to objectA
+        Vec3 relPosB;   // Position relative to objectB
+        Vec3 localPosA; // Position in objectA's local space, used to find the same contact next step
     };
 #define MAX_CONTACT_POINTS 8
 
@@ -38,6 +44,14 @@ namespace Lumos
         void ApplyImpulse();
         void PreSolverStep(float dt);
 
+        // Copies the accumulated impulses of last step's manifold for the same pair onto contacts that have not moved
+        // on objectA, then WarmStart applies them before the first iteration so the solver starts close to the answer
+        void ContinueFrom(const Manifold& previous);
+        void WarmStart();
+
+        uint32_t GetContactCount() const { return m_ContactCount; }
+        uint32_t GetWarmStartedCount() const { return m_WarmStartedCount; }
+
         // Debug draws the manifold surface area
         void DebugDraw() const;
 
@@ -53,13 +67,15 @@ namespace Lumos
 
     protected:
         void SolveContactPoint(ContactPoint& c) const;
+        void ApplyContactImpulse(const Vec3& r1, const Vec3& r2, const Vec3& impulse) const;
         void UpdateConstraint(ContactPoint& c);
 
     protected:
         RigidBody3D* m_pNodeA;
         RigidBody3D* m_pNodeB;
         ContactPoint m_vContacts[MAX_CONTACT_POINTS];
-        uint32_t m_ContactCount = 0;
+        uint32_t m_ContactCount     = 0;
+        uint32_t m_WarmStartedCount = 0;
         float m_BaumgarteScalar = 0.2f;   // Amount of force to add to the System to solve error
         float m_BaumgarteSlop   = 0.001f; // Amount of allowed penetration, ensures a complete manifold each frame
     };
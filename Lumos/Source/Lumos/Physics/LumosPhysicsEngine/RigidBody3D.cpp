@@ -13,37 +13,41 @@
 namespace Lumos
 {
 
-    RigidBody3D::RigidBody3D(const RigidBody3DProperties& properties)
-        : m_WSTransformInvalidated(true)
-        , m_RestVelocityThresholdSquared(0.004f)
+    RigidBody3D::RigidBody3D(RigidBodyStreams* streams, u32 streamIndex, const RigidBody3DProperties& properties)
+        : m_RestVelocityThresholdSquared(0.004f)
         , m_AverageSummedVelocity(0.0f)
-        , m_WSAabbInvalidated(true)
-        , m_Position(properties.Position)
-        , m_LinearVelocity(properties.LinearVelocity)
+        , m_Streams(streams)
+        , m_StreamIndex(streamIndex)
+        , m_WSTransform(Mat4(1.0f))
         , m_Force(properties.Force)
-        , m_Orientation(properties.Orientation)
-        , m_AngularVelocity(properties.AngularVelocity)
         , m_Torque(properties.Torque)
         , m_InvInertia(Mat3(1.0f))
-        , m_AngularFactor(1.0f)
-        , m_WSTransform(Mat4(1.0f))
     {
         ASSERT(properties.Mass > 0.0f, "Mass <= 0");
-        
-        m_Static = properties.Static;
-        
+
+        m_Streams->Flag[m_StreamIndex] = RigidBodyStreams::TransformInvalidated | RigidBodyStreams::AabbInvalidated;
+        m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::Valid, true);
+        m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::Static, properties.Static);
+        m_Streams->SetPosition(m_StreamIndex, properties.Position);
+        m_Streams->SetLinearVelocity(m_StreamIndex, properties.LinearVelocity);
+        m_Streams->SetOrientation(m_StreamIndex, properties.Orientation);
+        m_Streams->SetAngularVelocity(m_StreamIndex, properties.AngularVelocity);
+        m_Streams->AngularFactor[m_StreamIndex] = 1.0f;
+
         // Static objects have infinite mass (zero inverse mass)
-        if(m_Static)
+        if(properties.Static)
         {
             m_InvMass = 0.0f;
-            m_AtRest = true;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, true);
         }
         else
         {
             m_InvMass = 1.0f / properties.Mass;
-            m_AtRest = properties.AtRest;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, properties.AtRest);
         }
 
+        UpdateAccelerations();
+
         m_LocalBoundingBox.Set(Vec3(-0.5f), Vec3(0.5f));
         m_CollisionShape = nullptr;
 
@@ -71,11 +75,11 @@ namespace Lumos
     const Maths::BoundingBox& RigidBody3D::GetWorldSpaceAABB()
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        if(m_WSAabbInvalidated)
+        if(m_Streams->HasFlag(m_StreamIndex, RigidBodyStreams::AabbInvalidated))
         {
             LUMOS_PROFILE_SCOPE_LOW("Calculate BoundingBox");
-            m_WSAabb            = m_LocalBoundingBox.Transformed(GetWorldSpaceTransform());
-            m_WSAabbInvalidated = false;
+            m_WSAabb = m_LocalBoundingBox.Transformed(GetWorldSpaceTransform());
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AabbInvalidated, false);
         }
 
         return m_WSAabb;
@@ -88,17 +92,17 @@ namespace Lumos
 
     void RigidBody3D::SetIsAtRest(const bool isAtRest)
     {
-        m_AtRest = isAtRest;
+        m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, isAtRest);
     }
 
     const Mat4& RigidBody3D::GetWorldSpaceTransform() const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        if(m_WSTransformInvalidated)
+        if(m_Streams->HasFlag(m_StreamIndex, RigidBodyStreams::TransformInvalidated))
         {
-            m_WSTransform = Mat4::Translation(m_Position) * Maths::ToMat4(m_Orientation);
+            m_WSTransform = Mat4::Translation(GetPosition()) * Maths::ToMat4(GetOrientation());
 
-            m_WSTransformInvalidated = false;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::TransformInvalidated, false);
         }
 
         return m_WSTransform;
@@ -130,7 +134,7 @@ namespace Lumos
             m_LocalBoundingBox.Merge(upper);
         }
 
-        m_WSAabbInvalidated = true;
+        m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AabbInvalidated, true);
     }
 
     void RigidBody3D::RestTest()
@@ -144,11 +148,8 @@ namespace Lumos
         static const float ALPHA = 0.15f;
 
         // Calculate exponential moving average
-        const float v = Maths::Length2(m_LinearVelocity) + Maths::Length2(m_AngularVelocity);
+        const float v = Maths::Length2(GetLinearVelocity()) + Maths::Length2(GetAngularVelocity());
         m_AverageSummedVelocity += ALPHA * (v - m_AverageSummedVelocity);
-
-        // Do test
-        SetIsAtRest(m_AverageSummedVelocity <= m_RestVelocityThresholdSquared);
     }
 
     void RigidBody3D::DebugDraw(uint64_t flags) const
@@ -167,7 +168,7 @@ namespace Lumos
         }
 
         if(flags & PhysicsDebugFlags::LINEARVELOCITY)
-            DebugRenderer::DrawThickLine(Vec3(m_WSTransform.Translation()), m_WSTransform * Vec4(m_LinearVelocity, 1.0f), 0.02f, false, Vec4(0.0f, 1.0f, 0.0f, 1.0f));
+            DebugRenderer::DrawThickLine(Vec3(m_WSTransform.Translation()), m_WSTransform * Vec4(GetLinearVelocity(), 1.0f), 0.02f, false, Vec4(0.0f, 1.0f, 0.0f, 1.0f));
 
         if(flags & PhysicsDebugFlags::LINEARFORCE)
             DebugRenderer::DrawThickLine(Vec3(m_WSTransform.Translation()), m_WSTransform * Vec4(m_Force, 1.0f), 0.02f, false, Vec4(0.0f, 0.0f, 1.0f, 1.0f));
@@ -206,42 +207,45 @@ namespace Lumos
         if(m_CollisionShape)
         {
             m_InvInertia = m_CollisionShape->BuildInverseInertia(m_InvMass);
+            UpdateAccelerations();
             AutoResizeBoundingBox();
         }
     }
 
     void RigidBody3D::SetAngularVelocity(const Vec3& v)
     {
-        if(m_Static)
+        if(GetIsStatic())
             return;
-        m_AngularVelocity = v;
+        m_Streams->SetAngularVelocity(m_StreamIndex, v);
 
         if(Maths::Length2(v) > Maths::M_EPSILON)
-            m_AtRest = false;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, false);
     }
 
     void RigidBody3D::SetLinearVelocity(const Vec3& v)
     {
-        if(m_Static)
+        if(GetIsStatic())
             return;
-        m_LinearVelocity = v;
+        m_Streams->SetLinearVelocity(m_StreamIndex, v);
 
         if(Maths::Length2(v) > Maths::M_EPSILON)
-            m_AtRest = false;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, false);
     }
     void RigidBody3D::SetForce(const Vec3& v)
     {
-        if(m_Static)
+        if(GetIsStatic())
             return;
         m_Force = v;
         if(Maths::Length2(v) > Maths::M_EPSILON)
-            m_AtRest = false;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, false);
+        UpdateAccelerations();
     }
 
     void RigidBody3D::CollisionShapeUpdated()
     {
         if(m_CollisionShape)
             m_InvInertia = m_CollisionShape->BuildInverseInertia(m_InvMass);
+        UpdateAccelerations();
         AutoResizeBoundingBox();
     }
 
@@ -250,6 +254,7 @@ namespace Lumos
         m_InvMass = v;
         if(m_CollisionShape)
             m_InvInertia = m_CollisionShape->BuildInverseInertia(m_InvMass);
+        UpdateAccelerations();
     }
 
     void RigidBody3D::SetMass(const float& v)
@@ -259,6 +264,14 @@ namespace Lumos
 
         if(m_CollisionShape)
             m_InvInertia = m_CollisionShape->BuildInverseInertia(m_InvMass);
+        UpdateAccelerations();
+    }
+
+    void RigidBody3D::UpdateAccelerations()
+    {
+        m_Streams->SetLinearAcceleration(m_StreamIndex, m_Force * m_InvMass);
+        m_Streams->SetAngularAcceleration(m_StreamIndex, m_InvInertia * m_Torque);
+        m_Streams->GravityScale[m_StreamIndex] = m_InvMass > 0.0f ? 1.0f : 0.0f;
     }
 
     const SharedPtr<CollisionShape>& RigidBody3D::GetCollisionShape() const
@@ -269,8 +282,8 @@ namespace Lumos
     RigidBody3DProperties RigidBody3D::GetProperties()
     {
         RigidBody3DProperties properties;
-        properties.Position       = m_Position;
-        properties.LinearVelocity = m_LinearVelocity;
+        properties.Position       = GetPosition();
+        properties.LinearVelocity = GetLinearVelocity();
         properties.Force          = m_Force;
         properties.Elasticity     = m_Elasticity;
 
@@ -278,12 +291,12 @@ namespace Lumos
             properties.Mass = 1.0f / m_InvMass;
         else
             properties.Mass = 1.0f;
-        properties.Orientation     = m_Orientation;
-        properties.AngularVelocity = m_AngularVelocity;
+        properties.Orientation     = GetOrientation();
+        properties.AngularVelocity = GetAngularVelocity();
         properties.Torque          = m_Torque;
-        properties.Static          = m_Static;
+        properties.Static          = GetIsStatic();
         properties.Friction        = m_Friction;
-        properties.AtRest          = m_AtRest;
+        properties.AtRest          = GetIsAtRest();
         properties.isTrigger       = m_Trigger;
         properties.Shape           = m_CollisionShape;
 
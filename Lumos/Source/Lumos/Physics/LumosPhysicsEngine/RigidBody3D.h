@@ -9,6 +9,7 @@
 #include "Maths/Matrix4.h"
 #include "Maths/Quaternion.h"
 #include "Core/Function.h"
+#include "RigidBodyStreams.h"
 
 namespace Lumos
 {
@@ -107,6 +108,8 @@ namespace Lumos
         SharedPtr<CollisionShape> Shape;
     };
 
+    // Handle onto one lane of the physics engine's RigidBodyStreams. Position, orientation, velocities and the
+    // static / at rest flags live in the streams, the rest of the body's state is stored here.
     class alignas(16) RigidBody3D
     {
         friend class LumosPhysicsEngine;
@@ -122,12 +125,12 @@ namespace Lumos
         DEFAULTCOPYANDMOVEDECLARE(RigidBody3D);
 
         //<--------- GETTERS ------------->
-        const Vec3& GetPosition() const { return m_Position; }
-        const Vec3& GetLinearVelocity() const { return m_LinearVelocity; }
+        Vec3 GetPosition() const { return m_Streams->GetPosition(m_StreamIndex); }
+        Vec3 GetLinearVelocity() const { return m_Streams->GetLinearVelocity(m_StreamIndex); }
         const Vec3& GetForce() const { return m_Force; }
         float GetInverseMass() const { return m_InvMass; }
-        const Quat& GetOrientation() const { return m_Orientation; }
-        const Vec3& GetAngularVelocity() const { return m_AngularVelocity; }
+        Quat GetOrientation() const { return m_Streams->GetOrientation(m_StreamIndex); }
+        Vec3 GetAngularVelocity() const { return m_Streams->GetAngularVelocity(m_StreamIndex); }
         const Vec3& GetTorque() const { return m_Torque; }
         const Mat3& GetInverseInertia() const { return m_InvInertia; }
         const Mat4& GetWorldSpaceTransform() const; // Built from scratch or returned from cached value
@@ -152,17 +155,16 @@ namespace Lumos
 
         void SetLocalBoundingBox(const Maths::BoundingBox& bb)
         {
-            m_LocalBoundingBox  = bb;
-            m_WSAabbInvalidated = true;
+            m_LocalBoundingBox = bb;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AabbInvalidated, true);
         }
 
         //<--------- SETTERS ------------->
 
         void SetPosition(const Vec3& v)
         {
-            m_Position               = v;
-            m_WSTransformInvalidated = true;
-            m_WSAabbInvalidated      = true;
+            m_Streams->SetPosition(m_StreamIndex, v);
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::TransformInvalidated | RigidBodyStreams::AabbInvalidated, true);
         }
 
         void SetLinearVelocity(const Vec3& v);
@@ -170,19 +172,24 @@ namespace Lumos
 
         void SetOrientation(const Quat& v)
         {
-            m_Orientation            = v;
-            m_WSTransformInvalidated = true;
+            m_Streams->SetOrientation(m_StreamIndex, v);
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::TransformInvalidated, true);
         }
 
         void SetAngularVelocity(const Vec3& v);
         void SetTorque(const Vec3& v)
         {
-            if(m_Static)
+            if(GetIsStatic())
                 return;
             m_Torque = v;
-            m_AtRest = false;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, false);
+            UpdateAccelerations();
+        }
+        void SetInverseInertia(const Mat3& v)
+        {
+            m_InvInertia = v;
+            UpdateAccelerations();
         }
-        void SetInverseInertia(const Mat3& v) { m_InvInertia = v; }
 
         //<---------- CALLBACKS ------------>
         void SetOnCollisionCallback(PhysicsCollisionCallback& callback) { m_OnCollisionCallback = callback; }
@@ -204,7 +211,9 @@ namespace Lumos
         }
 
         void AutoResizeBoundingBox();
+        // Updates the averaged velocity used by CanSleep. Bodies are put to sleep a whole island at a time by the physics engine.
         void RestTest();
+        bool CanSleep() const { return m_RestVelocityThresholdSquared > 0.0f && m_AverageSummedVelocity <= m_RestVelocityThresholdSquared; }
 
         void DebugDraw(uint64_t flags) const;
 
@@ -222,21 +231,21 @@ namespace Lumos
         bool GetIsTrigger() const { return m_Trigger; }
         void SetIsTrigger(bool trigger) { m_Trigger = trigger; }
 
-        float GetAngularFactor() const { return m_AngularFactor; }
-        void SetAngularFactor(float factor) { m_AngularFactor = factor; }
+        float GetAngularFactor() const { return m_Streams->AngularFactor[m_StreamIndex]; }
+        void SetAngularFactor(float factor) { m_Streams->AngularFactor[m_StreamIndex] = factor; }
 
-        bool GetIsStatic() const { return m_Static; }
-        bool GetIsAtRest() const { return m_AtRest; }
+        bool GetIsStatic() const { return m_Streams->HasFlag(m_StreamIndex, RigidBodyStreams::Static); }
+        bool GetIsAtRest() const { return m_Streams->HasFlag(m_StreamIndex, RigidBodyStreams::AtRest); }
         float GetElasticity() const { return m_Elasticity; }
         float GetFriction() const { return m_Friction; }
-        bool IsAwake() const { return !m_AtRest; }
+        bool IsAwake() const { return !GetIsAtRest(); }
         void SetElasticity(const float elasticity) { m_Elasticity = elasticity; }
         void SetFriction(const float friction) { m_Friction = friction; }
         void SetIsStatic(const bool isStatic)
         {
-            m_Static = isStatic;
-            if(m_Static)
-                m_AtRest = true;
+            m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::Static, isStatic);
+            if(isStatic)
+                m_Streams->SetFlag(m_StreamIndex, RigidBodyStreams::AtRest, true);
         }
         // void SetIsColliding(const bool colliding) { m_IsColliding = colliding; }
         UUID GetUUID() const { return m_UUID; }
@@ -258,40 +267,35 @@ namespace Lumos
 
         RigidBody3DProperties GetProperties();
 
-        bool GetIsValid() const { return m_IsValid; }
+        bool GetIsValid() const { return m_Streams && m_Streams->HasFlag(m_StreamIndex, RigidBodyStreams::Valid); }
 
     protected:
-        RigidBody3D(const RigidBody3DProperties& properties = RigidBody3DProperties());
+        RigidBody3D(RigidBodyStreams* streams, u32 streamIndex, const RigidBody3DProperties& properties = RigidBody3DProperties());
+
+        // Writes force * inverse mass and inverse inertia * torque to the streams, called whenever one of them changes
+        void UpdateAccelerations();
 
         float m_RestVelocityThresholdSquared;
         float m_AverageSummedVelocity;
         float m_Elasticity;
         float m_Friction;
 
+        RigidBodyStreams* m_Streams = nullptr;
+        u32 m_StreamIndex           = 0;
+
         mutable Mat4 m_WSTransform;
         Maths::BoundingBox m_LocalBoundingBox; //!< Model orientated bounding box in model space
 
         mutable Maths::BoundingBox m_WSAabb; //!< Axis aligned bounding box of this object in world space
 
-        mutable bool m_WSTransformInvalidated;
-        mutable bool m_WSAabbInvalidated; //!< Flag indicating if the cached world space transoformed AABB is invalid
-        bool m_Static;
-        bool m_AtRest;
-        float m_AngularFactor;
-
         UUID m_UUID;
 
-        Vec3 m_Position;
-        Vec3 m_LinearVelocity;
         Vec3 m_Force;
         float m_InvMass;
         bool m_Trigger       = false;
         u16 m_CollisionLayer = 0;
         u16 m_CollisionMask  = 0xFFFF;
-        bool m_IsValid       = true;
 
-        Quat m_Orientation;
-        Vec3 m_AngularVelocity;
         Vec3 m_Torque;
         Mat3 m_InvInertia;
 
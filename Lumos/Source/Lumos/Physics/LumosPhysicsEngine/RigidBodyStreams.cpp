@@ -0,0 +1,295 @@
+#include "Precompiled.h"
+#include "RigidBodyStreams.h"
+#include "LumosPhysicsEngine.h"
+#include "Core/OS/Memory.h"
+#include "Maths/MathsUtilities.h"
+
+#ifdef LUMOS_SSE
+#include <smmintrin.h>
+#endif
+
+namespace Lumos
+{
+    namespace
+    {
+#ifdef LUMOS_SSE
+        typedef __m128 FloatLane;
+
+        inline FloatLane LoadLane(const float* p) { return _mm_loadu_ps(p); }
+        inline void StoreLane(float* p, FloatLane v) { _mm_storeu_ps(p, v); }
+        inline FloatLane SplatLane(float v) { return _mm_set1_ps(v); }
+        inline FloatLane Add(FloatLane a, FloatLane b) { return _mm_add_ps(a, b); }
+        inline FloatLane Sub(FloatLane a, FloatLane b) { return _mm_sub_ps(a, b); }
+        inline FloatLane Mul(FloatLane a, FloatLane b) { return _mm_mul_ps(a, b); }
+        inline FloatLane InvSqrt(FloatLane v) { return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v)); }
+
+        typedef __m128 MaskLane;
+
+        // One byte per lane, 0 or 1, widened to an all ones / all zeros lane mask
+        inline MaskLane AwakeMask(uint32_t awake) { return _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(int(awake))), _mm_setzero_si128())); }
+        inline FloatLane Select(MaskLane mask, FloatLane a, FloatLane b) { return _mm_blendv_ps(b, a, mask); }
+#else
+        typedef float FloatLane;
+
+        inline FloatLane LoadLane(const float* p) { return *p; }
+        inline void StoreLane(float* p, FloatLane v) { *p = v; }
+        inline FloatLane SplatLane(float v) { return v; }
+        inline FloatLane Add(FloatLane a, FloatLane b) { return a + b; }
+        inline FloatLane Sub(FloatLane a, FloatLane b) { return a - b; }
+        inline FloatLane Mul(FloatLane a, FloatLane b) { return a * b; }
+        inline FloatLane InvSqrt(FloatLane v) { return 1.0f / Maths::Sqrt(v); }
+
+        // A single lane is only integrated when it is awake, so there is nothing to mask
+        typedef bool MaskLane;
+
+        inline MaskLane AwakeMask(uint32_t awake) { return awake != 0; }
+        inline FloatLane Select(MaskLane, FloatLane a, FloatLane) { return a; }
+#endif
+
+        // a * b + c
+        inline FloatLane MulAdd(FloatLane a, FloatLane b, FloatLane c) { return Add(Mul(a, b), c); }
+
+        struct Vec3Lane
+        {
+            FloatLane x, y, z;
+        };
+
+        struct QuatLane
+        {
+            FloatLane x, y, z, w;
+        };
+
+        inline void Normalise(QuatLane& q)
+        {
+            const FloatLane invLength = InvSqrt(MulAdd(q.x, q.x, MulAdd(q.y, q.y, MulAdd(q.z, q.z, Mul(q.w, q.w)))));
+            q.x                       = Mul(q.x, invLength);
+            q.y                       = Mul(q.y, invLength);
+            q.z                       = Mul(q.z, invLength);
+            q.w                       = Mul(q.w, invLength);
+        }
+
+        // q += q * (0, v), then renormalised
+        inline void IntegrateOrientation(QuatLane& q, const Vec3Lane& v)
+        {
+            const FloatLane w = Sub(Sub(Sub(q.w, Mul(q.x, v.x)), Mul(q.y, v.y)), Mul(q.z, v.z));
+            const FloatLane x = Add(q.x, Sub(MulAdd(q.w, v.x, Mul(v.y, q.z)), Mul(v.z, q.y)));
+            const FloatLane y = Add(q.y, Sub(MulAdd(q.w, v.y, Mul(v.z, q.x)), Mul(v.x, q.z)));
+            const FloatLane z = Add(q.z, Sub(MulAdd(q.w, v.z, Mul(v.x, q.y)), Mul(v.y, q.x)));
+
+            q = { x, y, z, w };
+            Normalise(q);
+        }
+
+        // q' = q * (0, v) / 2 for the quaternion RK stages
+        inline QuatLane OrientationDerivative(const QuatLane& q, const Vec3Lane& v)
+        {
+            const FloatLane half = SplatLane(0.5f);
+            return { Mul(Sub(MulAdd(q.w, v.x, Mul(v.y, q.z)), Mul(v.z, q.y)), half),
+                     Mul(Sub(MulAdd(q.w, v.y, Mul(v.z, q.x)), Mul(v.x, q.z)), half),
+                     Mul(Sub(MulAdd(q.w, v.z, Mul(v.x, q.y)), Mul(v.y, q.x)), half),
+                     Mul(Sub(Sub(Sub(SplatLane(0.0f), Mul(q.x, v.x)), Mul(q.y, v.y)), Mul(q.z, v.z)), half) };
+        }
+
+        // q + d * t
+        inline QuatLane OrientationStep(const QuatLane& q, const QuatLane& d, FloatLane t)
+        {
+            return { MulAdd(d.x, t, q.x), MulAdd(d.y, t, q.y), MulAdd(d.z, t, q.z), MulAdd(d.w, t, q.w) };
+        }
+
+        inline Vec3Lane LoadVec3(const float* x, const float* y, const float* z, uint32_t i)
+        {
+            return { LoadLane(x + i), LoadLane(y + i), LoadLane(z + i) };
+        }
+
+        inline void StoreVec3(float* x, float* y, float* z, uint32_t i, const Vec3Lane& v, MaskLane mask)
+        {
+            StoreLane(x + i, Select(mask, v.x, LoadLane(x + i)));
+            StoreLane(y + i, Select(mask, v.y, LoadLane(y + i)));
+            StoreLane(z + i, Select(mask, v.z, LoadLane(z + i)));
+        }
+
+        template <IntegrationType Type>
+        void IntegrateLanes(RigidBodyStreams& streams, const Vec3& gravity, float damping, float dt, uint32_t iterations, uint32_t count)
+        {
+            const FloatLane dtLane      = SplatLane(dt);
+            const FloatLane halfDtLane  = SplatLane(dt * 0.5f);
+            const FloatLane sixthDtLane = SplatLane(dt / 6.0f);
+            const FloatLane twoLane     = SplatLane(2.0f);
+            const FloatLane dampingLane = SplatLane(damping);
+
+            // One Awake bit per flag byte, read a whole lane group of flags at once
+            constexpr uint32_t AwakeBits       = RigidBodyStreams::LaneCount == 4 ? 0x01010101u : 0x01u;
+            constexpr uint32_t AwakeShift      = 3;
+            constexpr uint8_t InvalidatedFlags = RigidBodyStreams::TransformInvalidated | RigidBodyStreams::AabbInvalidated;
+            static_assert(RigidBodyStreams::Awake == 1 << AwakeShift, "AwakeShift must match the Awake flag");
+
+            for(uint32_t i = 0; i < count; i += RigidBodyStreams::LaneCount)
+            {
+                uint32_t flags = 0;
+                memcpy(&flags, streams.Flag + i, RigidBodyStreams::LaneCount);
+
+                const uint32_t awake = (flags >> AwakeShift) & AwakeBits;
+                if(awake == 0)
+                    continue;
+
+                const MaskLane mask = AwakeMask(awake);
+
+                Vec3Lane position        = LoadVec3(streams.PositionX, streams.PositionY, streams.PositionZ, i);
+                Vec3Lane linearVelocity  = LoadVec3(streams.LinearVelocityX, streams.LinearVelocityY, streams.LinearVelocityZ, i);
+                Vec3Lane angularVelocity = LoadVec3(streams.AngularVelocityX, streams.AngularVelocityY, streams.AngularVelocityZ, i);
+                QuatLane orientation     = { LoadLane(streams.OrientationX + i), LoadLane(streams.OrientationY + i), LoadLane(streams.OrientationZ + i), LoadLane(streams.OrientationW + i) };
+
+                const Vec3Lane linearAcceleration  = LoadVec3(streams.LinearAccelerationX, streams.LinearAccelerationY, streams.LinearAccelerationZ, i);
+                const Vec3Lane angularAcceleration = LoadVec3(streams.AngularAccelerationX, streams.AngularAccelerationY, streams.AngularAccelerationZ, i);
+
+                const FloatLane gravityScale = Mul(LoadLane(streams.GravityScale + i), dtLane);
+                const Vec3Lane gravityStep   = { Mul(SplatLane(gravity.x), gravityScale), Mul(SplatLane(gravity.y), gravityScale), Mul(SplatLane(gravity.z), gravityScale) };
+
+                const FloatLane angularDamping = Mul(LoadLane(streams.AngularFactor + i), dampingLane);
+
+                for(uint32_t iteration = 0; iteration < iterations; iteration++)
+                {
+                    linearVelocity.x = Add(linearVelocity.x, gravityStep.x);
+                    linearVelocity.y = Add(linearVelocity.y, gravityStep.y);
+                    linearVelocity.z = Add(linearVelocity.z, gravityStep.z);
+
+                    if constexpr(Type == IntegrationType::SEMI_IMPLICIT_EULER)
+                    {
+                        // Velocity first, then position with the new velocity
+                        linearVelocity.x = Mul(MulAdd(linearAcceleration.x, dtLane, linearVelocity.x), dampingLane);
+                        linearVelocity.y = Mul(MulAdd(linearAcceleration.y, dtLane, linearVelocity.y), dampingLane);
+                        linearVelocity.z = Mul(MulAdd(linearAcceleration.z, dtLane, linearVelocity.z), dampingLane);
+
+                        position.x = MulAdd(linearVelocity.x, dtLane, position.x);
+                        position.y = MulAdd(linearVelocity.y, dtLane, position.y);
+                        position.z = MulAdd(linearVelocity.z, dtLane, position.z);
+                    }
+                    else if constexpr(Type == IntegrationType::EXPLICIT_EULER)
+                    {
+                        // Position with the old velocity
+                        position.x = MulAdd(linearVelocity.x, dtLane, position.x);
+                        position.y = MulAdd(linearVelocity.y, dtLane, position.y);
+                        position.z = MulAdd(linearVelocity.z, dtLane, position.z);
+
+                        linearVelocity.x = Mul(MulAdd(linearAcceleration.x, dtLane, linearVelocity.x), dampingLane);
+                        linearVelocity.y = Mul(MulAdd(linearAcceleration.y, dtLane, linearVelocity.y), dampingLane);
+                        linearVelocity.z = Mul(MulAdd(linearAcceleration.z, dtLane, linearVelocity.z), dampingLane);
+                    }
+                    else
+                    {
+                        // Acceleration is constant over the step, so every Runge Kutta order gives the exact
+                        // x += (v + a * dt / 2) * dt, v += a * dt. RK2 and RK4 only differ in the orientation below.
+                        position.x = MulAdd(MulAdd(linearAcceleration.x, halfDtLane, linearVelocity.x), dtLane, position.x);
+                        position.y = MulAdd(MulAdd(linearAcceleration.y, halfDtLane, linearVelocity.y), dtLane, position.y);
+                        position.z = MulAdd(MulAdd(linearAcceleration.z, halfDtLane, linearVelocity.z), dtLane, position.z);
+
+                        linearVelocity.x = Mul(MulAdd(linearAcceleration.x, dtLane, linearVelocity.x), dampingLane);
+                        linearVelocity.y = Mul(MulAdd(linearAcceleration.y, dtLane, linearVelocity.y), dampingLane);
+                        linearVelocity.z = Mul(MulAdd(linearAcceleration.z, dtLane, linearVelocity.z), dampingLane);
+                    }
+
+                    if constexpr(Type == IntegrationType::EXPLICIT_EULER)
+                    {
+                        const Vec3Lane halfRotation = { Mul(angularVelocity.x, halfDtLane), Mul(angularVelocity.y, halfDtLane), Mul(angularVelocity.z, halfDtLane) };
+                        IntegrateOrientation(orientation, halfRotation);
+                    }
+
+                    const Vec3Lane startAngularVelocity = angularVelocity;
+
+                    angularVelocity.x = Mul(MulAdd(angularAcceleration.x, dtLane, angularVelocity.x), angularDamping);
+                    angularVelocity.y = Mul(MulAdd(angularAcceleration.y, dtLane, angularVelocity.y), angularDamping);
+                    angularVelocity.z = Mul(MulAdd(angularAcceleration.z, dtLane, angularVelocity.z), angularDamping);
+
+                    if constexpr(Type == IntegrationType::SEMI_IMPLICIT_EULER)
+                    {
+                        const Vec3Lane rotation = { Mul(angularVelocity.x, dtLane), Mul(angularVelocity.y, dtLane), Mul(angularVelocity.z, dtLane) };
+                        IntegrateOrientation(orientation, rotation);
+                    }
+                    else if constexpr(Type != IntegrationType::EXPLICIT_EULER)
+                    {
+                        // q' = q * (0, w) / 2 with w going linearly from the start to the end angular velocity of the step
+                        const FloatLane half              = SplatLane(0.5f);
+                        const Vec3Lane midAngularVelocity = { Mul(Add(startAngularVelocity.x, angularVelocity.x), half),
+                                                              Mul(Add(startAngularVelocity.y, angularVelocity.y), half),
+                                                              Mul(Add(startAngularVelocity.z, angularVelocity.z), half) };
+
+                        const QuatLane k1 = OrientationDerivative(orientation, startAngularVelocity);
+                        const QuatLane k2 = OrientationDerivative(OrientationStep(orientation, k1, halfDtLane), midAngularVelocity);
+
+                        if constexpr(Type == IntegrationType::RUNGE_KUTTA_2)
+                        {
+                            // Midpoint method
+                            orientation = OrientationStep(orientation, k2, dtLane);
+                        }
+                        else
+                        {
+                            const QuatLane k3 = OrientationDerivative(OrientationStep(orientation, k2, halfDtLane), midAngularVelocity);
+                            const QuatLane k4 = OrientationDerivative(OrientationStep(orientation, k3, dtLane), angularVelocity);
+
+                            const QuatLane sum = { Add(Add(k1.x, k4.x), Mul(Add(k2.x, k3.x), twoLane)),
+                                                   Add(Add(k1.y, k4.y), Mul(Add(k2.y, k3.y), twoLane)),
+                                                   Add(Add(k1.z, k4.z), Mul(Add(k2.z, k3.z), twoLane)),
+                                                   Add(Add(k1.w, k4.w), Mul(Add(k2.w, k3.w), twoLane)) };
+
+                            orientation = OrientationStep(orientation, sum, sixthDtLane);
+                        }
+
+                        Normalise(orientation);
+                    }
+                }
+
+                // Lanes of sleeping, static or free slots in this group keep their values
+                StoreVec3(streams.PositionX, streams.PositionY, streams.PositionZ, i, position, mask);
+                StoreVec3(streams.LinearVelocityX, streams.LinearVelocityY, streams.LinearVelocityZ, i, linearVelocity, mask);
+                StoreVec3(streams.AngularVelocityX, streams.AngularVelocityY, streams.AngularVelocityZ, i, angularVelocity, mask);
+                StoreLane(streams.OrientationX + i, Select(mask, orientation.x, LoadLane(streams.OrientationX + i)));
+                StoreLane(streams.OrientationY + i, Select(mask, orientation.y, LoadLane(streams.OrientationY + i)));
+                StoreLane(streams.OrientationZ + i, Select(mask, orientation.z, LoadLane(streams.OrientationZ + i)));
+                StoreLane(streams.OrientationW + i, Select(mask, orientation.w, LoadLane(streams.OrientationW + i)));
+
+                // Awake bits are 0 or 1 per byte, so the multiply cannot carry into the next lane's flags
+                flags |= awake * InvalidatedFlags;
+                memcpy(streams.Flag + i, &flags, RigidBodyStreams::LaneCount);
+            }
+        }
+    }
+
+    void RigidBodyStreams::Init(Arena* arena, uint32_t capacity)
+    {
+        Capacity = (capacity + LaneCount - 1) / LaneCount * LaneCount;
+
+        // Zeroed, so lanes past the last body are never flagged Awake
+        Flag = PushArray(arena, uint8_t, Capacity);
+
+        float** streams[] = { &PositionX, &PositionY, &PositionZ,
+                              &LinearVelocityX, &LinearVelocityY, &LinearVelocityZ,
+                              &LinearAccelerationX, &LinearAccelerationY, &LinearAccelerationZ,
+                              &AngularAccelerationX, &AngularAccelerationY, &AngularAccelerationZ,
+                              &OrientationX, &OrientationY, &OrientationZ, &OrientationW,
+                              &AngularVelocityX, &AngularVelocityY, &AngularVelocityZ,
+                              &GravityScale, &AngularFactor };
+
+        for(float** stream : streams)
+            *stream = PushArray(arena, float, Capacity);
+    }
+
+    void RigidBodyStreams::Integrate(IntegrationType type, const Vec3& gravity, float damping, float dt, uint32_t iterations, uint32_t count)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        switch(type)
+        {
+        case IntegrationType::EXPLICIT_EULER:
+            IntegrateLanes<IntegrationType::EXPLICIT_EULER>(*this, gravity, damping, dt, iterations, count);
+            break;
+        case IntegrationType::SEMI_IMPLICIT_EULER:
+            IntegrateLanes<IntegrationType::SEMI_IMPLICIT_EULER>(*this, gravity, damping, dt, iterations, count);
+            break;
+        case IntegrationType::RUNGE_KUTTA_2:
+            IntegrateLanes<IntegrationType::RUNGE_KUTTA_2>(*this, gravity, damping, dt, iterations, count);
+            break;
+        case IntegrationType::RUNGE_KUTTA_4:
+            IntegrateLanes<IntegrationType::RUNGE_KUTTA_4>(*this, gravity, damping, dt, iterations, count);
+            break;
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#ifdef LUMOS_SSE
+#include <smmintrin.h> // Quaternion.h needs __m128 declared
+#endif
+
+#include "Maths/Vector3.h"
+#include "Maths/Quaternion.h"
+
+namespace Lumos
+{
+    struct Arena;
+    enum class IntegrationType : uint32_t;
+
+    // Structure of arrays storage for every rigid body owned by LumosPhysicsEngine, one lane per body pool slot.
+    // The streams are the only copy of a body's position, orientation and velocities, RigidBody3D reads and
+    // writes them through its slot index. Integrate runs every position iteration straight over them.
+    struct LUMOS_EXPORT RigidBodyStreams
+    {
+#ifdef LUMOS_SSE
+        static constexpr uint32_t LaneCount = 4; // Bodies integrated together in one SIMD register
+#else
+        static constexpr uint32_t LaneCount = 1;
+#endif
+
+        enum Flags : uint8_t
+        {
+            Valid                = 1 << 0,
+            Static               = 1 << 1,
+            AtRest               = 1 << 2,
+            Awake                = 1 << 3, // Valid, not static and not at rest, the lanes Integrate updates
+            TransformInvalidated = 1 << 4,
+            AabbInvalidated      = 1 << 5
+        };
+
+        void Init(Arena* arena, uint32_t capacity);
+
+        // Runs iterations steps of dt with the integrator chosen at compile time over the first count lanes.
+        // Lane groups without an awake body are skipped.
+        void Integrate(IntegrationType type, const Vec3& gravity, float damping, float dt, uint32_t iterations, uint32_t count);
+
+        void SetFlag(uint32_t i, uint8_t flag, bool value)
+        {
+            const uint8_t flags = value ? (Flag[i] | flag) : (Flag[i] & ~flag);
+            const bool awake    = (flags & (Valid | Static | AtRest)) == Valid;
+            Flag[i]             = awake ? (flags | Awake) : (flags & ~Awake);
+        }
+
+        bool HasFlag(uint32_t i, uint8_t flag) const { return (Flag[i] & flag) != 0; }
+
+        Vec3 GetPosition(uint32_t i) const { return Vec3(PositionX[i], PositionY[i], PositionZ[i]); }
+        Vec3 GetLinearVelocity(uint32_t i) const { return Vec3(LinearVelocityX[i], LinearVelocityY[i], LinearVelocityZ[i]); }
+        Vec3 GetAngularVelocity(uint32_t i) const { return Vec3(AngularVelocityX[i], AngularVelocityY[i], AngularVelocityZ[i]); }
+        Quat GetOrientation(uint32_t i) const { return Quat(OrientationX[i], OrientationY[i], OrientationZ[i], OrientationW[i]); }
+
+        void SetPosition(uint32_t i, const Vec3& v)
+        {
+            PositionX[i] = v.x;
+            PositionY[i] = v.y;
+            PositionZ[i] = v.z;
+        }
+
+        void SetLinearVelocity(uint32_t i, const Vec3& v)
+        {
+            LinearVelocityX[i] = v.x;
+            LinearVelocityY[i] = v.y;
+            LinearVelocityZ[i] = v.z;
+        }
+
+        void SetAngularVelocity(uint32_t i, const Vec3& v)
+        {
+            AngularVelocityX[i] = v.x;
+            AngularVelocityY[i] = v.y;
+            AngularVelocityZ[i] = v.z;
+        }
+
+        void SetOrientation(uint32_t i, const Quat& q)
+        {
+            OrientationX[i] = q.x;
+            OrientationY[i] = q.y;
+            OrientationZ[i] = q.z;
+            OrientationW[i] = q.w;
+        }
+
+        void SetLinearAcceleration(uint32_t i, const Vec3& v)
+        {
+            LinearAccelerationX[i] = v.x;
+            LinearAccelerationY[i] = v.y;
+            LinearAccelerationZ[i] = v.z;
+        }
+
+        void SetAngularAcceleration(uint32_t i, const Vec3& v)
+        {
+            AngularAccelerationX[i] = v.x;
+            AngularAccelerationY[i] = v.y;
+            AngularAccelerationZ[i] = v.z;
+        }
+
+        uint32_t Capacity = 0; // Body pool size rounded up to LaneCount
+
+        uint8_t* Flag = nullptr;
+
+        float* PositionX = nullptr;
+        float* PositionY = nullptr;
+        float* PositionZ = nullptr;
+
+        float* LinearVelocityX = nullptr;
+        float* LinearVelocityY = nullptr;
+        float* LinearVelocityZ = nullptr;
+
+        // Force * inverse mass and inverse inertia * torque, kept up to date by the RigidBody3D setters
+        float* LinearAccelerationX  = nullptr;
+        float* LinearAccelerationY  = nullptr;
+        float* LinearAccelerationZ  = nullptr;
+        float* AngularAccelerationX = nullptr;
+        float* AngularAccelerationY = nullptr;
+        float* AngularAccelerationZ = nullptr;
+
+        float* OrientationX = nullptr;
+        float* OrientationY = nullptr;
+        float* OrientationZ = nullptr;
+        float* OrientationW = nullptr;
+
+        float* AngularVelocityX = nullptr;
+        float* AngularVelocityY = nullptr;
+        float* AngularVelocityZ = nullptr;
+
+        float* GravityScale  = nullptr; // 0 for bodies with infinite mass, 1 otherwise
+        float* AngularFactor = nullptr;
+    };
+}
@@ -6,22 +6,32 @@
 
 namespace Lumos
 {
-    ALSound::ALSound(const std::string& fileName, const std::string& format)
+    ALSound::ALSound(const std::string& fileName, const std::string& format, bool load)
         : m_Format(0)
     {
         m_FilePath = fileName;
+        if(!load)
+            return;
+
         if(format == "wav")
             m_Data = LoadWav(fileName);
         else if(format == "ogg")
             m_Data = LoadOgg(fileName);
 
-        alGenBuffers(1, &m_Buffer);
-        alBufferData(m_Buffer, GetOALFormat(m_Data.BitRate, m_Data.Channels), m_Data.Data.Data(), m_Data.Size, static_cast<ALsizei>(m_Data.FreqRate));
+        Upload();
     }
 
     ALSound::~ALSound()
     {
-        alDeleteBuffers(1, &m_Buffer);
+        if(m_Buffer)
+            alDeleteBuffers(1, &m_Buffer);
+    }
+
+    void ALSound::Upload()
+    {
+        if(!m_Buffer)
+            alGenBuffers(1, &m_Buffer);
+        alBufferData(m_Buffer, GetOALFormat(m_Data.BitRate, m_Data.Channels), m_Data.Data.Data(), m_Data.Size, static_cast<ALsizei>(m_Data.FreqRate));
     }
 
     ALenum ALSound::GetOALFormat(uint32_t bitRate, uint32_t channels)
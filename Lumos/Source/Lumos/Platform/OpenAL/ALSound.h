@@ -9,9 +9,11 @@ namespace Lumos
     class ALSound : public Sound
     {
     public:
-        ALSound(const std::string& fileName, const std::string& format);
+        ALSound(const std::string& fileName, const std::string& format, bool load = true);
         virtual ~ALSound();
 
+        void Upload() override;
+
         unsigned int GetBuffer() const
         {
             return m_Buffer;
@@ -19,7 +21,7 @@ namespace Lumos
 
     private:
         static ALenum GetOALFormat(uint32_t bitRate, uint32_t channels);
-        unsigned int m_Buffer;
+        unsigned int m_Buffer = 0;
         int m_Format;
     };
 }
@@ -21,6 +21,10 @@ namespace Lumos
 
     void ALSoundNode::OnUpdate(float msec)
     {
+        // Streamed sounds get their buffer after they were set, attach it once it exists
+        if(m_Sound && m_BoundBuffer != m_Sound.As<ALSound>()->GetBuffer())
+            SetSound(m_Sound);
+
         alSourcef(m_Source, AL_GAIN, m_Volume);
         alSourcef(m_Source, AL_PITCH, m_Pitch);
         alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
@@ -73,8 +77,9 @@ namespace Lumos
         m_Sound = s;
         if(m_Sound)
         {
-            m_TimeLeft = m_Sound->GetLength();
-            alSourcei(m_Source, AL_BUFFER, m_Sound.As<ALSound>()->GetBuffer());
+            m_TimeLeft    = m_Sound->GetLength();
+            m_BoundBuffer = m_Sound.As<ALSound>()->GetBuffer();
+            alSourcei(m_Source, AL_BUFFER, m_BoundBuffer);
             alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
             alSourcef(m_Source, AL_ROLLOFF_FACTOR, m_RollOffFactor);
             alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
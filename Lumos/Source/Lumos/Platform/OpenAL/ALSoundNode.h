@@ -22,6 +22,7 @@ namespace Lumos
 
     private:
         ALuint m_Source;
+        ALuint m_BoundBuffer = 0;
         ALuint m_StreamBuffers[NUM_STREAM_BUFFERS];
     };
 }
@@ -256,10 +256,28 @@ namespace Lumos
             }
 
             Engine::Get().Statistics().NumDrawCalls++;
-            GLCall(glDrawElements(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), nullptr));
+            GLCall(glDrawElements(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), (const void*)(uintptr_t)(start * sizeof(uint32_t))));
             // GLCall(glDrawArrays(GLTools::DrawTypeToGL(type), start, count));
         }
 
+        void GLRenderer::DrawIndexedInstancedInternal(CommandBuffer* commandBuffer, const DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start) const
+        {
+            LUMOS_PROFILE_FUNCTION();
+
+            if(m_BoundIndexBuffer == -1)
+            {
+                m_DefaultVertexBuffer->Bind(commandBuffer, nullptr);
+            }
+
+            if(m_BoundVertexBuffer == -1)
+            {
+                m_DefaultIndexBuffer->Bind(commandBuffer);
+            }
+
+            Engine::Get().Statistics().NumDrawCalls++;
+            GLCall(glDrawElementsInstanced(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), (const void*)(uintptr_t)(start * sizeof(uint32_t)), instanceCount));
+        }
+
         void GLRenderer::BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount)
         {
             LUMOS_PROFILE_FUNCTION();
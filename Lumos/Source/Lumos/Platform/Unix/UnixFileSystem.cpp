@@ -6,6 +6,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <iostream>
 
 namespace Lumos
@@ -42,6 +43,14 @@ namespace Lumos
         return buffer.st_size;
     }
 
+    int64_t FileSystem::GetFileModifiedTime(const String8& path)
+    {
+        struct stat buffer;
+        if(stat(ToCChar(path), &buffer) != 0)
+            return -1;
+        return (int64_t)buffer.st_mtime;
+    }
+
     bool FileSystem::ReadFile(Arena* arena, const String8& path, void* buffer, int64_t size)
     {
         if(!FileExists(path))
@@ -160,6 +169,39 @@ namespace Lumos
         return size == text.size;
     }
 
+    bool FileSystem::MapFile(const String8& path, MappedFile* outFile)
+    {
+        int fd = open(ToCChar(path), O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat buffer;
+        if(fstat(fd, &buffer) != 0 || buffer.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file
+        void* data = mmap(nullptr, buffer.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(data == MAP_FAILED)
+            return false;
+
+        outFile->Data   = (uint8_t*)data;
+        outFile->Size   = buffer.st_size;
+        outFile->Handle = nullptr;
+        return true;
+    }
+
+    void FileSystem::UnmapFile(MappedFile* file)
+    {
+        if(file->Data)
+            munmap(file->Data, file->Size);
+
+        *file = MappedFile();
+    }
+
     String8 FileSystem::GetWorkingDirectory(Arena* arena)
     {
         String8 Path = PushStr8FillByte(arena, 4096, 0);
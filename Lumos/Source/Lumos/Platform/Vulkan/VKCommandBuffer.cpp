@@ -8,6 +8,7 @@
 #include "VKInitialisers.h"
 #include "VKSemaphore.h"
 #include "Core/JobSystem.h"
+#include "Core/Engine.h"
 
 #if LUMOS_PROFILE
 #if LUMOS_PROFILE_GPU_TIMINGS
@@ -83,8 +84,12 @@ namespace Lumos
 
             VK_CHECK_RESULT(vkAllocateCommandBuffers(VKDevice::Get().GetDevice(), &cmdBufferCreateInfo, &m_CommandBuffer));
 
-            m_Semaphore = CreateSharedPtr<VKSemaphore>(false);
-            m_Fence     = CreateSharedPtr<VKFence>(false);
+            // Secondaries are never submitted on their own
+            if(primary)
+            {
+                m_Semaphore = CreateSharedPtr<VKSemaphore>(false);
+                m_Fence     = CreateSharedPtr<VKFence>(false);
+            }
 
             return true;
         }
@@ -94,7 +99,7 @@ namespace Lumos
             LUMOS_PROFILE_FUNCTION_LOW();
             VKUtilities::WaitIdle();
 
-            if(m_State == CommandBufferState::Submitted)
+            if(m_Primary && m_State == CommandBufferState::Submitted)
                 Wait();
 
             m_Fence     = nullptr;
@@ -117,7 +122,8 @@ namespace Lumos
         {
             LUMOS_PROFILE_FUNCTION_LOW();
             ASSERT(!m_Primary, "BeginRecordingSecondary() called from a primary command buffer!");
-            m_State = CommandBufferState::Recording;
+            m_State         = CommandBufferState::Recording;
+            m_BoundPipeline = nullptr;
 
             VkCommandBufferInheritanceInfo inheritanceInfo = VKInitialisers::CommandBufferInheritanceInfo();
             inheritanceInfo.subpass                        = 0;
@@ -142,7 +148,9 @@ namespace Lumos
             m_BoundPipeline = nullptr;
 #if LUMOS_PROFILE
 #if LUMOS_PROFILE_GPU_TIMINGS
-            TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
+            // Query resets can't be recorded inside the render pass a secondary continues
+            if(m_Primary)
+                TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
 #endif
 #endif
 
@@ -190,6 +198,35 @@ namespace Lumos
             m_State = CommandBufferState::Submitted;
 
             vkCmdExecuteCommands(static_cast<VKCommandBuffer*>(primaryCmdBuffer)->GetHandle(), 1, &m_CommandBuffer);
+
+            auto& stats = Engine::Get().Statistics();
+            stats.NumDrawCalls += m_DrawCalls;
+            stats.TriangleCount += m_TriangleCount;
+            stats.BoundPipelines += m_BoundPipelines;
+            m_DrawCalls      = 0;
+            m_TriangleCount  = 0;
+            m_BoundPipelines = 0;
+        }
+
+        void VKCommandBuffer::CountDraw(uint32_t triangles)
+        {
+            if(m_Primary)
+            {
+                Engine::Get().Statistics().NumDrawCalls++;
+                Engine::Get().Statistics().TriangleCount += triangles;
+                return;
+            }
+
+            m_DrawCalls++;
+            m_TriangleCount += triangles;
+        }
+
+        void VKCommandBuffer::CountBoundPipeline()
+        {
+            if(m_Primary)
+                Engine::Get().Statistics().BoundPipelines++;
+            else
+                m_BoundPipelines++;
         }
 
         void VKCommandBuffer::BindPipeline(Pipeline* pipeline)
@@ -242,10 +279,10 @@ namespace Lumos
             m_BoundRenderPass = nullptr;
         }
 
-        void VKCommandBuffer::BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height)
+        void VKCommandBuffer::BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height, SubPassContents contents)
         {
             LUMOS_PROFILE_FUNCTION();
-            if(m_BoundRenderPass != renderpass || m_BoundFrameBuffer != framebuffer || m_BoundRenderPassWidth != width || m_BoundRenderPassHeight != height)
+            if(m_BoundRenderPass != renderpass || m_BoundFrameBuffer != framebuffer || m_BoundRenderPassWidth != width || m_BoundRenderPassHeight != height || m_BoundContents != contents)
             {
                 if(m_BoundRenderPass)
                     m_BoundRenderPass->EndRenderPass(this);
@@ -254,8 +291,9 @@ namespace Lumos
                 m_BoundFrameBuffer      = framebuffer;
                 m_BoundRenderPassWidth  = width;
                 m_BoundRenderPassHeight = height;
+                m_BoundContents         = contents;
 
-                m_BoundRenderPass->BeginRenderPass(this, clearColour, framebuffer, SubPassContents::INLINE, width, height);
+                m_BoundRenderPass->BeginRenderPass(this, clearColour, framebuffer, contents, width, height);
             }
         }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "VK.h"
 #include "Graphics/RHI/CommandBuffer.h"
+#include "Graphics/RHI/RHIDefinitions.h"
 #include "VKFence.h"
 #include "Core/Reference.h"
 
@@ -44,7 +45,7 @@ namespace Lumos
             void UnBindPipeline() override;
             void EndCurrentRenderPass() override;
 
-            void BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height);
+            void BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height, SubPassContents contents = SubPassContents::INLINE);
 
             bool Execute(VkPipelineStageFlags flags, VkSemaphore signalSemaphore, bool waitFence);
 
@@ -53,6 +54,11 @@ namespace Lumos
 
             VkCommandBuffer GetHandle() const { return m_CommandBuffer; };
             CommandBufferState GetState() const { return m_State; }
+            bool IsPrimary() const { return m_Primary; }
+
+            // Secondaries are recorded on worker threads, so they keep their own counts until executed from a primary
+            void CountDraw(uint32_t triangles);
+            void CountBoundPipeline();
 
             VkSemaphore GetSemaphore() const;
 
@@ -76,6 +82,11 @@ namespace Lumos
             uint32_t m_BoundRenderPassWidth  = 0;
             uint32_t m_BoundRenderPassHeight = 0;
             Framebuffer* m_BoundFrameBuffer  = nullptr;
+            SubPassContents m_BoundContents  = SubPassContents::INLINE;
+
+            uint32_t m_DrawCalls      = 0;
+            uint32_t m_TriangleCount  = 0;
+            uint32_t m_BoundPipelines = 0;
         };
     }
 }
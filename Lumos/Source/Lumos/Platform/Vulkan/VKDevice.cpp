@@ -2,6 +2,7 @@
 
 #include "Core/Application.h"
 #include "Core/Version.h"
+#include "Core/OS/FileSystem.h"
 #include "Utilities/StringUtilities.h"
 #include "VKUtilities.h"
 #include "VKDevice.h"
@@ -181,7 +182,12 @@ namespace Lumos
             caps.MaxAnisotropy                = m_PhysicalDeviceProperties.limits.maxSamplerAnisotropy;
             caps.MaxTextureUnits              = m_PhysicalDeviceProperties.limits.maxDescriptorSetSamplers;
             caps.UniformBufferOffsetAlignment = int(m_PhysicalDeviceProperties.limits.minUniformBufferOffsetAlignment);
+            caps.MaxBoundDescriptorSets       = int(m_PhysicalDeviceProperties.limits.maxBoundDescriptorSets);
             caps.SupportCompute               = false; // true; //Need to sort descriptor set management first
+            caps.SupportInstancing            = true;
+            caps.SupportStorageBuffers        = true;
+            caps.SupportCompactVertices       = true;
+            caps.SupportGPUParticles          = true;
 
             uint32_t queueFamilyCount;
             vkGetPhysicalDeviceQueueFamilyProperties(m_Handle, &queueFamilyCount, nullptr);
@@ -389,6 +395,7 @@ namespace Lumos
         VKDevice::~VKDevice()
         {
             m_CommandPool.reset();
+            SavePipelineCache();
             vkDestroyPipelineCache(m_Device, m_PipelineCache, VK_NULL_HANDLE);
 
 #ifdef USE_VMA_ALLOCATOR
@@ -455,6 +462,12 @@ namespace Lumos
             if(supportedFeatures.depthBiasClamp)
                 m_EnabledFeatures.depthBiasClamp = true;
 
+            // GPU culled draws keep each batch's instance offset in the indirect arguments
+            if(supportedFeatures.drawIndirectFirstInstance)
+                m_EnabledFeatures.drawIndirectFirstInstance = true;
+            Renderer::GetCapabilities().SupportGPUCulling = supportedFeatures.drawIndirectFirstInstance == VK_TRUE;
+            Renderer::GetCapabilities().SupportSecondaryCommandBuffers = true;
+
             TDArray<const char*> deviceExtensions = {
                 VK_KHR_SWAPCHAIN_EXTENSION_NAME
             };
@@ -618,14 +631,88 @@ namespace Lumos
             return VK_SUCCESS;
         }
 
+        // A cache blob is only usable by the GPU and driver that wrote it
+        static bool IsPipelineCacheDataValid(const uint8_t* data, int64_t size, const VkPhysicalDeviceProperties& properties)
+        {
+            if(!data || size < (int64_t)sizeof(VkPipelineCacheHeaderVersionOne))
+                return false;
+
+            VkPipelineCacheHeaderVersionOne header;
+            MemoryCopy(&header, data, sizeof(VkPipelineCacheHeaderVersionOne));
+
+            return header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)
+                && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+                && header.vendorID == properties.vendorID
+                && header.deviceID == properties.deviceID
+                && memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+        }
+
+        // Resolved whenever it is needed, the project mounted on //Assets can change after the device is created
+        static bool ResolvePipelineCachePath(Arena* arena, String8* outPath)
+        {
+            String8 assetFolder;
+            if(!FileSystem::Get().ResolvePhysicalPath(arena, Str8Lit("//Assets"), &assetFolder, true))
+                return false;
+
+            FileSystem::Get().ResolvePhysicalPath(arena, Str8Lit("//Assets/Cache/VulkanPipelineCache.bin"), outPath);
+            return true;
+        }
+
         void VKDevice::CreatePipelineCache()
         {
             LINFO("Creating VK Pipeline Cache");
 
+            ArenaTemp scratch    = ScratchBegin(nullptr, 0);
+            uint8_t* initialData = nullptr;
+            int64_t initialSize  = 0;
+
+            // Seed the cache with the pipelines compiled by the last run of this project
+            String8 cachePath;
+            if(ResolvePipelineCachePath(scratch.arena, &cachePath) && FileSystem::FileExists(cachePath))
+            {
+                initialSize = FileSystem::GetFileSize(cachePath);
+                initialData = FileSystem::ReadFile(scratch.arena, cachePath);
+
+                if(IsPipelineCacheDataValid(initialData, initialSize, m_PhysicalDevice->GetProperties()))
+                    LINFO("Loaded VK Pipeline Cache : %lld bytes", (long long)initialSize);
+                else
+                {
+                    LWARN("Discarding VK Pipeline Cache written by a different device or driver");
+                    initialData = nullptr;
+                    initialSize = 0;
+                }
+            }
+
             VkPipelineCacheCreateInfo pipelineCacheCI = {};
             pipelineCacheCI.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
             pipelineCacheCI.pNext                     = NULL;
+            pipelineCacheCI.initialDataSize           = size_t(initialSize);
+            pipelineCacheCI.pInitialData              = initialData;
             VK_CHECK_RESULT(vkCreatePipelineCache(m_Device, &pipelineCacheCI, VK_NULL_HANDLE, &m_PipelineCache));
+
+            ScratchEnd(scratch);
+        }
+
+        void VKDevice::SavePipelineCache()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            if(m_PipelineCache == VK_NULL_HANDLE)
+                return;
+
+            size_t size = 0;
+            if(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, nullptr) != VK_SUCCESS || size == 0)
+                return;
+
+            ArenaTemp scratch = ScratchBegin(nullptr, 0);
+            String8 cachePath;
+            uint8_t* data = PushArrayNoZero(scratch.arena, uint8_t, size);
+            if(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, data) == VK_SUCCESS && ResolvePipelineCachePath(scratch.arena, &cachePath))
+            {
+                FileSystem::CreateFolderIfDoesntExist(Str8StdS(StringUtilities::GetFileLocation(ToStdString(cachePath))));
+                if(FileSystem::WriteFile(cachePath, data, uint32_t(size)))
+                    LINFO("Saved VK Pipeline Cache : %llu bytes", (unsigned long long)size);
+            }
+            ScratchEnd(scratch);
         }
 
         void VKDevice::CreateTracyContext()
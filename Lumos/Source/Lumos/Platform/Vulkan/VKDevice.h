@@ -104,6 +104,7 @@ namespace Lumos
 
             bool Init();
             void CreatePipelineCache();
+            void SavePipelineCache();
             void CreateTracyContext();
 
             VkDevice GetDevice() const
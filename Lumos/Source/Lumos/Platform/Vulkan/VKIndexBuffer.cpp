@@ -10,6 +10,7 @@ namespace Lumos
         VKIndexBuffer::VKIndexBuffer(uint16_t* data, uint32_t count, BufferUsage bufferUsage)
             : VKBuffer(VK_BUFFER_USAGE_INDEX_BUFFER_BIT, bufferUsage == BufferUsage::DYNAMIC ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT : 0, count * sizeof(uint16_t), data)
             , m_Size(count * sizeof(uint16_t))
+            , m_IndexType(VK_INDEX_TYPE_UINT16)
             , m_Count(count)
             , m_Usage(bufferUsage)
         {
@@ -18,6 +19,7 @@ namespace Lumos
         VKIndexBuffer::VKIndexBuffer(uint32_t* data, uint32_t count, BufferUsage bufferUsage)
             : VKBuffer(VK_BUFFER_USAGE_INDEX_BUFFER_BIT, bufferUsage == BufferUsage::DYNAMIC ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT : 0, count * sizeof(uint32_t), data)
             , m_Size(count * sizeof(uint32_t))
+            , m_IndexType(VK_INDEX_TYPE_UINT32)
             , m_Count(count)
             , m_Usage(bufferUsage)
         {
@@ -37,7 +39,7 @@ namespace Lumos
         void VKIndexBuffer::Bind(CommandBuffer* commandBuffer) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            vkCmdBindIndexBuffer(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), m_Buffer, 0, VK_INDEX_TYPE_UINT32);
+            vkCmdBindIndexBuffer(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), m_Buffer, 0, m_IndexType);
         }
 
         void VKIndexBuffer::Unbind() const
@@ -32,6 +32,7 @@ namespace Lumos
             BufferUsage m_Usage;
             uint32_t m_Count;
             uint32_t m_Size;
+            VkIndexType m_IndexType;
             bool m_MappedBuffer = false;
         };
     }
@@ -11,6 +11,8 @@
 #include "Graphics/RHI/DescriptorSet.h"
 #include "VKInitialisers.h"
 #include "Core/Engine.h"
+#include "Core/JobSystem.h"
+#include "Maths/MathsUtilities.h"
 
 namespace Lumos
 {
@@ -42,266 +44,253 @@ namespace Lumos
 
             TransitionAttachments();
 
-            // Pipeline
-            TDArray<VkDynamicState> dynamicStateDescriptors;
-            VkPipelineDynamicStateCreateInfo dynamicStateCI {};
-            dynamicStateCI.sType          = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-            dynamicStateCI.pNext          = NULL;
-            dynamicStateCI.pDynamicStates = dynamicStateDescriptors.Data();
-
-            TDArray<VkVertexInputAttributeDescription> vertexInputDescription;
-
             m_Compute = m_Shader.As<VKShader>()->IsCompute();
 
             if(m_Compute)
             {
-                VkComputePipelineCreateInfo pipelineInfo = {};
-                pipelineInfo.sType                       = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-                pipelineInfo.layout                      = m_PipelineLayout;
-                pipelineInfo.stage                       = m_Shader.As<VKShader>()->GetShaderStages()[0];
-                VK_CHECK_RESULT(vkCreateComputePipelines(VKDevice::Get().GetDevice(), nullptr, 1, &pipelineInfo, nullptr, &m_Pipeline));
+                VK_CHECK_RESULT(CreateComputePipeline(m_Shader.As<VKShader>().get(), &m_Pipeline));
             }
             else
             {
                 CreateFramebuffers();
 
-                uint32_t stride = m_Shader.As<VKShader>()->GetVertexInputStride();
-
-                // Vertex layout
-                VkVertexInputBindingDescription vertexBindingDescription = {};
-
-                if(stride > 0)
+                if(pipelineDesc.depthBiasEnabled)
                 {
-                    vertexBindingDescription.binding   = 0;
-                    vertexBindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-                    vertexBindingDescription.stride    = m_Shader.As<VKShader>()->GetVertexInputStride();
+                    m_DepthBiasConstant = pipelineDesc.depthBiasConstantFactor;
+                    m_DepthBiasSlope    = pipelineDesc.depthBiasSlopeFactor;
+                    m_DepthBiasEnabled  = true;
                 }
-
-                const TDArray<VkVertexInputAttributeDescription>& vertexInputAttributeDescription = m_Shader.As<VKShader>()->GetVertexInputAttributeDescription();
-
-                VkPipelineVertexInputStateCreateInfo vi {};
-                vi.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-                vi.pNext                           = NULL;
-                vi.vertexBindingDescriptionCount   = stride > 0 ? 1 : 0;
-                vi.pVertexBindingDescriptions      = stride > 0 ? &vertexBindingDescription : nullptr;
-                vi.vertexAttributeDescriptionCount = stride > 0 ? uint32_t(vertexInputAttributeDescription.Size()) : 0;
-                vi.pVertexAttributeDescriptions    = stride > 0 ? vertexInputAttributeDescription.Data() : nullptr;
-
-                VkPipelineInputAssemblyStateCreateInfo inputAssemblyCI {};
-                inputAssemblyCI.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-                inputAssemblyCI.pNext                  = NULL;
-                inputAssemblyCI.primitiveRestartEnable = VK_FALSE;
-                inputAssemblyCI.topology               = VKUtilities::DrawTypeToVk(pipelineDesc.drawType);
-
-                VkPipelineRasterizationStateCreateInfo rs {};
-                rs.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-                rs.polygonMode             = VKUtilities::PolygonModeToVk(pipelineDesc.polygonMode);
-                rs.cullMode                = VKUtilities::CullModeToVK(pipelineDesc.cullMode);
-                rs.frontFace               = pipelineDesc.swapchainTarget ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE;
-                rs.depthClampEnable        = VK_TRUE;
-                rs.rasterizerDiscardEnable = VK_FALSE;
-                rs.depthBiasEnable         = (pipelineDesc.depthBiasEnabled ? VK_TRUE : VK_FALSE);
-                rs.depthBiasConstantFactor = pipelineDesc.depthBiasEnabled ? pipelineDesc.depthBiasConstantFactor : 0.0f;
-                rs.depthBiasClamp          = 0;
-                rs.depthBiasSlopeFactor    = pipelineDesc.depthBiasEnabled ? pipelineDesc.depthBiasSlopeFactor : 0.0f;
-
-                if(Renderer::GetCapabilities().WideLines)
-                    rs.lineWidth = pipelineDesc.lineWidth;
                 else
-                    rs.lineWidth = 1.0f;
-                rs.pNext = NULL;
+                {
+                    m_DepthBiasEnabled = false;
+                }
+
+                VK_CHECK_RESULT(CreateGraphicsPipeline(pipelineDesc, m_Shader.As<VKShader>().get(), m_RenderPass.As<VKRenderPass>()->GetHandle(), m_RenderPass.As<VKRenderPass>()->GetColourAttachmentCount(), &m_Pipeline));
+            }
+
+            if(!pipelineDesc.DebugName)
+                VKUtilities::SetDebugUtilsObjectName(VKDevice::Get().GetDevice(), VK_OBJECT_TYPE_PIPELINE, pipelineDesc.DebugName, m_Pipeline);
+
+            return true;
+        }
+
+        VkResult VKPipeline::CreateComputePipeline(VKShader* shader, VkPipeline* outPipeline)
+        {
+            VkComputePipelineCreateInfo pipelineInfo = {};
+            pipelineInfo.sType                       = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+            pipelineInfo.layout                      = shader->GetPipelineLayout();
+            pipelineInfo.stage                       = shader->GetShaderStages()[0];
+            return vkCreateComputePipelines(VKDevice::Get().GetDevice(), VKDevice::Get().GetPipelineCache(), 1, &pipelineInfo, nullptr, outPipeline);
+        }
+
+        VkResult VKPipeline::CreateGraphicsPipeline(const PipelineDesc& pipelineDesc, VKShader* shader, VkRenderPass renderPass, uint32_t colourAttachmentCount, VkPipeline* outPipeline)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            TDArray<VkDynamicState> dynamicStateDescriptors;
+            VkPipelineDynamicStateCreateInfo dynamicStateCI {};
+            dynamicStateCI.sType          = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+            dynamicStateCI.pNext          = NULL;
+            dynamicStateCI.pDynamicStates = dynamicStateDescriptors.Data();
 
-                VkPipelineColorBlendStateCreateInfo cb {};
-                cb.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-                cb.pNext = NULL;
-                cb.flags = 0;
+            // Vertex layout, interleaved attributes in binding 0 and one binding per quantised stream
+            const TDArray<VkVertexInputBindingDescription>& vertexInputBindingDescription     = shader->GetVertexInputBindingDescription();
+            const TDArray<VkVertexInputAttributeDescription>& vertexInputAttributeDescription = shader->GetVertexInputAttributeDescription();
+            const bool hasVertexInput                                                         = !vertexInputBindingDescription.Empty();
+
+            VkPipelineVertexInputStateCreateInfo vi {};
+            vi.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+            vi.pNext                           = NULL;
+            vi.vertexBindingDescriptionCount   = uint32_t(vertexInputBindingDescription.Size());
+            vi.pVertexBindingDescriptions      = hasVertexInput ? vertexInputBindingDescription.Data() : nullptr;
+            vi.vertexAttributeDescriptionCount = hasVertexInput ? uint32_t(vertexInputAttributeDescription.Size()) : 0;
+            vi.pVertexAttributeDescriptions    = hasVertexInput ? vertexInputAttributeDescription.Data() : nullptr;
+
+            VkPipelineInputAssemblyStateCreateInfo inputAssemblyCI {};
+            inputAssemblyCI.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+            inputAssemblyCI.pNext                  = NULL;
+            inputAssemblyCI.primitiveRestartEnable = VK_FALSE;
+            inputAssemblyCI.topology               = VKUtilities::DrawTypeToVk(pipelineDesc.drawType);
+
+            VkPipelineRasterizationStateCreateInfo rs {};
+            rs.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+            rs.polygonMode             = VKUtilities::PolygonModeToVk(pipelineDesc.polygonMode);
+            rs.cullMode                = VKUtilities::CullModeToVK(pipelineDesc.cullMode);
+            rs.frontFace               = pipelineDesc.swapchainTarget ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE;
+            rs.depthClampEnable        = VK_TRUE;
+            rs.rasterizerDiscardEnable = VK_FALSE;
+            rs.depthBiasEnable         = (pipelineDesc.depthBiasEnabled ? VK_TRUE : VK_FALSE);
+            rs.depthBiasConstantFactor = pipelineDesc.depthBiasEnabled ? pipelineDesc.depthBiasConstantFactor : 0.0f;
+            rs.depthBiasClamp          = 0;
+            rs.depthBiasSlopeFactor    = pipelineDesc.depthBiasEnabled ? pipelineDesc.depthBiasSlopeFactor : 0.0f;
+
+            if(Renderer::GetCapabilities().WideLines)
+                rs.lineWidth = pipelineDesc.lineWidth;
+            else
+                rs.lineWidth = 1.0f;
+            rs.pNext = NULL;
 
-                TDArray<VkPipelineColorBlendAttachmentState> blendAttachState;
-                blendAttachState.Resize(m_RenderPass.As<VKRenderPass>()->GetColourAttachmentCount());
+            VkPipelineColorBlendStateCreateInfo cb {};
+            cb.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+            cb.pNext = NULL;
+            cb.flags = 0;
 
-                for(unsigned int i = 0; i < blendAttachState.Size(); i++)
+            TDArray<VkPipelineColorBlendAttachmentState> blendAttachState;
+            blendAttachState.Resize(colourAttachmentCount);
+
+            for(unsigned int i = 0; i < blendAttachState.Size(); i++)
+            {
+                blendAttachState[i]                     = VkPipelineColorBlendAttachmentState();
+                blendAttachState[i].colorWriteMask      = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+                blendAttachState[i].alphaBlendOp        = VK_BLEND_OP_ADD;
+                blendAttachState[i].colorBlendOp        = VK_BLEND_OP_ADD;
+                blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+                blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+
+                if(pipelineDesc.transparencyEnabled)
                 {
-                    blendAttachState[i]                     = VkPipelineColorBlendAttachmentState();
-                    blendAttachState[i].colorWriteMask      = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-                    blendAttachState[i].alphaBlendOp        = VK_BLEND_OP_ADD;
-                    blendAttachState[i].colorBlendOp        = VK_BLEND_OP_ADD;
+                    blendAttachState[i].blendEnable         = VK_TRUE;
                     blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
                     blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
 
-                    if(pipelineDesc.transparencyEnabled)
+                    if(pipelineDesc.blendMode == BlendMode::SrcAlphaOneMinusSrcAlpha)
                     {
-                        blendAttachState[i].blendEnable         = VK_TRUE;
-                        blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+                        blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+                        blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+                        blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+                        blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+                    }
+                    else if(pipelineDesc.blendMode == BlendMode::SrcAlphaOne)
+                    {
+                        blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+                        blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+                        blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
                         blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-
-                        if(pipelineDesc.blendMode == BlendMode::SrcAlphaOneMinusSrcAlpha)
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-                            blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-                            blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-                        }
-                        else if(pipelineDesc.blendMode == BlendMode::SrcAlphaOne)
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
-                            blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
-                            blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-                        }
-                        else if(pipelineDesc.blendMode == BlendMode::OneMinusSrcAlpha)
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-                            blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-                            blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-                        }
-                        else if(pipelineDesc.blendMode == BlendMode::ZeroSrcColor)
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_SRC_COLOR;
-                        }
-                        else if(pipelineDesc.blendMode == BlendMode::OneZero)
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-                        }
-                        else
-                        {
-                            blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-                            blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-                        }
+                    }
+                    else if(pipelineDesc.blendMode == BlendMode::OneMinusSrcAlpha)
+                    {
+                        blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+                        blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+                        blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+                        blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+                    }
+                    else if(pipelineDesc.blendMode == BlendMode::ZeroSrcColor)
+                    {
+                        blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+                        blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_SRC_COLOR;
+                    }
+                    else if(pipelineDesc.blendMode == BlendMode::OneZero)
+                    {
+                        blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+                        blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
                     }
                     else
                     {
-                        blendAttachState[i].blendEnable         = VK_FALSE;
                         blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
                         blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-                        blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
-                        blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
                     }
                 }
-
-                cb.attachmentCount   = static_cast<uint32_t>(blendAttachState.Size());
-                cb.pAttachments      = blendAttachState.Data();
-                cb.logicOpEnable     = VK_FALSE;
-                cb.logicOp           = VK_LOGIC_OP_NO_OP;
-                cb.blendConstants[0] = 1.0f;
-                cb.blendConstants[1] = 1.0f;
-                cb.blendConstants[2] = 1.0f;
-                cb.blendConstants[3] = 1.0f;
-
-                VkPipelineViewportStateCreateInfo vp {};
-                vp.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-                vp.pNext         = NULL;
-                vp.viewportCount = 1;
-                vp.scissorCount  = 1;
-                vp.pScissors     = NULL;
-                vp.pViewports    = NULL;
-                dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_VIEWPORT);
-                dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_SCISSOR);
-
-                if(Renderer::GetCapabilities().WideLines && pipelineDesc.polygonMode == PolygonMode::LINE) // || pipelineDesc.polygonMode == PolygonMode::LINESTRIP)
-                    dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_LINE_WIDTH);
-
-                if(pipelineDesc.depthBiasEnabled)
-                {
-                    dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_DEPTH_BIAS);
-                    m_DepthBiasConstant = pipelineDesc.depthBiasConstantFactor;
-                    m_DepthBiasSlope    = pipelineDesc.depthBiasSlopeFactor;
-                    m_DepthBiasEnabled  = true;
-                }
                 else
                 {
-                    m_DepthBiasEnabled = false;
+                    blendAttachState[i].blendEnable         = VK_FALSE;
+                    blendAttachState[i].srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+                    blendAttachState[i].dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+                    blendAttachState[i].srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+                    blendAttachState[i].dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
                 }
-
-                VkPipelineDepthStencilStateCreateInfo ds {};
-                ds.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-                ds.pNext                 = NULL;
-                ds.depthTestEnable       = pipelineDesc.DepthTest ? VK_TRUE : VK_FALSE;
-                ds.depthWriteEnable      = pipelineDesc.DepthWrite ? VK_TRUE : VK_FALSE;
-                ds.depthCompareOp        = VK_COMPARE_OP_LESS_OR_EQUAL;
-                ds.depthBoundsTestEnable = VK_FALSE;
-                ds.stencilTestEnable     = VK_FALSE;
-                ds.back.failOp           = VK_STENCIL_OP_KEEP;
-                ds.back.passOp           = VK_STENCIL_OP_KEEP;
-                ds.back.compareOp        = VK_COMPARE_OP_ALWAYS;
-                ds.back.compareMask      = 0;
-                ds.back.reference        = 0;
-                ds.back.depthFailOp      = VK_STENCIL_OP_KEEP;
-                ds.back.writeMask        = 0;
-                ds.minDepthBounds        = 0;
-                ds.maxDepthBounds        = 0;
-                ds.front                 = ds.back;
-
-                VkPipelineMultisampleStateCreateInfo ms {};
-                ms.sType                 = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-                ms.pNext                 = NULL;
-                ms.pSampleMask           = NULL;
-                ms.rasterizationSamples  = m_Description.samples > 1 ? (VkSampleCountFlagBits)m_Description.samples : VK_SAMPLE_COUNT_1_BIT;
-                ms.sampleShadingEnable   = VK_FALSE;
-                ms.alphaToCoverageEnable = VK_FALSE;
-                ms.alphaToOneEnable      = VK_FALSE;
-                ms.minSampleShading      = 0.0;
-
-                dynamicStateCI.dynamicStateCount = uint32_t(dynamicStateDescriptors.Size());
-                dynamicStateCI.pDynamicStates    = dynamicStateDescriptors.Data();
-
-                auto vkshader = pipelineDesc.shader.As<VKShader>();
-                VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo {};
-                graphicsPipelineCreateInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-                graphicsPipelineCreateInfo.pNext               = NULL;
-                graphicsPipelineCreateInfo.layout              = m_PipelineLayout;
-                graphicsPipelineCreateInfo.basePipelineHandle  = VK_NULL_HANDLE;
-                graphicsPipelineCreateInfo.basePipelineIndex   = -1;
-                graphicsPipelineCreateInfo.pVertexInputState   = &vi;
-                graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyCI;
-                graphicsPipelineCreateInfo.pRasterizationState = &rs;
-                graphicsPipelineCreateInfo.pColorBlendState    = &cb;
-                graphicsPipelineCreateInfo.pTessellationState  = VK_NULL_HANDLE;
-                graphicsPipelineCreateInfo.pMultisampleState   = &ms;
-                graphicsPipelineCreateInfo.pDynamicState       = &dynamicStateCI;
-                graphicsPipelineCreateInfo.pViewportState      = &vp;
-                graphicsPipelineCreateInfo.pDepthStencilState  = &ds;
-                graphicsPipelineCreateInfo.pStages             = vkshader->GetShaderStages();
-                graphicsPipelineCreateInfo.stageCount          = vkshader->GetStageCount();
-                graphicsPipelineCreateInfo.renderPass          = m_RenderPass.As<VKRenderPass>()->GetHandle();
-                graphicsPipelineCreateInfo.subpass             = 0;
-
-                VK_CHECK_RESULT(vkCreateGraphicsPipelines(VKDevice::Get().GetDevice(), VKDevice::Get().GetPipelineCache(), 1, &graphicsPipelineCreateInfo, VK_NULL_HANDLE, &m_Pipeline));
             }
 
-            if(!pipelineDesc.DebugName)
-                VKUtilities::SetDebugUtilsObjectName(VKDevice::Get().GetDevice(), VK_OBJECT_TYPE_PIPELINE, pipelineDesc.DebugName, m_Pipeline);
-
-            return true;
+            cb.attachmentCount   = static_cast<uint32_t>(blendAttachState.Size());
+            cb.pAttachments      = blendAttachState.Data();
+            cb.logicOpEnable     = VK_FALSE;
+            cb.logicOp           = VK_LOGIC_OP_NO_OP;
+            cb.blendConstants[0] = 1.0f;
+            cb.blendConstants[1] = 1.0f;
+            cb.blendConstants[2] = 1.0f;
+            cb.blendConstants[3] = 1.0f;
+
+            VkPipelineViewportStateCreateInfo vp {};
+            vp.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+            vp.pNext         = NULL;
+            vp.viewportCount = 1;
+            vp.scissorCount  = 1;
+            vp.pScissors     = NULL;
+            vp.pViewports    = NULL;
+            dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_VIEWPORT);
+            dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_SCISSOR);
+
+            if(Renderer::GetCapabilities().WideLines && pipelineDesc.polygonMode == PolygonMode::LINE) // || pipelineDesc.polygonMode == PolygonMode::LINESTRIP)
+                dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_LINE_WIDTH);
+
+            if(pipelineDesc.depthBiasEnabled)
+                dynamicStateDescriptors.PushBack(VK_DYNAMIC_STATE_DEPTH_BIAS);
+
+            VkPipelineDepthStencilStateCreateInfo ds {};
+            ds.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+            ds.pNext                 = NULL;
+            ds.depthTestEnable       = pipelineDesc.DepthTest ? VK_TRUE : VK_FALSE;
+            ds.depthWriteEnable      = pipelineDesc.DepthWrite ? VK_TRUE : VK_FALSE;
+            ds.depthCompareOp        = VK_COMPARE_OP_LESS_OR_EQUAL;
+            ds.depthBoundsTestEnable = VK_FALSE;
+            ds.stencilTestEnable     = VK_FALSE;
+            ds.back.failOp           = VK_STENCIL_OP_KEEP;
+            ds.back.passOp           = VK_STENCIL_OP_KEEP;
+            ds.back.compareOp        = VK_COMPARE_OP_ALWAYS;
+            ds.back.compareMask      = 0;
+            ds.back.reference        = 0;
+            ds.back.depthFailOp      = VK_STENCIL_OP_KEEP;
+            ds.back.writeMask        = 0;
+            ds.minDepthBounds        = 0;
+            ds.maxDepthBounds        = 0;
+            ds.front                 = ds.back;
+
+            VkPipelineMultisampleStateCreateInfo ms {};
+            ms.sType                 = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+            ms.pNext                 = NULL;
+            ms.pSampleMask           = NULL;
+            ms.rasterizationSamples  = pipelineDesc.samples > 1 ? (VkSampleCountFlagBits)pipelineDesc.samples : VK_SAMPLE_COUNT_1_BIT;
+            ms.sampleShadingEnable   = VK_FALSE;
+            ms.alphaToCoverageEnable = VK_FALSE;
+            ms.alphaToOneEnable      = VK_FALSE;
+            ms.minSampleShading      = 0.0;
+
+            dynamicStateCI.dynamicStateCount = uint32_t(dynamicStateDescriptors.Size());
+            dynamicStateCI.pDynamicStates    = dynamicStateDescriptors.Data();
+
+            VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo {};
+            graphicsPipelineCreateInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            graphicsPipelineCreateInfo.pNext               = NULL;
+            graphicsPipelineCreateInfo.layout              = shader->GetPipelineLayout();
+            graphicsPipelineCreateInfo.basePipelineHandle  = VK_NULL_HANDLE;
+            graphicsPipelineCreateInfo.basePipelineIndex   = -1;
+            graphicsPipelineCreateInfo.pVertexInputState   = &vi;
+            graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyCI;
+            graphicsPipelineCreateInfo.pRasterizationState = &rs;
+            graphicsPipelineCreateInfo.pColorBlendState    = &cb;
+            graphicsPipelineCreateInfo.pTessellationState  = VK_NULL_HANDLE;
+            graphicsPipelineCreateInfo.pMultisampleState   = &ms;
+            graphicsPipelineCreateInfo.pDynamicState       = &dynamicStateCI;
+            graphicsPipelineCreateInfo.pViewportState      = &vp;
+            graphicsPipelineCreateInfo.pDepthStencilState  = &ds;
+            graphicsPipelineCreateInfo.pStages             = shader->GetShaderStages();
+            graphicsPipelineCreateInfo.stageCount          = shader->GetStageCount();
+            graphicsPipelineCreateInfo.renderPass          = renderPass;
+            graphicsPipelineCreateInfo.subpass             = 0;
+
+            return vkCreateGraphicsPipelines(VKDevice::Get().GetDevice(), VKDevice::Get().GetPipelineCache(), 1, &graphicsPipelineCreateInfo, VK_NULL_HANDLE, outPipeline);
         }
 
         void VKPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().BoundPipelines++;
+            VKCommandBuffer* vkCommandBuffer = static_cast<VKCommandBuffer*>(commandBuffer);
+            vkCommandBuffer->CountBoundPipeline();
 
-            VKFramebuffer* framebuffer;
-
-            if(!m_Compute)
+            // Secondaries continue a render pass BeginSecondaryPass started on the primary
+            if(!m_Compute && vkCommandBuffer->IsPrimary())
             {
                 TransitionAttachments();
 
-                if(m_Description.swapchainTarget)
-                {
-                    framebuffer = m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()];
-                }
-                else if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
-                {
-                    framebuffer = m_Framebuffers[layer];
-                }
-                else
-                {
-                    framebuffer = m_Framebuffers[0];
-                }
-
-                ((VKCommandBuffer*)commandBuffer)->BeginRenderPass(m_RenderPass, m_Description.clearColour, framebuffer, GetWidth(), GetHeight());
+                vkCommandBuffer->BeginRenderPass(m_RenderPass, m_Description.clearColour, GetFramebuffer(layer), GetWidth(), GetHeight());
                 // m_RenderPass->BeginRenderPass(commandBuffer, m_Description.clearColour, framebuffer, Graphics::INLINE, GetWidth(), GetHeight());
             }
             else
@@ -322,6 +311,37 @@ namespace Lumos
                                   m_DepthBiasSlope);
         }
 
+        Framebuffer* VKPipeline::GetFramebuffer(uint32_t layer) const
+        {
+            if(m_Description.swapchainTarget)
+                return m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()].get();
+
+            if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
+                return m_Framebuffers[layer].get();
+
+            return m_Framebuffers[0].get();
+        }
+
+        void VKPipeline::BeginSecondaryPass(CommandBuffer* primaryCommandBuffer, uint32_t layer)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            ASSERT(!m_Compute, "Compute pipelines have no render pass");
+
+            // Pipeline binds on the primary would otherwise be skipped as already bound
+            primaryCommandBuffer->UnBindPipeline();
+            TransitionAttachments();
+            static_cast<VKCommandBuffer*>(primaryCommandBuffer)->BeginRenderPass(m_RenderPass, m_Description.clearColour, GetFramebuffer(layer), GetWidth(), GetHeight(), SubPassContents::SECONDARY);
+        }
+
+        void VKPipeline::BeginSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            secondaryCommandBuffer->BeginRecordingSecondary(m_RenderPass, GetFramebuffer(layer));
+
+            // Viewport state isn't inherited from the primary
+            secondaryCommandBuffer->UpdateViewport(Maths::Max(GetWidth(), 1u), Maths::Max(GetHeight(), 1u), m_Description.swapchainTarget);
+        }
+
         void VKPipeline::CreateFramebuffers()
         {
             LUMOS_PROFILE_FUNCTION_LOW();
@@ -520,11 +540,194 @@ namespace Lumos
         void VKPipeline::MakeDefault()
         {
             CreateFunc = CreateFuncVulkan;
+            WarmUpFunc = WarmUpFuncVulkan;
         }
 
         Pipeline* VKPipeline::CreateFuncVulkan(const PipelineDesc& pipelineDesc)
         {
             return new VKPipeline(pipelineDesc);
         }
+
+        // Render pass with the attachments of a recorded pipeline, declared in the same order and with the same
+        // dependencies as VKRenderPass so pipelines compiled against it are compatible with the real one
+        static VkRenderPass CreateWarmUpRenderPass(const PipelineRecord& record, uint32_t& colourAttachmentCount)
+        {
+            static const uint32_t MaxAttachments = MAX_RENDER_TARGETS + 3;
+
+            VkAttachmentDescription attachments[MaxAttachments]    = {};
+            VkAttachmentReference colourReferences[MaxAttachments] = {};
+            VkAttachmentReference depthReference                   = {};
+            VkSubpassDependency dependencies[MaxAttachments * 2]   = {};
+            uint32_t attachmentCount                               = 0;
+            uint32_t dependencyCount                               = 0;
+            bool hasDepth                                          = false;
+            colourAttachmentCount                                  = 0;
+
+            const VkSampleCountFlagBits samples = record.samples > 1 ? (VkSampleCountFlagBits)record.samples : VK_SAMPLE_COUNT_1_BIT;
+
+            auto addAttachment = [&](VkFormat format, bool depth)
+            {
+                VkAttachmentDescription& attachment = attachments[attachmentCount];
+                attachment.format                   = format;
+                attachment.samples                  = samples;
+                attachment.loadOp                   = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                attachment.storeOp                  = VK_ATTACHMENT_STORE_OP_STORE;
+                attachment.stencilLoadOp            = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                attachment.stencilStoreOp           = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                attachment.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED;
+                attachment.finalLayout              = depth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+                VkSubpassDependency& in  = dependencies[dependencyCount++];
+                VkSubpassDependency& out = dependencies[dependencyCount++];
+                in.srcSubpass            = VK_SUBPASS_EXTERNAL;
+                in.dstSubpass            = 0;
+                in.dependencyFlags       = VK_DEPENDENCY_BY_REGION_BIT;
+                out.srcSubpass           = 0;
+                out.dstSubpass           = VK_SUBPASS_EXTERNAL;
+                out.dependencyFlags      = VK_DEPENDENCY_BY_REGION_BIT;
+
+                if(depth)
+                {
+                    depthReference = { attachmentCount, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+                    hasDepth       = true;
+
+                    in.srcStageMask   = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                    in.dstStageMask   = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+                    in.srcAccessMask  = VK_ACCESS_SHADER_READ_BIT;
+                    in.dstAccessMask  = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                    out.srcStageMask  = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+                    out.dstStageMask  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                    out.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                    out.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                }
+                else
+                {
+                    colourReferences[colourAttachmentCount++] = { attachmentCount, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+                    in.srcStageMask   = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+                    in.dstStageMask   = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+                    in.srcAccessMask  = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+                    in.dstAccessMask  = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+                    out.srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+                    out.dstStageMask  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                    out.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+                    out.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                }
+
+                attachmentCount++;
+            };
+
+            if(record.swapchainTarget)
+                addAttachment(((VKTexture2D*)Renderer::GetMainSwapChain()->GetImage(0))->GetVKFormat(), false);
+            else
+            {
+                for(uint32_t i = 0; i < MAX_RENDER_TARGETS && record.colourFormats[i] != RHIFormat::NONE; i++)
+                    addAttachment(VKUtilities::FormatToVK(record.colourFormats[i]), false);
+            }
+
+            if(record.depthFormat != RHIFormat::NONE)
+                addAttachment(VKUtilities::FormatToVK(record.depthFormat), true);
+            if(record.cubeMapFormat != RHIFormat::NONE)
+                addAttachment(VKUtilities::FormatToVK(record.cubeMapFormat), false);
+
+            VkAttachmentReference resolveReference = {};
+            const bool resolve                     = record.resolveFormat != RHIFormat::NONE && record.samples > 1;
+            if(resolve)
+            {
+                resolveReference                     = { attachmentCount, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+                attachments[attachmentCount]         = attachments[0];
+                attachments[attachmentCount].format  = VKUtilities::FormatToVK(record.resolveFormat);
+                attachments[attachmentCount].samples = VK_SAMPLE_COUNT_1_BIT;
+                attachmentCount++;
+            }
+
+            VkSubpassDescription subpass    = {};
+            subpass.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+            subpass.colorAttachmentCount    = colourAttachmentCount;
+            subpass.pColorAttachments       = colourReferences;
+            subpass.pDepthStencilAttachment = hasDepth ? &depthReference : nullptr;
+            subpass.pResolveAttachments     = resolve ? &resolveReference : nullptr;
+
+            VkRenderPassCreateInfo renderPassCreateInfo = VKInitialisers::RenderPassCreateInfo();
+            renderPassCreateInfo.attachmentCount        = attachmentCount;
+            renderPassCreateInfo.pAttachments           = attachments;
+            renderPassCreateInfo.subpassCount           = 1;
+            renderPassCreateInfo.pSubpasses             = &subpass;
+            renderPassCreateInfo.dependencyCount        = dependencyCount;
+            renderPassCreateInfo.pDependencies          = dependencies;
+
+            VkRenderPass renderPass = VK_NULL_HANDLE;
+            if(vkCreateRenderPass(VKDevice::Get().GetDevice(), &renderPassCreateInfo, VK_NULL_HANDLE, &renderPass) != VK_SUCCESS)
+                return VK_NULL_HANDLE;
+            return renderPass;
+        }
+
+        static bool WarmUpPipeline(const PipelineRecord& record, VKShader* shader)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            VkDevice device     = VKDevice::Get().GetDevice();
+            VkPipeline pipeline = VK_NULL_HANDLE;
+
+            if(record.compute)
+            {
+                VKPipeline::CreateComputePipeline(shader, &pipeline);
+            }
+            else
+            {
+                uint32_t colourAttachmentCount = 0;
+                VkRenderPass renderPass        = CreateWarmUpRenderPass(record, colourAttachmentCount);
+                if(renderPass == VK_NULL_HANDLE)
+                    return false;
+
+                PipelineDesc pipelineDesc;
+                pipelineDesc.cullMode            = record.cullMode;
+                pipelineDesc.polygonMode         = record.polygonMode;
+                pipelineDesc.drawType            = record.drawType;
+                pipelineDesc.blendMode           = record.blendMode;
+                pipelineDesc.transparencyEnabled = record.transparencyEnabled;
+                pipelineDesc.depthBiasEnabled    = record.depthBiasEnabled;
+                pipelineDesc.swapchainTarget     = record.swapchainTarget;
+                pipelineDesc.DepthTest           = record.DepthTest;
+                pipelineDesc.DepthWrite          = record.DepthWrite;
+                pipelineDesc.samples             = record.samples;
+                pipelineDesc.lineWidth           = record.lineWidth;
+
+                VKPipeline::CreateGraphicsPipeline(pipelineDesc, shader, renderPass, colourAttachmentCount, &pipeline);
+                vkDestroyRenderPass(device, renderPass, VK_NULL_HANDLE);
+            }
+
+            // Only the driver's copy in the pipeline cache is wanted
+            if(pipeline == VK_NULL_HANDLE)
+                return false;
+            vkDestroyPipeline(device, pipeline, VK_NULL_HANDLE);
+            return true;
+        }
+
+        uint32_t VKPipeline::WarmUpFuncVulkan(const PipelineRecord* records, const SharedPtr<Shader>* shaders, uint32_t count)
+        {
+            LUMOS_PROFILE_FUNCTION();
+
+            struct WarmUpJobs
+            {
+                const PipelineRecord* Records;
+                const SharedPtr<Shader>* Shaders;
+                std::atomic<uint32_t> Created;
+            };
+
+            WarmUpJobs jobs;
+            jobs.Records = records;
+            jobs.Shaders = shaders;
+            jobs.Created = 0;
+
+            // The pipeline cache is internally synchronised so every job compiles straight into it
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, count, 1, [&jobs](JobDispatchArgs args)
+                                        {
+                if(WarmUpPipeline(jobs.Records[args.jobIndex], (VKShader*)jobs.Shaders[args.jobIndex].get()))
+                    jobs.Created++; });
+            System::JobSystem::Wait(ctx);
+
+            return jobs.Created;
+        }
     }
 }
@@ -12,6 +12,7 @@ namespace Lumos
     namespace Graphics
     {
         class VKCommandBuffer;
+        class VKShader;
 
         class VKPipeline : public Pipeline
         {
@@ -38,6 +39,11 @@ namespace Lumos
                 return m_Shader.get();
             }
 
+            RenderPass* GetRenderPass() const override { return m_RenderPass.get(); }
+            Framebuffer* GetFramebuffer(uint32_t layer = 0) const override;
+            void BeginSecondaryPass(CommandBuffer* primaryCommandBuffer, uint32_t layer = 0) override;
+            void BeginSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer = 0) override;
+
             void CreateFramebuffers();
             void ClearRenderTargets(CommandBuffer* commandBuffer) override;
             void TransitionAttachments();
@@ -45,8 +51,13 @@ namespace Lumos
 
             static void MakeDefault();
 
+            // Only the state and sample count of pipelineDesc are read, renderPass supplies the attachments
+            static VkResult CreateGraphicsPipeline(const PipelineDesc& pipelineDesc, VKShader* shader, VkRenderPass renderPass, uint32_t colourAttachmentCount, VkPipeline* outPipeline);
+            static VkResult CreateComputePipeline(VKShader* shader, VkPipeline* outPipeline);
+
         protected:
             static Pipeline* CreateFuncVulkan(const PipelineDesc& pipelineDesc);
+            static uint32_t WarmUpFuncVulkan(const PipelineRecord* records, const SharedPtr<Shader>* shaders, uint32_t count);
 
         private:
             SharedPtr<Shader> m_Shader;
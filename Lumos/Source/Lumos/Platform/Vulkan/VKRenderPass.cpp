@@ -337,7 +337,10 @@ namespace Lumos
             }
 
             vkCmdBeginRenderPass(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), &rpBegin, SubPassContentsToVK(contents));
-            commandBuffer->UpdateViewport(RenderPassWidth, RenderPassHeight, m_SwapchainTarget);
+
+            // Secondaries executed in the pass set their own viewport, the primary can't record one inside it
+            if(contents == SubPassContents::INLINE)
+                commandBuffer->UpdateViewport(RenderPassWidth, RenderPassHeight, m_SwapchainTarget);
 
             s_ActiveCount++;
             Engine::Get().Statistics().BoundRenderPasses++;
@@ -10,7 +10,10 @@
 #include "VKSwapChain.h"
 #include "VKSemaphore.h"
 #include "VKTexture.h"
+#include "VKStorageBuffer.h"
+#include "VKCommandPool.h"
 #include "Core/Engine.h"
+#include "Core/JobSystem.h"
 #include "Core/Application.h"
 #include "Core/OS/Window.h"
 #include "Core/Algorithms/Find.h"
@@ -47,6 +50,11 @@ namespace Lumos
         VKRenderer::~VKRenderer()
         {
             // DescriptorPool deleted by VKContext
+            if(!m_SecondaryCommandPools.Empty())
+            {
+                VKUtilities::WaitIdle();
+                m_SecondaryCommandPools.Clear();
+            }
         }
 
         void VKRenderer::PresentInternal(CommandBuffer* commandBuffer)
@@ -145,7 +153,54 @@ namespace Lumos
             s_DeletionQueue[s_DeletionQueueIndex].Flush();
 
             SharedPtr<VKSwapChain> swapChain = Application::Get().GetWindow()->GetSwapChain().As<VKSwapChain>();
-            return swapChain->Begin();
+            if(!swapChain->Begin())
+                return false;
+
+            // The swapchain has waited on this frame's fence, so its secondaries are no longer in use
+            ResetSecondaryCommandPools(swapChain->GetCurrentBufferIndex());
+            return true;
+        }
+
+        void VKRenderer::ResetSecondaryCommandPools(uint32_t frameIndex)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(m_SecondaryCommandPools.Empty())
+            {
+                m_SecondaryPoolsPerFrame = System::JobSystem::GetThreadCount() + 1;
+                m_SecondaryCommandPools.Resize(MAX_SWAPCHAIN_BUFFERS * m_SecondaryPoolsPerFrame);
+                return;
+            }
+
+            for(uint32_t i = 0; i < m_SecondaryPoolsPerFrame; i++)
+            {
+                SecondaryCommandPool& pool = m_SecondaryCommandPools[frameIndex * m_SecondaryPoolsPerFrame + i];
+                if(pool.Used == 0)
+                    continue;
+
+                pool.Pool->Reset();
+                pool.Used = 0;
+            }
+        }
+
+        CommandBuffer* VKRenderer::AllocateSecondaryCommandBuffer()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const uint32_t threadIndex = System::JobSystem::GetCurrentThreadIndex();
+            ASSERT(threadIndex < m_SecondaryPoolsPerFrame, "Secondary command pools not created for this thread");
+
+            // Only the calling thread touches its pool, so no lock is needed
+            SecondaryCommandPool& pool = m_SecondaryCommandPools[GetMainSwapChain()->GetCurrentBufferIndex() * m_SecondaryPoolsPerFrame + threadIndex];
+            if(!pool.Pool)
+                pool.Pool = CreateSharedPtr<VKCommandPool>(VKDevice::Get().GetPhysicalDevice()->GetGraphicsQueueFamilyIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+
+            if(pool.Used == pool.CommandBuffers.Size())
+            {
+                SharedPtr<VKCommandBuffer> commandBuffer = CreateSharedPtr<VKCommandBuffer>();
+                commandBuffer->Init(false, pool.Pool->GetHandle());
+                pool.CommandBuffers.PushBack(commandBuffer);
+            }
+
+            return pool.CommandBuffers[pool.Used++].get();
         }
 
         void VKRenderer::PresentInternal()
@@ -471,17 +526,23 @@ file.close();
         void VKRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().NumDrawCalls++;
-            Engine::Get().Statistics().TriangleCount += count / 3;
+            static_cast<VKCommandBuffer*>(commandBuffer)->CountDraw(count / 3);
+
+            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, start, 0, 0);
+        }
+
+        void VKRenderer::DrawIndexedInstancedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start) const
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            static_cast<VKCommandBuffer*>(commandBuffer)->CountDraw((count / 3) * instanceCount);
 
-            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, 0, 0, 0);
+            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, instanceCount, start, 0, 0);
         }
 
         void VKRenderer::DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().NumDrawCalls++;
-            Engine::Get().Statistics().TriangleCount += count / 3;
+            static_cast<VKCommandBuffer*>(commandBuffer)->CountDraw(count / 3);
 
             vkCmdDraw(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, 0, 0);
         }
@@ -521,6 +582,43 @@ file.close();
             //            }
         }
 
+        void VKRenderer::DrawIndexedIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            static_cast<VKCommandBuffer*>(commandBuffer)->CountDraw(0);
+
+            VkBuffer buffer = *static_cast<VkBuffer*>(argumentBuffer->GetBuffer());
+            vkCmdDrawIndexedIndirect(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), buffer, offset, 1, sizeof(DrawIndexedArguments));
+        }
+
+        void VKRenderer::DrawIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            static_cast<VKCommandBuffer*>(commandBuffer)->CountDraw(0);
+
+            VkBuffer buffer = *static_cast<VkBuffer*>(argumentBuffer->GetBuffer());
+            vkCmdDrawIndirect(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), buffer, offset, 1, sizeof(DrawArguments));
+        }
+
+        void VKRenderer::ComputeBarrier(CommandBuffer* commandBuffer)
+        {
+            VkMemoryBarrier barrier = {};
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask   = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+
+            vkCmdPipelineBarrier(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                                 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        }
+
+        void VKRenderer::VertexToComputeBarrier(CommandBuffer* commandBuffer)
+        {
+            // Write after read only needs the execution dependency
+            vkCmdPipelineBarrier(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+        }
+
         void VKRenderer::DrawSplashScreen(Texture* texture)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -18,6 +18,8 @@ namespace Lumos
     namespace Graphics
     {
         class CommandBuffer;
+        class VKCommandBuffer;
+        class VKCommandPool;
 
         class LUMOS_EXPORT VKRenderer : public Renderer
         {
@@ -57,10 +59,16 @@ namespace Lumos
             void BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount) override;
             void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const override;
             void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const override;
+            void DrawIndexedInstancedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start) const override;
             void DrawSplashScreen(Texture* texture) override;
             uint32_t GetGPUCount() const override;
             bool SupportsCompute() override { return true; }
             void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) override;
+            void DrawIndexedIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset) override;
+            void DrawIndirect(CommandBuffer* commandBuffer, StorageBuffer* argumentBuffer, uint32_t offset) override;
+            void ComputeBarrier(CommandBuffer* commandBuffer) override;
+            void VertexToComputeBarrier(CommandBuffer* commandBuffer) override;
+            CommandBuffer* AllocateSecondaryCommandBuffer() override;
 
             bool AllocateDescriptorSet(VkDescriptorSet* set, VkDescriptorPool& pool, VkDescriptorSetLayout layout, uint32_t descriptorCount);
             bool DeallocateDescriptorSet(VkDescriptorSet* set, VkDescriptorPool& pool);
@@ -99,6 +107,18 @@ namespace Lumos
         private:
             VkDescriptorPool CreatePool(VkDevice device, uint32_t count, VkDescriptorPoolCreateFlags flags);
             VkDescriptorPool GetPool();
+            void ResetSecondaryCommandPools(uint32_t frameIndex);
+
+            // Command pools can only be used by one thread at a time, so each frame in flight has one per job system thread
+            struct SecondaryCommandPool
+            {
+                SharedPtr<VKCommandPool> Pool;
+                TDArray<SharedPtr<VKCommandBuffer>> CommandBuffers;
+                uint32_t Used = 0;
+            };
+
+            TDArray<SecondaryCommandPool> m_SecondaryCommandPools;
+            uint32_t m_SecondaryPoolsPerFrame = 0;
 
             uint32_t m_CurrentSemaphoreIndex = 0;
 
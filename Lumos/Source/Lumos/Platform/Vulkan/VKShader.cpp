@@ -366,11 +366,16 @@ namespace Lumos
                 return sizeof(Vec4);
             case VK_FORMAT_R32G32B32A32_SINT:
                 return sizeof(IVec4);
-            case VK_FORMAT_R32G32_SINT:
-            case VK_FORMAT_R32G32B32_SINT:
+            case VK_FORMAT_R32_UINT:
+                return sizeof(uint32_t);
             case VK_FORMAT_R32G32_UINT:
+                return sizeof(uint32_t) * 2;
             case VK_FORMAT_R32G32B32_UINT:
+                return sizeof(uint32_t) * 3;
             case VK_FORMAT_R32G32B32A32_UINT:
+                return sizeof(uint32_t) * 4;
+            case VK_FORMAT_R32G32_SINT:
+            case VK_FORMAT_R32G32B32_SINT:
             default:
                 LERROR("Unsupported Format %i", (int)format);
                 return 0;
@@ -477,12 +482,13 @@ namespace Lumos
 
                 HashCombine(m_Hash, debugName.str);
 
-                uint32_t fileSize = uint32_t(FileSystem::GetFileSize(debugName));
-                uint32_t* source  = reinterpret_cast<uint32_t*>(FileSystem::ReadFile(arena, debugName));
+                // Project shaders can come from the mounted pack, entries there are aligned for reading in place
+                String8 source;
+                String8 vfsPath = FileSystem::Get().AbsolutePathToFileSystem(arena, debugName);
 
-                if(source)
+                if(FileSystem::Get().MapFileVFS(arena, vfsPath, &source))
                 {
-                    LoadFromData(source, fileSize, file.first, currentShaderStage);
+                    LoadFromData(reinterpret_cast<const uint32_t*>(source.str), uint32_t(source.size), file.first, currentShaderStage);
 
                     currentShaderStage++;
                 }
@@ -590,6 +596,55 @@ namespace Lumos
             VK_CHECK_RESULT(vkCreatePipelineLayout(VKDevice::Get().GetDevice(), &pipelineLayoutCreateInfo, VK_NULL_HANDLE, &m_PipelineLayout));
         }
 
+        void VKShader::SetVertexInputLayout(VertexInputLayout layout)
+        {
+            if(layout == m_VertexInputLayout)
+                return;
+
+            m_VertexInputLayout = layout;
+            HashCombine(m_Hash, (uint8_t)layout);
+            BuildVertexInputDescriptions();
+        }
+
+        void VKShader::BuildVertexInputDescriptions()
+        {
+            m_VertexInputStride = 0;
+            m_VertexInputAttributeDescriptions.Clear();
+            m_VertexInputBindingDescriptions.Clear();
+
+            for(const VertexInput& input : m_VertexInputs)
+            {
+                VkVertexInputAttributeDescription& description = m_VertexInputAttributeDescriptions.EmplaceBack();
+                description.location                           = input.Location;
+                description.format                             = input.Format;
+
+                if(m_VertexInputLayout == VertexInputLayout::CompactStreams)
+                {
+                    description.binding = input.Location;
+                    description.offset  = 0;
+
+                    VkVertexInputBindingDescription& binding = m_VertexInputBindingDescriptions.EmplaceBack();
+                    binding.binding                          = input.Location;
+                    binding.stride                           = GetStrideFromVulkanFormat(input.Format);
+                    binding.inputRate                        = VK_VERTEX_INPUT_RATE_VERTEX;
+                }
+                else
+                {
+                    description.binding = 0;
+                    description.offset  = m_VertexInputStride;
+                    m_VertexInputStride += GetStrideFromVulkanFormat(input.Format);
+                }
+            }
+
+            if(m_VertexInputStride > 0)
+            {
+                VkVertexInputBindingDescription& binding = m_VertexInputBindingDescriptions.EmplaceBack();
+                binding.binding                          = 0;
+                binding.stride                           = m_VertexInputStride;
+                binding.inputRate                        = VK_VERTEX_INPUT_RATE_VERTEX;
+            }
+        }
+
         static const char* ShaderStageToString(const VkShaderStageFlagBits stage)
         {
             switch(stage)
@@ -621,21 +676,14 @@ namespace Lumos
             if(shaderType == ShaderType::VERTEX)
             {
                 // Vertex Layout
-                m_VertexInputStride = 0;
-
+                m_VertexInputs.Clear();
                 for(const spirv_cross::Resource& resource : resources.stage_inputs)
                 {
-                    const spirv_cross::SPIRType& InputType = comp.get_type(resource.type_id);
-
-                    VkVertexInputAttributeDescription Description = {};
-                    Description.binding                           = comp.get_decoration(resource.id, spv::DecorationBinding);
-                    Description.location                          = comp.get_decoration(resource.id, spv::DecorationLocation);
-                    Description.offset                            = m_VertexInputStride;
-                    Description.format                            = GetVulkanFormat(InputType);
-                    m_VertexInputAttributeDescriptions.PushBack(Description);
-
-                    m_VertexInputStride += GetStrideFromVulkanFormat(Description.format);
+                    VertexInput& input = m_VertexInputs.EmplaceBack();
+                    input.Location     = comp.get_decoration(resource.id, spv::DecorationLocation);
+                    input.Format       = GetVulkanFormat(comp.get_type(resource.type_id));
                 }
+                BuildVertexInputDescriptions();
             }
 
             // Descriptor Layout
@@ -679,6 +727,27 @@ namespace Lumos
                 }
             }
 
+            for(auto& u : resources.storage_buffers)
+            {
+                uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+                uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+                auto& type       = comp.get_type(u.type_id);
+
+                SHADER_LOG(LINFO("Found SSBO %s at set = %i, binding = %i", u.name.c_str(), set, binding));
+                m_DescriptorLayoutInfo.PushBack({ Graphics::DescriptorType::STORAGE_BUFFER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
+
+                // Size left at 0 so the whole buffer is bound, runtime sized arrays have no declared size
+                auto& descriptorInfo     = m_DescriptorInfos[set];
+                auto& descriptor         = descriptorInfo.descriptors.EmplaceBack();
+                descriptor.binding       = binding;
+                descriptor.size          = 0;
+                descriptor.name          = u.name;
+                descriptor.offset        = 0;
+                descriptor.shaderType    = shaderType;
+                descriptor.type          = Graphics::DescriptorType::STORAGE_BUFFER;
+                descriptor.storageBuffer = nullptr;
+            }
+
             for(auto& u : resources.push_constant_buffers)
             {
                 uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
@@ -818,6 +887,13 @@ namespace Lumos
             }
         }
 
+        void VKShader::BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const PushConstant& pc = m_PushConstants[index];
+            vkCmdPushConstants(static_cast<Graphics::VKCommandBuffer*>(commandBuffer)->GetHandle(), static_cast<Graphics::VKPipeline*>(pipeline)->GetPipelineLayout(), VKUtilities::ShaderTypeToVK(pc.shaderStage), pc.offset, pc.size, data);
+        }
+
         VkPipelineShaderStageCreateInfo* VKShader::GetShaderStages() const
         {
             return m_ShaderStages;
@@ -85,6 +85,7 @@ namespace Lumos
             const TDArray<DescriptorLayoutInfo>& GetDescriptorLayout() const { return m_DescriptorLayoutInfo; }
             const TDArray<VkDescriptorSetLayout>& GetDescriptorLayouts() const { return m_DescriptorSetLayouts; }
             void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) override;
+            void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const void* data) override;
 
             static void PreProcess(const std::string& source, std::map<ShaderType, std::string>* sources);
             static void ReadShaderFile(const TDArray<std::string>& lines, std::map<ShaderType, std::string>* shaders);
@@ -98,15 +99,20 @@ namespace Lumos
 
             const TDArray<VkVertexInputAttributeDescription>& GetVertexInputAttributeDescription() const { return m_VertexInputAttributeDescriptions; }
             const uint32_t GetVertexInputStride() const { return m_VertexInputStride; }
+            const TDArray<VkVertexInputBindingDescription>& GetVertexInputBindingDescription() const { return m_VertexInputBindingDescriptions; }
 
             uint64_t GetHash() const override { return m_Hash; }
 
+            void SetVertexInputLayout(VertexInputLayout layout) override;
+            VertexInputLayout GetVertexInputLayout() const override { return m_VertexInputLayout; }
+
         protected:
             static Shader* CreateFuncVulkan(const char*);
             static Shader* CreateFromEmbeddedFuncVulkan(const uint32_t* vertData, uint32_t vertDataSize, const uint32_t* fragData, uint32_t fragDataSize);
             static Shader* CreateCompFromEmbeddedFuncVulkan(const uint32_t* compData, uint32_t compDataSize);
             void LoadFromData(const uint32_t* data, uint32_t size, ShaderType type, int currentShaderStage);
             void CreatePipelineLayout();
+            void BuildVertexInputDescriptions();
 
         private:
             std::unordered_map<uint32_t, DescriptorSetInfo> m_DescriptorInfos;
@@ -119,9 +125,19 @@ namespace Lumos
             TDArray<ShaderType> m_ShaderTypes;
             bool m_Compiled = false;
 
+            // Reflected from the vertex stage, the descriptions below are built from them for m_VertexInputLayout
+            struct VertexInput
+            {
+                uint32_t Location;
+                VkFormat Format;
+            };
+
+            TDArray<VertexInput> m_VertexInputs;
             TDArray<VkVertexInputAttributeDescription> m_VertexInputAttributeDescriptions;
-            uint32_t m_VertexInputStride = 0;
-            uint64_t m_Hash              = 0;
+            TDArray<VkVertexInputBindingDescription> m_VertexInputBindingDescriptions;
+            VertexInputLayout m_VertexInputLayout = VertexInputLayout::Interleaved;
+            uint32_t m_VertexInputStride          = 0;
+            uint64_t m_Hash                       = 0;
 
             VkPipelineLayout m_PipelineLayout;
             TDArray<PushConstant> m_PushConstants;
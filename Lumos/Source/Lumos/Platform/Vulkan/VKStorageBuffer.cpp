@@ -6,9 +6,11 @@ namespace Lumos
 {
     namespace Graphics
     {
-        VKStorageBuffer::VKStorageBuffer(uint32_t size, const void* data)
+        VKStorageBuffer::VKStorageBuffer(uint32_t size, const void* data, BufferUsage usage)
         {
-            VKBuffer::Init(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, size, data);
+            // Compute passes can also write draw arguments into storage buffers. Static buffers get device local
+            // memory, any initial data goes through a staging copy
+            VKBuffer::Init(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, usage == BufferUsage::STATIC ? 0 : VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, size, data);
         }
 
         VKStorageBuffer::VKStorageBuffer()
@@ -47,9 +49,9 @@ namespace Lumos
             CreateFunc = CreateFuncVulkan;
         }
 
-        StorageBuffer* VKStorageBuffer::CreateFuncVulkan(uint32_t size, const void* data)
+        StorageBuffer* VKStorageBuffer::CreateFuncVulkan(uint32_t size, const void* data, BufferUsage usage)
         {
-            return new VKStorageBuffer(size, data);
+            return new VKStorageBuffer(size, data, usage);
         }
     }
 }
@@ -66,6 +66,22 @@ namespace Lumos
         return result;
     }
 
+    int64_t FileSystem::GetFileModifiedTime(const String8& path)
+    {
+        ArenaTemp scratch              = ScratchBegin(0, 0);
+        String16 path16                = Str16From8(scratch.arena, path);
+        WIN32_FILE_ATTRIBUTE_DATA data = {};
+        const bool found               = GetFileAttributesExW((WCHAR*)path16.str, GetFileExInfoStandard, &data) != 0;
+        ScratchEnd(scratch);
+        if(!found)
+            return -1;
+
+        ULARGE_INTEGER time;
+        time.LowPart  = data.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        return (int64_t)time.QuadPart;
+    }
+
     bool FileSystem::ReadFile(Arena* arena, const String8& path, void* buffer, int64_t size)
     {
         std::ifstream stream((const char*)path.str, std::ios::binary | std::ios::ate);
@@ -167,6 +183,45 @@ namespace Lumos
     {
         return WriteFile(path, text.str, (uint32_t)text.size);
     }
+
+    bool FileSystem::MapFile(const String8& path, MappedFile* outFile)
+    {
+        ArenaTemp scratch = ScratchBegin(0, 0);
+        String16 path16   = Str16From8(scratch.arena, path);
+        HANDLE file       = CreateFileW((WCHAR*)path16.str, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+        ScratchEnd(scratch);
+
+        if(file == INVALID_HANDLE_VALUE)
+            return false;
+
+        const int64_t size = GetFileSizeInternal(file);
+        HANDLE mapping     = size > 0 ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : NULL;
+        CloseHandle(file);
+        if(!mapping)
+            return false;
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(!data)
+        {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        outFile->Data   = (uint8_t*)data;
+        outFile->Size   = size;
+        outFile->Handle = mapping;
+        return true;
+    }
+
+    void FileSystem::UnmapFile(MappedFile* file)
+    {
+        if(file->Data)
+            UnmapViewOfFile(file->Data);
+        if(file->Handle)
+            CloseHandle((HANDLE)file->Handle);
+
+        *file = MappedFile();
+    }
 }
 
 #endif
@@ -14,6 +14,7 @@ namespace Lumos::Graphics
     {
         String8 Path = Str8StdS(path);
         ModelRef     = Application::Get().GetAssetManager()->AddAsset(Path, CreateSharedPtr<Graphics::Model>(path)).Data.As<Graphics::Model>();
+        Animation.reset();
 
         // ModelRef = Application::Get().GetModelLibrary()->GetAsset(path);
     }
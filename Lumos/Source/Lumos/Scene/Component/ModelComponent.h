@@ -1,5 +1,6 @@
 #pragma once
 #include "Graphics/Model.h"
+#include "Graphics/Animation/AnimationInstance.h"
 
 namespace Lumos::Graphics
 {
@@ -27,12 +28,33 @@ namespace Lumos::Graphics
         {
         }
 
+        // Copies share the model but get their own animation instance, created on their first update
+        ModelComponent(const ModelComponent& other)
+            : ModelRef(other.ModelRef)
+            , MeshLODs(other.MeshLODs)
+        {
+        }
+
+        ModelComponent& operator=(const ModelComponent& other)
+        {
+            ModelRef = other.ModelRef;
+            MeshLODs = other.MeshLODs;
+            Animation.reset();
+            return *this;
+        }
+
+        ModelComponent(ModelComponent&&)            = default;
+        ModelComponent& operator=(ModelComponent&&) = default;
+
         void LoadFromLibrary(const std::string& path);
         void LoadPrimitive(PrimitiveType primitive)
         {
             ModelRef = CreateSharedPtr<Model>(primitive);
+            Animation.reset();
         }
 
         SharedPtr<Model> ModelRef;
+        TDArray<uint8_t> MeshLODs; // LOD the renderer picked for each mesh last frame
+        SharedPtr<AnimationInstance> Animation;
     };
 }
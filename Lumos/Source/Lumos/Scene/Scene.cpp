@@ -33,6 +33,11 @@
 #include "Scene/EntityManager.h"
 #include "Scene/Component/SoundComponent.h"
 #include "Scene/Component/ModelComponent.h"
+#include "Graphics/Animation/AnimationController.h"
+#include "Core/JobSystem.h"
+#include "Core/QualitySettings.h"
+#include "Core/Algorithms/Sort.h"
+#include "Utilities/Timer.h"
 #include "SceneGraph.h"
 #include "Serialisation/SerialisationImplementation.h"
 
@@ -51,6 +56,8 @@
 #include <fstream>
 #include <ostream>
 
+static const uint32_t ANIMATION_SAMPLE_GROUP_SIZE = 8; // Skeletons sampled per job
+
 CEREAL_REGISTER_TYPE(Lumos::SphereCollisionShape);
 CEREAL_REGISTER_TYPE(Lumos::CuboidCollisionShape);
 CEREAL_REGISTER_TYPE(Lumos::PyramidCollisionShape);
@@ -307,20 +314,200 @@ namespace Lumos
             animSprite.OnUpdate((float)timeStep.GetSeconds());
         }
 
-        auto group = m_EntityManager->GetRegistry().group<Graphics::ModelComponent>(entt::get<Maths::Transform>);
+        UpdateAnimations(timeStep);
+        UpdateParticles(timeStep);
+    }
+
+    void Scene::UpdateAnimations(const TimeStep& timeStep)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Timer timer;
+
+        struct AnimationUpdate
+        {
+            Graphics::AnimationInstance* Instance;
+            const Graphics::AnimationController* Controller;
+            float Priority;
+            float TimeAhead;
+            uint32_t Interval;
+            uint32_t JointDepth;
+            uint32_t Phase; // Spreads skeletons created together over the frames of their interval
+            bool Sample;    // Otherwise blends the cached palettes
+        };
+
+        const QualitySettings& qs = Application::Get().GetQualitySettings();
+        const float dt            = (float)timeStep.GetSeconds();
+
+        // Samples fill updates from the front and blends from the back, so samples can be sorted on their own
+        auto group               = m_EntityManager->GetRegistry().group<Graphics::ModelComponent>(entt::get<Maths::Transform>);
+        const uint32_t capacity  = (uint32_t)group.size();
+        AnimationUpdate* updates = PushArrayNoZero(Application::Get().GetFrameArena(), AnimationUpdate, capacity);
+        uint32_t sampleCount     = 0;
+        uint32_t blendCount      = 0;
+        uint32_t skippedCount    = 0;
+        uint32_t animatedCount   = 0;
+
+        // Instances are created, their clocks moved on and their update rate picked here. The jobs below only touch
+        // each instance
         for(auto entity : group)
         {
-            if(!Entity(entity, this).Active())
+            if(!SceneGraph::IsActive(m_EntityManager->GetRegistry(), entity))
                 continue;
 
-            const auto& [model, trans] = group.get<Graphics::ModelComponent, Maths::Transform>(entity);
-
+            auto& model = group.get<Graphics::ModelComponent>(entity);
             if(!model.ModelRef)
                 continue;
 
-            const auto& meshes = model.ModelRef->GetMeshes();
-            model.ModelRef->UpdateAnimation(Engine::GetTimeStep());
+            const auto& controller = model.ModelRef->GetAnimationController();
+            if(!controller)
+                continue;
+
+            if(!model.Animation)
+            {
+                model.Animation        = CreateSharedPtr<Graphics::AnimationInstance>();
+                model.Animation->State = (uint32_t)controller->GetCurrentState();
+            }
+
+            Graphics::AnimationInstance& instance = *model.Animation;
+            animatedCount++;
+
+            // What the renderer saw last frame
+            const float screenSize = instance.ScreenSize;
+            const bool visible     = screenSize > 0.0f || instance.ShadowVisible;
+            instance.ScreenSize    = 0.0f;
+            instance.ShadowVisible = false;
+
+            // Nothing to draw, so the pose can wait until something sees it again
+            if(qs.EnableAnimationLOD && !visible && !instance.Palette.Empty())
+            {
+                if(!qs.FreezeOffscreenAnimations)
+                    controller->Advance(instance, dt);
+                skippedCount++;
+                continue;
+            }
+
+            uint32_t interval   = 1;
+            uint32_t jointDepth = ~0u;
+            if(qs.EnableAnimationLOD && screenSize < qs.AnimationNearPixels)
+            {
+                if(screenSize >= qs.AnimationFarPixels)
+                    interval = Maths::Max(qs.AnimationMidInterval, 1u);
+                else
+                {
+                    interval   = Maths::Max(qs.AnimationFarInterval, 1u);
+                    jointDepth = qs.AnimationFarJointDepth;
+                }
+            }
+
+            controller->Advance(instance, dt);
+            instance.UpdateStep++;
+
+            // Getting closer cuts the current interval short
+            const bool due = instance.Palette.Empty() || instance.UpdateStep >= Maths::Min(instance.UpdateInterval, interval);
+            if(due)
+            {
+                // Skeletons waiting on their first pose always go first, then the biggest on screen and longest overdue
+                const float priority    = instance.Palette.Empty() ? FLT_MAX : (screenSize + 1.0f) * (float)instance.UpdateStep;
+                updates[sampleCount++] = { &instance, controller.get(), priority, dt * (float)(interval - 1), interval, jointDepth, animatedCount, true };
+            }
+            else
+                updates[capacity - ++blendCount] = { &instance, controller.get(), 0.0f, 0.0f, interval, jointDepth, 0, false };
         }
+
+        // Over budget the lowest priority samples are dropped, keeping the palette they have until there's room
+        if(qs.AnimationBudgetMs > 0.0f && m_AnimationSampleCost > 0.0f)
+        {
+            const uint32_t maxSamples = (uint32_t)Maths::Max(qs.AnimationBudgetMs / m_AnimationSampleCost, 1.0f);
+            if(sampleCount > maxSamples)
+            {
+                Algorithms::HeapSort(updates, updates + sampleCount, [](const AnimationUpdate& a, const AnimationUpdate& b)
+                                     { return a.Priority > b.Priority; });
+
+                skippedCount += sampleCount - maxSamples;
+                sampleCount = maxSamples;
+            }
+        }
+
+        // Blends move up behind the samples so one dispatch covers both
+        for(uint32_t i = 0; i < blendCount; i++)
+            updates[sampleCount + i] = updates[capacity - blendCount + i];
+        const uint32_t updateCount = sampleCount + blendCount;
+
+        if(updateCount > 0)
+        {
+            Timer sampleTimer;
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, updateCount, ANIMATION_SAMPLE_GROUP_SIZE, [updates](JobDispatchArgs args)
+                                        {
+                const AnimationUpdate& update = updates[args.jobIndex];
+                Graphics::AnimationInstance& instance = *update.Instance;
+                if(!update.Sample)
+                {
+                    instance.InterpolatePalette();
+                    return;
+                }
+
+                if(update.Interval <= 1)
+                {
+                    update.Controller->Sample(instance, 0.0f, update.JointDepth);
+                    instance.UpdateInterval = 1;
+                    instance.UpdateStep     = 0;
+                    return;
+                }
+
+                // Samples where the interval ends and blends there from the palette on screen. A first sample has
+                // nothing to blend from, so it can start part way through
+                const bool first = instance.Palette.Empty();
+                instance.BeginInterval(update.Interval);
+                update.Controller->Sample(instance, update.TimeAhead, update.JointDepth);
+                if(first)
+                    instance.UpdateStep = update.Phase % update.Interval;
+                instance.EndInterval(); });
+            System::JobSystem::Wait(ctx);
+
+            if(sampleCount > 0)
+            {
+                const float cost      = (float)sampleTimer.GetElapsedMS() / (float)sampleCount;
+                m_AnimationSampleCost = m_AnimationSampleCost > 0.0f ? Maths::Lerp(m_AnimationSampleCost, cost, 0.1f) : cost;
+            }
+        }
+
+        auto& stats                = Engine::Get().Statistics();
+        stats.NumAnimatedSkeletons = animatedCount;
+        stats.NumSampledSkeletons  = sampleCount;
+        stats.NumBlendedSkeletons  = blendCount;
+        stats.NumSkippedSkeletons  = skippedCount;
+        stats.AnimationTime        = timer.GetElapsedMS();
+    }
+
+    void Scene::UpdateParticles(const TimeStep& timeStep)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        struct EmitterUpdate
+        {
+            ParticleEmitter* Emitter;
+            Vec3 Position;
+        };
+
+        // World positions are read here, the jobs only touch their own emitter
+        auto group             = m_EntityManager->GetRegistry().group<ParticleEmitter>(entt::get<Maths::Transform>);
+        EmitterUpdate* updates = PushArrayNoZero(Application::Get().GetFrameArena(), EmitterUpdate, group.size());
+        uint32_t emitterCount  = 0;
+        for(auto entity : group)
+        {
+            const auto& [emitter, transform] = group.get<ParticleEmitter, Maths::Transform>(entity);
+            updates[emitterCount++]          = { &emitter, transform.GetWorldPosition() };
+        }
+
+        if(emitterCount == 0)
+            return;
+
+        const float dt = (float)timeStep.GetSeconds();
+        System::JobSystem::Context ctx;
+        System::JobSystem::Dispatch(ctx, emitterCount, 1, [updates, dt](JobDispatchArgs args)
+                                    { updates[args.jobIndex].Emitter->Update(dt, updates[args.jobIndex].Position); });
+        System::JobSystem::Wait(ctx);
     }
 
     void Scene::OnEvent(Event& e)
@@ -516,7 +703,9 @@ namespace Lumos
         }
         else
         {
-            if(!FileSystem::FileExists(path))
+            // Read through the VFS so a scene in the mounted pack is found without its loose file
+            String8 vfsPath = FileSystem::Get().AbsolutePathToFileSystem(scratch.arena, path);
+            if(!FileSystem::Get().ExistsVFS(vfsPath))
             {
                 LERROR("No saved scene file found %s", (const char*)path.str);
                 ScratchEnd(scratch);
@@ -524,7 +713,7 @@ namespace Lumos
             }
             try
             {
-                String8 data = FileSystem::ReadTextFile(scratch.arena, path);
+                String8 data = FileSystem::Get().ReadTextFileVFS(scratch.arena, vfsPath);
                 std::istringstream istr;
                 istr.str((const char*)data.str);
                 cereal::JSONInputArchive input(istr);
@@ -93,6 +93,12 @@ namespace Lumos
         entt::registry& GetRegistry();
 
         void UpdateSceneGraph();
+
+        // Advances every active animated model and samples their poses in parallel
+        void UpdateAnimations(const TimeStep& timeStep);
+
+        // Steps every particle emitter, one job per emitter
+        void UpdateParticles(const TimeStep& timeStep);
         void DuplicateEntity(Entity entity);
         void DuplicateEntity(Entity entity, Entity parent);
         Entity CreateEntity();
@@ -104,6 +110,7 @@ namespace Lumos
         void SavePrefab(Entity entity, const std::string& path);
 
         EntityManager* GetEntityManager() { return m_EntityManager.get(); }
+        SceneGraph* GetSceneGraph() { return m_SceneGraph.get(); }
 
         virtual void Serialise(const std::string& filePath, bool binary = false);
         virtual void Deserialise(const std::string& filePath, bool binary = false);
@@ -219,6 +226,8 @@ namespace Lumos
         uint32_t m_ScreenWidth;
         uint32_t m_ScreenHeight;
 
+        float m_AnimationSampleCost = 0.0f; // ms per sampled skeleton over recent frames, for the animation budget
+
         // Load these assets ready to be used during a scene
         TDArray<UUID> m_PreLoadAssetsList;
 
@@ -1,6 +1,8 @@
 #include "Precompiled.h"
 #include "SceneGraph.h"
 #include "Maths/Transform.h"
+#include "Maths/MathsUtilities.h"
+#include "Core/JobSystem.h"
 
 DISABLE_WARNING_PUSH
 DISABLE_WARNING_CONVERSION_TO_SMALLER_TYPE
@@ -34,26 +36,217 @@ namespace Lumos
         registry.on_construct<Hierarchy>().connect<&Hierarchy::OnConstruct>();
         registry.on_update<Hierarchy>().connect<&Hierarchy::OnUpdate>();
         registry.on_destroy<Hierarchy>().connect<&Hierarchy::OnDestroy>();
+
+        registry.on_construct<Hierarchy>().connect<&SceneGraph::OnTopologyChanged>(*this);
+        registry.on_update<Hierarchy>().connect<&SceneGraph::OnTopologyChanged>(*this);
+        registry.on_destroy<Hierarchy>().connect<&SceneGraph::OnTopologyChanged>(*this);
+        registry.on_construct<Maths::Transform>().connect<&SceneGraph::OnTopologyChanged>(*this);
+        registry.on_construct<ActiveComponent>().connect<&SceneGraph::OnTopologyChanged>(*this);
+        registry.on_destroy<Maths::Transform>().connect<&SceneGraph::OnTransformDestroyed>(*this);
+
+        registry.ctx().insert_or_assign<SceneGraph*>(this);
     }
 
-    void SceneGraph::Update(entt::registry& registry)
+    void SceneGraph::OnHierarchyChanged(entt::registry& registry, entt::entity entity)
+    {
+        if(auto sceneGraph = registry.ctx().find<SceneGraph*>())
+            (*sceneGraph)->OnTopologyChanged(registry, entity);
+    }
+
+    bool SceneGraph::IsActive(const entt::registry& registry, entt::entity entity)
+    {
+        return !registry.all_of<InactiveComponent>(entity);
+    }
+
+    void SceneGraph::OnTopologyChanged(entt::registry& registry, entt::entity entity)
+    {
+        m_LevelsDirty = true;
+
+        // The parent may have changed, so the world matrix needs rebuilding even if the local one did not
+        if(auto transform = registry.try_get<Maths::Transform>(entity))
+            transform->SetDirty();
+    }
+
+    void SceneGraph::OnTransformDestroyed(entt::registry& registry, entt::entity entity)
+    {
+        m_LevelsDirty = true;
+
+        // Children of an entity without a transform are relative to identity
+        if(auto hierarchy = registry.try_get<Hierarchy>(entity))
+        {
+            entt::entity child = hierarchy->First();
+            while(child != entt::null)
+            {
+                if(auto transform = registry.try_get<Maths::Transform>(child))
+                    transform->SetDirty();
+
+                auto childHierarchy = registry.try_get<Hierarchy>(child);
+                child               = childHierarchy ? childHierarchy->Next() : entt::null;
+            }
+        }
+    }
+
+    void SceneGraph::RebuildLevels(entt::registry& registry)
     {
         LUMOS_PROFILE_FUNCTION();
-        auto nonHierarchyView = registry.view<Maths::Transform>(entt::exclude<Hierarchy>);
+        for(uint32_t i = 0; i < m_LevelCount; i++)
+        {
+            m_Levels[i].Entities.Clear();
+            m_Levels[i].ParentIndices.Clear();
+        }
+
+        if(m_Levels.Empty())
+            m_Levels.Resize(1);
+
+        // Roots are transforms without a parent, plus parentless hierarchy nodes so their children are reached
+        // and standalone entities that can be deactivated
+        DepthLevel& roots = m_Levels[0];
+        for(auto entity : registry.view<Maths::Transform>(entt::exclude<Hierarchy>))
+        {
+            roots.Entities.PushBack(entity);
+            roots.ParentIndices.PushBack(InvalidParent);
+        }
 
-        for(auto entity : nonHierarchyView)
+        for(auto entity : registry.view<ActiveComponent>(entt::exclude<Maths::Transform, Hierarchy>))
         {
-            registry.get<Maths::Transform>(entity).SetWorldMatrix(Mat4(1.0f));
+            roots.Entities.PushBack(entity);
+            roots.ParentIndices.PushBack(InvalidParent);
+        }
+
+        for(auto [entity, hierarchy] : registry.view<Hierarchy>().each())
+        {
+            if(hierarchy.Parent() == entt::null)
+            {
+                roots.Entities.PushBack(entity);
+                roots.ParentIndices.PushBack(InvalidParent);
+            }
+        }
+
+        m_LevelCount = 1;
+        while(!m_Levels[m_LevelCount - 1].Entities.Empty())
+        {
+            if(m_Levels.Size() <= m_LevelCount)
+                m_Levels.Resize(m_LevelCount + 1);
+
+            const DepthLevel& parents = m_Levels[m_LevelCount - 1];
+            DepthLevel& children      = m_Levels[m_LevelCount];
+            children.Entities.Clear();
+            children.ParentIndices.Clear();
+
+            for(uint32_t parentIndex = 0; parentIndex < (uint32_t)parents.Entities.Size(); parentIndex++)
+            {
+                entt::entity parent = parents.Entities[parentIndex];
+                auto hierarchy      = registry.try_get<Hierarchy>(parent);
+                if(!hierarchy)
+                    continue;
+
+                entt::entity child = hierarchy->First();
+                while(child != entt::null)
+                {
+                    children.Entities.PushBack(child);
+                    children.ParentIndices.PushBack(parentIndex);
+
+                    auto childHierarchy = registry.try_get<Hierarchy>(child);
+                    child               = childHierarchy ? childHierarchy->Next() : entt::null;
+                }
+            }
+
+            m_LevelCount++;
         }
 
-        auto view = registry.view<Hierarchy>();
-        for(auto entity : view)
+        // The last level is always empty
+        m_LevelCount--;
+        for(uint32_t i = 0; i < m_LevelCount; i++)
+            m_Levels[i].State.Resize(m_Levels[i].Entities.Size());
+
+        m_LevelsDirty = false;
+    }
+
+    void SceneGraph::Update(entt::registry& registry)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(m_LevelsDirty)
+            RebuildLevels(registry);
+
+        m_ChangedEntities.Clear();
+
+        auto& transforms = registry.storage<Maths::Transform>();
+        auto& actives    = registry.storage<ActiveComponent>();
+        auto& inactives  = registry.storage<InactiveComponent>();
+
+        // Levels depend on the one above, entities within a level are independent of each other
+        for(uint32_t levelIndex = 0; levelIndex < m_LevelCount; levelIndex++)
         {
-            const auto hierarchy = registry.try_get<Hierarchy>(entity);
-            if(hierarchy && hierarchy->Parent() == entt::null)
+            DepthLevel& level         = m_Levels[levelIndex];
+            const DepthLevel* parents = levelIndex > 0 ? &m_Levels[levelIndex - 1] : nullptr;
+            const uint32_t count      = (uint32_t)level.Entities.Size();
+
+            auto updateRange = [&](uint32_t begin, uint32_t end)
+            {
+                for(uint32_t i = begin; i < end; i++)
+                {
+                    entt::entity entity        = level.Entities[i];
+                    const uint32_t parentIndex = level.ParentIndices[i];
+                    const uint8_t parentState  = parentIndex != InvalidParent ? parents->State[parentIndex] : uint8_t(NodeState_Active);
+
+                    uint8_t state = 0;
+                    if((parentState & NodeState_Active) && (!actives.contains(entity) || actives.get(entity).active))
+                        state |= NodeState_Active;
+                    if(bool(state & NodeState_Active) == inactives.contains(entity))
+                        state |= NodeState_ActiveChanged;
+
+                    if(transforms.contains(entity))
+                    {
+                        state |= NodeState_HasTransform;
+                        Maths::Transform& transform = transforms.get(entity);
+
+                        // Children of an entity without a transform are relative to identity
+                        if(parentState & NodeState_HasTransform)
+                        {
+                            if(transform.IsDirty() || (parentState & NodeState_Changed))
+                            {
+                                transform.SetWorldMatrix(transforms.get(parents->Entities[parentIndex]).GetWorldMatrix());
+                                state |= NodeState_Changed;
+                            }
+                        }
+                        else if(transform.IsDirty())
+                        {
+                            transform.SetWorldMatrix(Mat4(1.0f));
+                            state |= NodeState_Changed;
+                        }
+                    }
+
+                    level.State[i] = state;
+                }
+            };
+
+            static const uint32_t TRANSFORM_BATCH_SIZE = 256;
+            if(count <= TRANSFORM_BATCH_SIZE)
+                updateRange(0, count);
+            else
+            {
+                System::JobSystem::Context ctx;
+                System::JobSystem::Dispatch(ctx, System::JobSystem::DispatchGroupCount(count, TRANSFORM_BATCH_SIZE), 1, [&](JobDispatchArgs args)
+                                            {
+                    const uint32_t begin = args.jobIndex * TRANSFORM_BATCH_SIZE;
+                    updateRange(begin, Maths::Min(begin + TRANSFORM_BATCH_SIZE, count)); });
+                System::JobSystem::Wait(ctx);
+            }
+
+            // Registry storage can only be modified from one thread
+            for(uint32_t i = 0; i < count; i++)
             {
-                // Recursively update children
-                UpdateTransform(entity, registry);
+                const uint8_t state = level.State[i];
+                if(state & NodeState_Changed)
+                    m_ChangedEntities.PushBack(level.Entities[i]);
+
+                if(state & NodeState_ActiveChanged)
+                {
+                    if(state & NodeState_Active)
+                        inactives.remove(level.Entities[i]);
+                    else
+                        inactives.emplace(level.Entities[i]);
+                }
             }
         }
     }
@@ -110,6 +303,8 @@ namespace Lumos
             hierarchy.m_Parent = parent;
             Hierarchy::OnConstruct(registry, entity);
         }
+
+        SceneGraph::OnHierarchyChanged(registry, entity);
     }
 
     bool Hierarchy::Compare(const entt::registry& registry, const entt::entity rhs) const
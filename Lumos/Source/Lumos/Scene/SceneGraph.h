@@ -6,6 +6,8 @@
 #include "Graphics/Camera/FPSCamera.h"
 #include "Graphics/Camera/EditorCamera.h"
 
+#include "Core/DataStructures/TDArray.h"
+
 #include <entt/entity/fwd.hpp>
 #include <cereal/cereal.hpp>
 
@@ -163,6 +165,12 @@ namespace Lumos
         bool active = true;
     };
 
+    // Added by SceneGraph::Update to entities that are inactive themselves or have an inactive ancestor.
+    // Lets per frame loops skip disabled entities without walking the hierarchy.
+    struct InactiveComponent
+    {
+    };
+
     class Hierarchy
     {
     public:
@@ -221,7 +229,45 @@ namespace Lumos
 
         void DisableOnConstruct(bool disable, entt::registry& registry);
 
+        // Rebuilds world matrices for dirty transforms and their descendants, one depth level at a time
         void Update(entt::registry& registry);
         void UpdateTransform(entt::entity entity, entt::registry& registry);
+
+        // Effective active state as of the last Update, no hierarchy walk
+        static bool IsActive(const entt::registry& registry, entt::entity entity);
+
+        // Entities whose world matrix was rebuilt by the last Update
+        const TDArray<entt::entity>& GetChangedEntities() const { return m_ChangedEntities; }
+
+        // Called when parenting changes outside of registry signals (e.g. Hierarchy::Reparent)
+        static void OnHierarchyChanged(entt::registry& registry, entt::entity entity);
+
+    private:
+        void OnTopologyChanged(entt::registry& registry, entt::entity entity);
+        void OnTransformDestroyed(entt::registry& registry, entt::entity entity);
+        void RebuildLevels(entt::registry& registry);
+
+        // Hierarchy flattened breadth first. Every entity in a level has its parent in the previous level.
+        struct DepthLevel
+        {
+            TDArray<entt::entity> Entities;
+            TDArray<uint32_t> ParentIndices; // Index into the previous level, InvalidParent for roots
+            TDArray<uint8_t> State;          // NodeState bits written by the last Update
+        };
+
+        enum NodeState : uint8_t
+        {
+            NodeState_Changed       = BIT(0), // World matrix rebuilt this update
+            NodeState_HasTransform  = BIT(1),
+            NodeState_Active        = BIT(2),
+            NodeState_ActiveChanged = BIT(3) // InactiveComponent needs adding or removing
+        };
+
+        static constexpr uint32_t InvalidParent = ~0u;
+
+        TDArray<DepthLevel> m_Levels;
+        uint32_t m_LevelCount = 0;
+        bool m_LevelsDirty    = true;
+        TDArray<entt::entity> m_ChangedEntities;
     };
 }
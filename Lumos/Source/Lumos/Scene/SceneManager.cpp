@@ -112,7 +112,10 @@ namespace Lumos
 
         String8 physicalPath;
         std::string path = "//Assets/Scenes/" + m_CurrentScene->GetSceneName() + ".lsn";
-        if(Lumos::FileSystem::Get().ResolvePhysicalPath(Application::Get().GetFrameArena(), Str8StdS(path), &physicalPath))
+
+        // The physical path is still filled in when only the mounted pack has the scene
+        const bool loose = Lumos::FileSystem::Get().ResolvePhysicalPath(Application::Get().GetFrameArena(), Str8StdS(path), &physicalPath);
+        if(loose || Lumos::FileSystem::Get().ExistsVFS(Str8StdS(path)))
         {
             auto newPath = StringUtilities::RemoveName(ToStdString(physicalPath));
             m_CurrentScene->Deserialise(newPath, false);
@@ -86,7 +86,7 @@ namespace Lumos
 
         if(!soundFilePath.empty())
         {
-            node.SetSound(Sound::Create(soundFilePath, StringUtilities::GetFilePathExtension(soundFilePath)));
+            node.SetSound(Application::Get().GetAssetManager()->LoadSoundAsset(Str8StdS(soundFilePath), true));
         }
     }
 
@@ -171,8 +171,15 @@ namespace Lumos
 
         const int Version = 3;
 
+        const Vec3 position        = rigidBody.GetPosition();
+        const Quat orientation     = rigidBody.GetOrientation();
+        const Vec3 linearVelocity  = rigidBody.GetLinearVelocity();
+        const Vec3 angularVelocity = rigidBody.GetAngularVelocity();
+        const bool isStatic        = rigidBody.GetIsStatic();
+        const float angularFactor  = rigidBody.GetAngularFactor();
+
         archive(cereal::make_nvp("Version", Version));
-        archive(cereal::make_nvp("Position", rigidBody.m_Position), cereal::make_nvp("Orientation", rigidBody.m_Orientation), cereal::make_nvp("LinearVelocity", rigidBody.m_LinearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", rigidBody.m_AngularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", rigidBody.m_Static), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", rigidBody.m_AngularFactor));
+        archive(cereal::make_nvp("Position", position), cereal::make_nvp("Orientation", orientation), cereal::make_nvp("LinearVelocity", linearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", angularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", isStatic), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", angularFactor));
         archive(cereal::make_nvp("UUID", (uint64_t)rigidBody.m_UUID));
         archive(cereal::make_nvp("CollisionLayer", rigidBody.m_CollisionLayer), cereal::make_nvp("CollisionMask", rigidBody.m_CollisionMask));
         shape.release();
@@ -184,8 +191,24 @@ namespace Lumos
         auto shape = std::unique_ptr<CollisionShape>(rigidBody.m_CollisionShape.get());
 
         int Version;
+        Vec3 position, linearVelocity, angularVelocity;
+        Quat orientation;
+        bool isStatic;
+        float angularFactor;
+
         archive(cereal::make_nvp("Version", Version));
-        archive(cereal::make_nvp("Position", rigidBody.m_Position), cereal::make_nvp("Orientation", rigidBody.m_Orientation), cereal::make_nvp("LinearVelocity", rigidBody.m_LinearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", rigidBody.m_AngularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", rigidBody.m_Static), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", rigidBody.m_AngularFactor));
+        archive(cereal::make_nvp("Position", position), cereal::make_nvp("Orientation", orientation), cereal::make_nvp("LinearVelocity", linearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", angularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", isStatic), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", angularFactor));
+
+        // The body's pose and velocities live in the physics engine's streams, written directly so a static body keeps them
+        RigidBodyStreams& streams = *rigidBody.m_Streams;
+        const u32 index           = rigidBody.m_StreamIndex;
+        streams.SetPosition(index, position);
+        streams.SetOrientation(index, orientation);
+        streams.SetLinearVelocity(index, linearVelocity);
+        streams.SetAngularVelocity(index, angularVelocity);
+        streams.SetFlag(index, RigidBodyStreams::Static, isStatic);
+        streams.SetFlag(index, RigidBodyStreams::TransformInvalidated | RigidBodyStreams::AabbInvalidated, true);
+        streams.AngularFactor[index] = angularFactor;
 
         rigidBody.m_CollisionShape = nullptr;
         rigidBody.m_CollisionShape = SharedPtr<CollisionShape>(shape.get());
@@ -255,9 +278,9 @@ namespace Lumos
                     cereal::make_nvp("MaxWidth", textComponent.MaxWidth));
         }
 
-        if(!fontFilePath.size > 0 && FileSystem::FileExists(fontFilePath))
+        if(fontFilePath.size > 0)
         {
-            Application::Get().GetAssetManager()->AddAsset(fontFilePath, textComponent.FontHandle);
+            textComponent.FontHandle = Application::Get().GetAssetManager()->LoadFontAsset(fontFilePath, true);
         }
         else
         {
@@ -397,6 +420,9 @@ namespace Lumos
         archive(particleEmitter.m_DepthWrite);
         archive((uint8_t)particleEmitter.m_BlendType);
         archive((uint8_t)particleEmitter.m_AlignedType);
+        archive(particleEmitter.m_GPUSimulation);
+        archive(particleEmitter.m_DepthCollision);
+        archive(particleEmitter.m_Restitution);
         ScratchEnd(temp);
     }
 
@@ -445,6 +471,13 @@ namespace Lumos
             particleEmitter.m_AlignedType = (ParticleEmitter::AlignedType)value;
         }
 
+        if(Serialisation::CurrentSceneVersion > 27)
+        {
+            archive(particleEmitter.m_GPUSimulation);
+            archive(particleEmitter.m_DepthCollision);
+            archive(particleEmitter.m_Restitution);
+        }
+
         particleEmitter.Init();
     }
 
@@ -743,7 +776,12 @@ namespace Lumos
         template <typename Archive>
         void save(Archive& archive, const ModelComponent& component)
         {
-            if(!component.ModelRef || component.ModelRef->GetMeshes().Size() == 0)
+            if(!component.ModelRef)
+                return;
+
+            // File models that are still streaming have no meshes yet but still need saving
+            const auto& meshes = component.ModelRef->GetMeshes();
+            if(meshes.Empty() && component.ModelRef->GetPrimitiveType() != PrimitiveType::File)
                 return;
 
             ArenaTemp temp = ScratchBegin(nullptr, 0);
@@ -756,7 +794,7 @@ namespace Lumos
                     newPath = Str8Lit("Primitive");
 
                 // For now this saved material will be overriden by materials in the model file
-                auto material = std::unique_ptr<Material>(component.ModelRef->GetMeshes().Front()->GetMaterial().get());
+                auto material = std::unique_ptr<Material>(meshes.Empty() ? nullptr : meshes.Front()->GetMaterial().get());
                 archive(cereal::make_nvp("PrimitiveType", component.ModelRef->GetPrimitiveType()), cereal::make_nvp("FilePath", newPath), cereal::make_nvp("Material", material));
                 material.release();
             }
@@ -781,7 +819,7 @@ namespace Lumos
             }
             else
             {
-                component.LoadFromLibrary(filePath);
+                component.ModelRef = Application::Get().GetAssetManager()->LoadModelAsset(Str8StdS(filePath), true);
             }
         }
     }
@@ -798,6 +836,7 @@ namespace Lumos
         void load(Archive& archive, Maths::Transform& transform)
         {
             archive(cereal::make_nvp("Position", transform.m_LocalPosition), cereal::make_nvp("Rotation", transform.m_LocalOrientation), cereal::make_nvp("Scale", transform.m_LocalScale));
+            transform.m_Dirty = true;
         }
 
     }
@@ -34,6 +34,7 @@
 #include "Scene/Component/RigidBody2DComponent.h"
 #include "Scene/Component/RigidBody3DComponent.h"
 #include "Scene/Component/AIComponent.h"
+#include "Scene/Component/ModelComponent.h"
 #include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
 #include "Physics/LumosPhysicsEngine/RigidBody3D.h"
 
@@ -688,6 +689,9 @@ namespace Lumos
             particleEmitter_type.set_function("GetLifeSpread", &ParticleEmitter::GetLifeSpread);
             particleEmitter_type.set_function("GetAlignedType", &ParticleEmitter::GetAlignedType);
             particleEmitter_type.set_function("GetDepthWrite", &ParticleEmitter::GetDepthWrite);
+            particleEmitter_type.set_function("GetGPUSimulation", &ParticleEmitter::GetGPUSimulation);
+            particleEmitter_type.set_function("GetDepthCollision", &ParticleEmitter::GetDepthCollision);
+            particleEmitter_type.set_function("GetRestitution", &ParticleEmitter::GetRestitution);
 
             particleEmitter_type.set_function("SetParticleCount", &ParticleEmitter::SetParticleCount);
             particleEmitter_type.set_function("SetParticleLife", &ParticleEmitter::SetParticleLife);
@@ -709,6 +713,9 @@ namespace Lumos
             particleEmitter_type.set_function("SetLifeSpread", &ParticleEmitter::SetLifeSpread);
             particleEmitter_type.set_function("SetAlignedType", &ParticleEmitter::SetAlignedType);
             particleEmitter_type.set_function("SetDepthWrite", &ParticleEmitter::SetDepthWrite);
+            particleEmitter_type.set_function("SetGPUSimulation", &ParticleEmitter::SetGPUSimulation);
+            particleEmitter_type.set_function("SetDepthCollision", &ParticleEmitter::SetDepthCollision);
+            particleEmitter_type.set_function("SetRestitution", &ParticleEmitter::SetRestitution);
         }
 
         REGISTER_COMPONENT_WITH_ECS(state, ParticleEmitter, static_cast<ParticleEmitter& (Entity::*)()>(&Entity::AddComponent<ParticleEmitter>));
@@ -746,6 +753,10 @@ namespace Lumos
 
         REGISTER_COMPONENT_WITH_ECS(state, Model, static_cast<Model& (Entity::*)(const std::string&)>(&Entity::AddComponent<Model, const std::string&>));
 
+        // What the scene renderer draws. Primitives and paths create their own model, passing another entity's
+        // component shares its model while the new entity still gets its own animation instance.
+        REGISTER_COMPONENT_WITH_ECS(state, ModelComponent, sol::overload(static_cast<ModelComponent& (Entity::*)(PrimitiveType&&)>(&Entity::AddComponent<ModelComponent, PrimitiveType>), static_cast<ModelComponent& (Entity::*)(const std::string&)>(&Entity::AddComponent<ModelComponent, const std::string&>), static_cast<ModelComponent& (Entity::*)(const ModelComponent&)>(&Entity::AddComponent<ModelComponent, const ModelComponent&>)));
+
         auto material_type = state.new_usertype<Material>("Material");
         // Setters
         material_type["set_albedo_texture"]    = &Material::SetAlbedoTexture;
@@ -5,6 +5,8 @@
 #include "Core/Application.h"
 #include "Physics/B2PhysicsEngine/B2PhysicsEngine.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CollisionShape.h"
+#include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
+#include "Maths/Ray.h"
 
 #include <box2d/box2d.h>
 #include <sol/sol.hpp>
@@ -50,6 +52,56 @@ namespace Lumos
         return SharedPtr<RigidBody3D>(Application::Get().GetSystem<LumosPhysicsEngine>()->CreateBody({}));
     }
 
+    static sol::object Raycast3D(const Vec3& origin, const Vec3& direction, float maxDistance, sol::this_state s)
+    {
+        RaycastHit3D hit;
+        if(Application::Get().GetSystem<LumosPhysicsEngine>()->Raycast(Maths::Ray(origin, direction), maxDistance, hit))
+            return sol::make_object(s, hit);
+        return sol::lua_nil;
+    }
+
+    static sol::object SphereCast3D(const Vec3& origin, const Vec3& direction, float radius, float maxDistance, sol::this_state s)
+    {
+        RaycastHit3D hit;
+        if(Application::Get().GetSystem<LumosPhysicsEngine>()->SphereCast(Maths::Ray(origin, direction), radius, maxDistance, hit))
+            return sol::make_object(s, hit);
+        return sol::lua_nil;
+    }
+
+    static sol::table BodiesToTable(const TDArray<RigidBody3D*>& bodies, sol::this_state s)
+    {
+        sol::state_view lua(s);
+        sol::table result = lua.create_table();
+        int i             = 1;
+        for(RigidBody3D* body : bodies)
+            result[i++] = body;
+        return result;
+    }
+
+    static sol::table OverlapSphere3D(const Vec3& centre, float radius, sol::this_state s)
+    {
+        TDArray<RigidBody3D*> bodies;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapSphere(centre, radius, bodies);
+        return BodiesToTable(bodies, s);
+    }
+
+    static sol::table OverlapAABB3D(const Vec3& min, const Vec3& max, sol::this_state s)
+    {
+        TDArray<RigidBody3D*> bodies;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapAABB(Maths::BoundingBox(min, max), bodies);
+        return BodiesToTable(bodies, s);
+    }
+
+    static void SetBroadphase3D(BroadphaseType type)
+    {
+        Application::Get().GetSystem<LumosPhysicsEngine>()->SetBroadphaseType(type);
+    }
+
+    static int GetBroadphasePairCount3D()
+    {
+        return Application::Get().GetSystem<LumosPhysicsEngine>()->GetNumberCollisionPairs();
+    }
+
     void BindPhysicsLua(sol::state& state)
     {
         sol::usertype<RigidBodyParameters> physicsObjectParameters_type = state.new_usertype<RigidBodyParameters>("RigidBodyParameters");
@@ -101,6 +153,14 @@ namespace Lumos
         };
         state.new_enum<CollisionShapeType, false>("CollisionShapeType", shapes3D);
 
+        std::initializer_list<std::pair<sol::string_view, BroadphaseType>> broadphases = {
+            { "BruteForce", BroadphaseType::BRUTE_FORCE },
+            { "SortAndSweep", BroadphaseType::SORT_AND_SWEAP },
+            { "Octree", BroadphaseType::OCTREE },
+            { "DynamicTree", BroadphaseType::DYNAMIC_TREE }
+        };
+        state.new_enum<BroadphaseType, false>("BroadphaseType", broadphases);
+
         sol::usertype<RigidBody2D> physics2D_type = state.new_usertype<RigidBody2D>("RigidBody2D", sol::constructors<RigidBody2D(const RigidBodyParameters&)>());
         physics2D_type.set_function("SetForce", &RigidBody2D::SetForce);
         physics2D_type.set_function("SetPosition", &RigidBody2D::SetPosition);
@@ -119,6 +179,19 @@ namespace Lumos
         physics2D_type.set_function("SetIsStatic", &RigidBody2D::SetIsStatic);
         physics2D_type.set_function("GetB2Body", &RigidBody2D::GetB2Body);
 
+        sol::usertype<RaycastHit3D> raycastHit3D_type = state.new_usertype<RaycastHit3D>("RaycastHit3D");
+        raycastHit3D_type["body"]                     = &RaycastHit3D::Body;
+        raycastHit3D_type["point"]                    = &RaycastHit3D::Point;
+        raycastHit3D_type["normal"]                   = &RaycastHit3D::Normal;
+        raycastHit3D_type["distance"]                 = &RaycastHit3D::Distance;
+
+        state.set_function("Raycast3D", &Raycast3D);
+        state.set_function("SphereCast3D", &SphereCast3D);
+        state.set_function("OverlapSphere3D", &OverlapSphere3D);
+        state.set_function("OverlapAABB3D", &OverlapAABB3D);
+        state.set_function("SetBroadphase3D", &SetBroadphase3D);
+        state.set_function("GetBroadphasePairCount3D", &GetBroadphasePairCount3D);
+
         state.set_function("SetCallback", &SetCallback);
         state.set_function("SetB2DGravity", &SetB2DGravity);
     }
@@ -2,6 +2,7 @@
 #include "LoadImage.h"
 
 #include "Core/OS/FileSystem.h"
+#include "Core/Asset/AssetPack.h"
 
 #ifdef FREEIMAGE
 #include <FreeImage.h>
@@ -22,6 +23,85 @@ namespace Lumos
     static uint32_t s_MaxWidth  = 0;
     static uint32_t s_MaxHeight = 0;
 
+    // Textures cooked into the mounted pack are already decoded, they are only scaled when a smaller size is asked for
+    static bool LoadPackedImage(ImageLoadDesc& desc)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        AssetPack* pack             = FileSystem::Get().GetPack();
+        const AssetPackEntry* entry = pack ? pack->Find(Str8C((char*)desc.filePath)) : nullptr;
+        if(!entry || entry->Kind != AssetPackEntryKind::Texture)
+            return false;
+
+        // Uncompressed pixels are read in place, compressed ones are inflated into what becomes the result
+        String8 data;
+        uint8_t* inflated = nullptr;
+        if(entry->Compression == AssetPackCompression::None)
+            pack->Read(nullptr, *entry, &data);
+        else
+        {
+            inflated = new uint8_t[entry->UncompressedSize];
+            data     = pack->ReadInto(*entry, inflated) ? Str8(inflated, entry->UncompressedSize) : String8();
+        }
+
+        if(data.size < sizeof(AssetPackTexture))
+        {
+            delete[] inflated;
+            return false;
+        }
+
+        AssetPackTexture texture = *(const AssetPackTexture*)data.str;
+        const uint8_t* pixels    = data.str + sizeof(AssetPackTexture);
+        uint32_t width           = texture.Width;
+        uint32_t height          = texture.Height;
+
+        if(data.size < sizeof(AssetPackTexture) + uint64_t(width) * height * (texture.Bits / 8))
+        {
+            delete[] inflated;
+            return false;
+        }
+
+        if(!texture.IsHDR && desc.maxWidth > 0 && desc.maxHeight > 0 && (width > desc.maxWidth || height > desc.maxHeight))
+        {
+            const float aspectRatio = float(width) / float(height);
+            if(width > desc.maxWidth)
+            {
+                width  = desc.maxWidth;
+                height = uint32_t(desc.maxWidth / aspectRatio);
+            }
+            if(height > desc.maxHeight)
+            {
+                height = desc.maxHeight;
+                width  = uint32_t(desc.maxHeight * aspectRatio);
+            }
+        }
+
+        const uint64_t size = uint64_t(width) * height * (texture.Bits / 8);
+        uint8_t* result     = nullptr;
+        if(width != texture.Width || height != texture.Height)
+        {
+            result = new uint8_t[size];
+            stbir_resize_uint8_linear(pixels, texture.Width, texture.Height, 0, result, width, height, 0, STBIR_RGBA);
+            delete[] inflated;
+        }
+        else if(inflated)
+        {
+            memmove(inflated, pixels, size);
+            result = inflated;
+        }
+        else
+        {
+            result = new uint8_t[size];
+            memcpy(result, pixels, size);
+        }
+
+        desc.outWidth  = width;
+        desc.outHeight = height;
+        desc.outBits   = texture.Bits;
+        desc.isHDR     = texture.IsHDR != 0;
+        desc.outPixels = result;
+        return true;
+    }
+
     uint8_t* LoadImageFromFile(const char* filename, uint32_t* width, uint32_t* height, uint32_t* bits, bool* isHDR, bool flipY, bool srgb)
     {
         LUMOS_PROFILE_FUNCTION();
@@ -29,6 +109,23 @@ namespace Lumos
         stbi_uc* pixels   = nullptr;
         int sizeOfChannel = 8;
 
+        ImageLoadDesc packed = {};
+        packed.filePath      = filename;
+        packed.maxWidth      = s_MaxWidth;
+        packed.maxHeight     = s_MaxHeight;
+        if(LoadPackedImage(packed))
+        {
+            if(width)
+                *width = packed.outWidth;
+            if(height)
+                *height = packed.outHeight;
+            if(bits)
+                *bits = packed.outBits;
+            if(isHDR)
+                *isHDR = packed.isHDR;
+            return packed.outPixels;
+        }
+
         ArenaTemp Scratch = ScratchBegin(0, 0);
 
         String8 filePath = Str8C((char*)filename);
@@ -151,6 +248,9 @@ namespace Lumos
         int texWidth = 0, texHeight = 0, texChannels = 0;
         int sizeOfChannel = 8;
 
+        if(LoadPackedImage(desc))
+            return true;
+
         ArenaTemp Scratch = ScratchBegin(0, 0);
 
         String8 filePath = Str8C((char*)desc.filePath);